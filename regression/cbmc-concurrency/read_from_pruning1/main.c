@@ -0,0 +1,27 @@
+int x;
+
+void writer()
+{
+  x=3;
+}
+
+int main()
+{
+  x=1;
+  __CPROVER_ASYNC_1: writer();
+
+  x=2;
+  // x==1 has been overwritten by this thread
+  int y=x;
+  __CPROVER_assert(y==2 || y==3, "coherence");
+
+  _Bool c;
+  if(c)
+    x=4;
+  else
+    x=5;
+
+  int z=x;
+  __CPROVER_assert(z!=1 && z!=2, "overwritten");
+  return 0;
+}
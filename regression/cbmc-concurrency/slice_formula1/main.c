@@ -0,0 +1,21 @@
+int x, y, unused;
+
+void writer()
+{
+  int t=unused*3;
+  unused=t+1;
+  y=1;
+  x=y+1;
+}
+
+int main()
+{
+  __CPROVER_ASYNC_1: writer();
+
+  int a=unused;
+  unused=a+2;
+
+  // x is written by the other thread, after this read in the equation
+  assert(x!=2);
+  return 0;
+}
@@ -0,0 +1,19 @@
+_Bool nondet_bool();
+
+int main()
+{
+  _Bool a=nondet_bool(), b=nondet_bool();
+
+  // the same AND node, built twice
+  _Bool ab=a && b;
+  _Bool ba=b && a;
+
+  // left to the AIG, as ab is not expanded by the simplifier:
+  // (a&b)&!a is false, and (a&b)&a is a&b
+  __CPROVER_assert(!(ab && !a), "contradiction");
+  __CPROVER_assert(ab==ba, "hashing");
+  __CPROVER_assert(!(!ab && a) || !b, "substitution");
+  __CPROVER_assert(!(ab && a), "idempotence");
+
+  return 0;
+}
@@ -0,0 +1,25 @@
+unsigned char nondet_uchar();
+
+int main()
+{
+  unsigned char a=nondet_uchar();
+  unsigned char b=nondet_uchar();
+
+  // both operands variable, and one constant
+  __CPROVER_assert(a*b==b*a, "commutative");
+  __CPROVER_assert(a*255==(a<<8)-a, "constant");
+
+  if(b!=0)
+    __CPROVER_assert((a/b)*b+a%b==a, "division");
+
+  __CPROVER_assert(a/8==a>>3 && a%8==(a&7), "power of two");
+
+  // 7*9
+  __CPROVER_assert(a*b!=63 || a==1 || b==1 || a==63 || b==63 ||
+                   (a==7 && b==9) || (a==9 && b==7) ||
+                   (a==3 && b==21) || (a==21 && b==3), "factors");
+
+  __CPROVER_assert(a/10!=4 || a%10!=2, "forty-two");
+
+  return 0;
+}
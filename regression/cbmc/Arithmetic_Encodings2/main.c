@@ -0,0 +1,18 @@
+unsigned char nondet_uchar();
+
+int main()
+{
+  unsigned char a=nondet_uchar();
+  unsigned x=a;
+
+  // constants, recoded into signed digits
+  __CPROVER_assert((unsigned char)(x*255)==(unsigned char)-x, "run of ones");
+  __CPROVER_assert(x*10==(x<<3)+(x<<1), "ten");
+
+  // divisors that are powers of two, turned into shifts
+  __CPROVER_assert(x/16==x>>4 && x%16==(x&15), "power of two");
+  __CPROVER_assert(x/1==x && x%1==0, "one");
+  __CPROVER_assert(x%32!=31 || x/32!=7, "maximum");
+
+  return 0;
+}
@@ -0,0 +1,42 @@
+_Bool nondet_bool();
+
+int main()
+{
+  _Bool a=nondet_bool(), b=nondet_bool(), c=nondet_bool();
+  int x=0;
+
+  // all paths reach 'out', under guards that only simplify to
+  // true when joined as BDDs
+  if(a)
+  {
+    if(b)
+    {
+      x=1;
+      goto out;
+    }
+
+    if(c)
+    {
+      x=2;
+      goto out;
+    }
+  }
+
+  if(b)
+  {
+    x=3;
+    goto out;
+  }
+
+  if(c)
+    x=4;
+  else
+    x=5;
+
+out:
+  __CPROVER_assert(x>=1 && x<=5, "range");
+  __CPROVER_assert(x!=2 || (a && !b && c), "two");
+  __CPROVER_assert(x!=5, "five");
+
+  return 0;
+}
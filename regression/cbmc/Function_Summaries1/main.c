@@ -0,0 +1,34 @@
+int nondet_int();
+
+int limit;
+
+int mix(int x)
+{
+  int r;
+
+  if(x>limit)
+    r=x*3;
+  else
+    r=x+limit;
+
+  return r;
+}
+
+int main()
+{
+  int a=nondet_int();
+  __CPROVER_assume(a>=0 && a<100);
+
+  // the second call uses the summary of the first
+  int first=mix(a);
+  int second=mix(a);
+  __CPROVER_assert(first==second, "same call");
+  __CPROVER_assert(first==a*3, "first");
+
+  // but not once a global that mix reads has changed
+  limit=5;
+  int third=mix(a);
+  __CPROVER_assert(third==first, "limit changed");
+
+  return 0;
+}
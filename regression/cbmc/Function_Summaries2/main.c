@@ -0,0 +1,34 @@
+int f()
+{
+  int r;
+  return r;
+}
+
+int g(int x)
+{
+  int r;
+
+  if(x>0)
+    r=1;
+
+  return r;
+}
+
+int h(int x)
+{
+  int r;
+  r=x*2;
+  return r;
+}
+
+int main()
+{
+  // the locals that are not assigned have a new value in each
+  // call, hence there is no summary for f and g
+  __CPROVER_assert(f()==f(), "uninitialised");
+  __CPROVER_assert(g(1)==g(1), "assigned");
+  __CPROVER_assert(g(0)==g(0), "on one branch");
+  __CPROVER_assert(h(3)==h(3), "summary");
+
+  return 0;
+}
@@ -0,0 +1,17 @@
+int nondet_int();
+
+int main()
+{
+  int n=nondet_int();
+  __CPROVER_assume(n>0 && n<1000);
+
+  int x=0;
+
+  for(int i=0; i<n; i++)
+  {
+    x+=3;
+    __CPROVER_assert(x!=30, "deep");
+  }
+
+  return 0;
+}
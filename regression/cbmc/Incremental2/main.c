@@ -0,0 +1,16 @@
+int nondet_int();
+
+int main()
+{
+  int n=nondet_int();
+  __CPROVER_assume(n>=0 && n<3);
+
+  int sum=0;
+
+  for(int i=0; i<n; i++)
+    sum+=i;
+
+  __CPROVER_assert(sum<=1, "sum");
+
+  return 0;
+}
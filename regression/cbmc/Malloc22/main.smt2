@@ -0,0 +1,353 @@
+; SMT 2
+(set-info :source "Generated by CBMC 5.6")
+(set-option :produce-models true)
+(set-logic QF_AUFBV)
+
+; find_symbols
+(declare-fun |goto_symex::&92;guard#1| () Bool)
+; convert
+(define-fun |B0| () Bool |goto_symex::&92;guard#1|)
+
+; convert
+(define-fun |B1| () Bool |goto_symex::&92;guard#1|)
+
+; convert
+(define-fun |B2| () Bool |goto_symex::&92;guard#1|)
+
+; convert
+(define-fun |B3| () Bool |goto_symex::&92;guard#1|)
+
+; convert
+(define-fun |B4| () Bool |goto_symex::&92;guard#1|)
+
+; convert
+(define-fun |B5| () Bool |goto_symex::&92;guard#1|)
+
+; find_symbols
+(declare-fun |goto_symex::&92;guard#2| () Bool)
+; convert
+(define-fun |B6| () Bool (and |goto_symex::&92;guard#1| |goto_symex::&92;guard#2|))
+
+; convert
+(define-fun |B7| () Bool (and |goto_symex::&92;guard#1| |goto_symex::&92;guard#2|))
+
+; convert
+(define-fun |B8| () Bool (and |goto_symex::&92;guard#1| |goto_symex::&92;guard#2|))
+
+; convert
+(define-fun |B9| () Bool (and |goto_symex::&92;guard#1| |goto_symex::&92;guard#2|))
+
+; convert
+(define-fun |B10| () Bool (and |goto_symex::&92;guard#1| |goto_symex::&92;guard#2|))
+
+; convert
+(define-fun |B11| () Bool (and |goto_symex::&92;guard#1| |goto_symex::&92;guard#2|))
+
+; set_to true (equal)
+(define-fun |__CPROVER_dead_object#1| () (_ BitVec 64) (_ bv0 64))
+
+; set_to true (equal)
+(define-fun |__CPROVER_deallocated#1| () (_ BitVec 64) (_ bv0 64))
+
+; set_to true (equal)
+(define-fun |__CPROVER_malloc_is_new_array#1| () Bool false)
+
+; set_to true (equal)
+(define-fun |__CPROVER_malloc_object#1| () (_ BitVec 64) (_ bv0 64))
+
+; set_to true (equal)
+(define-fun |__CPROVER_malloc_size#1| () (_ BitVec 64) (_ bv0 64))
+
+; set_to true (equal)
+(define-fun |__CPROVER_memory_leak#1| () (_ BitVec 64) (_ bv0 64))
+
+; set_to true (equal)
+(define-fun |__CPROVER_next_thread_id#1| () (_ BitVec 64) (_ bv0 64))
+
+; set_to true (equal)
+(define-fun |__CPROVER_pipe_count#1| () (_ BitVec 32) (_ bv0 32))
+
+; set_to true (equal)
+(define-fun |__CPROVER_rounding_mode!0#1| () (_ BitVec 32) (_ bv0 32))
+
+; set_to true (equal)
+(define-fun |__CPROVER_thread_id!0#1| () (_ BitVec 64) (_ bv0 64))
+
+; the following is a substitute for lambda i. x
+(declare-fun array_of.0 () (Array (_ BitVec 64) (_ BitVec 1)))
+; set_to true (equal)
+(define-fun |__CPROVER_threads_exited#1| () (Array (_ BitVec 64) (_ BitVec 1)) array_of.0)
+
+; find_symbols
+(declare-fun |nondet_symex::nondet0| () (_ BitVec 32))
+; set_to true (equal)
+(define-fun |main::1::n!0@1#2| () (_ BitVec 32) |nondet_symex::nondet0|)
+
+; set_to true (equal)
+(define-fun |main::1::n$array_size0!0@1#2| () (_ BitVec 64) ((_ zero_extend 32) |main::1::n!0@1#2|))
+
+; set_to true (equal)
+(define-fun |malloc::malloc_size!0@1#2| () (_ BitVec 64) (bvmul (_ bv4 64) ((_ zero_extend 32) |main::1::n!0@1#2|)))
+
+; set_to true (equal)
+(define-fun |symex_dynamic::dynamic_object_size1#1| () (_ BitVec 64) ((_ zero_extend 32) |main::1::n!0@1#2|))
+
+; find_symbols
+(declare-fun |symex_dynamic::dynamic_object1| () (Array (_ BitVec 64) (_ BitVec 32)))
+; set_to true (equal)
+(define-fun |malloc::$tmp::malloc_value$1!0@1#2| () (_ BitVec 64) (concat (_ bv2 8) (_ bv0 56)))
+
+; set_to true (equal)
+(define-fun |malloc::1::malloc_res!0@1#2| () (_ BitVec 64) (concat (_ bv2 8) (_ bv0 56)))
+
+; set_to true (equal)
+(define-fun |__CPROVER_deallocated#2| () (_ BitVec 64) (_ bv0 64))
+
+; find_symbols
+(declare-fun |malloc::1::record_malloc!0@1#1| () Bool)
+; set_to true (equal)
+(define-fun |__CPROVER_malloc_object#2| () (_ BitVec 64) (ite |malloc::1::record_malloc!0@1#1| (concat (_ bv2 8) (_ bv0 56)) (_ bv0 64)))
+
+; set_to true (equal)
+(define-fun |__CPROVER_malloc_size#2| () (_ BitVec 64) (ite |malloc::1::record_malloc!0@1#1| (bvmul (_ bv4 64) ((_ zero_extend 32) |main::1::n!0@1#2|)) (_ bv0 64)))
+
+; set_to true (equal)
+(define-fun |__CPROVER_malloc_is_new_array#2| () Bool false)
+
+; find_symbols
+(declare-fun |malloc::1::record_may_leak!0@1#1| () Bool)
+; set_to true (equal)
+(define-fun |__CPROVER_memory_leak#2| () (_ BitVec 64) (ite |malloc::1::record_may_leak!0@1#1| (concat (_ bv2 8) (_ bv0 56)) (_ bv0 64)))
+
+; set_to true (equal)
+(define-fun |main::$tmp::return_value_malloc$1!0@1#2| () (_ BitVec 64) (concat (_ bv2 8) (_ bv0 56)))
+
+; set_to true (equal)
+(define-fun |main::1::p!0@1#2| () (_ BitVec 64) (concat (_ bv2 8) (_ bv0 56)))
+
+; set_to true (equal)
+(define-fun |main::1::1::i!0@1#2| () (_ BitVec 32) (_ bv0 32))
+
+; set_to true
+(assert (= |goto_symex::&92;guard#1| (bvuge |main::1::n!0@1#2| (_ bv1 32))))
+
+; find_symbols
+(declare-fun |symex_dynamic::dynamic_object1#0| () (Array (_ BitVec 64) (_ BitVec 32)))
+; set_to true (equal)
+(define-fun |symex_dynamic::dynamic_object1#1| () (Array (_ BitVec 64) (_ BitVec 32)) (store |symex_dynamic::dynamic_object1#0| (_ bv0 64) (_ bv0 32)))
+
+; find_symbols
+(declare-fun |main::1::pA!0@1#1| () (Array (_ BitVec 64) (_ BitVec 32)))
+; set_to true (equal)
+(define-fun |main::1::pA!0@1#2| () (Array (_ BitVec 64) (_ BitVec 32)) (store |main::1::pA!0@1#1| (_ bv0 64) (_ bv0 32)))
+
+; set_to true (equal)
+(define-fun |main::1::1::i!0@1#3| () (_ BitVec 32) (_ bv1 32))
+
+; set_to true
+(assert (= |goto_symex::&92;guard#2| (bvuge |main::1::n!0@1#2| (_ bv2 32))))
+
+; set_to true (equal)
+(define-fun |symex_dynamic::dynamic_object1#2| () (Array (_ BitVec 64) (_ BitVec 32)) (store |symex_dynamic::dynamic_object1#1| (_ bv1 64) (_ bv1 32)))
+
+; set_to true (equal)
+(define-fun |main::1::pA!0@1#3| () (Array (_ BitVec 64) (_ BitVec 32)) (store |main::1::pA!0@1#2| (_ bv1 64) (_ bv1 32)))
+
+; set_to true (equal)
+(define-fun |main::1::1::i!0@1#4| () (_ BitVec 32) (_ bv2 32))
+
+; set_to true (equal)
+(define-fun |main::1::pA!0@1#4| () (Array (_ BitVec 64) (_ BitVec 32)) (ite |goto_symex::&92;guard#2| |main::1::pA!0@1#3| |main::1::pA!0@1#2|))
+
+; set_to true (equal)
+(define-fun |main::1::1::i!0@1#5| () (_ BitVec 32) (ite |goto_symex::&92;guard#2| (_ bv2 32) (_ bv1 32)))
+
+; set_to true (equal)
+(define-fun |symex_dynamic::dynamic_object1#3| () (Array (_ BitVec 64) (_ BitVec 32)) (ite |goto_symex::&92;guard#2| |symex_dynamic::dynamic_object1#2| |symex_dynamic::dynamic_object1#1|))
+
+; set_to true (equal)
+(define-fun |main::1::pA!0@1#5| () (Array (_ BitVec 64) (_ BitVec 32)) (ite |goto_symex::&92;guard#1| |main::1::pA!0@1#4| |main::1::pA!0@1#1|))
+
+; set_to true (equal)
+(define-fun |main::1::1::i!0@1#6| () (_ BitVec 32) (ite |goto_symex::&92;guard#1| |main::1::1::i!0@1#5| (_ bv0 32)))
+
+; set_to true (equal)
+(define-fun |symex_dynamic::dynamic_object1#4| () (Array (_ BitVec 64) (_ BitVec 32)) (ite |goto_symex::&92;guard#1| |symex_dynamic::dynamic_object1#3| |symex_dynamic::dynamic_object1#0|))
+
+; set_to true (equal)
+(define-fun |goto_symex::&92;guard#3| () Bool (= (select |symex_dynamic::dynamic_object1#4| ((_ zero_extend 32) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|)))
+
+; set_to true (equal)
+(define-fun |goto_symex::&92;guard#4| () Bool (= (select |main::1::pA!0@1#5| ((_ zero_extend 32) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|)))
+
+; find_symbols
+(declare-fun |main::1::n!0@1#1| () (_ BitVec 32))
+; convert
+(define-fun |B12| () Bool (= |main::1::n!0@1#1| |main::1::n!0@1#1|))
+
+; find_symbols
+(declare-fun |main::1::n$array_size0!0@1#1| () (_ BitVec 64))
+; convert
+(define-fun |B13| () Bool (= |main::1::n$array_size0!0@1#1| |main::1::n$array_size0!0@1#1|))
+
+; convert
+(define-fun |B14| () Bool (= |main::1::pA!0@1#1| |main::1::pA!0@1#1|))
+
+; find_symbols
+(declare-fun |main::1::p!0@1#1| () (_ BitVec 64))
+; convert
+(define-fun |B15| () Bool (= |main::1::p!0@1#1| |main::1::p!0@1#1|))
+
+; find_symbols
+(declare-fun |main::$tmp::return_value_malloc$1!0@1#1| () (_ BitVec 64))
+; convert
+(define-fun |B16| () Bool (= |main::$tmp::return_value_malloc$1!0@1#1| |main::$tmp::return_value_malloc$1!0@1#1|))
+
+; find_symbols
+(declare-fun |malloc::malloc_size!0@1#1| () (_ BitVec 64))
+; convert
+(define-fun |B17| () Bool (= |malloc::malloc_size!0@1#1| |malloc::malloc_size!0@1#1|))
+
+; find_symbols
+(declare-fun |malloc::1::malloc_res!0@1#1| () (_ BitVec 64))
+; convert
+(define-fun |B18| () Bool (= |malloc::1::malloc_res!0@1#1| |malloc::1::malloc_res!0@1#1|))
+
+; find_symbols
+(declare-fun |malloc::$tmp::malloc_value$1!0@1#1| () (_ BitVec 64))
+; convert
+(define-fun |B19| () Bool (= |malloc::$tmp::malloc_value$1!0@1#1| |malloc::$tmp::malloc_value$1!0@1#1|))
+
+; convert
+(define-fun |B20| () Bool (= |malloc::1::record_malloc!0@1#1| |malloc::1::record_malloc!0@1#1|))
+
+; convert
+(define-fun |B21| () Bool (= |malloc::1::record_may_leak!0@1#1| |malloc::1::record_may_leak!0@1#1|))
+
+; find_symbols
+(declare-fun |main::1::1::i!0@1#1| () (_ BitVec 32))
+; convert
+(define-fun |B22| () Bool (= |main::1::1::i!0@1#1| |main::1::1::i!0@1#1|))
+
+; convert
+(define-fun |B23| () Bool (bvuge |main::1::n!0@1#2| (_ bv1 32)))
+
+; convert
+(define-fun |B24| () Bool (not (and |goto_symex::&92;guard#1| |goto_symex::&92;guard#2|)))
+
+; convert
+(define-fun |B25| () Bool (=> (and true |B23| |B24|) (= (select |symex_dynamic::dynamic_object1#4| ((_ zero_extend 32) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))))
+
+; convert
+(define-fun |B26| () Bool (=> (and true |B23| |B24|) (= (select |main::1::pA!0@1#5| ((_ zero_extend 32) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))))
+
+; convert
+(define-fun |B27| () Bool (=> (and true |B23| |B24|) false))
+
+; set_to true
+(assert (or (not |B25|) (not |B26|) (not |B27|)))
+
+; convert
+(define-fun |B28| () Bool (not (bvuge |main::1::n!0@1#2| (_ bv1 32))))
+
+; convert
+(define-fun |B29| () Bool (not (bvuge |main::1::n!0@1#2| (_ bv2 32))))
+
+; convert
+(define-fun |B30| () Bool (not (= (select |symex_dynamic::dynamic_object1#4| ((_ zero_extend 32) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))))
+
+; convert
+(define-fun |B31| () Bool (not (= (select |main::1::pA!0@1#5| ((_ zero_extend 32) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))) (bvadd (_ bv4294967295 32) |main::1::n!0@1#2|))))
+
+(check-sat)
+
+(get-value (|B0|))
+(get-value (|B1|))
+(get-value (|B10|))
+(get-value (|B11|))
+(get-value (|B12|))
+(get-value (|B13|))
+(get-value (|B14|))
+(get-value (|B15|))
+(get-value (|B16|))
+(get-value (|B17|))
+(get-value (|B18|))
+(get-value (|B19|))
+(get-value (|B2|))
+(get-value (|B20|))
+(get-value (|B21|))
+(get-value (|B22|))
+(get-value (|B23|))
+(get-value (|B24|))
+(get-value (|B25|))
+(get-value (|B26|))
+(get-value (|B27|))
+(get-value (|B28|))
+(get-value (|B29|))
+(get-value (|B3|))
+(get-value (|B30|))
+(get-value (|B31|))
+(get-value (|B4|))
+(get-value (|B5|))
+(get-value (|B6|))
+(get-value (|B7|))
+(get-value (|B8|))
+(get-value (|B9|))
+(get-value (|__CPROVER_dead_object#1|))
+(get-value (|__CPROVER_deallocated#1|))
+(get-value (|__CPROVER_deallocated#2|))
+(get-value (|__CPROVER_malloc_is_new_array#1|))
+(get-value (|__CPROVER_malloc_is_new_array#2|))
+(get-value (|__CPROVER_malloc_object#1|))
+(get-value (|__CPROVER_malloc_object#2|))
+(get-value (|__CPROVER_malloc_size#1|))
+(get-value (|__CPROVER_malloc_size#2|))
+(get-value (|__CPROVER_memory_leak#1|))
+(get-value (|__CPROVER_memory_leak#2|))
+(get-value (|__CPROVER_next_thread_id#1|))
+(get-value (|__CPROVER_pipe_count#1|))
+(get-value (|__CPROVER_rounding_mode!0#1|))
+(get-value (|__CPROVER_thread_id!0#1|))
+(get-value (|__CPROVER_threads_exited#1|))
+(get-value (|goto_symex::&92;guard#1|))
+(get-value (|goto_symex::&92;guard#2|))
+(get-value (|goto_symex::&92;guard#3|))
+(get-value (|goto_symex::&92;guard#4|))
+(get-value (|main::$tmp::return_value_malloc$1!0@1#1|))
+(get-value (|main::$tmp::return_value_malloc$1!0@1#2|))
+(get-value (|main::1::1::i!0@1#1|))
+(get-value (|main::1::1::i!0@1#2|))
+(get-value (|main::1::1::i!0@1#3|))
+(get-value (|main::1::1::i!0@1#4|))
+(get-value (|main::1::1::i!0@1#5|))
+(get-value (|main::1::1::i!0@1#6|))
+(get-value (|main::1::n!0@1#1|))
+(get-value (|main::1::n!0@1#2|))
+(get-value (|main::1::n$array_size0!0@1#1|))
+(get-value (|main::1::n$array_size0!0@1#2|))
+(get-value (|main::1::p!0@1#1|))
+(get-value (|main::1::p!0@1#2|))
+(get-value (|main::1::pA!0@1#1|))
+(get-value (|main::1::pA!0@1#2|))
+(get-value (|main::1::pA!0@1#3|))
+(get-value (|main::1::pA!0@1#4|))
+(get-value (|main::1::pA!0@1#5|))
+(get-value (|malloc::$tmp::malloc_value$1!0@1#1|))
+(get-value (|malloc::$tmp::malloc_value$1!0@1#2|))
+(get-value (|malloc::1::malloc_res!0@1#1|))
+(get-value (|malloc::1::malloc_res!0@1#2|))
+(get-value (|malloc::1::record_malloc!0@1#1|))
+(get-value (|malloc::1::record_may_leak!0@1#1|))
+(get-value (|malloc::malloc_size!0@1#1|))
+(get-value (|malloc::malloc_size!0@1#2|))
+(get-value (|nondet_symex::nondet0|))
+(get-value (|symex_dynamic::dynamic_object1|))
+(get-value (|symex_dynamic::dynamic_object1#0|))
+(get-value (|symex_dynamic::dynamic_object1#1|))
+(get-value (|symex_dynamic::dynamic_object1#2|))
+(get-value (|symex_dynamic::dynamic_object1#3|))
+(get-value (|symex_dynamic::dynamic_object1#4|))
+(get-value (|symex_dynamic::dynamic_object_size1#1|))
+
+(exit)
+; end of SMT2 file
@@ -0,0 +1,17 @@
+unsigned nondet_unsigned();
+
+int main()
+{
+  unsigned x=nondet_unsigned();
+  unsigned y=nondet_unsigned();
+
+  __CPROVER_assume(x>1 && x<1000 && y>1 && y<1000);
+
+  // 899=29*31 has a factorisation
+  __CPROVER_assert(x*y!=899, "composite");
+
+  // 997 is prime
+  __CPROVER_assert(x*y!=997, "prime");
+
+  return 0;
+}
@@ -0,0 +1,27 @@
+unsigned char nondet_uchar();
+
+int id(int v)
+{
+  return v;
+}
+
+int main()
+{
+  unsigned char a=nondet_uchar();
+  unsigned char b=nondet_uchar();
+
+  // a chain of copies, two of them through hidden assignments
+  int x=a;
+  int y=x;
+  int z=id(id(y));
+  __CPROVER_assert(z==a, "copies");
+
+  // zero-extended narrow values added at full width, twice
+  int s=a+b;
+  int s2=a+b;
+  __CPROVER_assert(s2==s, "same sum");
+  __CPROVER_assert(s<=510, "narrow sum");
+  __CPROVER_assert(s!=510, "maximum");
+
+  return 0;
+}
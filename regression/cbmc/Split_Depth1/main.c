@@ -0,0 +1,28 @@
+int nondet_int();
+void g(int x);
+
+int main()
+{
+  int x=nondet_int(), y;
+
+  // the other sides of both branches are split off, and assign
+  // y on paths of their own, which must not share SSA names
+  if(x>0)
+    y=1;
+  else
+  {
+    y=2;
+    g(x);
+  }
+
+  if(x>10)
+    y+=10;
+  else
+    y+=20;
+
+  __CPROVER_assert(y==11 || y==21 || y==22, "values");
+  __CPROVER_assert(y!=21 || (x>0 && x<=10), "middle");
+  __CPROVER_assert(y!=22, "both split off");
+
+  return 0;
+}
@@ -0,0 +1,28 @@
+_Bool nondet_bool();
+int nondet_int();
+
+int main()
+{
+  int x=nondet_int();
+
+  // not restricted by the assumption that follows
+  __CPROVER_assert(x!=20, "before");
+
+  __CPROVER_assume(x>=0 && x<10);
+  __CPROVER_assert(x<10, "after");
+
+  int y=x;
+
+  // an assumption that holds on this branch only
+  if(nondet_bool())
+  {
+    __CPROVER_assume(x==3);
+    y=x+10;
+  }
+
+  __CPROVER_assert(y!=13 || x==3, "guarded");
+  __CPROVER_assert(y!=5, "other branch");
+  __CPROVER_assert(y<=13, "bounded");
+
+  return 0;
+}
@@ -0,0 +1,21 @@
+int nondet_int();
+
+int main()
+{
+  int x=nondet_int();
+  int sum=0;
+
+  for(int i=0; i<10; i++)
+  {
+    // the same guards and index expressions in every iteration
+    if(x>0 && x<100)
+      sum+=x+1-1;
+    else
+      sum+=1;
+  }
+
+  __CPROVER_assert(sum>=10, "sum");
+  __CPROVER_assert(sum!=20, "sum!=20");
+
+  return 0;
+}
@@ -0,0 +1,22 @@
+int g(int x)
+{
+  return x+1;
+}
+
+int f(int x)
+{
+  int y=g(x);
+  __CPROVER_assert(y!=11, "f");
+  return y;
+}
+
+void h(void)
+{
+  __CPROVER_assert(0, "h");
+}
+
+int main()
+{
+  h();
+  return 0;
+}
@@ -0,0 +1,12 @@
+#!/bin/bash
+
+SRC=../../../src
+
+GC=$SRC/goto-cc/goto-cc
+CBMC=$SRC/cbmc/cbmc
+
+OPTS=$1
+NAME=${2%.c}
+
+$GC --indexed-goto-binary $NAME.c -o $NAME.gb
+$CBMC $OPTS $NAME.gb
@@ -0,0 +1,7687 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         yyansi_cparse
+#define yylex           yyansi_clex
+#define yyerror         yyansi_cerror
+#define yydebug         yyansi_cdebug
+#define yynerrs         yyansi_cnerrs
+#define yylval          yyansi_clval
+#define yychar          yyansi_cchar
+
+/* First part of user prologue.  */
+#line 1 "parser.y"
+
+
+/*
+ * This parser is based on:
+ *
+ * c5.y, a ANSI-C grammar written by James A. Roskind.
+ * "Portions Copyright (c) 1989, 1990 James A. Roskind".
+ * (http://www.idiom.com/free-compilers/,
+ * ftp://ftp.infoseek.com/ftp/pub/c++grammar/,
+ * ftp://ftp.sra.co.jp/.a/pub/cmd/c++grammar2.0.tar.gz)
+ */
+
+#ifdef ANSI_C_DEBUG
+#define YYDEBUG 1
+#endif
+#define PARSER ansi_c_parser
+
+#include "ansi_c_parser.h"
+
+int yyansi_clex();
+extern char *yyansi_ctext;
+
+#include "parser_static.inc"
+
+#include "ansi_c_y.tab.h"
+
+// statements have right recursion, deep nesting of statements thus
+// requires more stack space
+#define YYMAXDEPTH 25600
+
+/*** token declaration **************************************************/
+#line 245 "parser.y"
+
+/************************************************************************/
+/*** rules **************************************************************/
+/************************************************************************/
+
+#line 116 "ansi_c_y.tab.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "ansi_c_y.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_TOK_AUTO = 3,                   /* "auto"  */
+  YYSYMBOL_TOK_BOOL = 4,                   /* "bool"  */
+  YYSYMBOL_TOK_COMPLEX = 5,                /* "complex"  */
+  YYSYMBOL_TOK_BREAK = 6,                  /* "break"  */
+  YYSYMBOL_TOK_CASE = 7,                   /* "case"  */
+  YYSYMBOL_TOK_CHAR = 8,                   /* "char"  */
+  YYSYMBOL_TOK_CONST = 9,                  /* "const"  */
+  YYSYMBOL_TOK_CONTINUE = 10,              /* "continue"  */
+  YYSYMBOL_TOK_DEFAULT = 11,               /* "default"  */
+  YYSYMBOL_TOK_DO = 12,                    /* "do"  */
+  YYSYMBOL_TOK_DOUBLE = 13,                /* "double"  */
+  YYSYMBOL_TOK_ELSE = 14,                  /* "else"  */
+  YYSYMBOL_TOK_ENUM = 15,                  /* "enum"  */
+  YYSYMBOL_TOK_EXTERN = 16,                /* "extern"  */
+  YYSYMBOL_TOK_FLOAT = 17,                 /* "float"  */
+  YYSYMBOL_TOK_FOR = 18,                   /* "for"  */
+  YYSYMBOL_TOK_GOTO = 19,                  /* "goto"  */
+  YYSYMBOL_TOK_IF = 20,                    /* "if"  */
+  YYSYMBOL_TOK_INLINE = 21,                /* "inline"  */
+  YYSYMBOL_TOK_INT = 22,                   /* "int"  */
+  YYSYMBOL_TOK_LONG = 23,                  /* "long"  */
+  YYSYMBOL_TOK_REGISTER = 24,              /* "register"  */
+  YYSYMBOL_TOK_RESTRICT = 25,              /* "restrict"  */
+  YYSYMBOL_TOK_RETURN = 26,                /* "return"  */
+  YYSYMBOL_TOK_SHORT = 27,                 /* "short"  */
+  YYSYMBOL_TOK_SIGNED = 28,                /* "signed"  */
+  YYSYMBOL_TOK_SIZEOF = 29,                /* "sizeof"  */
+  YYSYMBOL_TOK_STATIC = 30,                /* "static"  */
+  YYSYMBOL_TOK_STRUCT = 31,                /* "struct"  */
+  YYSYMBOL_TOK_SWITCH = 32,                /* "switch"  */
+  YYSYMBOL_TOK_TYPEDEF = 33,               /* "typedef"  */
+  YYSYMBOL_TOK_UNION = 34,                 /* "union"  */
+  YYSYMBOL_TOK_UNSIGNED = 35,              /* "unsigned"  */
+  YYSYMBOL_TOK_VOID = 36,                  /* "void"  */
+  YYSYMBOL_TOK_VOLATILE = 37,              /* "volatile"  */
+  YYSYMBOL_TOK_WCHAR_T = 38,               /* "wchar_t"  */
+  YYSYMBOL_TOK_WHILE = 39,                 /* "while"  */
+  YYSYMBOL_TOK_ARROW = 40,                 /* "->"  */
+  YYSYMBOL_TOK_INCR = 41,                  /* "++"  */
+  YYSYMBOL_TOK_DECR = 42,                  /* "--"  */
+  YYSYMBOL_TOK_SHIFTLEFT = 43,             /* "<<"  */
+  YYSYMBOL_TOK_SHIFTRIGHT = 44,            /* ">>"  */
+  YYSYMBOL_TOK_LE = 45,                    /* "<="  */
+  YYSYMBOL_TOK_GE = 46,                    /* ">="  */
+  YYSYMBOL_TOK_EQ = 47,                    /* "=="  */
+  YYSYMBOL_TOK_NE = 48,                    /* "!="  */
+  YYSYMBOL_TOK_ANDAND = 49,                /* "&&"  */
+  YYSYMBOL_TOK_OROR = 50,                  /* "||"  */
+  YYSYMBOL_TOK_ELLIPSIS = 51,              /* "..."  */
+  YYSYMBOL_TOK_MULTASSIGN = 52,            /* "*="  */
+  YYSYMBOL_TOK_DIVASSIGN = 53,             /* "/="  */
+  YYSYMBOL_TOK_MODASSIGN = 54,             /* "%="  */
+  YYSYMBOL_TOK_PLUSASSIGN = 55,            /* "+="  */
+  YYSYMBOL_TOK_MINUSASSIGN = 56,           /* "-="  */
+  YYSYMBOL_TOK_SHLASSIGN = 57,             /* "<<="  */
+  YYSYMBOL_TOK_SHRASSIGN = 58,             /* ">>="  */
+  YYSYMBOL_TOK_ANDASSIGN = 59,             /* "&="  */
+  YYSYMBOL_TOK_XORASSIGN = 60,             /* "^="  */
+  YYSYMBOL_TOK_ORASSIGN = 61,              /* "|="  */
+  YYSYMBOL_TOK_IDENTIFIER = 62,            /* TOK_IDENTIFIER  */
+  YYSYMBOL_TOK_TYPEDEFNAME = 63,           /* TOK_TYPEDEFNAME  */
+  YYSYMBOL_TOK_INTEGER = 64,               /* TOK_INTEGER  */
+  YYSYMBOL_TOK_FLOATING = 65,              /* TOK_FLOATING  */
+  YYSYMBOL_TOK_CHARACTER = 66,             /* TOK_CHARACTER  */
+  YYSYMBOL_TOK_STRING = 67,                /* TOK_STRING  */
+  YYSYMBOL_TOK_ASM_STRING = 68,            /* TOK_ASM_STRING  */
+  YYSYMBOL_TOK_INT8 = 69,                  /* "__int8"  */
+  YYSYMBOL_TOK_INT16 = 70,                 /* "__int16"  */
+  YYSYMBOL_TOK_INT32 = 71,                 /* "__int32"  */
+  YYSYMBOL_TOK_INT64 = 72,                 /* "__int64"  */
+  YYSYMBOL_TOK_PTR32 = 73,                 /* "__ptr32"  */
+  YYSYMBOL_TOK_PTR64 = 74,                 /* "__ptr64"  */
+  YYSYMBOL_TOK_TYPEOF = 75,                /* "typeof"  */
+  YYSYMBOL_TOK_GCC_AUTO_TYPE = 76,         /* "__auto_type"  */
+  YYSYMBOL_TOK_GCC_FLOAT80 = 77,           /* "__float80"  */
+  YYSYMBOL_TOK_GCC_FLOAT128 = 78,          /* "__float128"  */
+  YYSYMBOL_TOK_GCC_INT128 = 79,            /* "__int128"  */
+  YYSYMBOL_TOK_GCC_DECIMAL32 = 80,         /* "_Decimal32"  */
+  YYSYMBOL_TOK_GCC_DECIMAL64 = 81,         /* "_Decimal64"  */
+  YYSYMBOL_TOK_GCC_DECIMAL128 = 82,        /* "_Decimal128"  */
+  YYSYMBOL_TOK_GCC_ASM = 83,               /* "__asm__"  */
+  YYSYMBOL_TOK_GCC_ASM_PAREN = 84,         /* "__asm__ (with parentheses)"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE = 85,         /* "__attribute__"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_ALIGNED = 86, /* "aligned"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_TRANSPARENT_UNION = 87, /* "transparent_union"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_PACKED = 88,  /* "packed"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_VECTOR_SIZE = 89, /* "vector_size"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_MODE = 90,    /* "mode"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_GNU_INLINE = 91, /* "__gnu_inline__"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_WEAK = 92,    /* "weak"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_ALIAS = 93,   /* "alias"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_SECTION = 94, /* "section"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_NORETURN = 95, /* "noreturn"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_CONSTRUCTOR = 96, /* "constructor"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_DESTRUCTOR = 97, /* "destructor"  */
+  YYSYMBOL_TOK_GCC_LABEL = 98,             /* "__label__"  */
+  YYSYMBOL_TOK_MSC_ASM = 99,               /* "__asm"  */
+  YYSYMBOL_TOK_MSC_BASED = 100,            /* "__based"  */
+  YYSYMBOL_TOK_CW_VAR_ARG_TYPEOF = 101,    /* "_var_arg_typeof"  */
+  YYSYMBOL_TOK_BUILTIN_VA_ARG = 102,       /* "__builtin_va_arg"  */
+  YYSYMBOL_TOK_GCC_BUILTIN_TYPES_COMPATIBLE_P = 103, /* "__builtin_types_compatible_p"  */
+  YYSYMBOL_TOK_OFFSETOF = 104,             /* "__offsetof"  */
+  YYSYMBOL_TOK_ALIGNOF = 105,              /* "__alignof__"  */
+  YYSYMBOL_TOK_MSC_TRY = 106,              /* "__try"  */
+  YYSYMBOL_TOK_MSC_FINALLY = 107,          /* "__finally"  */
+  YYSYMBOL_TOK_MSC_EXCEPT = 108,           /* "__except"  */
+  YYSYMBOL_TOK_MSC_LEAVE = 109,            /* "__leave"  */
+  YYSYMBOL_TOK_MSC_DECLSPEC = 110,         /* "__declspec"  */
+  YYSYMBOL_TOK_INTERFACE = 111,            /* "__interface"  */
+  YYSYMBOL_TOK_CDECL = 112,                /* "__cdecl"  */
+  YYSYMBOL_TOK_STDCALL = 113,              /* "__stdcall"  */
+  YYSYMBOL_TOK_FASTCALL = 114,             /* "__fastcall"  */
+  YYSYMBOL_TOK_CLRCALL = 115,              /* "__clrcall"  */
+  YYSYMBOL_TOK_FORALL = 116,               /* "forall"  */
+  YYSYMBOL_TOK_EXISTS = 117,               /* "exists"  */
+  YYSYMBOL_TOK_ACSL_FORALL = 118,          /* "\\forall"  */
+  YYSYMBOL_TOK_ACSL_EXISTS = 119,          /* "\\exists"  */
+  YYSYMBOL_TOK_ARRAY_OF = 120,             /* "array_of"  */
+  YYSYMBOL_TOK_CPROVER_BITVECTOR = 121,    /* "__CPROVER_bitvector"  */
+  YYSYMBOL_TOK_CPROVER_FLOATBV = 122,      /* "__CPROVER_floatbv"  */
+  YYSYMBOL_TOK_CPROVER_FIXEDBV = 123,      /* "__CPROVER_fixedbv"  */
+  YYSYMBOL_TOK_CPROVER_ATOMIC = 124,       /* "__CPROVER_atomic"  */
+  YYSYMBOL_TOK_CPROVER_BOOL = 125,         /* "__CPROVER_bool"  */
+  YYSYMBOL_TOK_CPROVER_THROW = 126,        /* "__CPROVER_throw"  */
+  YYSYMBOL_TOK_CPROVER_CATCH = 127,        /* "__CPROVER_catch"  */
+  YYSYMBOL_TOK_CPROVER_TRY = 128,          /* "__CPROVER_try"  */
+  YYSYMBOL_TOK_CPROVER_FINALLY = 129,      /* "__CPROVER_finally"  */
+  YYSYMBOL_TOK_CPROVER_ID = 130,           /* "__CPROVER_ID"  */
+  YYSYMBOL_TOK_CPROVER_LOOP_INVARIANT = 131, /* "__CPROVER_loop_invariant"  */
+  YYSYMBOL_TOK_CPROVER_REQUIRES = 132,     /* "__CPROVER_requires"  */
+  YYSYMBOL_TOK_CPROVER_ENSURES = 133,      /* "__CPROVER_ensures"  */
+  YYSYMBOL_TOK_IMPLIES = 134,              /* "==>"  */
+  YYSYMBOL_TOK_EQUIVALENT = 135,           /* "<==>"  */
+  YYSYMBOL_TOK_TRUE = 136,                 /* "TRUE"  */
+  YYSYMBOL_TOK_FALSE = 137,                /* "FALSE"  */
+  YYSYMBOL_TOK_REAL = 138,                 /* "__real__"  */
+  YYSYMBOL_TOK_IMAG = 139,                 /* "__imag__"  */
+  YYSYMBOL_TOK_ALIGNAS = 140,              /* "_Alignas"  */
+  YYSYMBOL_TOK_ATOMIC_TYPE_QUALIFIER = 141, /* "_Atomic"  */
+  YYSYMBOL_TOK_ATOMIC_TYPE_SPECIFIER = 142, /* "_Atomic()"  */
+  YYSYMBOL_TOK_GENERIC = 143,              /* "_Generic"  */
+  YYSYMBOL_TOK_IMAGINARY = 144,            /* "_Imaginary"  */
+  YYSYMBOL_TOK_NORETURN = 145,             /* "_Noreturn"  */
+  YYSYMBOL_TOK_STATIC_ASSERT = 146,        /* "_Static_assert"  */
+  YYSYMBOL_TOK_THREAD_LOCAL = 147,         /* "_Thread_local"  */
+  YYSYMBOL_TOK_NULLPTR = 148,              /* "nullptr"  */
+  YYSYMBOL_TOK_CONSTEXPR = 149,            /* "constexpr"  */
+  YYSYMBOL_TOK_SCANNER_ERROR = 150,        /* TOK_SCANNER_ERROR  */
+  YYSYMBOL_TOK_SCANNER_EOF = 151,          /* TOK_SCANNER_EOF  */
+  YYSYMBOL_TOK_CATCH = 152,                /* "catch"  */
+  YYSYMBOL_TOK_CHAR16_T = 153,             /* "char16_t"  */
+  YYSYMBOL_TOK_CHAR32_T = 154,             /* "char32_t"  */
+  YYSYMBOL_TOK_CLASS = 155,                /* "class"  */
+  YYSYMBOL_TOK_DELETE = 156,               /* "delete"  */
+  YYSYMBOL_TOK_DECLTYPE = 157,             /* "decltype"  */
+  YYSYMBOL_TOK_EXPLICIT = 158,             /* "explicit"  */
+  YYSYMBOL_TOK_FRIEND = 159,               /* "friend"  */
+  YYSYMBOL_TOK_MUTABLE = 160,              /* "mutable"  */
+  YYSYMBOL_TOK_NAMESPACE = 161,            /* "namespace"  */
+  YYSYMBOL_TOK_NEW = 162,                  /* "new"  */
+  YYSYMBOL_TOK_NOEXCEPT = 163,             /* "noexcept"  */
+  YYSYMBOL_TOK_OPERATOR = 164,             /* "operator"  */
+  YYSYMBOL_TOK_PRIVATE = 165,              /* "private"  */
+  YYSYMBOL_TOK_PROTECTED = 166,            /* "protected"  */
+  YYSYMBOL_TOK_PUBLIC = 167,               /* "public"  */
+  YYSYMBOL_TOK_TEMPLATE = 168,             /* "template"  */
+  YYSYMBOL_TOK_THIS = 169,                 /* "this"  */
+  YYSYMBOL_TOK_THROW = 170,                /* "throw"  */
+  YYSYMBOL_TOK_TYPEID = 171,               /* "typeid"  */
+  YYSYMBOL_TOK_TYPENAME = 172,             /* "typename"  */
+  YYSYMBOL_TOK_TRY = 173,                  /* "try"  */
+  YYSYMBOL_TOK_USING = 174,                /* "using"  */
+  YYSYMBOL_TOK_VIRTUAL = 175,              /* "virtual"  */
+  YYSYMBOL_TOK_SCOPE = 176,                /* "::"  */
+  YYSYMBOL_TOK_DOTPM = 177,                /* ".*"  */
+  YYSYMBOL_TOK_ARROWPM = 178,              /* "->*"  */
+  YYSYMBOL_TOK_UNARY_TYPE_PREDICATE = 179, /* TOK_UNARY_TYPE_PREDICATE  */
+  YYSYMBOL_TOK_BINARY_TYPE_PREDICATE = 180, /* TOK_BINARY_TYPE_PREDICATE  */
+  YYSYMBOL_TOK_MSC_UUIDOF = 181,           /* "__uuidof"  */
+  YYSYMBOL_TOK_MSC_IF_EXISTS = 182,        /* "__if_exists"  */
+  YYSYMBOL_TOK_MSC_IF_NOT_EXISTS = 183,    /* "__if_not_exists"  */
+  YYSYMBOL_TOK_UNDERLYING_TYPE = 184,      /* "__underlying_type"  */
+  YYSYMBOL_185_ = 185,                     /* '('  */
+  YYSYMBOL_186_ = 186,                     /* ')'  */
+  YYSYMBOL_187_ = 187,                     /* ','  */
+  YYSYMBOL_188_ = 188,                     /* ':'  */
+  YYSYMBOL_189_ = 189,                     /* '.'  */
+  YYSYMBOL_190_ = 190,                     /* '['  */
+  YYSYMBOL_191_ = 191,                     /* ']'  */
+  YYSYMBOL_192_ = 192,                     /* '{'  */
+  YYSYMBOL_193_ = 193,                     /* '}'  */
+  YYSYMBOL_194_ = 194,                     /* '&'  */
+  YYSYMBOL_195_ = 195,                     /* '*'  */
+  YYSYMBOL_196_ = 196,                     /* '+'  */
+  YYSYMBOL_197_ = 197,                     /* '-'  */
+  YYSYMBOL_198_ = 198,                     /* '~'  */
+  YYSYMBOL_199_ = 199,                     /* '!'  */
+  YYSYMBOL_200_ = 200,                     /* '/'  */
+  YYSYMBOL_201_ = 201,                     /* '%'  */
+  YYSYMBOL_202_ = 202,                     /* '<'  */
+  YYSYMBOL_203_ = 203,                     /* '>'  */
+  YYSYMBOL_204_ = 204,                     /* '^'  */
+  YYSYMBOL_205_ = 205,                     /* '|'  */
+  YYSYMBOL_206_ = 206,                     /* '?'  */
+  YYSYMBOL_207_ = 207,                     /* '='  */
+  YYSYMBOL_208_ = 208,                     /* ';'  */
+  YYSYMBOL_YYACCEPT = 209,                 /* $accept  */
+  YYSYMBOL_grammar = 210,                  /* grammar  */
+  YYSYMBOL_identifier = 211,               /* identifier  */
+  YYSYMBOL_typedef_name = 212,             /* typedef_name  */
+  YYSYMBOL_integer = 213,                  /* integer  */
+  YYSYMBOL_floating = 214,                 /* floating  */
+  YYSYMBOL_character = 215,                /* character  */
+  YYSYMBOL_string = 216,                   /* string  */
+  YYSYMBOL_constant = 217,                 /* constant  */
+  YYSYMBOL_primary_expression = 218,       /* primary_expression  */
+  YYSYMBOL_generic_selection = 219,        /* generic_selection  */
+  YYSYMBOL_generic_assoc_list = 220,       /* generic_assoc_list  */
+  YYSYMBOL_generic_association = 221,      /* generic_association  */
+  YYSYMBOL_gcc_builtin_expressions = 222,  /* gcc_builtin_expressions  */
+  YYSYMBOL_cw_builtin_expressions = 223,   /* cw_builtin_expressions  */
+  YYSYMBOL_offsetof = 224,                 /* offsetof  */
+  YYSYMBOL_offsetof_member_designator = 225, /* offsetof_member_designator  */
+  YYSYMBOL_quantifier_expression = 226,    /* quantifier_expression  */
+  YYSYMBOL_loop_invariant_opt = 227,       /* loop_invariant_opt  */
+  YYSYMBOL_requires_opt = 228,             /* requires_opt  */
+  YYSYMBOL_ensures_opt = 229,              /* ensures_opt  */
+  YYSYMBOL_statement_expression = 230,     /* statement_expression  */
+  YYSYMBOL_postfix_expression = 231,       /* postfix_expression  */
+  YYSYMBOL_member_name = 232,              /* member_name  */
+  YYSYMBOL_argument_expression_list = 233, /* argument_expression_list  */
+  YYSYMBOL_unary_expression = 234,         /* unary_expression  */
+  YYSYMBOL_cast_expression = 235,          /* cast_expression  */
+  YYSYMBOL_multiplicative_expression = 236, /* multiplicative_expression  */
+  YYSYMBOL_additive_expression = 237,      /* additive_expression  */
+  YYSYMBOL_shift_expression = 238,         /* shift_expression  */
+  YYSYMBOL_relational_expression = 239,    /* relational_expression  */
+  YYSYMBOL_equality_expression = 240,      /* equality_expression  */
+  YYSYMBOL_and_expression = 241,           /* and_expression  */
+  YYSYMBOL_exclusive_or_expression = 242,  /* exclusive_or_expression  */
+  YYSYMBOL_inclusive_or_expression = 243,  /* inclusive_or_expression  */
+  YYSYMBOL_logical_and_expression = 244,   /* logical_and_expression  */
+  YYSYMBOL_logical_or_expression = 245,    /* logical_or_expression  */
+  YYSYMBOL_logical_implication_expression = 246, /* logical_implication_expression  */
+  YYSYMBOL_logical_equivalence_expression = 247, /* logical_equivalence_expression  */
+  YYSYMBOL_conditional_expression = 248,   /* conditional_expression  */
+  YYSYMBOL_assignment_expression = 249,    /* assignment_expression  */
+  YYSYMBOL_comma_expression = 250,         /* comma_expression  */
+  YYSYMBOL_constant_expression = 251,      /* constant_expression  */
+  YYSYMBOL_comma_expression_opt = 252,     /* comma_expression_opt  */
+  YYSYMBOL_declaration = 253,              /* declaration  */
+  YYSYMBOL_static_assert_declaration = 254, /* static_assert_declaration  */
+  YYSYMBOL_default_declaring_list = 255,   /* default_declaring_list  */
+  YYSYMBOL_256_1 = 256,                    /* @1  */
+  YYSYMBOL_257_2 = 257,                    /* @2  */
+  YYSYMBOL_258_3 = 258,                    /* $@3  */
+  YYSYMBOL_post_declarator_attribute = 259, /* post_declarator_attribute  */
+  YYSYMBOL_post_declarator_attributes = 260, /* post_declarator_attributes  */
+  YYSYMBOL_post_declarator_attributes_opt = 261, /* post_declarator_attributes_opt  */
+  YYSYMBOL_declaring_list = 262,           /* declaring_list  */
+  YYSYMBOL_263_4 = 263,                    /* @4  */
+  YYSYMBOL_264_5 = 264,                    /* @5  */
+  YYSYMBOL_265_6 = 265,                    /* $@6  */
+  YYSYMBOL_declaration_specifier = 266,    /* declaration_specifier  */
+  YYSYMBOL_type_specifier = 267,           /* type_specifier  */
+  YYSYMBOL_declaration_qualifier_list = 268, /* declaration_qualifier_list  */
+  YYSYMBOL_type_qualifier_list = 269,      /* type_qualifier_list  */
+  YYSYMBOL_attribute_type_qualifier_list = 270, /* attribute_type_qualifier_list  */
+  YYSYMBOL_declaration_qualifier = 271,    /* declaration_qualifier  */
+  YYSYMBOL_type_qualifier = 272,           /* type_qualifier  */
+  YYSYMBOL_alignas_specifier = 273,        /* alignas_specifier  */
+  YYSYMBOL_attribute_or_type_qualifier = 274, /* attribute_or_type_qualifier  */
+  YYSYMBOL_attribute_or_type_qualifier_or_storage_class = 275, /* attribute_or_type_qualifier_or_storage_class  */
+  YYSYMBOL_attribute_type_qualifier_storage_class_list = 276, /* attribute_type_qualifier_storage_class_list  */
+  YYSYMBOL_basic_declaration_specifier = 277, /* basic_declaration_specifier  */
+  YYSYMBOL_basic_type_specifier = 278,     /* basic_type_specifier  */
+  YYSYMBOL_sue_declaration_specifier = 279, /* sue_declaration_specifier  */
+  YYSYMBOL_sue_type_specifier = 280,       /* sue_type_specifier  */
+  YYSYMBOL_typedef_declaration_specifier = 281, /* typedef_declaration_specifier  */
+  YYSYMBOL_typeof_declaration_specifier = 282, /* typeof_declaration_specifier  */
+  YYSYMBOL_atomic_declaration_specifier = 283, /* atomic_declaration_specifier  */
+  YYSYMBOL_typedef_type_specifier = 284,   /* typedef_type_specifier  */
+  YYSYMBOL_typeof_specifier = 285,         /* typeof_specifier  */
+  YYSYMBOL_typeof_type_specifier = 286,    /* typeof_type_specifier  */
+  YYSYMBOL_atomic_specifier = 287,         /* atomic_specifier  */
+  YYSYMBOL_atomic_type_specifier = 288,    /* atomic_type_specifier  */
+  YYSYMBOL_msc_decl_identifier = 289,      /* msc_decl_identifier  */
+  YYSYMBOL_msc_decl_modifier = 290,        /* msc_decl_modifier  */
+  YYSYMBOL_msc_declspec_seq = 291,         /* msc_declspec_seq  */
+  YYSYMBOL_msc_declspec = 292,             /* msc_declspec  */
+  YYSYMBOL_msc_declspec_opt = 293,         /* msc_declspec_opt  */
+  YYSYMBOL_storage_class = 294,            /* storage_class  */
+  YYSYMBOL_basic_type_name = 295,          /* basic_type_name  */
+  YYSYMBOL_elaborated_type_name = 296,     /* elaborated_type_name  */
+  YYSYMBOL_array_of_construct = 297,       /* array_of_construct  */
+  YYSYMBOL_pragma_packed = 298,            /* pragma_packed  */
+  YYSYMBOL_aggregate_name = 299,           /* aggregate_name  */
+  YYSYMBOL_300_7 = 300,                    /* $@7  */
+  YYSYMBOL_301_8 = 301,                    /* $@8  */
+  YYSYMBOL_302_9 = 302,                    /* $@9  */
+  YYSYMBOL_aggregate_key = 303,            /* aggregate_key  */
+  YYSYMBOL_gcc_type_attribute = 304,       /* gcc_type_attribute  */
+  YYSYMBOL_gcc_attribute = 305,            /* gcc_attribute  */
+  YYSYMBOL_gcc_attribute_list = 306,       /* gcc_attribute_list  */
+  YYSYMBOL_gcc_attribute_specifier = 307,  /* gcc_attribute_specifier  */
+  YYSYMBOL_gcc_type_attribute_opt = 308,   /* gcc_type_attribute_opt  */
+  YYSYMBOL_gcc_type_attribute_list = 309,  /* gcc_type_attribute_list  */
+  YYSYMBOL_member_declaration_list_opt = 310, /* member_declaration_list_opt  */
+  YYSYMBOL_member_declaration_list = 311,  /* member_declaration_list  */
+  YYSYMBOL_member_declaration = 312,       /* member_declaration  */
+  YYSYMBOL_member_default_declaring_list = 313, /* member_default_declaring_list  */
+  YYSYMBOL_member_declaring_list = 314,    /* member_declaring_list  */
+  YYSYMBOL_member_declarator = 315,        /* member_declarator  */
+  YYSYMBOL_member_identifier_declarator = 316, /* member_identifier_declarator  */
+  YYSYMBOL_bit_field_size_opt = 317,       /* bit_field_size_opt  */
+  YYSYMBOL_bit_field_size = 318,           /* bit_field_size  */
+  YYSYMBOL_enum_name = 319,                /* enum_name  */
+  YYSYMBOL_320_10 = 320,                   /* $@10  */
+  YYSYMBOL_321_11 = 321,                   /* $@11  */
+  YYSYMBOL_enum_key = 322,                 /* enum_key  */
+  YYSYMBOL_enumerator_list_opt = 323,      /* enumerator_list_opt  */
+  YYSYMBOL_enumerator_list = 324,          /* enumerator_list  */
+  YYSYMBOL_enumerator_declaration = 325,   /* enumerator_declaration  */
+  YYSYMBOL_enumerator_value_opt = 326,     /* enumerator_value_opt  */
+  YYSYMBOL_parameter_type_list = 327,      /* parameter_type_list  */
+  YYSYMBOL_KnR_parameter_list = 328,       /* KnR_parameter_list  */
+  YYSYMBOL_KnR_parameter = 329,            /* KnR_parameter  */
+  YYSYMBOL_parameter_list = 330,           /* parameter_list  */
+  YYSYMBOL_parameter_declaration = 331,    /* parameter_declaration  */
+  YYSYMBOL_identifier_or_typedef_name = 332, /* identifier_or_typedef_name  */
+  YYSYMBOL_type_name = 333,                /* type_name  */
+  YYSYMBOL_initializer_opt = 334,          /* initializer_opt  */
+  YYSYMBOL_initializer = 335,              /* initializer  */
+  YYSYMBOL_initializer_list = 336,         /* initializer_list  */
+  YYSYMBOL_initializer_list_opt = 337,     /* initializer_list_opt  */
+  YYSYMBOL_designated_initializer = 338,   /* designated_initializer  */
+  YYSYMBOL_designator = 339,               /* designator  */
+  YYSYMBOL_statement = 340,                /* statement  */
+  YYSYMBOL_declaration_statement = 341,    /* declaration_statement  */
+  YYSYMBOL_labeled_statement = 342,        /* labeled_statement  */
+  YYSYMBOL_compound_statement = 343,       /* compound_statement  */
+  YYSYMBOL_compound_scope = 344,           /* compound_scope  */
+  YYSYMBOL_statement_list = 345,           /* statement_list  */
+  YYSYMBOL_expression_statement = 346,     /* expression_statement  */
+  YYSYMBOL_selection_statement = 347,      /* selection_statement  */
+  YYSYMBOL_declaration_or_expression_statement = 348, /* declaration_or_expression_statement  */
+  YYSYMBOL_iteration_statement = 349,      /* iteration_statement  */
+  YYSYMBOL_350_12 = 350,                   /* $@12  */
+  YYSYMBOL_jump_statement = 351,           /* jump_statement  */
+  YYSYMBOL_gcc_local_label_statement = 352, /* gcc_local_label_statement  */
+  YYSYMBOL_gcc_local_label_list = 353,     /* gcc_local_label_list  */
+  YYSYMBOL_gcc_local_label = 354,          /* gcc_local_label  */
+  YYSYMBOL_gcc_asm_statement = 355,        /* gcc_asm_statement  */
+  YYSYMBOL_msc_asm_statement = 356,        /* msc_asm_statement  */
+  YYSYMBOL_msc_seh_statement = 357,        /* msc_seh_statement  */
+  YYSYMBOL_cprover_exception_statement = 358, /* cprover_exception_statement  */
+  YYSYMBOL_volatile_or_goto_opt = 359,     /* volatile_or_goto_opt  */
+  YYSYMBOL_gcc_asm_commands = 360,         /* gcc_asm_commands  */
+  YYSYMBOL_gcc_asm_assembler_template = 361, /* gcc_asm_assembler_template  */
+  YYSYMBOL_gcc_asm_outputs = 362,          /* gcc_asm_outputs  */
+  YYSYMBOL_gcc_asm_output = 363,           /* gcc_asm_output  */
+  YYSYMBOL_gcc_asm_output_list = 364,      /* gcc_asm_output_list  */
+  YYSYMBOL_gcc_asm_inputs = 365,           /* gcc_asm_inputs  */
+  YYSYMBOL_gcc_asm_input = 366,            /* gcc_asm_input  */
+  YYSYMBOL_gcc_asm_input_list = 367,       /* gcc_asm_input_list  */
+  YYSYMBOL_gcc_asm_clobbered_registers = 368, /* gcc_asm_clobbered_registers  */
+  YYSYMBOL_gcc_asm_clobbered_register = 369, /* gcc_asm_clobbered_register  */
+  YYSYMBOL_gcc_asm_clobbered_registers_list = 370, /* gcc_asm_clobbered_registers_list  */
+  YYSYMBOL_gcc_asm_labels = 371,           /* gcc_asm_labels  */
+  YYSYMBOL_gcc_asm_labels_list = 372,      /* gcc_asm_labels_list  */
+  YYSYMBOL_gcc_asm_label = 373,            /* gcc_asm_label  */
+  YYSYMBOL_translation_unit = 374,         /* translation_unit  */
+  YYSYMBOL_external_definition_list = 375, /* external_definition_list  */
+  YYSYMBOL_external_definition = 376,      /* external_definition  */
+  YYSYMBOL_asm_definition = 377,           /* asm_definition  */
+  YYSYMBOL_function_definition = 378,      /* function_definition  */
+  YYSYMBOL_function_body = 379,            /* function_body  */
+  YYSYMBOL_KnR_parameter_header_opt = 380, /* KnR_parameter_header_opt  */
+  YYSYMBOL_KnR_parameter_header = 381,     /* KnR_parameter_header  */
+  YYSYMBOL_KnR_parameter_declaration = 382, /* KnR_parameter_declaration  */
+  YYSYMBOL_KnR_declaration_qualifier_list = 383, /* KnR_declaration_qualifier_list  */
+  YYSYMBOL_KnR_basic_declaration_specifier = 384, /* KnR_basic_declaration_specifier  */
+  YYSYMBOL_KnR_typedef_declaration_specifier = 385, /* KnR_typedef_declaration_specifier  */
+  YYSYMBOL_KnR_sue_declaration_specifier = 386, /* KnR_sue_declaration_specifier  */
+  YYSYMBOL_KnR_declaration_specifier = 387, /* KnR_declaration_specifier  */
+  YYSYMBOL_KnR_parameter_declaring_list = 388, /* KnR_parameter_declaring_list  */
+  YYSYMBOL_function_head = 389,            /* function_head  */
+  YYSYMBOL_declarator = 390,               /* declarator  */
+  YYSYMBOL_paren_attribute_declarator = 391, /* paren_attribute_declarator  */
+  YYSYMBOL_typedef_declarator = 392,       /* typedef_declarator  */
+  YYSYMBOL_parameter_typedef_declarator = 393, /* parameter_typedef_declarator  */
+  YYSYMBOL_clean_typedef_declarator = 394, /* clean_typedef_declarator  */
+  YYSYMBOL_clean_postfix_typedef_declarator = 395, /* clean_postfix_typedef_declarator  */
+  YYSYMBOL_paren_typedef_declarator = 396, /* paren_typedef_declarator  */
+  YYSYMBOL_paren_postfix_typedef_declarator = 397, /* paren_postfix_typedef_declarator  */
+  YYSYMBOL_simple_paren_typedef_declarator = 398, /* simple_paren_typedef_declarator  */
+  YYSYMBOL_identifier_declarator = 399,    /* identifier_declarator  */
+  YYSYMBOL_unary_identifier_declarator = 400, /* unary_identifier_declarator  */
+  YYSYMBOL_postfix_identifier_declarator = 401, /* postfix_identifier_declarator  */
+  YYSYMBOL_paren_identifier_declarator = 402, /* paren_identifier_declarator  */
+  YYSYMBOL_abstract_declarator = 403,      /* abstract_declarator  */
+  YYSYMBOL_parameter_abstract_declarator = 404, /* parameter_abstract_declarator  */
+  YYSYMBOL_postfixing_abstract_declarator = 405, /* postfixing_abstract_declarator  */
+  YYSYMBOL_406_13 = 406,                   /* $@13  */
+  YYSYMBOL_parameter_postfixing_abstract_declarator = 407, /* parameter_postfixing_abstract_declarator  */
+  YYSYMBOL_408_14 = 408,                   /* $@14  */
+  YYSYMBOL_array_abstract_declarator = 409, /* array_abstract_declarator  */
+  YYSYMBOL_unary_abstract_declarator = 410, /* unary_abstract_declarator  */
+  YYSYMBOL_parameter_unary_abstract_declarator = 411, /* parameter_unary_abstract_declarator  */
+  YYSYMBOL_postfix_abstract_declarator = 412, /* postfix_abstract_declarator  */
+  YYSYMBOL_parameter_postfix_abstract_declarator = 413 /* parameter_postfix_abstract_declarator  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  140
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   6134
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  209
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  205
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  598
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1077
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   439
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   199,     2,     2,     2,   201,   194,     2,
+     185,   186,   195,   196,   187,   197,   189,   200,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   188,   208,
+     202,   207,   203,   206,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   190,     2,   191,   204,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   192,   205,   193,   198,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   253,   253,   259,   260,   272,   276,   280,   284,   288,
+     293,   294,   295,   296,   302,   303,   304,   306,   307,   308,
+     309,   310,   311,   315,   325,   329,   336,   343,   353,   360,
+     374,   383,   393,   401,   408,   418,   426,   436,   444,   458,
+     459,   465,   466,   472,   473,   477,   487,   488,   490,   499,
+     508,   514,   520,   526,   533,   543,   557,   558,   562,   567,
+     575,   576,   582,   588,   593,   603,   608,   613,   618,   623,
+     628,   633,   638,   644,   653,   654,   661,   666,   674,   675,
+     677,   679,   684,   685,   687,   692,   693,   695,   700,   701,
+     703,   705,   707,   712,   713,   715,   720,   721,   726,   727,
+     732,   733,   738,   739,   744,   745,   753,   754,   762,   763,
+     768,   769,   776,   786,   787,   789,   791,   793,   795,   797,
+     799,   801,   803,   805,   807,   812,   813,   818,   823,   824,
+     830,   836,   842,   843,   844,   848,   860,   859,   872,   871,
+     884,   883,   899,   906,   910,   914,   919,   922,   928,   926,
+     944,   942,   958,   976,   974,   991,   992,   993,   994,   995,
+     999,  1000,  1001,  1002,  1003,  1007,  1008,  1012,  1013,  1017,
+    1024,  1025,  1032,  1039,  1040,  1047,  1048,  1052,  1053,  1054,
+    1055,  1056,  1057,  1058,  1059,  1060,  1064,  1069,  1077,  1078,
+    1082,  1083,  1084,  1088,  1089,  1096,  1100,  1104,  1108,  1115,
+    1119,  1123,  1127,  1135,  1139,  1143,  1151,  1152,  1156,  1163,
+    1167,  1171,  1178,  1182,  1186,  1193,  1197,  1201,  1208,  1212,
+    1216,  1223,  1228,  1236,  1237,  1241,  1245,  1252,  1261,  1262,
+    1266,  1270,  1277,  1281,  1285,  1292,  1293,  1297,  1301,  1305,
+    1309,  1313,  1317,  1324,  1329,  1337,  1340,  1344,  1345,  1346,
+    1347,  1348,  1349,  1350,  1351,  1352,  1356,  1357,  1358,  1359,
+    1360,  1361,  1362,  1363,  1364,  1365,  1366,  1367,  1368,  1369,
+    1370,  1371,  1372,  1373,  1374,  1375,  1376,  1377,  1383,  1390,
+    1397,  1401,  1402,  1403,  1407,  1412,  1424,  1421,  1442,  1438,
+    1462,  1458,  1475,  1477,  1482,  1484,  1486,  1488,  1490,  1492,
+    1494,  1496,  1498,  1500,  1502,  1504,  1506,  1512,  1515,  1519,
+    1520,  1527,  1529,  1535,  1538,  1542,  1543,  1551,  1554,  1558,
+    1563,  1571,  1572,  1573,  1577,  1584,  1595,  1603,  1630,  1638,
+    1649,  1652,  1663,  1672,  1684,  1687,  1691,  1703,  1701,  1715,
+    1712,  1725,  1736,  1745,  1748,  1752,  1757,  1762,  1769,  1780,
+    1784,  1791,  1792,  1801,  1806,  1813,  1822,  1827,  1835,  1843,
+    1850,  1858,  1867,  1875,  1882,  1890,  1898,  1905,  1913,  1921,
+    1929,  1936,  1947,  1948,  1952,  1956,  1961,  1965,  1974,  1978,
+    1988,  1989,  1995,  2004,  2012,  2020,  2022,  2030,  2031,  2039,
+    2045,  2060,  2067,  2074,  2082,  2089,  2097,  2109,  2110,  2111,
+    2112,  2113,  2114,  2115,  2116,  2117,  2118,  2119,  2120,  2124,
+    2133,  2145,  2153,  2160,  2169,  2180,  2187,  2195,  2207,  2214,
+    2219,  2226,  2241,  2250,  2259,  2270,  2271,  2275,  2287,  2300,
+    2299,  2331,  2348,  2355,  2357,  2359,  2361,  2366,  2388,  2393,
+    2400,  2404,  2410,  2421,  2427,  2436,  2445,  2453,  2461,  2466,
+    2474,  2484,  2486,  2487,  2488,  2489,  2501,  2507,  2514,  2522,
+    2531,  2543,  2547,  2551,  2555,  2561,  2571,  2576,  2584,  2588,
+    2592,  2598,  2608,  2613,  2621,  2625,  2629,  2637,  2642,  2650,
+    2654,  2658,  2663,  2671,  2679,  2681,  2685,  2686,  2690,  2695,
+    2699,  2700,  2704,  2711,  2738,  2743,  2746,  2750,  2755,  2763,
+    2768,  2769,  2773,  2780,  2784,  2788,  2792,  2800,  2804,  2808,
+    2816,  2821,  2831,  2832,  2833,  2837,  2843,  2849,  2857,  2865,
+    2872,  2879,  2886,  2896,  2897,  2898,  2902,  2909,  2919,  2927,
+    2928,  2932,  2933,  2938,  2942,  2943,  2948,  2956,  2958,  2968,
+    2969,  2974,  2980,  2985,  2993,  2995,  3000,  3010,  3011,  3016,
+    3017,  3021,  3022,  3027,  3034,  3047,  3053,  3055,  3065,  3072,
+    3077,  3078,  3079,  3083,  3084,  3088,  3090,  3101,  3100,  3123,
+    3124,  3132,  3131,  3157,  3164,  3174,  3182,  3189,  3198,  3207,
+    3220,  3226,  3234,  3239,  3249,  3260,  3266,  3274,  3279,  3289,
+    3300,  3302,  3304,  3306,  3312,  3321,  3323,  3325,  3326
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"auto\"", "\"bool\"",
+  "\"complex\"", "\"break\"", "\"case\"", "\"char\"", "\"const\"",
+  "\"continue\"", "\"default\"", "\"do\"", "\"double\"", "\"else\"",
+  "\"enum\"", "\"extern\"", "\"float\"", "\"for\"", "\"goto\"", "\"if\"",
+  "\"inline\"", "\"int\"", "\"long\"", "\"register\"", "\"restrict\"",
+  "\"return\"", "\"short\"", "\"signed\"", "\"sizeof\"", "\"static\"",
+  "\"struct\"", "\"switch\"", "\"typedef\"", "\"union\"", "\"unsigned\"",
+  "\"void\"", "\"volatile\"", "\"wchar_t\"", "\"while\"", "\"->\"",
+  "\"++\"", "\"--\"", "\"<<\"", "\">>\"", "\"<=\"", "\">=\"", "\"==\"",
+  "\"!=\"", "\"&&\"", "\"||\"", "\"...\"", "\"*=\"", "\"/=\"", "\"%=\"",
+  "\"+=\"", "\"-=\"", "\"<<=\"", "\">>=\"", "\"&=\"", "\"^=\"", "\"|=\"",
+  "TOK_IDENTIFIER", "TOK_TYPEDEFNAME", "TOK_INTEGER", "TOK_FLOATING",
+  "TOK_CHARACTER", "TOK_STRING", "TOK_ASM_STRING", "\"__int8\"",
+  "\"__int16\"", "\"__int32\"", "\"__int64\"", "\"__ptr32\"",
+  "\"__ptr64\"", "\"typeof\"", "\"__auto_type\"", "\"__float80\"",
+  "\"__float128\"", "\"__int128\"", "\"_Decimal32\"", "\"_Decimal64\"",
+  "\"_Decimal128\"", "\"__asm__\"", "\"__asm__ (with parentheses)\"",
+  "\"__attribute__\"", "\"aligned\"", "\"transparent_union\"",
+  "\"packed\"", "\"vector_size\"", "\"mode\"", "\"__gnu_inline__\"",
+  "\"weak\"", "\"alias\"", "\"section\"", "\"noreturn\"",
+  "\"constructor\"", "\"destructor\"", "\"__label__\"", "\"__asm\"",
+  "\"__based\"", "\"_var_arg_typeof\"", "\"__builtin_va_arg\"",
+  "\"__builtin_types_compatible_p\"", "\"__offsetof\"", "\"__alignof__\"",
+  "\"__try\"", "\"__finally\"", "\"__except\"", "\"__leave\"",
+  "\"__declspec\"", "\"__interface\"", "\"__cdecl\"", "\"__stdcall\"",
+  "\"__fastcall\"", "\"__clrcall\"", "\"forall\"", "\"exists\"",
+  "\"\\\\forall\"", "\"\\\\exists\"", "\"array_of\"",
+  "\"__CPROVER_bitvector\"", "\"__CPROVER_floatbv\"",
+  "\"__CPROVER_fixedbv\"", "\"__CPROVER_atomic\"", "\"__CPROVER_bool\"",
+  "\"__CPROVER_throw\"", "\"__CPROVER_catch\"", "\"__CPROVER_try\"",
+  "\"__CPROVER_finally\"", "\"__CPROVER_ID\"",
+  "\"__CPROVER_loop_invariant\"", "\"__CPROVER_requires\"",
+  "\"__CPROVER_ensures\"", "\"==>\"", "\"<==>\"", "\"TRUE\"", "\"FALSE\"",
+  "\"__real__\"", "\"__imag__\"", "\"_Alignas\"", "\"_Atomic\"",
+  "\"_Atomic()\"", "\"_Generic\"", "\"_Imaginary\"", "\"_Noreturn\"",
+  "\"_Static_assert\"", "\"_Thread_local\"", "\"nullptr\"",
+  "\"constexpr\"", "TOK_SCANNER_ERROR", "TOK_SCANNER_EOF", "\"catch\"",
+  "\"char16_t\"", "\"char32_t\"", "\"class\"", "\"delete\"",
+  "\"decltype\"", "\"explicit\"", "\"friend\"", "\"mutable\"",
+  "\"namespace\"", "\"new\"", "\"noexcept\"", "\"operator\"",
+  "\"private\"", "\"protected\"", "\"public\"", "\"template\"", "\"this\"",
+  "\"throw\"", "\"typeid\"", "\"typename\"", "\"try\"", "\"using\"",
+  "\"virtual\"", "\"::\"", "\".*\"", "\"->*\"", "TOK_UNARY_TYPE_PREDICATE",
+  "TOK_BINARY_TYPE_PREDICATE", "\"__uuidof\"", "\"__if_exists\"",
+  "\"__if_not_exists\"", "\"__underlying_type\"", "'('", "')'", "','",
+  "':'", "'.'", "'['", "']'", "'{'", "'}'", "'&'", "'*'", "'+'", "'-'",
+  "'~'", "'!'", "'/'", "'%'", "'<'", "'>'", "'^'", "'|'", "'?'", "'='",
+  "';'", "$accept", "grammar", "identifier", "typedef_name", "integer",
+  "floating", "character", "string", "constant", "primary_expression",
+  "generic_selection", "generic_assoc_list", "generic_association",
+  "gcc_builtin_expressions", "cw_builtin_expressions", "offsetof",
+  "offsetof_member_designator", "quantifier_expression",
+  "loop_invariant_opt", "requires_opt", "ensures_opt",
+  "statement_expression", "postfix_expression", "member_name",
+  "argument_expression_list", "unary_expression", "cast_expression",
+  "multiplicative_expression", "additive_expression", "shift_expression",
+  "relational_expression", "equality_expression", "and_expression",
+  "exclusive_or_expression", "inclusive_or_expression",
+  "logical_and_expression", "logical_or_expression",
+  "logical_implication_expression", "logical_equivalence_expression",
+  "conditional_expression", "assignment_expression", "comma_expression",
+  "constant_expression", "comma_expression_opt", "declaration",
+  "static_assert_declaration", "default_declaring_list", "@1", "@2", "$@3",
+  "post_declarator_attribute", "post_declarator_attributes",
+  "post_declarator_attributes_opt", "declaring_list", "@4", "@5", "$@6",
+  "declaration_specifier", "type_specifier", "declaration_qualifier_list",
+  "type_qualifier_list", "attribute_type_qualifier_list",
+  "declaration_qualifier", "type_qualifier", "alignas_specifier",
+  "attribute_or_type_qualifier",
+  "attribute_or_type_qualifier_or_storage_class",
+  "attribute_type_qualifier_storage_class_list",
+  "basic_declaration_specifier", "basic_type_specifier",
+  "sue_declaration_specifier", "sue_type_specifier",
+  "typedef_declaration_specifier", "typeof_declaration_specifier",
+  "atomic_declaration_specifier", "typedef_type_specifier",
+  "typeof_specifier", "typeof_type_specifier", "atomic_specifier",
+  "atomic_type_specifier", "msc_decl_identifier", "msc_decl_modifier",
+  "msc_declspec_seq", "msc_declspec", "msc_declspec_opt", "storage_class",
+  "basic_type_name", "elaborated_type_name", "array_of_construct",
+  "pragma_packed", "aggregate_name", "$@7", "$@8", "$@9", "aggregate_key",
+  "gcc_type_attribute", "gcc_attribute", "gcc_attribute_list",
+  "gcc_attribute_specifier", "gcc_type_attribute_opt",
+  "gcc_type_attribute_list", "member_declaration_list_opt",
+  "member_declaration_list", "member_declaration",
+  "member_default_declaring_list", "member_declaring_list",
+  "member_declarator", "member_identifier_declarator",
+  "bit_field_size_opt", "bit_field_size", "enum_name", "$@10", "$@11",
+  "enum_key", "enumerator_list_opt", "enumerator_list",
+  "enumerator_declaration", "enumerator_value_opt", "parameter_type_list",
+  "KnR_parameter_list", "KnR_parameter", "parameter_list",
+  "parameter_declaration", "identifier_or_typedef_name", "type_name",
+  "initializer_opt", "initializer", "initializer_list",
+  "initializer_list_opt", "designated_initializer", "designator",
+  "statement", "declaration_statement", "labeled_statement",
+  "compound_statement", "compound_scope", "statement_list",
+  "expression_statement", "selection_statement",
+  "declaration_or_expression_statement", "iteration_statement", "$@12",
+  "jump_statement", "gcc_local_label_statement", "gcc_local_label_list",
+  "gcc_local_label", "gcc_asm_statement", "msc_asm_statement",
+  "msc_seh_statement", "cprover_exception_statement",
+  "volatile_or_goto_opt", "gcc_asm_commands", "gcc_asm_assembler_template",
+  "gcc_asm_outputs", "gcc_asm_output", "gcc_asm_output_list",
+  "gcc_asm_inputs", "gcc_asm_input", "gcc_asm_input_list",
+  "gcc_asm_clobbered_registers", "gcc_asm_clobbered_register",
+  "gcc_asm_clobbered_registers_list", "gcc_asm_labels",
+  "gcc_asm_labels_list", "gcc_asm_label", "translation_unit",
+  "external_definition_list", "external_definition", "asm_definition",
+  "function_definition", "function_body", "KnR_parameter_header_opt",
+  "KnR_parameter_header", "KnR_parameter_declaration",
+  "KnR_declaration_qualifier_list", "KnR_basic_declaration_specifier",
+  "KnR_typedef_declaration_specifier", "KnR_sue_declaration_specifier",
+  "KnR_declaration_specifier", "KnR_parameter_declaring_list",
+  "function_head", "declarator", "paren_attribute_declarator",
+  "typedef_declarator", "parameter_typedef_declarator",
+  "clean_typedef_declarator", "clean_postfix_typedef_declarator",
+  "paren_typedef_declarator", "paren_postfix_typedef_declarator",
+  "simple_paren_typedef_declarator", "identifier_declarator",
+  "unary_identifier_declarator", "postfix_identifier_declarator",
+  "paren_identifier_declarator", "abstract_declarator",
+  "parameter_abstract_declarator", "postfixing_abstract_declarator",
+  "$@13", "parameter_postfixing_abstract_declarator", "$@14",
+  "array_abstract_declarator", "unary_abstract_declarator",
+  "parameter_unary_abstract_declarator", "postfix_abstract_declarator",
+  "parameter_postfix_abstract_declarator", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-958)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-568)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    2025,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+    -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+    -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+    -958,  -958,  -163,   961,  -958,  -958,  -958,  -958,  -958,  -958,
+    -958,  -160,   -65,   -57,     9,   -49,    -5,    25,    32,  -958,
+    -958,   180,   119,  -958,   129,  -958,   138,  -958,   437,  3563,
+     437,  -958,   270,  -958,    -2,  -958,   123,   -97,   -93,   451,
+     700,  2317,  2317,  -958,  -958,  5695,  5695,  1611,  1611,  1611,
+    1611,  1611,  1611,  1200,  1024,  1200,  1024,  -958,  -958,    -2,
+    -958,  -958,  -958,    -2,  -958,  -958,    -2,  -958,  2025,  -958,
+    -958,  -958,   214,  -958,  -958,  -958,   122,  4231,   571,  1682,
+     122,   114,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+     277,   207,  4751,    62,    -2,  4751,  4751,  4751,  -958,  4231,
+      -2,  4751,   221,   212,  3563,  -958,  -958,  -958,  -958,  -958,
+    -958,  -958,  -958,    -2,  -958,   437,  -958,    -2,  -958,  -958,
+     359,  -958,   641,    -2,  -958,  -958,    -2,    -2,  -958,    -2,
+    -958,  -958,    77,    -2,  -958,  1200,  1200,  -958,    -2,  -958,
+    -958,    79,    -2,    -2,  -958,    -2,    -2,  -958,  -958,  -958,
+      -2,    -2,    -2,    -2,    -2,  1355,    -2,  1355,    -2,  -958,
+     315,    54,  -958,   216,   300,   -23,  3338,  -958,  -958,   245,
+    4856,  4862,  4862,    54,  -958,  -958,  -958,  -958,   257,   266,
+     268,   271,  4961,  -958,  -958,  -958,  -958,  4751,  4751,   278,
+    4146,  4751,  4751,  4751,  4751,  4751,  4751,  -958,  -958,  -958,
+    -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+     100,  -958,   977,   189,    99,    34,    50,   324,   251,   290,
+     261,   453,    53,  -958,   -68,  -958,  -958,   208,  5914,   303,
+     997,  1822,  -958,   990,   355,   366,   122,   571,  1869,  -958,
+    -958,  -958,  -958,   102,  -958,   114,   311,  -958,   401,  1746,
+     231,  -958,  -958,  -958,  -958,  -958,   409,  -958,    64,   411,
+     165,   171,   178,   297,   418,   426,   429,   122,  -958,  -958,
+    -958,  -958,  -958,   961,  -958,  -958,  -958,  -958,  -958,  -958,
+     428,  -958,  1355,  1355,  -958,   428,  -958,  -958,  -958,  -958,
+    -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,    54,  -958,
+    -958,   455,   -61,  4751,   433,  -958,  5533,     2,  5388,  -958,
+    4261,  -958,   467,  -958,  -958,  3477,  -958,  -958,  4757,  4146,
+    -958,  4146,  -958,  -958,  -958,  -958,    -2,  4751,    -2,    -2,
+    4146,  -958,   468,   471,  5098,  5098,  -958,  -958,  4751,   330,
+     492,   508,   510,  -958,  -958,  -958,  -958,  -958,  -958,    54,
+    -958,  -958,  4346,    54,  4751,  4751,  4751,  4751,  4751,  4751,
+    4751,  4751,  4751,  4751,  4751,  4751,  4751,  4751,  4751,  4751,
+    4751,  4751,  4751,  4751,  4751,  4751,  4751,  4751,  4751,  4751,
+    4751,  4751,  4751,  4751,  4751,  4751,  4432,  -958,  4751,   169,
+    2461,  5993,  1200,  1200,  -958,  -958,  -958,   274,   997,   520,
+     122,   122,   534,   285,   997,  -958,  -958,   687,   709,   548,
+    -958,  4462,   541,   566,  -958,  -958,   569,   573,  -958,  -958,
+     576,   580,  -958,  -958,  -958,  -958,  -958,   338,  -958,   262,
+    -958,  -958,  -958,  -958,   594,   599,  -958,  -958,  -958,  4751,
+    -958,   428,   114,   428,   428,  4462,  -958,  -958,   601,   607,
+      54,  -958,   609,  -958,   604,  4751,  -958,  -958,   961,  5775,
+    1024,  5695,  1611,  -958,  5533,  -958,  5614,  5695,  1611,  -958,
+     961,    18,  -958,   392,  -958,   959,   959,  2172,  2172,   605,
+     615,  -958,  -958,  -958,  -958,   612,  -958,  4547,   614,   622,
+     627,   629,   632,   633,   635,   637,  5098,  5098,  1667,   451,
+     700,  2317,  2317,  1667,   639,  -958,  4646,  -958,  2606,  -958,
+    -958,  -958,  -958,   405,  -958,  -958,   187,  -958,  -958,  -958,
+    -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+    -958,   189,   189,    99,    99,    34,    34,    34,    34,    50,
+      50,   324,   251,   290,   261,   453,  -958,  -958,  4751,   423,
+    -958,   -30,  3596,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+     122,  -958,  -958,  -958,  -958,   291,  -958,  -958,   277,  4047,
+    -958,  -958,  -958,  4751,  4751,     2,   757,   761,   645,  1746,
+     646,   649,   631,  4751,  4751,   650,  -958,  -958,  -958,  -958,
+    -958,   128,   647,    -2,   651,   653,  -958,    -2,    54,  -958,
+     661,  -958,  -958,    -2,    -2,  -958,    -2,  -958,    -2,    54,
+      54,    -2,    -2,    -2,  -958,   961,  -958,  5533,     2,   246,
+    1357,   437,  -958,    -2,  -958,  -958,  -958,  -958,  -958,    -2,
+    -958,   744,  3561,    -2,  -958,    -2,  -958,  5533,  5243,  -958,
+    -958,  -958,   656,   656,  -958,    -2,    -2,    54,   656,  4751,
+    4751,  4751,  -958,   114,   114,  -958,  -958,  -958,     6,  4047,
+    -958,   644,  4751,   660,   665,  3000,  -958,  4652,   664,  3711,
+     669,   684,   685,   102,    54,   -40,  -958,  -958,   671,  -958,
+    -958,   696,   111,   699,   680,  -958,   701,  -958,  -958,  -958,
+    -958,  2803,  -958,  -958,  -958,  -958,  -958,  -958,  -958,  -958,
+    -958,  -958,  4751,  -958,  -958,  4751,   704,   707,   711,  3596,
+    -958,  -958,  -958,  -958,   713,   708,    54,  4751,   714,   717,
+    -958,   720,   719,  -958,  3741,   440,   444,   715,   727,   728,
+    -958,  -958,  -958,  -958,    51,   233,   336,  -958,   428,  -958,
+     725,  5914,   723,   215,  -958,    78,    85,   128,  -958,    -2,
+      54,   721,   734,  -958,  -958,  -958,  -958,  -958,    -2,    -2,
+    -958,  -958,  -958,  -958,  -958,  5533,  -958,  -958,   732,   752,
+    1357,  -958,  -958,  -958,  3561,  -958,  -958,  -958,  -958,  -958,
+     754,   755,   373,  -958,   105,   147,   758,   466,  -958,   762,
+     764,   756,  -958,    12,  -958,  3000,   916,   771,   749,    93,
+    4751,  -958,    94,  4751,  4751,  -958,  -104,    97,  -958,  -958,
+     890,   530,  -958,   203,  -958,  3000,  -958,  -958,  -958,  -958,
+    -958,   122,   122,  -958,  -958,   -36,   772,  -958,   -15,  4462,
+    3849,  -958,    54,  4751,  4462,  -958,  -958,  -958,  -958,  -958,
+    -958,   480,  -958,  -958,  -958,  -958,   352,  1455,    -2,  -958,
+     192,  -958,   352,  -958,   766,  -958,  -958,  4751,  -958,    -2,
+    -958,  -958,   130,  -958,  -958,  -958,  -958,  -958,    54,  4751,
+    -958,  -958,  4751,  -958,     6,  4751,  3948,  -958,  4751,  3000,
+    -958,   779,  3197,  -958,  -958,   486,  -958,   496,   781,   277,
+     900,    54,  -958,   776,  -958,   785,  -958,  -958,   763,  -958,
+    -958,  -958,    54,   787,  -958,   790,   -32,   786,  4751,  -958,
+    -958,  -958,  -958,  -958,    71,  -958,  -958,    51,  4751,  -958,
+      -2,   791,  -958,    -2,   791,  -958,  -958,  -958,    -2,  -958,
+    -958,   792,  -958,  -958,   374,  -958,  -958,  -958,  -958,   794,
+    -958,  4751,  -958,  -958,  4751,  3000,  3000,   849,   797,   793,
+    -958,  -958,  -958,  4751,  -958,  -958,  -958,   798,  4751,   -36,
+      54,   803,  -958,   804,   277,   805,   389,  4751,  -958,   788,
+    -958,  -958,    -2,  -958,  -958,    -2,  -958,  -958,  -958,  3000,
+     500,   784,   980,  -958,   812,  3000,   796,  -958,   506,   277,
+     511,  -958,   811,  4751,   -32,  -958,  -958,   818,    54,  -958,
+    -958,   397,    51,  -958,  -958,  -958,  -958,   849,  4751,  3000,
+    4751,  -958,  -958,  -958,   821,  -958,   277,   526,  -958,   277,
+    -958,   829,  -958,  -958,   833,   817,   834,  -958,   840,  -958,
+    4751,   856,  -958,  -958,    54,  -958,  -958,   849,  -958,   532,
+    4751,  -958,  3000,  -958,   544,  -958,  -958
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+     484,   250,   275,   276,   261,   178,   271,   342,   248,   264,
+     252,   256,   263,   251,   179,   262,   272,   249,   292,   247,
+     293,   273,   274,   180,     3,     5,   257,   258,   259,   260,
+     182,   183,     0,     0,   265,   266,   267,   268,   269,   270,
+     254,     0,     0,     0,     0,     0,     0,     0,     0,   181,
+     280,     0,     0,   177,     0,   312,     0,   253,     0,     0,
+       0,   491,     0,   558,   313,   489,     0,     0,     0,     0,
+       0,     0,     0,   170,   185,   155,   160,   156,   161,   157,
+     158,   159,   162,   223,   163,   228,   164,   255,   165,   313,
+     206,   283,   281,   313,   167,   282,   313,     2,   485,   486,
+     490,   488,    41,   518,   549,   551,   550,   313,     0,     0,
+     531,   146,   525,   524,   530,   533,   534,   529,   539,   523,
+       0,     0,     0,     0,   313,     0,     0,     0,     4,   313,
+     313,     0,     0,     0,     0,   188,   173,   189,   552,   553,
+       1,   315,   218,   314,   132,     0,   134,   313,   133,   130,
+     146,   131,   146,   313,   169,   176,   313,   313,   175,   313,
+     203,   168,   136,   313,   171,   224,   229,   166,   313,   207,
+     172,   138,   313,   313,   201,   313,   313,   205,   208,   204,
+     313,   313,   313,   313,   313,   226,   313,   231,   313,   199,
+     245,   337,   487,     0,    43,   571,     0,   555,   565,   569,
+       0,     0,     0,     0,     6,     7,     8,     9,     0,     0,
+       0,     0,     0,   418,   418,   418,   418,     0,     0,     0,
+     313,     0,     0,     0,     0,     0,     0,    14,    10,    11,
+      12,    13,    15,    46,    22,    18,    19,    20,    21,    17,
+      60,    74,    78,    82,    85,    88,    93,    96,    98,   100,
+     102,   104,   106,   108,   110,   113,   125,     0,     0,     0,
+       0,     0,   547,     0,     0,     0,     0,     0,     0,   528,
+     535,   542,   532,   451,   145,   147,     0,   143,     0,   307,
+       0,   234,   232,   233,   244,   240,   235,   241,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   556,   559,   174,
+     554,   316,   140,     0,   148,   150,   210,   213,   216,   195,
+     378,   219,   225,   230,   200,   378,   197,   198,   196,   202,
+     211,   214,   217,   220,   209,   212,   215,   246,   286,   372,
+     373,     0,   313,     0,     0,   418,   570,     0,     0,   573,
+       0,   127,     0,   190,   193,     0,   192,   191,     0,   313,
+      70,   313,    61,    62,   440,    64,   313,     0,   313,   313,
+     313,    72,     0,     0,     0,     0,    76,    77,     0,     0,
+       0,     0,     0,    63,    65,    66,    67,    68,    69,     0,
+      52,    53,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   221,     0,   374,
+     376,   160,   161,   162,   163,   164,   222,     0,     0,     0,
+     537,   544,     0,     0,     0,   536,   543,   453,   452,     0,
+     144,     0,     0,   297,   295,   294,     0,     0,   300,   301,
+       0,     0,   304,   305,   306,   308,   309,     0,   184,     0,
+     243,   242,   284,   277,     0,     0,   186,   187,   227,     0,
+     557,   378,   146,   378,   378,     0,   137,   139,     0,   290,
+     343,   341,     0,    78,     0,     0,   494,   493,     0,     0,
+     170,   160,   162,   500,   566,   497,     0,   512,   513,   514,
+       0,     0,   355,     0,   353,   358,   365,   362,   369,     0,
+     351,   356,   575,   576,   574,     0,   194,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    16,     0,    45,   128,    56,
+      57,    51,    48,     0,    58,    50,     0,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   114,    79,    80,
+      81,    83,    84,    86,    87,    91,    92,    89,    90,    94,
+      95,    97,    99,   101,   103,   105,   107,   109,     0,     0,
+     126,   571,   580,   584,   375,   562,   560,   561,   377,   548,
+     526,   538,   546,   545,   540,     0,   454,   455,     0,   386,
+     380,   152,   492,     0,     0,     0,     0,     0,     0,   307,
+       0,     0,     0,     0,     0,     0,   141,   153,   149,   151,
+     379,   313,     0,   313,     0,   344,   345,   313,   343,    42,
+       0,   516,   501,   313,   313,   498,   313,   502,   313,     0,
+       0,   313,   313,   313,   515,     0,   499,   495,     0,   571,
+     585,   589,   361,   313,   359,   597,   563,   564,   368,   313,
+     366,   571,   585,   313,   363,   313,   370,   495,     0,   577,
+     579,   578,    71,     0,    30,   313,   313,     0,    73,     0,
+       0,   418,    36,   146,   146,   136,   138,    38,   313,   386,
+      75,     0,     0,     0,     0,   128,   429,     0,     0,     0,
+       0,     0,     0,   451,     0,     0,   418,   447,     0,   418,
+     415,    14,   313,   129,     0,   409,     0,   419,   399,   397,
+     398,   128,   400,   401,   402,   403,   405,   404,   406,   407,
+     408,    49,     0,    47,   112,     0,     0,     0,     0,   581,
+     582,   527,   541,   461,     0,   456,     0,     0,    14,     0,
+     387,   385,     0,   383,     0,     0,     0,     0,     0,     0,
+     311,   310,   237,   236,     0,     0,     0,   135,   378,   323,
+       0,     0,     0,   313,   319,     0,     0,   313,   291,   313,
+     347,   349,     0,    44,   504,   507,   508,   503,   313,   313,
+     505,   506,   509,   517,   568,   496,   354,   570,     0,     0,
+     586,   587,   360,   367,   586,   364,   371,   572,   352,   357,
+       0,     0,     0,    32,     0,     0,     0,     0,    24,     0,
+     385,     0,   434,     0,   433,   128,     0,     0,     0,     0,
+       0,   435,     0,     0,   128,   417,     0,     0,   438,   444,
+       0,     0,   448,     0,   421,   128,   416,   420,    59,   111,
+     592,   590,   591,   583,   142,   463,   457,   391,     0,     0,
+       0,   381,     0,     0,     0,   389,   298,   296,   299,   302,
+     303,     0,   278,   279,   154,   324,   330,     0,   313,   320,
+       0,   322,   330,   321,     0,   338,   346,     0,   348,   313,
+     510,   511,   595,   596,   588,    28,    29,    31,     0,     0,
+      35,    37,     0,    23,   313,     0,     0,    54,     0,   128,
+     414,     0,   128,   432,   431,     0,   436,     0,     0,     0,
+       0,     0,   437,     0,   418,     0,   418,   418,   167,   411,
+     594,   593,     0,     0,   466,   462,   469,   458,     0,   392,
+     390,   382,   384,   396,     0,   388,   238,     0,     0,   327,
+     313,   334,   325,   313,   334,   285,   326,   328,   313,   350,
+     340,   571,   598,    33,     0,    27,    25,    26,    55,     0,
+     412,     0,   425,   426,   128,   128,   128,    39,     0,     0,
+     439,   443,   446,     0,   449,   450,   410,     0,     0,     0,
+       0,     0,   472,   468,   475,   459,     0,     0,   394,     0,
+     336,   331,   313,   335,   333,   313,   287,   285,    34,   128,
+       0,     0,   422,   424,     0,   128,     0,   442,     0,     0,
+       0,   467,     0,     0,     0,   476,   477,   474,   480,   460,
+     393,     0,     0,   329,   332,   289,   413,    39,   128,   128,
+       0,   427,   441,   418,     0,   464,     0,     0,   473,     0,
+     483,   479,   481,   395,     0,     0,     0,   423,     0,   445,
+       0,     0,   470,   478,     0,   239,   428,    39,    40,     0,
+       0,   482,   128,   465,     0,   430,   471
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -958,  -958,     0,    75,  -958,  -958,  -958,  -102,  -958,  -436,
+    -958,  -958,   139,  -958,  -958,  -958,  -958,  -958,  -957,  -958,
+    -958,  -958,  -958,  -277,  -958,   442,  -169,   340,   343,   332,
+     360,   654,   634,   642,   630,   643,  -958,   363,  -958,  -323,
+     966,   184,  -153,  -755,    82,  -580,  -958,  -958,  -958,  -958,
+     780,  -958,   -91,  -958,  -958,  -958,  -958,     3,   190,     7,
+     915,   -33,   127,  1208,  -958,  -119,   716,  -958,  -958,  -237,
+    -958,  -218,  -958,  -958,  -958,   -72,   -34,    21,   -21,    80,
+    -446,   770,  -958,   872,  -958,  1297,   -70,    65,  -958,    39,
+    -958,  -958,  -958,  -958,   570,  -958,   458,  -958,   598,  1030,
+     -85,   294,  -958,   295,  -958,  -958,   191,   194,   124,  -657,
+    -958,  -958,  -958,   581,   448,  -958,   299,  -958,  -958,  -958,
+     434,  -958,   417,  -161,   652,  -296,  -407,   399,   403,  -756,
+    -958,   224,   174,  -958,  -216,   710,  -958,   181,  -958,  -958,
+    -958,  -958,  -958,  -958,  -958,  -192,  -958,  -958,  -958,  -958,
+     393,   176,  -958,  -958,   109,  -958,  -958,    76,  -958,  -958,
+      52,  -958,  -958,  -958,    35,  -958,  -958,  1004,  -958,  -958,
+    -958,   443,   773,  -478,  -958,  -958,  -958,  -958,  -958,  -958,
+    -958,    60,  1006,  -958,  -100,   -79,  -958,   -43,  -958,   -81,
+      14,   -46,  -958,   108,  -412,  -461,   260,  -958,   304,  -958,
+    -958,   535,  -492,   536,  -460
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    62,   227,   110,   228,   229,   230,   231,   232,   233,
+     234,   817,   818,   235,   236,   237,   812,   238,  1015,   194,
+     335,   239,   240,   749,   543,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
+     256,   713,   600,   714,   715,    66,    67,   310,   315,   471,
+     274,   275,   304,    68,   473,   474,   768,   529,   530,   531,
+     532,   268,   154,    73,    74,   136,   344,   345,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+     286,   287,   288,    87,   328,    88,    89,    90,    91,  1006,
+      92,   478,   622,   623,    93,   455,   456,   457,   141,   258,
+     143,   772,   773,   774,   775,   776,   949,   952,  1002,   950,
+      95,   331,   482,    96,   624,   625,   626,   888,   509,   503,
+     504,   510,   511,   716,   819,   476,   750,   751,   752,   753,
+     754,   717,   718,   719,   720,   372,   721,   722,   723,   974,
+     724,   827,   725,   726,   837,  1050,   727,   728,   729,   730,
+     439,   744,   745,   856,   934,   935,   937,   992,   993,   995,
+    1026,  1027,  1029,  1051,  1052,    97,    98,    99,   100,   101,
+     487,   794,   795,   495,   496,   497,   498,   499,   500,   501,
+     102,   951,   112,   113,   114,   115,   116,   117,   118,   433,
+     119,   104,   105,   106,   584,   801,   432,   337,   198,   338,
+     199,   586,   656,   587,   657
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      63,   159,   168,    69,   371,   173,   176,    71,   588,   270,
+     484,   355,   132,   612,   103,   299,   635,   816,   278,   477,
+     276,   421,   107,   263,    42,   120,   134,   266,   839,   264,
+     332,   207,  -567,    63,   601,   207,   938,   156,   165,  -567,
+     422,   770,   354,   342,   654,   660,   664,   666,   366,   367,
+     157,   166,   373,   374,   375,   376,   377,   378,    63,    63,
+      63,   305,   132,   908,    24,   265,   271,   415,   620,    63,
+      63,    63,    63,   138,   139,    64,   281,   401,   402,   918,
+    1055,   919,    65,    42,    55,   162,   171,   281,   920,   281,
+     145,    42,   682,   111,   147,   403,   404,   687,    63,   491,
+    -567,    69,   541,   413,   942,    71,   545,  -567,    63,    63,
+    1072,   146,   103,   282,   283,   148,    24,    25,   422,   486,
+     121,   437,   997,   138,   282,   283,   282,   283,   122,   150,
+     152,  -339,    51,   371,    63,   371,   160,   169,   416,   438,
+     379,   380,   381,    55,   371,    63,   153,   163,   300,   299,
+     942,    55,   840,   124,   932,   581,   336,   798,   990,   302,
+     196,   270,   630,   336,   483,   582,   133,   479,   435,   798,
+     740,   374,   418,    64,   583,   616,   939,   618,   619,   427,
+      65,   264,   263,   262,    51,   125,   423,   414,   264,   799,
+      70,   329,   515,   770,   123,   518,    42,   770,   273,    42,
+     909,   799,   172,   329,   177,   645,   180,   181,   182,  -521,
+    -521,  -522,  -522,    42,   132,   126,   133,   265,   271,  1011,
+     953,   132,   127,   953,   265,   436,   646,   558,   559,   560,
+     483,   483,   483,   483,   483,   483,   483,   483,   483,   483,
+     483,   483,   483,   483,   483,   483,   483,   128,   284,   285,
+     460,   285,   405,   406,    24,   734,    55,   491,   418,    55,
+      63,    63,   998,    63,   492,   880,   330,    63,    63,  -521,
+     140,  -522,   882,    55,    56,   138,   422,   429,   330,   424,
+     418,   418,   300,  1056,   921,   382,   881,   281,    70,   383,
+     384,   257,   418,   883,  1003,   399,   400,  1003,   900,  -373,
+      42,   914,   916,    63,   129,   922,   280,   195,    24,   290,
+     291,   292,   196,   293,   130,   961,   483,   635,   871,   627,
+     196,  -317,    51,   131,   282,   283,   610,   853,   329,   611,
+     926,   144,   927,    64,   418,   262,   769,   502,   425,   894,
+     901,   505,   262,   894,   207,   507,   193,   865,   374,   264,
+     168,   176,   418,   595,   581,   264,   463,   424,   418,   196,
+      55,    56,   464,   472,   582,   418,   197,   690,   133,   465,
+     272,   407,   408,   583,   418,   133,    51,    58,   733,   539,
+     948,   617,   132,   539,   396,   265,   165,    59,   132,   397,
+     398,   265,   279,   197,   417,   418,    60,   195,   298,   166,
+     813,   333,   196,   330,   369,   652,   658,   297,  -318,   483,
+     491,    64,   849,    64,    24,    25,   425,   458,   418,   168,
+     418,   176,   492,   769,   872,    44,   638,   642,    63,   422,
+     491,   649,   797,   334,    63,   348,   196,   159,   168,    64,
+      64,   650,   356,   273,    42,   409,   528,   533,   419,   422,
+     651,   357,   940,   358,   540,   165,   359,   945,   540,   195,
+     589,   159,   168,   368,   196,   371,   411,   627,   166,   857,
+     195,   594,   874,   156,   165,   196,   195,   742,   788,   789,
+     329,   196,    51,   466,   418,   169,   157,   166,    63,   426,
+     841,  -519,  -519,   843,   410,   163,   743,   156,   165,    24,
+      63,   999,   412,   262,    55,    63,    63,    63,    63,   262,
+     157,   166,   838,    24,    25,   424,   535,   418,   441,   653,
+     659,   663,   665,   418,   608,   609,   488,   873,   506,    63,
+      63,    63,    63,   369,   421,   369,   133,   108,   711,   823,
+     948,   430,   133,   354,   369,   685,   686,   109,   631,   739,
+     270,  -519,   431,   422,   169,   330,    60,   470,   491,   897,
+     644,   418,   898,   899,   163,  1008,   483,    51,   546,    64,
+     264,   636,   160,   169,   425,   492,   418,   422,   647,   648,
+    1030,    51,   153,   163,   418,   943,  1054,   442,  1053,   683,
+     684,   731,   732,   305,   459,   492,   160,   169,    94,   748,
+     579,    64,    64,   132,   467,   757,   153,   163,   679,   680,
+     418,   735,   468,   712,   462,   132,   469,   800,   485,   627,
+     299,   963,    58,   637,   641,   643,   866,   418,   329,   804,
+     867,   418,    59,    24,    25,   475,   108,   924,   925,   329,
+     329,    60,   350,   352,   353,    63,   109,   480,   502,    63,
+      63,    63,   903,   904,   361,    60,    42,   137,   513,   149,
+     526,    63,    63,   527,   138,   139,   946,   947,   424,   161,
+     170,   505,   975,   418,   540,   507,   138,   539,   536,   585,
+     585,   299,   976,   418,   488,   299,  1037,   418,   424,   748,
+     591,   592,  1043,   418,   537,   711,    94,  1045,   418,   423,
+     435,    51,   538,   330,   329,   793,   590,   137,   982,   277,
+     984,   985,  1062,   418,   330,   330,    55,  1058,  1073,   418,
+     593,   711,    64,   492,   596,   273,    42,   425,   597,   980,
+    1076,   418,   137,   598,   959,   565,   566,   567,   568,   561,
+     562,   301,    64,    64,   563,   564,   539,   425,   277,   602,
+     277,   603,   540,   933,   604,   969,   260,   133,   605,   259,
+     354,   606,    24,    25,   540,   607,   261,   569,   570,   133,
+     712,   987,   828,  -520,  -520,    60,   289,   576,   577,   330,
+     329,   294,   295,   170,   613,   170,    55,   755,   756,   614,
+     629,   667,   424,   621,   347,  1000,   712,   765,   766,  -288,
+      63,   628,   668,   669,    63,   671,    24,   168,   672,   655,
+     655,   655,   655,   673,   300,   674,   424,   743,   300,   675,
+     676,   540,   677,   678,   758,   711,   688,  1059,   759,  1022,
+      51,   760,   762,  -520,   991,   763,   767,   488,   764,   777,
+     780,   736,   585,   165,   779,   711,    64,   783,   689,   830,
+     741,   425,   822,   825,   833,   330,   166,   488,   506,   137,
+     748,   301,   539,   814,   815,   369,   137,   354,   824,   834,
+      64,   483,   370,   277,    51,   425,    63,    63,   835,   842,
+      63,   829,    63,   832,  -372,   108,   418,   933,   844,   845,
+     850,   954,  1025,   851,   954,   109,   855,   852,   539,   854,
+     712,   868,   -56,   354,    60,   859,   748,   860,   151,   711,
+     170,   170,   861,   869,   870,    72,   878,  1044,   892,   826,
+     712,   329,   991,   362,   363,   364,   365,   889,   887,   661,
+     797,   858,   329,   875,   196,   540,    94,   540,   893,   662,
+     895,   896,   169,   347,  1061,   847,   902,  1025,   651,   907,
+     905,   906,   163,   655,   655,   911,   912,   913,   923,   958,
+     936,   876,    94,    94,   971,   655,   655,   977,   979,   981,
+     983,   986,   988,   540,   994,   711,   711,   989,   797,   948,
+    1014,   540,  1009,  1016,   712,   488,  1017,    64,  1023,  1019,
+     329,  1024,  1038,  1028,  1039,  1032,   330,  1040,   185,   585,
+     187,   519,  1046,   520,  1042,  1049,  1060,   330,   521,   711,
+     523,   524,   525,    72,   915,   711,  1064,   917,   170,  1065,
+    1067,    24,    25,    24,    25,  1066,  1068,     1,   329,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,   711,
+       8,  1070,   574,   966,   572,    10,  1035,   944,    13,   910,
+     712,   712,    24,   573,    17,   440,   575,    19,   461,    24,
+      25,   516,   327,   571,   329,   330,   639,   761,   879,   929,
+     277,   884,   711,   957,   956,    42,   782,   640,  1005,   886,
+     312,   313,   796,   964,   712,   809,   972,   170,   820,    51,
+     712,    51,   821,   973,   142,   978,   836,   296,  1021,  1071,
+    1048,  1063,   192,   330,   655,   161,   170,    40,   655,   494,
+     807,   930,   931,     0,   712,   269,   737,   738,     0,   189,
+      51,     0,   996,   190,    94,    94,   191,    51,     0,   161,
+     170,     0,     0,   970,    44,    55,    94,     0,     0,   330,
+       0,     0,     0,     0,   649,     0,   108,   712,     0,   196,
+       0,     0,     0,     0,   650,  1010,   109,     0,     0,     0,
+       0,     0,   341,   651,     0,    60,     0,  1018,     0,     0,
+       0,    57,  1020,   420,     0,    58,     0,   303,     0,     0,
+     137,  1031,   260,   306,   395,    59,   307,   308,     0,   309,
+       0,     0,   261,   311,    60,     0,   962,     0,   314,  1012,
+    1013,    60,   316,   317,     0,   318,   319,  1047,     0,     5,
+     320,   321,   322,   323,   324,     0,   325,     0,   326,     0,
+       0,     0,     0,     0,     0,    14,     0,     0,     0,     0,
+       0,     0,     0,  1036,     0,     0,     0,    23,     0,  1041,
+       0,     0,     0,     0,  1069,     0,     0,     0,   137,     0,
+       0,   489,     0,   508,  1074,     0,     0,     0,     0,     0,
+     137,     0,     0,  1057,     0,     0,    94,   135,     0,     0,
+       0,     0,     0,    30,    31,     0,     0,     0,     0,   155,
+     164,   277,   277,   155,   174,   155,   178,   155,   155,   155,
+     183,     0,     0,    94,     0,     0,  1075,     0,     0,     0,
+      43,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   341,     0,     0,   341,     0,     0,   135,     0,    94,
+       0,     0,     0,   522,    49,     0,     0,   810,   811,     0,
+       0,     0,     0,     0,   534,     0,     0,   137,     0,     0,
+      52,    53,   135,     0,     0,     0,     0,     0,   544,     0,
+       0,   547,   548,   549,   550,   551,   552,   553,   554,   555,
+     556,   557,   481,     0,     5,     0,     5,     0,   158,   167,
+       0,     0,   158,   175,   158,   179,   158,   158,   158,   184,
+      14,   186,    14,   188,   580,     0,     0,     0,     0,     0,
+       0,     0,    23,   164,    23,   164,     0,     0,   137,     0,
+       0,     0,   137,     0,   343,     0,     0,   341,     0,   489,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    24,
+      25,     0,     0,    94,     0,     0,     0,     0,    30,    31,
+      30,    31,     0,     0,     0,   615,     0,     0,     0,     0,
+      42,   341,    42,   928,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    43,     0,    43,     0,     2,
+       3,     0,     0,     4,     5,     0,     0,     0,     6,   135,
+       7,     0,     9,     0,     0,   170,   135,    11,    12,    49,
+      14,    49,    15,    16,     0,     0,    18,    51,     0,    20,
+      21,    22,    23,   346,     0,    52,    53,    52,    53,     0,
+      55,     0,    55,     0,     0,     0,     0,    94,     0,     0,
+      94,     0,     0,     0,     0,     0,     0,    24,    25,     0,
+     164,   164,     0,     0,    26,    27,    28,    29,    30,    31,
+      32,     0,    34,    35,    36,    37,    38,    39,     0,     0,
+      42,     0,   649,     0,   490,     0,     0,   196,     0,     0,
+       0,     0,   650,   343,     0,    43,     0,     0,     0,     0,
+       0,   651,   489,     0,     0,   341,     0,     0,     0,     0,
+       0,     0,     0,    94,    94,    45,    46,    47,    48,    49,
+      50,     0,   489,   508,     0,    51,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    52,    53,    54,     0,     0,
+      55,     0,     0,     0,     0,     0,     0,    94,     0,     0,
+       0,     0,     0,    94,     1,     0,     0,     0,     0,     0,
+       5,     0,     0,     0,     0,     0,     0,     8,   164,   174,
+     178,   183,    10,   493,     0,    13,    14,    94,     0,     0,
+      58,    17,   346,   948,    19,     0,     0,     0,    23,     0,
+      59,   771,     0,   778,     0,   341,     0,   781,   341,    60,
+       0,     0,     0,   784,   785,     0,   786,     0,   787,     0,
+      94,   790,   791,   792,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   802,    30,    31,   877,     0,     0,   803,
+       0,     5,     0,   805,    40,   806,     0,   164,   848,   174,
+     183,     0,   490,     0,   155,   155,   155,    14,     0,     0,
+     489,    43,     0,     0,     0,   155,   164,     0,     0,    23,
+     341,    44,     0,     0,     0,     0,     0,     0,     0,    24,
+       0,   204,   205,   206,   207,    49,     0,     0,     0,   155,
+     164,     0,   142,     0,    24,    25,     0,     0,     0,     0,
+       0,    52,    53,     0,     0,    30,    31,     0,    57,     0,
+       0,     0,     0,     0,     0,     0,     0,    42,   208,   209,
+     210,   211,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    43,   213,   214,   215,   216,   632,   633,   634,
+     135,   493,     0,   158,   158,   158,     0,    51,     0,     0,
+       0,     0,     0,   771,   158,   167,    49,   771,     0,   885,
+     219,     0,    51,     0,     0,     0,     0,     0,   890,   891,
+       0,     0,    52,    53,     0,   341,   341,    55,   158,   167,
+     341,     5,   443,   444,   445,   446,   447,   448,   449,   450,
+     451,   452,   453,   454,     0,     0,     0,    14,     0,     0,
+       0,     0,   681,   341,     0,   490,     0,     0,   135,    23,
+       0,     0,     0,     0,     0,     0,     0,   267,   965,     0,
+     135,   967,   341,     0,   341,   490,     0,   109,     5,     0,
+       0,     0,     0,     0,    24,    25,    60,     0,     0,     0,
+       0,     0,     0,     0,    14,    30,    31,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    23,    42,   955,     0,
+       0,     0,     0,     0,   341,     0,     0,     0,     0,   960,
+       0,     0,    43,     0,     0,     0,     0,     0,     0,     0,
+       0,    24,    25,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    30,    31,   493,     0,    49,   135,     0,     0,
+       0,     0,    51,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,    52,    53,   493,     0,     0,    55,     0,    43,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,  1004,     0,     0,     0,     0,  1007,     0,
+       0,     0,     0,    49,     0,     0,     0,     0,     0,    51,
+       0,     0,     0,   490,     0,     0,     0,   428,   135,    52,
+      53,     0,   135,     0,    55,     0,     0,   261,     0,     0,
+       0,     0,     0,     0,     0,     0,    60,     0,     1,     2,
+       3,     0,  1033,     4,     5,  1034,     0,     0,     6,     0,
+       7,     8,     9,     0,     0,     0,    10,    11,    12,    13,
+      14,     0,    15,    16,   434,    17,    18,     0,    19,    20,
+      21,    22,    23,     0,   261,     0,     0,     0,     0,     0,
+       0,     0,     0,    60,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   164,     0,    24,    25,     0,
+       0,     0,   493,     0,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    43,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    44,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    45,    46,    47,    48,    49,
+      50,     0,     0,     0,     0,    51,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    52,    53,    54,     0,     0,
+      55,    56,    57,     0,     0,     1,     2,     3,     0,     0,
+       4,     5,     0,     0,     0,     6,     0,     7,     8,     9,
+       0,     0,     0,    10,    11,    12,    13,    14,     0,    15,
+      16,     0,    17,    18,     0,    19,    20,    21,    22,    23,
+      58,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      59,     0,     0,     0,     0,     0,     0,     0,     0,    60,
+       0,     0,     0,    61,    24,    25,     0,     0,     0,     0,
+       0,    26,    27,    28,    29,    30,    31,    32,     0,    34,
+      35,    36,    37,    38,    39,    40,     0,    42,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    43,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    44,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    45,    46,    47,    48,    49,    50,     0,     0,
+       0,     0,    51,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    52,    53,    54,     0,     0,    55,     0,    57,
+       1,     2,     3,     0,     0,     4,     5,     0,     0,     0,
+       6,     0,     7,     8,     9,     0,     0,     0,    10,    11,
+      12,    13,    14,     0,    15,    16,     0,    17,    18,     0,
+      19,    20,    21,    22,    23,     0,     0,   661,     0,     0,
+       0,     0,   196,     0,     0,     0,     0,   662,     0,     0,
+       0,     0,     0,     0,     0,     0,   651,     0,     0,    24,
+      25,     0,     0,     0,     0,     0,    26,    27,    28,    29,
+      30,    31,    32,     0,    34,    35,    36,    37,    38,    39,
+      40,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    43,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    44,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    45,    46,    47,
+      48,    49,    50,     0,     0,     0,     0,    51,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    52,    53,    54,
+       0,     0,    55,     0,    57,     2,     3,     0,     0,     4,
+       5,     0,     0,     0,     6,     0,     7,     0,     9,     0,
+       0,     0,     0,    11,    12,     0,    14,     0,    15,    16,
+       0,     0,    18,     0,     0,    20,    21,    22,    23,     0,
+       0,     0,    58,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    59,     0,     0,     0,     0,     0,     0,     0,
+       0,    60,     0,     0,    25,     0,     0,     0,     0,     0,
+      26,    27,    28,    29,    30,    31,    32,     0,    34,    35,
+      36,    37,    38,    39,     0,     0,    42,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    43,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    45,    46,    47,    48,    49,    50,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    52,    53,    54,     0,     0,    55,     0,     0,     1,
+       2,     3,   691,   692,     4,     5,   693,   694,   695,     6,
+       0,     7,     8,     9,   696,   697,   698,    10,    11,    12,
+      13,    14,   699,    15,    16,   200,    17,    18,   700,    19,
+      20,    21,    22,    23,     0,   701,   581,   201,   202,     0,
+       0,   196,     0,     0,     0,   203,   582,     0,     0,     0,
+       0,     0,     0,     0,     0,   583,     0,     0,    24,    25,
+     204,   205,   206,   207,   702,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+     703,    42,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   704,   705,    43,   208,   209,   210,
+     211,   212,   706,     0,     0,   707,    44,     0,     0,     0,
+       0,     0,   213,   214,   215,   216,    45,    46,    47,    48,
+      49,    50,   708,     0,   709,     0,    51,     0,     0,     0,
+       0,     0,     0,     0,   217,   218,    52,    53,    54,   219,
+       0,    55,    56,    57,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   220,     0,     0,     0,     0,     0,     0,  -418,   710,
+     221,   222,   223,   224,   225,   226,     1,     2,     3,   691,
+     692,     4,     5,   693,   694,   695,     6,     0,     7,     8,
+       9,   696,   697,   698,    10,    11,    12,    13,    14,   699,
+      15,    16,   200,    17,    18,   700,    19,    20,    21,    22,
+      23,     0,   701,     0,   201,   202,     0,     0,     0,     0,
+       0,     0,   203,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    24,    25,   204,   205,   206,
+     207,     0,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,   703,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   704,   705,    43,   208,   209,   210,   211,   212,   706,
+       0,     0,   707,    44,     0,     0,     0,     0,     0,   213,
+     214,   215,   216,    45,    46,    47,    48,    49,    50,   708,
+       0,   709,     0,    51,     0,     0,     0,     0,     0,     0,
+       0,   217,   218,    52,    53,    54,   219,     0,    55,    56,
+      57,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   220,     0,
+       0,     0,     0,     0,     0,  -418,   846,   221,   222,   223,
+     224,   225,   226,     1,     2,     3,   691,   692,     4,     5,
+     693,   694,   695,     6,     0,     7,     8,     9,   696,   697,
+     698,    10,    11,    12,    13,    14,   699,    15,    16,   200,
+      17,    18,   700,    19,    20,    21,    22,    23,     0,   701,
+       0,   201,   202,     0,     0,     0,     0,     0,     0,   203,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    24,    25,   204,   205,   206,   207,     0,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,   703,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   704,   705,
+      43,   208,   209,   210,   211,   212,   706,     0,     0,   707,
+      44,     0,     0,     0,     0,     0,   213,   214,   215,   216,
+      45,    46,    47,    48,    49,    50,   708,     0,   709,     0,
+      51,     0,     0,     0,     0,     0,     0,     0,   217,   218,
+      52,    53,    54,   219,     0,    55,    56,    57,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   220,     0,     0,     0,     0,
+       0,     0,  -418,     0,   221,   222,   223,   224,   225,   226,
+       1,     2,     3,     0,     0,     4,     5,     0,     0,     0,
+       6,     0,     7,     8,     9,     0,     0,     0,    10,    11,
+      12,    13,    14,     0,    15,    16,   200,    17,    18,     0,
+      19,    20,    21,    22,    23,     0,     0,     0,   201,   202,
+       0,     0,     0,     0,     0,     0,   203,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    24,
+      25,   204,   205,   206,   207,     0,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    43,   208,   209,
+     210,   211,   212,     0,     0,     0,     0,    44,     0,     0,
+       0,     0,     0,   213,   214,   215,   216,    45,    46,    47,
+      48,    49,    50,     0,     0,     0,     0,    51,     0,     0,
+       0,     0,     0,     0,     0,   217,   218,    52,    53,    54,
+     219,     1,    55,    56,    57,     0,     0,     5,     0,     0,
+       0,     0,     0,     0,     8,     0,     0,     0,     0,    10,
+       0,     0,    13,    14,     0,     0,     0,   200,    17,     0,
+       0,    19,     0,     0,     0,    23,     0,     0,     0,   201,
+     202,     0,   220,     0,     0,     0,     0,   203,     0,     0,
+       0,   221,   222,   223,   224,   225,   226,     0,     0,     0,
+      24,     0,   204,   205,   206,   207,     0,     0,     0,     0,
+       0,    30,    31,     0,     0,     0,     0,     0,     0,     0,
+       0,    40,     0,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    43,   208,
+     209,   210,   211,   212,     0,     0,     0,     0,    44,     0,
+       0,     0,     0,     0,   213,   214,   215,   216,     0,     0,
+       0,     0,    49,     0,     0,     0,     0,     0,    51,     0,
+       0,     0,     0,     0,     0,     0,   217,   218,    52,    53,
+       1,   219,     0,    55,     0,    57,     5,     0,     0,     0,
+       0,     0,     0,     8,     0,     0,     0,     0,    10,     0,
+       0,    13,    14,     0,     0,     0,   200,    17,     0,     0,
+      19,     0,     0,     0,    23,     0,     0,     0,   201,   202,
+       0,     0,     0,   220,     0,     0,   203,     0,     0,   339,
+       0,     0,   221,   340,   223,   224,   225,   226,     0,    24,
+       0,   204,   205,   206,   207,     0,     0,     0,     0,     0,
+      30,    31,     0,     0,     0,     0,     0,     0,     0,     0,
+      40,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       5,     0,     5,     0,     0,     0,     0,    43,   208,   209,
+     210,   211,   212,     0,     0,     0,    14,    44,    14,     0,
+       0,     0,     0,   213,   214,   215,   216,     0,    23,     0,
+      23,    49,     0,     0,     0,     5,     0,    51,     0,     0,
+       0,     0,     0,     0,     0,   217,   218,    52,    53,     0,
+     219,    14,    55,    24,    57,    24,     0,     0,     0,     0,
+       0,     0,     0,    23,    30,    31,    30,    31,     0,     0,
+       0,     0,     0,     0,     0,     0,    42,     0,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    43,   220,    43,     0,     0,     0,     0,   514,    30,
+      31,   221,   222,   223,   224,   225,   226,     0,     0,     0,
+       0,    42,     0,     0,     0,    49,     0,    49,     0,     0,
+       0,    51,     0,    51,     0,     0,    43,     0,     0,     0,
+       0,    52,    53,    52,    53,     0,    55,     0,    55,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      49,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    52,    53,     0,     0,
+     200,    55,     0,     0,     0,     0,   661,     0,    58,     0,
+       0,   196,   201,   202,     0,     0,   662,     0,    59,     0,
+     203,     0,     0,     0,     0,   651,     0,    60,     0,     0,
+     200,     0,     0,    24,     0,   204,   205,   206,   207,     0,
+       0,   581,   201,   202,     0,     0,   196,     0,     0,     0,
+     203,   582,     0,     0,     0,     0,     0,     0,     0,     0,
+     583,     0,     0,    24,     0,   204,   205,   206,   207,     0,
+       0,     0,   208,   209,   210,   211,   212,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   213,   214,   215,
+     216,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    51,   208,   209,   210,   211,   212,     0,     0,   217,
+     218,     0,     0,     0,   219,     0,     0,   213,   214,   215,
+     216,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    51,     0,     0,     0,     0,     0,     0,   200,   217,
+     218,     0,     0,     0,   219,     0,     0,     0,     0,     0,
+     201,   202,     0,     0,     0,     0,   220,     0,   203,     0,
+       0,     0,     0,     0,     0,   221,   222,   223,   224,   225,
+     226,    24,    25,   204,   205,   206,   207,     0,     0,   831,
+       0,     0,     0,     0,     0,     0,   220,     0,     0,     0,
+     862,   863,     0,   599,     0,   221,   222,   223,   224,   225,
+     226,     0,     0,     0,     0,     0,     0,     0,   864,     0,
+     208,   209,   210,   211,   212,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   213,   214,   215,   216,     0,
+       0,     0,     0,     0,     0,     0,     0,   200,     0,    51,
+       0,     0,     0,     0,     0,     0,     0,   217,   218,   201,
+     202,     0,   219,     0,     0,     0,     0,   203,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      24,    25,   204,   205,   206,   207,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   220,     0,     0,     0,   746,   747,
+       0,   599,   941,   221,   222,   223,   224,   225,   226,   208,
+     209,   210,   211,   212,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   213,   214,   215,   216,     0,     0,
+       0,     0,     0,     0,     0,     0,   200,     0,    51,     0,
+       0,     0,     0,     0,     0,     0,   217,   218,   201,   202,
+       0,   219,     0,     0,     0,     0,   203,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    24,
+      25,   204,   205,   206,   207,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   220,     0,     0,     0,   746,   747,     0,
+     599,   968,   221,   222,   223,   224,   225,   226,   208,   209,
+     210,   211,   212,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   213,   214,   215,   216,     0,     0,     0,
+       0,     0,     0,     0,     0,   200,     0,    51,     0,     0,
+       0,     0,     0,     0,     0,   217,   218,   201,   202,     0,
+     219,     0,     0,     0,     0,   203,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    24,     0,
+     204,   205,   206,   207,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    42,   220,     0,     0,     0,   746,   747,     0,   599,
+       0,   221,   222,   223,   224,   225,   226,   208,   209,   210,
+     211,   212,     0,     0,     0,     0,     0,     0,     0,     0,
+     200,     0,   213,   214,   215,   216,     0,     0,     0,     0,
+       0,     0,   201,   202,     0,     0,    51,     0,     0,     0,
+     203,     0,     0,     0,   217,   218,     0,     0,     0,   219,
+     200,    55,     0,    24,     0,   204,   205,   206,   207,     0,
+       0,     0,   201,   202,     0,     0,     0,     0,     0,     0,
+     203,     0,     0,     0,     0,     0,    42,     0,     0,     0,
+       0,     0,     0,    24,     0,   204,   205,   206,   207,     0,
+       0,   220,   208,   209,   210,   211,   212,     0,  -418,     0,
+     221,   222,   223,   224,   225,   226,     0,   213,   214,   215,
+     216,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    51,   208,   209,   210,   211,   212,     0,     0,   217,
+     218,     0,     0,     0,   219,   200,    55,   213,   214,   215,
+     216,     0,     0,     0,     0,     0,     0,   201,   202,     0,
+       0,    51,     0,     0,     0,   203,     0,     0,     0,   217,
+     218,     0,     0,     0,   219,     0,     0,     0,    24,     0,
+     204,   205,   206,   207,     0,     0,   220,     0,     0,     0,
+       0,     0,     0,     0,     0,   221,   222,   223,   224,   225,
+     226,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   220,   208,   209,   210,
+     211,   212,   512,     0,     0,   221,   222,   223,   224,   225,
+     226,   200,   213,   214,   215,   216,     0,     0,     0,     0,
+       0,     0,     0,   201,   202,     0,    51,     0,     0,     0,
+       0,   203,     0,     0,   217,   218,     0,     0,     0,   219,
+       0,   200,     0,     0,    24,     0,   204,   205,   206,   207,
+       0,     0,     0,   201,   202,     0,     0,     0,     0,     0,
+       0,   203,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    24,     0,   204,   205,   206,   207,
+       0,   220,   542,   208,   209,   210,   211,   212,     0,     0,
+     221,   222,   223,   224,   225,   226,     0,     0,   213,   214,
+     215,   216,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    51,   208,   209,   210,   211,   212,     0,     0,
+     217,   218,     0,     0,     0,   219,   200,     0,   213,   214,
+     215,   216,     0,     0,     0,     0,     0,     0,   201,   202,
+       0,     0,    51,     0,     0,     0,   203,     0,     0,     0,
+     217,   218,     0,     0,     0,   219,     0,     0,     0,    24,
+       0,   204,   205,   206,   207,     0,     0,   220,     0,     0,
+     578,     0,     0,     0,     0,     0,   221,   222,   223,   224,
+     225,   226,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   220,   208,   209,
+     210,   211,   212,     0,   599,     0,   221,   222,   223,   224,
+     225,   226,     0,   213,   214,   215,   216,     0,     0,     0,
+       0,     0,     0,     0,     0,   200,     0,    51,     0,     0,
+       0,   200,     0,     0,     0,   217,   218,   201,   202,     0,
+     219,     0,     0,   201,   202,   203,     0,     0,     0,     0,
+       0,   203,     0,     0,     0,     0,     0,     0,    24,     0,
+     204,   205,   206,   207,    24,    25,   204,   205,   206,   207,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   220,     0,     0,     0,     0,     0,   670,     0,
+       0,   221,   222,   223,   224,   225,   226,   208,   209,   210,
+     211,   212,     0,   208,   209,   210,   211,   212,     0,     0,
+       0,     0,   213,   214,   215,   216,     0,     0,   213,   214,
+     215,   216,     0,     0,     0,     0,    51,     0,     0,     0,
+     200,     0,    51,     0,   217,   218,   200,     0,     0,   219,
+     217,   218,   201,   202,     0,   219,     0,     0,   201,   202,
+     203,     0,     0,     0,     0,     0,   203,     0,     0,     0,
+       0,     0,     0,    24,     0,   204,   205,   206,   207,    24,
+       0,   204,   205,   206,   207,     0,     0,     0,     0,     0,
+       0,   220,     0,     0,     0,     0,     0,   220,   689,     0,
+     221,   222,   223,   224,   225,   226,   221,   222,   223,   224,
+     225,   226,   208,   209,   210,   211,   212,     0,   208,   209,
+     210,   211,   212,     0,     0,     0,     0,   213,   214,   215,
+     216,     0,     0,   213,   214,   215,   216,     0,     0,     0,
+       0,    51,     0,     0,     0,   200,     0,    51,     0,   217,
+     218,   200,     0,     0,   219,   217,   218,   201,   202,     0,
+     219,     0,     0,   201,   202,   203,     0,     0,     0,     0,
+       0,   203,     0,     0,     0,     0,     0,     0,    24,     0,
+     204,   205,   206,   207,    24,     0,   204,   205,   206,   207,
+       0,     0,     0,     0,     0,     0,   220,     0,     0,     0,
+       0,     0,   220,     0,     0,   221,   222,   223,   224,   225,
+     226,   221,   517,   223,   224,   225,   226,   208,   209,   210,
+     211,   212,     0,   208,   209,   210,   211,   212,     0,     0,
+       0,     0,   213,   214,   215,   216,     0,     0,   213,   214,
+     215,   216,     0,     0,     0,     0,    51,     0,     0,     0,
+     200,     0,    51,     0,     0,     0,     0,     0,     0,   219,
+       0,     0,   201,   202,     0,   219,     0,     0,     0,     0,
+     203,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    24,     0,   204,   205,   206,   207,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   349,     0,     0,     0,     0,     0,   351,     0,     0,
+     221,   222,   223,   224,   225,   226,   221,   222,   223,   224,
+     225,   226,   208,   209,   210,   211,   212,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   213,   214,   215,
+     216,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    51,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     1,     2,     3,   219,     0,     4,     5,     0,     0,
+       0,     6,     0,     7,     8,     9,     0,     0,     0,    10,
+      11,    12,    13,    14,     0,    15,    16,     0,    17,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   360,     0,     0,     0,
+       0,     0,     0,     0,     0,   221,   222,   223,   224,   225,
+     226,    25,     0,     0,     0,     0,     0,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,     0,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    43,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    44,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    45,    46,
+      47,    48,    49,    50,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    52,    53,
+      54,     0,     0,    55,    56,    57,     1,     2,     3,     0,
+       0,     4,     5,     0,     0,     0,     6,     0,     7,     8,
+       9,     0,     0,     0,    10,    11,    12,    13,    14,     0,
+      15,    16,     0,    17,    18,     0,    19,    20,    21,    22,
+      23,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   808,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    25,     0,     0,     0,
+       0,     0,    26,    27,    28,    29,    30,    31,    32,     0,
+      34,    35,    36,    37,    38,    39,    40,     0,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    43,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    45,    46,    47,    48,    49,    50,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    52,    53,    54,     0,     0,    55,     0,
+      57,     1,     2,     3,     0,     0,     4,     5,     0,     0,
+       0,     6,     0,     7,     8,     9,     0,     0,     0,    10,
+      11,    12,    13,    14,     0,    15,    16,     0,    17,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    25,     0,     0,     0,     0,     0,    26,    27,    28,
+      29,    30,    31,    32,     0,    34,    35,    36,    37,    38,
+      39,    40,     0,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    43,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    44,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    45,    46,
+      47,    48,    49,    50,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    52,    53,
+      54,     0,     0,    55,     0,    57,     1,     2,     3,     0,
+       0,     4,     5,     0,     0,     0,     6,     0,     7,     8,
+       9,     0,     0,     0,    10,    11,    12,    13,    14,     0,
+      15,    16,     0,    17,    18,     0,    19,    20,    21,    22,
+      23,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    25,     0,     0,     0,
+       0,     0,    26,    27,    28,    29,    30,    31,    32,     0,
+      34,    35,    36,    37,    38,    39,    40,     1,     2,     3,
+       0,     0,     4,     5,     0,     0,     0,     6,     0,     7,
+       8,     9,     0,    43,     0,    10,    11,    12,    13,    14,
+       0,    15,    16,    44,    17,    18,     0,    19,    20,    21,
+      22,    23,     0,    45,    46,    47,    48,    49,    50,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    52,    53,    54,     0,    25,     0,     0,
+      57,     0,     0,    26,    27,    28,    29,    30,    31,     0,
+       0,    34,    35,    36,    37,    38,    39,    40,     1,     2,
+       3,     0,     0,     4,     5,     0,     0,     0,     6,     0,
+       0,     8,     9,     0,    43,     0,    10,    11,    12,    13,
+      14,     0,    15,    16,    44,    17,     0,     0,    19,     0,
+      21,    22,    23,     0,     0,    46,    47,    48,    49,    50,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    52,    53,     0,     0,     0,     0,
+       0,    57,     0,     0,    26,    27,    28,    29,    30,    31,
+       0,     0,    34,    35,    36,    37,    38,    39,    40,     2,
+       3,     0,     0,     4,     5,     0,     0,     0,     6,     0,
+       7,     0,     9,     0,     0,    43,     0,    11,    12,     0,
+      14,     0,    15,    16,     0,    44,    18,     0,     0,    20,
+      21,    22,    23,     0,     0,     0,    46,    47,    48,    49,
+      50,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    52,    53,     0,    25,     0,
+       0,     0,    57,     0,    26,    27,    28,    29,    30,    31,
+      32,     0,    34,    35,    36,    37,    38,    39,     0,     0,
+      42,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    43,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    45,    46,    47,    48,    49,
+      50,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    52,    53,    54,     2,     3,
+      55,     0,     4,     5,     0,     0,     0,     6,     0,     7,
+       0,     9,     0,     0,     0,     0,    11,    12,     0,    14,
+       0,    15,    16,     0,     0,    18,     0,     0,    20,    21,
+      22,    23,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    25,     0,     0,
+       0,     0,     0,    26,    27,    28,    29,    30,    31,    32,
+       0,    34,    35,    36,    37,    38,    39,     2,     3,     0,
+       0,     4,     5,     0,     0,     0,     6,     0,     0,     0,
+       9,     0,     0,     0,    43,    11,    12,     0,    14,     0,
+      15,    16,     0,     0,     0,     0,     0,     0,    21,    22,
+      23,     0,     0,     0,    45,    46,    47,    48,    49,    50,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    52,    53,    54,     0,     0,     0,
+       0,     0,    26,    27,    28,    29,    30,    31,     0,     0,
+      34,    35,    36,    37,    38,    39,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    43,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    46,    47,    48,    49,    50,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    52,    53
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,    71,    72,     0,   220,    75,    76,     0,   420,   109,
+     333,   203,    58,   459,     0,   134,   494,    11,   120,   315,
+     111,   258,   185,   108,    85,   185,    59,   108,    68,   108,
+     191,    67,    62,    33,   441,    67,    51,    71,    72,    62,
+     258,   621,   203,   196,   505,   506,   507,   508,   217,   218,
+      71,    72,   221,   222,   223,   224,   225,   226,    58,    59,
+      60,   152,   108,    51,    62,   108,   109,   135,   475,    69,
+      70,    71,    72,    59,    60,     0,    25,    43,    44,   834,
+    1037,   185,     0,    85,   145,    71,    72,    25,   192,    25,
+     187,    85,   528,    33,   187,    45,    46,   533,    98,   336,
+     130,    98,   379,    50,   860,    98,   383,   130,   108,   109,
+    1067,   208,    98,    62,    63,   208,    62,    63,   336,   335,
+     185,    19,    51,   109,    62,    63,    62,    63,   185,    69,
+      70,   192,   130,   349,   134,   351,    71,    72,   206,    37,
+      40,    41,    42,   145,   360,   145,    71,    72,   134,   268,
+     906,   145,   192,   202,   190,   185,   186,   649,   190,   145,
+     190,   261,   485,   186,   333,   195,    58,   328,   268,   661,
+     582,   340,   187,    98,   204,   471,   191,   473,   474,   260,
+      98,   260,   267,   108,   130,   190,   258,   134,   267,   649,
+       0,   191,   345,   773,   185,   348,    85,   777,    84,    85,
+     188,   661,    75,   203,    77,   187,    79,    80,    81,   132,
+     133,   132,   133,    85,   260,   190,   108,   260,   261,   974,
+     877,   267,   190,   880,   267,   268,   208,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,    67,   186,   187,
+     186,   187,   202,   203,    62,   578,   145,   494,   187,   145,
+     260,   261,   191,   263,   336,   187,   191,   267,   268,   192,
+       0,   192,   187,   145,   146,   261,   494,   263,   203,   258,
+     187,   187,   268,  1038,   187,   185,   208,    25,    98,   189,
+     190,   107,   187,   208,   951,   196,   197,   954,   193,   188,
+      85,   208,   208,   303,   185,   208,   122,   185,    62,   125,
+     126,   127,   190,   129,   185,   185,   485,   795,   764,   480,
+     190,   193,   130,   185,    62,    63,    64,   739,   328,    67,
+     127,   208,   129,   258,   187,   260,   208,   337,   258,   800,
+     193,   338,   267,   804,    67,   338,   132,   754,   517,   428,
+     420,   421,   187,   434,   185,   434,   191,   336,   187,   190,
+     145,   146,   191,   303,   195,   187,   106,   536,   260,   191,
+     110,    47,    48,   204,   187,   267,   130,   185,   191,   379,
+     188,   472,   428,   383,   195,   428,   420,   195,   434,   200,
+     201,   434,   185,   133,   186,   187,   204,   185,   186,   420,
+     677,   185,   190,   328,   220,   505,   506,   186,   193,   578,
+     647,   336,   735,   338,    62,    63,   336,   186,   187,   489,
+     187,   491,   494,   208,   191,   110,   496,   497,   428,   647,
+     667,   185,   186,   133,   434,   190,   190,   507,   508,   364,
+     365,   195,   185,    84,    85,   194,   364,   365,   258,   667,
+     204,   185,   859,   185,   379,   489,   185,   864,   383,   185,
+     186,   531,   532,   185,   190,   681,   205,   628,   489,   746,
+     185,   186,   768,   507,   508,   190,   185,   186,   639,   640,
+     480,   190,   130,   186,   187,   420,   507,   508,   488,   186,
+     706,   132,   133,   709,   204,   420,   598,   531,   532,    62,
+     500,   947,    49,   428,   145,   505,   506,   507,   508,   434,
+     531,   532,   704,    62,    63,   494,   186,   187,   207,   505,
+     506,   507,   508,   187,   186,   187,   336,   191,   338,   529,
+     530,   531,   532,   349,   771,   351,   428,   185,   538,   692,
+     188,   186,   434,   704,   360,   531,   532,   195,   488,   582,
+     650,   192,   186,   771,   489,   480,   204,   297,   795,   186,
+     500,   187,   189,   190,   489,   191,   735,   130,   384,   494,
+     649,   496,   507,   508,   494,   647,   187,   795,   186,   187,
+     191,   130,   507,   508,   187,   862,  1032,   186,   191,   529,
+     530,   186,   187,   684,   185,   667,   531,   532,     0,   599,
+     416,   526,   527,   649,   186,   605,   531,   532,   526,   527,
+     187,   188,   186,   538,   203,   661,   187,   650,   185,   780,
+     739,   898,   185,   496,   497,   498,   186,   187,   628,   662,
+     186,   187,   195,    62,    63,   207,   185,   107,   108,   639,
+     640,   204,   200,   201,   202,   645,   195,   192,   648,   649,
+     650,   651,   186,   187,   212,   204,    85,    59,   191,   208,
+     192,   661,   662,   192,   650,   651,   186,   187,   647,    71,
+      72,   668,   186,   187,   599,   668,   662,   677,   186,   419,
+     420,   800,   186,   187,   494,   804,   186,   187,   667,   689,
+     430,   431,   186,   187,   186,   695,    98,   186,   187,   771,
+     800,   130,   192,   628,   704,   645,   186,   109,   924,   111,
+     926,   927,   186,   187,   639,   640,   145,  1040,   186,   187,
+     186,   721,   647,   795,    37,    84,    85,   647,    19,   921,
+     186,   187,   134,   185,   887,   403,   404,   405,   406,   399,
+     400,   143,   667,   668,   401,   402,   746,   667,   150,   208,
+     152,   185,   677,   855,   185,   908,   185,   649,   185,   107,
+     921,   185,    62,    63,   689,   185,   195,   407,   408,   661,
+     695,   932,   697,   132,   133,   204,   124,   414,   415,   704,
+     780,   129,   130,   185,   190,   187,   145,   603,   604,   190,
+     186,   186,   771,   192,   196,   948,   721,   613,   614,   192,
+     800,   192,   187,   191,   804,   191,    62,   877,   186,   505,
+     506,   507,   508,   186,   800,   186,   795,   919,   804,   187,
+     187,   746,   187,   186,    67,   825,   187,  1043,    67,   990,
+     130,   186,   186,   192,   936,   186,   186,   647,   207,   192,
+     187,   581,   582,   877,   193,   845,   771,   186,   192,   185,
+     590,   771,   208,   188,   185,   780,   877,   667,   668,   261,
+     860,   263,   862,   679,   680,   681,   268,  1028,   208,   185,
+     795,  1040,   220,   275,   130,   795,   876,   877,   193,   208,
+     880,   697,   882,   699,   188,   185,   187,   989,   208,   188,
+     186,   877,   994,   186,   880,   195,   188,   186,   898,   186,
+     825,   186,   188,  1064,   204,   188,   906,   187,   208,   909,
+     312,   313,   193,   186,   186,     0,   193,  1019,   186,   695,
+     845,   921,  1024,   213,   214,   215,   216,   193,   207,   185,
+     186,   747,   932,   208,   190,   860,   338,   862,   186,   195,
+     186,   186,   877,   345,  1046,   721,   188,  1049,   204,   193,
+     188,   187,   877,   649,   650,    39,   185,   208,    68,   193,
+     188,   771,   364,   365,   185,   661,   662,   186,    68,   193,
+     185,   208,   185,   898,   188,   975,   976,   187,   186,   188,
+     131,   906,   188,   186,   909,   795,   193,   912,   185,   191,
+     990,   187,   208,   188,    14,   207,   921,   185,    83,   739,
+      85,   349,   191,   351,   208,   187,   185,   932,   356,  1009,
+     358,   359,   360,    98,   830,  1015,   187,   833,   420,   186,
+     186,    62,    63,    62,    63,   208,   186,     3,  1028,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,  1039,
+      16,   185,   412,   904,   410,    21,  1007,   863,    24,   825,
+     975,   976,    62,   411,    30,   275,   413,    33,   288,    62,
+      63,   345,   190,   409,  1064,   990,   496,   609,   773,   845,
+     472,   777,  1072,   882,   880,    85,   628,   496,   954,   780,
+     165,   166,   648,   899,  1009,   668,   912,   489,   689,   130,
+    1015,   130,   689,   912,    64,   919,   703,   131,   989,  1064,
+    1024,  1049,    98,  1028,   800,   507,   508,    83,   804,   336,
+     667,   851,   852,    -1,  1039,   109,   581,   581,    -1,    89,
+     130,    -1,   938,    93,   526,   527,    96,   130,    -1,   531,
+     532,    -1,    -1,   909,   110,   145,   538,    -1,    -1,  1064,
+      -1,    -1,    -1,    -1,   185,    -1,   185,  1072,    -1,   190,
+      -1,    -1,    -1,    -1,   195,   971,   195,    -1,    -1,    -1,
+      -1,    -1,   196,   204,    -1,   204,    -1,   983,    -1,    -1,
+      -1,   147,   988,   258,    -1,   185,    -1,   147,    -1,    -1,
+     582,   997,   185,   153,   207,   195,   156,   157,    -1,   159,
+      -1,    -1,   195,   163,   204,    -1,   892,    -1,   168,   975,
+     976,   204,   172,   173,    -1,   175,   176,  1023,    -1,     9,
+     180,   181,   182,   183,   184,    -1,   186,    -1,   188,    -1,
+      -1,    -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1009,    -1,    -1,    -1,    37,    -1,  1015,
+      -1,    -1,    -1,    -1,  1060,    -1,    -1,    -1,   650,    -1,
+      -1,   336,    -1,   338,  1070,    -1,    -1,    -1,    -1,    -1,
+     662,    -1,    -1,  1039,    -1,    -1,   668,    59,    -1,    -1,
+      -1,    -1,    -1,    73,    74,    -1,    -1,    -1,    -1,    71,
+      72,   683,   684,    75,    76,    77,    78,    79,    80,    81,
+      82,    -1,    -1,   695,    -1,    -1,  1072,    -1,    -1,    -1,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   345,    -1,    -1,   348,    -1,    -1,   109,    -1,   721,
+      -1,    -1,    -1,   357,   124,    -1,    -1,   675,   676,    -1,
+      -1,    -1,    -1,    -1,   368,    -1,    -1,   739,    -1,    -1,
+     140,   141,   134,    -1,    -1,    -1,    -1,    -1,   382,    -1,
+      -1,   385,   386,   387,   388,   389,   390,   391,   392,   393,
+     394,   395,   332,    -1,     9,    -1,     9,    -1,    71,    72,
+      -1,    -1,    75,    76,    77,    78,    79,    80,    81,    82,
+      25,    84,    25,    86,   418,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,   185,    37,   187,    -1,    -1,   800,    -1,
+      -1,    -1,   804,    -1,   196,    -1,    -1,   441,    -1,   494,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,
+      63,    -1,    -1,   825,    -1,    -1,    -1,    -1,    73,    74,
+      73,    74,    -1,    -1,    -1,   469,    -1,    -1,    -1,    -1,
+      85,   475,    85,   845,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   100,    -1,   100,    -1,     4,
+       5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,   261,
+      15,    -1,    17,    -1,    -1,   877,   268,    22,    23,   124,
+      25,   124,    27,    28,    -1,    -1,    31,   130,    -1,    34,
+      35,    36,    37,   196,    -1,   140,   141,   140,   141,    -1,
+     145,    -1,   145,    -1,    -1,    -1,    -1,   909,    -1,    -1,
+     912,    -1,    -1,    -1,    -1,    -1,    -1,    62,    63,    -1,
+     312,   313,    -1,    -1,    69,    70,    71,    72,    73,    74,
+      75,    -1,    77,    78,    79,    80,    81,    82,    -1,    -1,
+      85,    -1,   185,    -1,   336,    -1,    -1,   190,    -1,    -1,
+      -1,    -1,   195,   345,    -1,   100,    -1,    -1,    -1,    -1,
+      -1,   204,   647,    -1,    -1,   599,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   975,   976,   120,   121,   122,   123,   124,
+     125,    -1,   667,   668,    -1,   130,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   140,   141,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,    -1,  1009,    -1,    -1,
+      -1,    -1,    -1,  1015,     3,    -1,    -1,    -1,    -1,    -1,
+       9,    -1,    -1,    -1,    -1,    -1,    -1,    16,   420,   421,
+     422,   423,    21,   336,    -1,    24,    25,  1039,    -1,    -1,
+     185,    30,   345,   188,    33,    -1,    -1,    -1,    37,    -1,
+     195,   621,    -1,   623,    -1,   689,    -1,   627,   692,   204,
+      -1,    -1,    -1,   633,   634,    -1,   636,    -1,   638,    -1,
+    1072,   641,   642,   643,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   653,    73,    74,   771,    -1,    -1,   659,
+      -1,     9,    -1,   663,    83,   665,    -1,   489,   732,   491,
+     492,    -1,   494,    -1,   496,   497,   498,    25,    -1,    -1,
+     795,   100,    -1,    -1,    -1,   507,   508,    -1,    -1,    37,
+     754,   110,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,
+      -1,    64,    65,    66,    67,   124,    -1,    -1,    -1,   531,
+     532,    -1,   712,    -1,    62,    63,    -1,    -1,    -1,    -1,
+      -1,   140,   141,    -1,    -1,    73,    74,    -1,   147,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,   101,   102,
+     103,   104,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   100,   116,   117,   118,   119,   490,   491,   492,
+     582,   494,    -1,   496,   497,   498,    -1,   130,    -1,    -1,
+      -1,    -1,    -1,   773,   507,   508,   124,   777,    -1,   779,
+     143,    -1,   130,    -1,    -1,    -1,    -1,    -1,   788,   789,
+      -1,    -1,   140,   141,    -1,   859,   860,   145,   531,   532,
+     864,     9,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    -1,    -1,    -1,    25,    -1,    -1,
+      -1,    -1,   185,   887,    -1,   647,    -1,    -1,   650,    37,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   185,   902,    -1,
+     662,   905,   906,    -1,   908,   667,    -1,   195,     9,    -1,
+      -1,    -1,    -1,    -1,    62,    63,   204,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    25,    73,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    85,   878,    -1,
+      -1,    -1,    -1,    -1,   948,    -1,    -1,    -1,    -1,   889,
+      -1,    -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    73,    74,   647,    -1,   124,   739,    -1,    -1,
+      -1,    -1,   130,    -1,    85,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   140,   141,   667,    -1,    -1,   145,    -1,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     950,    -1,    -1,   953,    -1,    -1,    -1,    -1,   958,    -1,
+      -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,   130,
+      -1,    -1,    -1,   795,    -1,    -1,    -1,   185,   800,   140,
+     141,    -1,   804,    -1,   145,    -1,    -1,   195,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   204,    -1,     3,     4,
+       5,    -1,  1002,     8,     9,  1005,    -1,    -1,    13,    -1,
+      15,    16,    17,    -1,    -1,    -1,    21,    22,    23,    24,
+      25,    -1,    27,    28,   185,    30,    31,    -1,    33,    34,
+      35,    36,    37,    -1,   195,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   877,    -1,    62,    63,    -1,
+      -1,    -1,   795,    -1,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,   124,
+     125,    -1,    -1,    -1,    -1,   130,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   140,   141,   142,    -1,    -1,
+     145,   146,   147,    -1,    -1,     3,     4,     5,    -1,    -1,
+       8,     9,    -1,    -1,    -1,    13,    -1,    15,    16,    17,
+      -1,    -1,    -1,    21,    22,    23,    24,    25,    -1,    27,
+      28,    -1,    30,    31,    -1,    33,    34,    35,    36,    37,
+     185,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     195,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   204,
+      -1,    -1,    -1,   208,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    70,    71,    72,    73,    74,    75,    -1,    77,
+      78,    79,    80,    81,    82,    83,    -1,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   110,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,   124,   125,    -1,    -1,
+      -1,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   140,   141,   142,    -1,    -1,   145,    -1,   147,
+       3,     4,     5,    -1,    -1,     8,     9,    -1,    -1,    -1,
+      13,    -1,    15,    16,    17,    -1,    -1,    -1,    21,    22,
+      23,    24,    25,    -1,    27,    28,    -1,    30,    31,    -1,
+      33,    34,    35,    36,    37,    -1,    -1,   185,    -1,    -1,
+      -1,    -1,   190,    -1,    -1,    -1,    -1,   195,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   204,    -1,    -1,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,    72,
+      73,    74,    75,    -1,    77,    78,    79,    80,    81,    82,
+      83,    -1,    85,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,   122,
+     123,   124,   125,    -1,    -1,    -1,    -1,   130,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141,   142,
+      -1,    -1,   145,    -1,   147,     4,     5,    -1,    -1,     8,
+       9,    -1,    -1,    -1,    13,    -1,    15,    -1,    17,    -1,
+      -1,    -1,    -1,    22,    23,    -1,    25,    -1,    27,    28,
+      -1,    -1,    31,    -1,    -1,    34,    35,    36,    37,    -1,
+      -1,    -1,   185,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   195,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   204,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    71,    72,    73,    74,    75,    -1,    77,    78,
+      79,    80,    81,    82,    -1,    -1,    85,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,   121,   122,   123,   124,   125,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,    -1,    -1,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    -1,    39,   185,    41,    42,    -1,
+      -1,   190,    -1,    -1,    -1,    49,   195,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   204,    -1,    -1,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,    -1,    -1,   109,   110,    -1,    -1,    -1,
+      -1,    -1,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,    -1,   128,    -1,   130,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   138,   139,   140,   141,   142,   143,
+      -1,   145,   146,   147,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   185,    -1,    -1,    -1,    -1,    -1,    -1,   192,   193,
+     194,   195,   196,   197,   198,   199,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    -1,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    -1,    39,    -1,    41,    42,    -1,    -1,    -1,    -1,
+      -1,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    62,    63,    64,    65,    66,
+      67,    -1,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+      -1,    -1,   109,   110,    -1,    -1,    -1,    -1,    -1,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+      -1,   128,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,   143,    -1,   145,   146,
+     147,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   185,    -1,
+      -1,    -1,    -1,    -1,    -1,   192,   193,   194,   195,   196,
+     197,   198,   199,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    -1,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    -1,    39,
+      -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    49,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    62,    63,    64,    65,    66,    67,    -1,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,    -1,    -1,   109,
+     110,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,    -1,   128,    -1,
+     130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,   143,    -1,   145,   146,   147,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,    -1,
+      -1,    -1,   192,    -1,   194,   195,   196,   197,   198,   199,
+       3,     4,     5,    -1,    -1,     8,     9,    -1,    -1,    -1,
+      13,    -1,    15,    16,    17,    -1,    -1,    -1,    21,    22,
+      23,    24,    25,    -1,    27,    28,    29,    30,    31,    -1,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    41,    42,
+      -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,
+      63,    64,    65,    66,    67,    -1,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    -1,    85,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,   101,   102,
+     103,   104,   105,    -1,    -1,    -1,    -1,   110,    -1,    -1,
+      -1,    -1,    -1,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,    -1,    -1,    -1,    -1,   130,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+     143,     3,   145,   146,   147,    -1,    -1,     9,    -1,    -1,
+      -1,    -1,    -1,    -1,    16,    -1,    -1,    -1,    -1,    21,
+      -1,    -1,    24,    25,    -1,    -1,    -1,    29,    30,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    -1,    -1,    -1,    41,
+      42,    -1,   185,    -1,    -1,    -1,    -1,    49,    -1,    -1,
+      -1,   194,   195,   196,   197,   198,   199,    -1,    -1,    -1,
+      62,    -1,    64,    65,    66,    67,    -1,    -1,    -1,    -1,
+      -1,    73,    74,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    83,    -1,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,   101,
+     102,   103,   104,   105,    -1,    -1,    -1,    -1,   110,    -1,
+      -1,    -1,    -1,    -1,   116,   117,   118,   119,    -1,    -1,
+      -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,   130,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   138,   139,   140,   141,
+       3,   143,    -1,   145,    -1,   147,     9,    -1,    -1,    -1,
+      -1,    -1,    -1,    16,    -1,    -1,    -1,    -1,    21,    -1,
+      -1,    24,    25,    -1,    -1,    -1,    29,    30,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    -1,    -1,    -1,    41,    42,
+      -1,    -1,    -1,   185,    -1,    -1,    49,    -1,    -1,   191,
+      -1,    -1,   194,   195,   196,   197,   198,   199,    -1,    62,
+      -1,    64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      73,    74,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      83,    -1,    85,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       9,    -1,     9,    -1,    -1,    -1,    -1,   100,   101,   102,
+     103,   104,   105,    -1,    -1,    -1,    25,   110,    25,    -1,
+      -1,    -1,    -1,   116,   117,   118,   119,    -1,    37,    -1,
+      37,   124,    -1,    -1,    -1,     9,    -1,   130,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   138,   139,   140,   141,    -1,
+     143,    25,   145,    62,   147,    62,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    73,    74,    73,    74,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    85,    -1,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   100,   185,   100,    -1,    -1,    -1,    -1,   191,    73,
+      74,   194,   195,   196,   197,   198,   199,    -1,    -1,    -1,
+      -1,    85,    -1,    -1,    -1,   124,    -1,   124,    -1,    -1,
+      -1,   130,    -1,   130,    -1,    -1,   100,    -1,    -1,    -1,
+      -1,   140,   141,   140,   141,    -1,   145,    -1,   145,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     124,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   140,   141,    -1,    -1,
+      29,   145,    -1,    -1,    -1,    -1,   185,    -1,   185,    -1,
+      -1,   190,    41,    42,    -1,    -1,   195,    -1,   195,    -1,
+      49,    -1,    -1,    -1,    -1,   204,    -1,   204,    -1,    -1,
+      29,    -1,    -1,    62,    -1,    64,    65,    66,    67,    -1,
+      -1,   185,    41,    42,    -1,    -1,   190,    -1,    -1,    -1,
+      49,   195,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     204,    -1,    -1,    62,    -1,    64,    65,    66,    67,    -1,
+      -1,    -1,   101,   102,   103,   104,   105,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,
+     119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   130,   101,   102,   103,   104,   105,    -1,    -1,   138,
+     139,    -1,    -1,    -1,   143,    -1,    -1,   116,   117,   118,
+     119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,    29,   138,
+     139,    -1,    -1,    -1,   143,    -1,    -1,    -1,    -1,    -1,
+      41,    42,    -1,    -1,    -1,    -1,   185,    -1,    49,    -1,
+      -1,    -1,    -1,    -1,    -1,   194,   195,   196,   197,   198,
+     199,    62,    63,    64,    65,    66,    67,    -1,    -1,   208,
+      -1,    -1,    -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,
+     189,   190,    -1,   192,    -1,   194,   195,   196,   197,   198,
+     199,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   207,    -1,
+     101,   102,   103,   104,   105,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   116,   117,   118,   119,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,   130,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    41,
+      42,    -1,   143,    -1,    -1,    -1,    -1,    49,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      62,    63,    64,    65,    66,    67,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,   189,   190,
+      -1,   192,   193,   194,   195,   196,   197,   198,   199,   101,
+     102,   103,   104,   105,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   116,   117,   118,   119,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,   130,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    41,    42,
+      -1,   143,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,
+      63,    64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   185,    -1,    -1,    -1,   189,   190,    -1,
+     192,   193,   194,   195,   196,   197,   198,   199,   101,   102,
+     103,   104,   105,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   116,   117,   118,   119,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    -1,   130,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   138,   139,    41,    42,    -1,
+     143,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,
+      64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    85,   185,    -1,    -1,    -1,   189,   190,    -1,   192,
+      -1,   194,   195,   196,   197,   198,   199,   101,   102,   103,
+     104,   105,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      29,    -1,   116,   117,   118,   119,    -1,    -1,    -1,    -1,
+      -1,    -1,    41,    42,    -1,    -1,   130,    -1,    -1,    -1,
+      49,    -1,    -1,    -1,   138,   139,    -1,    -1,    -1,   143,
+      29,   145,    -1,    62,    -1,    64,    65,    66,    67,    -1,
+      -1,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      49,    -1,    -1,    -1,    -1,    -1,    85,    -1,    -1,    -1,
+      -1,    -1,    -1,    62,    -1,    64,    65,    66,    67,    -1,
+      -1,   185,   101,   102,   103,   104,   105,    -1,   192,    -1,
+     194,   195,   196,   197,   198,   199,    -1,   116,   117,   118,
+     119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   130,   101,   102,   103,   104,   105,    -1,    -1,   138,
+     139,    -1,    -1,    -1,   143,    29,   145,   116,   117,   118,
+     119,    -1,    -1,    -1,    -1,    -1,    -1,    41,    42,    -1,
+      -1,   130,    -1,    -1,    -1,    49,    -1,    -1,    -1,   138,
+     139,    -1,    -1,    -1,   143,    -1,    -1,    -1,    62,    -1,
+      64,    65,    66,    67,    -1,    -1,   185,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   194,   195,   196,   197,   198,
+     199,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   185,   101,   102,   103,
+     104,   105,   191,    -1,    -1,   194,   195,   196,   197,   198,
+     199,    29,   116,   117,   118,   119,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    41,    42,    -1,   130,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,   138,   139,    -1,    -1,    -1,   143,
+      -1,    29,    -1,    -1,    62,    -1,    64,    65,    66,    67,
+      -1,    -1,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    62,    -1,    64,    65,    66,    67,
+      -1,   185,   186,   101,   102,   103,   104,   105,    -1,    -1,
+     194,   195,   196,   197,   198,   199,    -1,    -1,   116,   117,
+     118,   119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   130,   101,   102,   103,   104,   105,    -1,    -1,
+     138,   139,    -1,    -1,    -1,   143,    29,    -1,   116,   117,
+     118,   119,    -1,    -1,    -1,    -1,    -1,    -1,    41,    42,
+      -1,    -1,   130,    -1,    -1,    -1,    49,    -1,    -1,    -1,
+     138,   139,    -1,    -1,    -1,   143,    -1,    -1,    -1,    62,
+      -1,    64,    65,    66,    67,    -1,    -1,   185,    -1,    -1,
+     188,    -1,    -1,    -1,    -1,    -1,   194,   195,   196,   197,
+     198,   199,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   185,   101,   102,
+     103,   104,   105,    -1,   192,    -1,   194,   195,   196,   197,
+     198,   199,    -1,   116,   117,   118,   119,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    -1,   130,    -1,    -1,
+      -1,    29,    -1,    -1,    -1,   138,   139,    41,    42,    -1,
+     143,    -1,    -1,    41,    42,    49,    -1,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,
+      64,    65,    66,    67,    62,    63,    64,    65,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   185,    -1,    -1,    -1,    -1,    -1,   191,    -1,
+      -1,   194,   195,   196,   197,   198,   199,   101,   102,   103,
+     104,   105,    -1,   101,   102,   103,   104,   105,    -1,    -1,
+      -1,    -1,   116,   117,   118,   119,    -1,    -1,   116,   117,
+     118,   119,    -1,    -1,    -1,    -1,   130,    -1,    -1,    -1,
+      29,    -1,   130,    -1,   138,   139,    29,    -1,    -1,   143,
+     138,   139,    41,    42,    -1,   143,    -1,    -1,    41,    42,
+      49,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,
+      -1,    -1,    -1,    62,    -1,    64,    65,    66,    67,    62,
+      -1,    64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,   185,    -1,    -1,    -1,    -1,    -1,   185,   192,    -1,
+     194,   195,   196,   197,   198,   199,   194,   195,   196,   197,
+     198,   199,   101,   102,   103,   104,   105,    -1,   101,   102,
+     103,   104,   105,    -1,    -1,    -1,    -1,   116,   117,   118,
+     119,    -1,    -1,   116,   117,   118,   119,    -1,    -1,    -1,
+      -1,   130,    -1,    -1,    -1,    29,    -1,   130,    -1,   138,
+     139,    29,    -1,    -1,   143,   138,   139,    41,    42,    -1,
+     143,    -1,    -1,    41,    42,    49,    -1,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,
+      64,    65,    66,    67,    62,    -1,    64,    65,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,
+      -1,    -1,   185,    -1,    -1,   194,   195,   196,   197,   198,
+     199,   194,   195,   196,   197,   198,   199,   101,   102,   103,
+     104,   105,    -1,   101,   102,   103,   104,   105,    -1,    -1,
+      -1,    -1,   116,   117,   118,   119,    -1,    -1,   116,   117,
+     118,   119,    -1,    -1,    -1,    -1,   130,    -1,    -1,    -1,
+      29,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,   143,
+      -1,    -1,    41,    42,    -1,   143,    -1,    -1,    -1,    -1,
+      49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    62,    -1,    64,    65,    66,    67,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   185,    -1,    -1,    -1,    -1,    -1,   185,    -1,    -1,
+     194,   195,   196,   197,   198,   199,   194,   195,   196,   197,
+     198,   199,   101,   102,   103,   104,   105,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,
+     119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,   143,    -1,     8,     9,    -1,    -1,
+      -1,    13,    -1,    15,    16,    17,    -1,    -1,    -1,    21,
+      22,    23,    24,    25,    -1,    27,    28,    -1,    30,    31,
+      -1,    33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   194,   195,   196,   197,   198,
+     199,    63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    -1,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,
+     122,   123,   124,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141,
+     142,    -1,    -1,   145,   146,   147,     3,     4,     5,    -1,
+      -1,     8,     9,    -1,    -1,    -1,    13,    -1,    15,    16,
+      17,    -1,    -1,    -1,    21,    22,    23,    24,    25,    -1,
+      27,    28,    -1,    30,    31,    -1,    33,    34,    35,    36,
+      37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    51,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    71,    72,    73,    74,    75,    -1,
+      77,    78,    79,    80,    81,    82,    83,    -1,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   110,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,   121,   122,   123,   124,   125,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   140,   141,   142,    -1,    -1,   145,    -1,
+     147,     3,     4,     5,    -1,    -1,     8,     9,    -1,    -1,
+      -1,    13,    -1,    15,    16,    17,    -1,    -1,    -1,    21,
+      22,    23,    24,    25,    -1,    27,    28,    -1,    30,    31,
+      -1,    33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,
+      72,    73,    74,    75,    -1,    77,    78,    79,    80,    81,
+      82,    83,    -1,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,
+     122,   123,   124,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141,
+     142,    -1,    -1,   145,    -1,   147,     3,     4,     5,    -1,
+      -1,     8,     9,    -1,    -1,    -1,    13,    -1,    15,    16,
+      17,    -1,    -1,    -1,    21,    22,    23,    24,    25,    -1,
+      27,    28,    -1,    30,    31,    -1,    33,    34,    35,    36,
+      37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    71,    72,    73,    74,    75,    -1,
+      77,    78,    79,    80,    81,    82,    83,     3,     4,     5,
+      -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,    15,
+      16,    17,    -1,   100,    -1,    21,    22,    23,    24,    25,
+      -1,    27,    28,   110,    30,    31,    -1,    33,    34,    35,
+      36,    37,    -1,   120,   121,   122,   123,   124,   125,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   140,   141,   142,    -1,    63,    -1,    -1,
+     147,    -1,    -1,    69,    70,    71,    72,    73,    74,    -1,
+      -1,    77,    78,    79,    80,    81,    82,    83,     3,     4,
+       5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,
+      -1,    16,    17,    -1,   100,    -1,    21,    22,    23,    24,
+      25,    -1,    27,    28,   110,    30,    -1,    -1,    33,    -1,
+      35,    36,    37,    -1,    -1,   121,   122,   123,   124,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   140,   141,    -1,    -1,    -1,    -1,
+      -1,   147,    -1,    -1,    69,    70,    71,    72,    73,    74,
+      -1,    -1,    77,    78,    79,    80,    81,    82,    83,     4,
+       5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,
+      15,    -1,    17,    -1,    -1,   100,    -1,    22,    23,    -1,
+      25,    -1,    27,    28,    -1,   110,    31,    -1,    -1,    34,
+      35,    36,    37,    -1,    -1,    -1,   121,   122,   123,   124,
+     125,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   140,   141,    -1,    63,    -1,
+      -1,    -1,   147,    -1,    69,    70,    71,    72,    73,    74,
+      75,    -1,    77,    78,    79,    80,    81,    82,    -1,    -1,
+      85,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,   124,
+     125,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   140,   141,   142,     4,     5,
+     145,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,    15,
+      -1,    17,    -1,    -1,    -1,    -1,    22,    23,    -1,    25,
+      -1,    27,    28,    -1,    -1,    31,    -1,    -1,    34,    35,
+      36,    37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    71,    72,    73,    74,    75,
+      -1,    77,    78,    79,    80,    81,    82,     4,     5,    -1,
+      -1,     8,     9,    -1,    -1,    -1,    13,    -1,    -1,    -1,
+      17,    -1,    -1,    -1,   100,    22,    23,    -1,    25,    -1,
+      27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    35,    36,
+      37,    -1,    -1,    -1,   120,   121,   122,   123,   124,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   140,   141,   142,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    71,    72,    73,    74,    -1,    -1,
+      77,    78,    79,    80,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   140,   141
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     3,     4,     5,     8,     9,    13,    15,    16,    17,
+      21,    22,    23,    24,    25,    27,    28,    30,    31,    33,
+      34,    35,    36,    37,    62,    63,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,   100,   110,   120,   121,   122,   123,   124,
+     125,   130,   140,   141,   142,   145,   146,   147,   185,   195,
+     204,   208,   210,   211,   212,   253,   254,   255,   262,   266,
+     267,   268,   269,   272,   273,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   292,   294,   295,
+     296,   297,   299,   303,   307,   319,   322,   374,   375,   376,
+     377,   378,   389,   399,   400,   401,   402,   185,   185,   195,
+     212,   390,   391,   392,   393,   394,   395,   396,   397,   399,
+     185,   185,   185,   185,   202,   190,   190,   190,    67,   185,
+     185,   185,   400,   402,   270,   272,   274,   307,   399,   399,
+       0,   307,   308,   309,   208,   187,   208,   187,   208,   208,
+     390,   208,   390,   212,   271,   272,   285,   287,   294,   295,
+     296,   307,   399,   212,   272,   285,   287,   294,   295,   296,
+     307,   399,   271,   295,   272,   294,   295,   271,   272,   294,
+     271,   271,   271,   272,   294,   269,   294,   269,   294,   308,
+     308,   308,   376,   132,   228,   185,   190,   405,   407,   409,
+      29,    41,    42,    49,    64,    65,    66,    67,   101,   102,
+     103,   104,   105,   116,   117,   118,   119,   138,   139,   143,
+     185,   194,   195,   196,   197,   198,   199,   211,   213,   214,
+     215,   216,   217,   218,   219,   222,   223,   224,   226,   230,
+     231,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   308,   333,
+     185,   195,   212,   309,   394,   396,   398,   185,   270,   391,
+     393,   396,   405,    84,   259,   260,   261,   307,   216,   185,
+     250,    25,    62,    63,   186,   187,   289,   290,   291,   333,
+     250,   250,   250,   250,   333,   333,   249,   186,   186,   274,
+     399,   307,   399,   308,   261,   261,   308,   308,   308,   308,
+     256,   308,   269,   269,   308,   257,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   292,   293,   211,
+     212,   320,   332,   185,   133,   229,   186,   406,   408,   191,
+     195,   249,   251,   272,   275,   276,   294,   307,   190,   185,
+     234,   185,   234,   234,   332,   354,   185,   185,   185,   185,
+     185,   234,   344,   344,   344,   344,   235,   235,   185,   250,
+     333,   343,   344,   235,   235,   235,   235,   235,   235,    40,
+      41,    42,   185,   189,   190,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,   207,   195,   200,   201,   196,
+     197,    43,    44,    45,    46,   202,   203,    47,    48,   194,
+     204,   205,    49,    50,   134,   135,   206,   186,   187,   267,
+     269,   278,   280,   284,   286,   288,   186,   398,   185,   399,
+     186,   186,   405,   398,   185,   393,   396,    19,    37,   359,
+     259,   207,   186,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,   304,   305,   306,   186,   185,
+     186,   290,   203,   191,   191,   191,   186,   186,   186,   187,
+     405,   258,   390,   263,   264,   207,   334,   334,   300,   332,
+     192,   308,   321,   235,   248,   185,   343,   379,   267,   269,
+     272,   278,   284,   294,   381,   382,   383,   384,   385,   386,
+     387,   388,   211,   328,   329,   266,   267,   268,   269,   327,
+     330,   331,   191,   191,   191,   251,   275,   195,   251,   333,
+     333,   333,   249,   333,   333,   333,   192,   192,   253,   266,
+     267,   268,   269,   253,   249,   186,   186,   186,   192,   211,
+     212,   232,   186,   233,   249,   232,   250,   249,   249,   249,
+     249,   249,   249,   249,   249,   249,   249,   249,   235,   235,
+     235,   236,   236,   237,   237,   238,   238,   238,   238,   239,
+     239,   240,   241,   242,   243,   244,   246,   246,   188,   250,
+     249,   185,   195,   204,   403,   405,   410,   412,   403,   186,
+     186,   405,   405,   186,   186,   398,    37,    19,   185,   192,
+     251,   335,   208,   185,   185,   185,   185,   185,   186,   187,
+      64,    67,   289,   190,   190,   249,   334,   261,   334,   334,
+     335,   192,   301,   302,   323,   324,   325,   332,   192,   186,
+     248,   390,   294,   294,   294,   382,   212,   271,   295,   303,
+     322,   271,   295,   271,   390,   187,   208,   186,   187,   185,
+     195,   204,   393,   399,   404,   407,   411,   413,   393,   399,
+     404,   185,   195,   399,   404,   399,   404,   186,   187,   191,
+     191,   191,   186,   186,   186,   187,   187,   187,   186,   253,
+     253,   185,   218,   390,   390,   399,   399,   218,   187,   192,
+     235,     6,     7,    10,    11,    12,    18,    19,    20,    26,
+      32,    39,    68,    84,    98,    99,   106,   109,   126,   128,
+     193,   211,   212,   250,   252,   253,   332,   340,   341,   342,
+     343,   345,   346,   347,   349,   351,   352,   355,   356,   357,
+     358,   186,   187,   191,   248,   188,   405,   410,   412,   270,
+     403,   405,   186,   216,   360,   361,   189,   190,   211,   232,
+     335,   336,   337,   338,   339,   250,   250,   211,    67,    67,
+     186,   305,   186,   186,   207,   250,   250,   186,   265,   208,
+     254,   308,   310,   311,   312,   313,   314,   192,   308,   193,
+     187,   308,   323,   186,   308,   308,   308,   308,   332,   332,
+     308,   308,   308,   390,   380,   381,   329,   186,   411,   413,
+     270,   404,   308,   308,   270,   308,   308,   380,    51,   331,
+     333,   333,   225,   232,   250,   250,    11,   220,   221,   333,
+     336,   337,   208,   251,   208,   188,   340,   350,   212,   250,
+     185,   208,   250,   185,   185,   193,   359,   353,   354,    68,
+     192,   343,   208,   343,   208,   188,   193,   340,   249,   248,
+     186,   186,   186,   403,   186,   188,   362,   232,   250,   188,
+     187,   193,   189,   190,   207,   335,   186,   186,   186,   186,
+     186,   289,   191,   191,   334,   208,   267,   269,   193,   312,
+     187,   208,   187,   208,   310,   308,   325,   207,   326,   193,
+     308,   308,   186,   186,   404,   186,   186,   186,   189,   190,
+     193,   193,   188,   186,   187,   188,   187,   193,    51,   188,
+     340,    39,   185,   208,   208,   250,   208,   250,   252,   185,
+     192,   187,   208,    68,   107,   108,   127,   129,   307,   340,
+     405,   405,   190,   216,   363,   364,   188,   365,    51,   191,
+     335,   193,   338,   232,   250,   335,   186,   187,   188,   315,
+     318,   390,   316,   318,   399,   308,   316,   315,   193,   251,
+     308,   185,   407,   232,   250,   249,   221,   249,   193,   251,
+     340,   185,   341,   346,   348,   186,   186,   186,   360,    68,
+     354,   193,   343,   185,   343,   343,   208,   332,   185,   187,
+     190,   216,   366,   367,   188,   368,   250,    51,   191,   289,
+     251,   308,   317,   318,   308,   317,   298,   308,   191,   188,
+     250,   252,   340,   340,   131,   227,   186,   193,   250,   191,
+     250,   363,   332,   185,   187,   216,   369,   370,   188,   371,
+     191,   250,   207,   308,   308,   298,   340,   186,   208,    14,
+     185,   340,   208,   186,   216,   186,   191,   250,   366,   187,
+     354,   372,   373,   191,   289,   227,   252,   340,   248,   343,
+     185,   216,   186,   369,   187,   186,   208,   186,   186,   250,
+     185,   373,   227,   186,   250,   340,   186
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   209,   210,   211,   211,   212,   213,   214,   215,   216,
+     217,   217,   217,   217,   218,   218,   218,   218,   218,   218,
+     218,   218,   218,   219,   220,   220,   221,   221,   222,   222,
+     223,   224,   225,   225,   225,   226,   226,   226,   226,   227,
+     227,   228,   228,   229,   229,   230,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   232,   232,   233,   233,
+     234,   234,   234,   234,   234,   234,   234,   234,   234,   234,
+     234,   234,   234,   234,   235,   235,   235,   235,   236,   236,
+     236,   236,   237,   237,   237,   238,   238,   238,   239,   239,
+     239,   239,   239,   240,   240,   240,   241,   241,   242,   242,
+     243,   243,   244,   244,   245,   245,   246,   246,   247,   247,
+     248,   248,   248,   249,   249,   249,   249,   249,   249,   249,
+     249,   249,   249,   249,   249,   250,   250,   251,   252,   252,
+     253,   253,   253,   253,   253,   254,   256,   255,   257,   255,
+     258,   255,   259,   259,   260,   260,   261,   261,   263,   262,
+     264,   262,   262,   265,   262,   266,   266,   266,   266,   266,
+     267,   267,   267,   267,   267,   268,   268,   268,   268,   268,
+     269,   269,   269,   270,   270,   271,   271,   272,   272,   272,
+     272,   272,   272,   272,   272,   272,   273,   273,   274,   274,
+     275,   275,   275,   276,   276,   277,   277,   277,   277,   278,
+     278,   278,   278,   279,   279,   279,   280,   280,   280,   281,
+     281,   281,   282,   282,   282,   283,   283,   283,   284,   284,
+     284,   285,   285,   286,   286,   286,   286,   287,   288,   288,
+     288,   288,   289,   289,   289,   290,   290,   290,   290,   290,
+     290,   291,   291,   292,   292,   293,   293,   294,   294,   294,
+     294,   294,   294,   294,   294,   294,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   296,   296,   296,   297,   298,   300,   299,   301,   299,
+     302,   299,   303,   303,   304,   304,   304,   304,   304,   304,
+     304,   304,   304,   304,   304,   304,   304,   305,   305,   306,
+     306,   307,   307,   308,   308,   309,   309,   310,   310,   311,
+     311,   312,   312,   312,   312,   313,   313,   314,   314,   315,
+     315,   315,   316,   316,   317,   317,   318,   320,   319,   321,
+     319,   319,   322,   323,   323,   324,   324,   324,   325,   326,
+     326,   327,   327,   328,   328,   329,   330,   330,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   332,   332,   333,   333,   333,   333,   334,   334,
+     335,   335,   335,   336,   336,   337,   337,   338,   338,   338,
+     338,   339,   339,   339,   339,   339,   339,   340,   340,   340,
+     340,   340,   340,   340,   340,   340,   340,   340,   340,   341,
+     342,   342,   342,   342,   342,   343,   343,   343,   344,   345,
+     345,   346,   347,   347,   347,   348,   348,   349,   349,   350,
+     349,   351,   351,   351,   351,   351,   351,   352,   353,   353,
+     354,   355,   355,   356,   356,   357,   357,   357,   358,   358,
+     358,   359,   359,   359,   359,   359,   360,   360,   360,   360,
+     360,   361,   362,   362,   363,   363,   364,   364,   365,   365,
+     366,   366,   367,   367,   368,   368,   369,   370,   370,   371,
+     371,   372,   372,   373,   374,   374,   375,   375,   376,   376,
+     376,   376,   377,   378,   379,   380,   380,   381,   381,   382,
+     383,   383,   383,   384,   384,   384,   384,   385,   385,   385,
+     386,   386,   387,   387,   387,   388,   388,   388,   389,   389,
+     389,   389,   389,   390,   390,   390,   391,   391,   391,   392,
+     392,   393,   393,   393,   394,   394,   394,   395,   395,   396,
+     396,   396,   396,   396,   397,   397,   397,   398,   398,   399,
+     399,   400,   400,   400,   400,   401,   401,   401,   402,   402,
+     403,   403,   403,   404,   404,   405,   405,   406,   405,   407,
+     407,   408,   407,   409,   409,   409,   409,   409,   409,   409,
+     410,   410,   410,   410,   410,   411,   411,   411,   411,   411,
+     412,   412,   412,   412,   412,   413,   413,   413,   413
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     6,     1,     3,     3,     3,     6,     6,
+       4,     6,     1,     3,     4,     6,     4,     6,     4,     0,
+       4,     0,     4,     0,     4,     3,     1,     4,     3,     4,
+       3,     3,     2,     2,     6,     7,     1,     1,     1,     3,
+       1,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     4,     2,     4,     1,     4,     2,     2,     1,     3,
+       3,     3,     1,     3,     3,     1,     3,     3,     1,     3,
+       3,     3,     3,     1,     3,     3,     1,     3,     1,     3,
+       1,     3,     1,     3,     1,     3,     1,     3,     1,     3,
+       1,     5,     4,     1,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     1,     3,     1,     0,     1,
+       2,     2,     2,     2,     2,     6,     0,     4,     0,     4,
+       0,     5,     5,     1,     2,     1,     0,     1,     0,     5,
+       0,     5,     5,     0,     7,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     1,     2,     2,
+       1,     2,     2,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     4,     1,     4,     4,     1,     1,
+       1,     1,     1,     1,     2,     3,     3,     3,     3,     2,
+       3,     2,     3,     2,     2,     2,     1,     2,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     2,     3,
+       3,     4,     4,     1,     2,     3,     2,     4,     1,     2,
+       3,     2,     1,     1,     1,     1,     4,     4,     6,    10,
+       1,     1,     2,     4,     3,     0,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     4,     7,     7,
+       1,     1,     1,     1,     4,     0,     0,     9,     0,    10,
+       0,     6,     1,     1,     1,     1,     4,     1,     4,     4,
+       1,     1,     4,     4,     1,     1,     1,     0,     1,     1,
+       3,     6,     1,     0,     1,     1,     2,     0,     1,     1,
+       2,     2,     2,     1,     2,     3,     3,     3,     3,     3,
+       0,     2,     3,     2,     0,     1,     2,     0,     7,     0,
+       8,     4,     1,     0,     1,     1,     3,     2,     3,     0,
+       2,     1,     3,     1,     3,     1,     1,     3,     1,     2,
+       3,     2,     1,     2,     3,     1,     2,     3,     2,     1,
+       2,     3,     1,     1,     2,     3,     2,     3,     0,     2,
+       1,     3,     4,     1,     3,     1,     0,     1,     3,     2,
+       3,     2,     3,     5,     4,     6,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     3,     4,     6,     3,     3,     4,     4,     0,     1,
+       2,     2,     5,     7,     5,     1,     1,     6,     8,     0,
+      10,     3,     3,     2,     2,     2,     3,     3,     1,     3,
+       1,     6,     5,     4,     2,     7,     4,     1,     2,     4,
+       4,     0,     1,     1,     2,     2,     1,     2,     3,     4,
+       5,     1,     2,     1,     4,     7,     1,     3,     2,     1,
+       4,     7,     1,     3,     2,     1,     1,     1,     3,     2,
+       1,     1,     3,     1,     0,     1,     1,     2,     1,     1,
+       1,     1,     5,     4,     1,     0,     1,     1,     2,     2,
+       1,     2,     2,     3,     3,     3,     3,     3,     3,     3,
+       4,     4,     1,     1,     1,     2,     2,     3,     1,     2,
+       2,     2,     2,     1,     1,     1,     4,     5,     2,     1,
+       1,     1,     2,     1,     1,     2,     3,     3,     4,     1,
+       4,     5,     2,     3,     3,     4,     4,     1,     3,     1,
+       1,     1,     2,     2,     3,     2,     3,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     3,     0,     5,     1,
+       2,     0,     5,     2,     3,     3,     3,     4,     4,     4,
+       1,     2,     2,     3,     1,     1,     2,     2,     3,     1,
+       3,     3,     3,     4,     4,     3,     3,     1,     4
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* identifier: "__CPROVER_ID" TOK_STRING  */
+#line 261 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_symbol);
+          irep_idt value=stack(yyvsp[0]).get(ID_value);
+          stack(yyval).set(ID_C_base_name, value);
+          stack(yyval).set(ID_identifier, value);
+          stack(yyval).set(ID_C_id_class, ANSI_C_SYMBOL);
+        }
+#line 3413 "ansi_c_y.tab.cpp"
+    break;
+
+  case 16: /* primary_expression: '(' comma_expression ')'  */
+#line 305 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 3419 "ansi_c_y.tab.cpp"
+    break;
+
+  case 23: /* generic_selection: "_Generic" '(' assignment_expression ',' generic_assoc_list ')'  */
+#line 316 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_generic_selection);
+          mto(yyval, yyvsp[-3]);
+          stack(yyval).add(ID_generic_associations).get_sub().swap((irept::subt&)stack(yyvsp[-1]).operands());
+        }
+#line 3430 "ansi_c_y.tab.cpp"
+    break;
+
+  case 24: /* generic_assoc_list: generic_association  */
+#line 326 "parser.y"
+        {
+          init(yyval); mto(yyval, yyvsp[0]);
+        }
+#line 3438 "ansi_c_y.tab.cpp"
+    break;
+
+  case 25: /* generic_assoc_list: generic_assoc_list ',' generic_association  */
+#line 330 "parser.y"
+        {
+          yyval=yyvsp[-2]; mto(yyval, yyvsp[0]);
+        }
+#line 3446 "ansi_c_y.tab.cpp"
+    break;
+
+  case 26: /* generic_association: type_name ':' assignment_expression  */
+#line 337 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_generic_association);
+          stack(yyval).set(ID_type_arg, stack(yyvsp[-2]));
+          stack(yyval).set(ID_value, stack(yyvsp[0]));
+        }
+#line 3457 "ansi_c_y.tab.cpp"
+    break;
+
+  case 27: /* generic_association: "default" ':' assignment_expression  */
+#line 344 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_generic_association);
+          stack(yyval).set(ID_type_arg, irept(ID_default));
+          stack(yyval).set(ID_value, stack(yyvsp[0]));
+        }
+#line 3468 "ansi_c_y.tab.cpp"
+    break;
+
+  case 28: /* gcc_builtin_expressions: "__builtin_va_arg" '(' assignment_expression ',' type_name ')'  */
+#line 354 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          stack(yyval).id(ID_gcc_builtin_va_arg);
+          mto(yyval, yyvsp[-3]);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+        }
+#line 3479 "ansi_c_y.tab.cpp"
+    break;
+
+  case 29: /* gcc_builtin_expressions: "__builtin_types_compatible_p" '(' type_name ',' type_name ')'  */
+#line 362 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          stack(yyval).id(ID_gcc_builtin_types_compatible_p);
+          typet &type_arg=(typet &)(stack(yyval).add(ID_type_arg));
+          typet::subtypest &subtypes=type_arg.subtypes();
+          subtypes.resize(2);
+          subtypes[0].swap(stack(yyvsp[-3]));
+          subtypes[1].swap(stack(yyvsp[-1]));
+        }
+#line 3493 "ansi_c_y.tab.cpp"
+    break;
+
+  case 30: /* cw_builtin_expressions: "_var_arg_typeof" '(' type_name ')'  */
+#line 375 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyval).id(ID_cw_va_arg_typeof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-1]));
+        }
+#line 3503 "ansi_c_y.tab.cpp"
+    break;
+
+  case 31: /* offsetof: "__offsetof" '(' type_name ',' offsetof_member_designator ')'  */
+#line 384 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          stack(yyval).id(ID_builtin_offsetof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-3]));
+          stack(yyval).add(ID_designator).swap(stack(yyvsp[-1]));
+        }
+#line 3514 "ansi_c_y.tab.cpp"
+    break;
+
+  case 32: /* offsetof_member_designator: member_name  */
+#line 394 "parser.y"
+        {
+          init(yyval, ID_designated_initializer);
+          stack(yyval).operands().resize(1);
+          stack(yyval).op0().id(ID_member);
+          stack(yyval).op0().add_source_location()=stack(yyvsp[0]).source_location();
+          stack(yyval).op0().set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+        }
+#line 3526 "ansi_c_y.tab.cpp"
+    break;
+
+  case 33: /* offsetof_member_designator: offsetof_member_designator '.' member_name  */
+#line 402 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyvsp[-1], ID_member);
+          stack(yyvsp[-1]).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3537 "ansi_c_y.tab.cpp"
+    break;
+
+  case 34: /* offsetof_member_designator: offsetof_member_designator '[' comma_expression ']'  */
+#line 409 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyvsp[-2], ID_index);
+          mto(yyvsp[-2], yyvsp[-1]);
+          mto(yyval, yyvsp[-2]);
+        }
+#line 3548 "ansi_c_y.tab.cpp"
+    break;
+
+  case 35: /* quantifier_expression: "forall" compound_scope '{' declaration comma_expression '}'  */
+#line 419 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_forall);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[-1]);
+          PARSER.pop_scope();
+        }
+#line 3560 "ansi_c_y.tab.cpp"
+    break;
+
+  case 36: /* quantifier_expression: "\\forall" compound_scope declaration primary_expression  */
+#line 427 "parser.y"
+        {
+          // The precedence of this operator is too high; it is meant
+          // to bind only very weakly.
+          yyval=yyvsp[-3];
+          set(yyval, ID_forall);
+          mto(yyval, yyvsp[-1]);
+          mto(yyval, yyvsp[0]);
+          PARSER.pop_scope();
+        }
+#line 3574 "ansi_c_y.tab.cpp"
+    break;
+
+  case 37: /* quantifier_expression: "exists" compound_scope '{' declaration comma_expression '}'  */
+#line 437 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_exists);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[-1]);
+          PARSER.pop_scope();
+        }
+#line 3586 "ansi_c_y.tab.cpp"
+    break;
+
+  case 38: /* quantifier_expression: "\\exists" compound_scope declaration primary_expression  */
+#line 445 "parser.y"
+        {
+          // The precedence of this operator is too high; it is meant
+          // to bind only very weakly.
+          yyval=yyvsp[-3];
+          set(yyval, ID_exists);
+          mto(yyval, yyvsp[-1]);
+          mto(yyval, yyvsp[0]);
+          PARSER.pop_scope();
+        }
+#line 3600 "ansi_c_y.tab.cpp"
+    break;
+
+  case 39: /* loop_invariant_opt: %empty  */
+#line 458 "parser.y"
+        { init(yyval); stack(yyval).make_nil(); }
+#line 3606 "ansi_c_y.tab.cpp"
+    break;
+
+  case 40: /* loop_invariant_opt: "__CPROVER_loop_invariant" '(' conditional_expression ')'  */
+#line 460 "parser.y"
+        { yyval=yyvsp[-1]; }
+#line 3612 "ansi_c_y.tab.cpp"
+    break;
+
+  case 41: /* requires_opt: %empty  */
+#line 465 "parser.y"
+        { init(yyval); stack(yyval).make_nil(); }
+#line 3618 "ansi_c_y.tab.cpp"
+    break;
+
+  case 42: /* requires_opt: "__CPROVER_requires" '(' conditional_expression ')'  */
+#line 467 "parser.y"
+        { yyval=yyvsp[-1]; }
+#line 3624 "ansi_c_y.tab.cpp"
+    break;
+
+  case 43: /* ensures_opt: %empty  */
+#line 472 "parser.y"
+        { init(yyval); stack(yyval).make_nil(); }
+#line 3630 "ansi_c_y.tab.cpp"
+    break;
+
+  case 44: /* ensures_opt: "__CPROVER_ensures" '(' conditional_expression ')'  */
+#line 474 "parser.y"
+        { yyval=yyvsp[-1]; }
+#line 3636 "ansi_c_y.tab.cpp"
+    break;
+
+  case 45: /* statement_expression: '(' compound_statement ')'  */
+#line 478 "parser.y"
+        { 
+          yyval=yyvsp[-2];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_statement_expression);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3647 "ansi_c_y.tab.cpp"
+    break;
+
+  case 47: /* postfix_expression: postfix_expression '[' comma_expression ']'  */
+#line 489 "parser.y"
+        { binary(yyval, yyvsp[-3], yyvsp[-2], ID_index, yyvsp[-1]); }
+#line 3653 "ansi_c_y.tab.cpp"
+    break;
+
+  case 48: /* postfix_expression: postfix_expression '(' ')'  */
+#line 491 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_function_call);
+          stack(yyval).operands().resize(2);
+          stack(yyval).op0().swap(stack(yyvsp[-2]));
+          stack(yyval).op1().clear();
+          stack(yyval).op1().id(ID_arguments);
+        }
+#line 3666 "ansi_c_y.tab.cpp"
+    break;
+
+  case 49: /* postfix_expression: postfix_expression '(' argument_expression_list ')'  */
+#line 500 "parser.y"
+        { yyval=yyvsp[-2];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_function_call);
+          stack(yyval).operands().resize(2);
+          stack(yyval).op0().swap(stack(yyvsp[-3]));
+          stack(yyval).op1().swap(stack(yyvsp[-1]));
+          stack(yyval).op1().id(ID_arguments);
+        }
+#line 3679 "ansi_c_y.tab.cpp"
+    break;
+
+  case 50: /* postfix_expression: postfix_expression '.' member_name  */
+#line 509 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_member);
+          mto(yyval, yyvsp[-2]);
+          stack(yyval).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+        }
+#line 3689 "ansi_c_y.tab.cpp"
+    break;
+
+  case 51: /* postfix_expression: postfix_expression "->" member_name  */
+#line 515 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_ptrmember);
+          mto(yyval, yyvsp[-2]);
+          stack(yyval).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+        }
+#line 3699 "ansi_c_y.tab.cpp"
+    break;
+
+  case 52: /* postfix_expression: postfix_expression "++"  */
+#line 521 "parser.y"
+        { yyval=yyvsp[0];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_postincrement);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3709 "ansi_c_y.tab.cpp"
+    break;
+
+  case 53: /* postfix_expression: postfix_expression "--"  */
+#line 527 "parser.y"
+        { yyval=yyvsp[0];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_postdecrement);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3719 "ansi_c_y.tab.cpp"
+    break;
+
+  case 54: /* postfix_expression: '(' type_name ')' '{' initializer_list_opt '}'  */
+#line 534 "parser.y"
+        {
+          exprt tmp(ID_initializer_list);
+          tmp.add_source_location()=stack(yyvsp[-2]).source_location();
+          tmp.operands().swap(stack(yyvsp[-1]).operands());
+          yyval=yyvsp[-5];
+          set(yyval, ID_typecast);
+          stack(yyval).move_to_operands(tmp);
+          stack(yyval).type().swap(stack(yyvsp[-4]));
+        }
+#line 3733 "ansi_c_y.tab.cpp"
+    break;
+
+  case 55: /* postfix_expression: '(' type_name ')' '{' initializer_list ',' '}'  */
+#line 544 "parser.y"
+        {
+          // same as above
+          exprt tmp(ID_initializer_list);
+          tmp.add_source_location()=stack(yyvsp[-3]).source_location();
+          tmp.operands().swap(stack(yyvsp[-2]).operands());
+          yyval=yyvsp[-6];
+          set(yyval, ID_typecast);
+          stack(yyval).move_to_operands(tmp);
+          stack(yyval).type().swap(stack(yyvsp[-5]));
+        }
+#line 3748 "ansi_c_y.tab.cpp"
+    break;
+
+  case 58: /* argument_expression_list: assignment_expression  */
+#line 563 "parser.y"
+        {
+          init(yyval, ID_expression_list);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3757 "ansi_c_y.tab.cpp"
+    break;
+
+  case 59: /* argument_expression_list: argument_expression_list ',' assignment_expression  */
+#line 568 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 3766 "ansi_c_y.tab.cpp"
+    break;
+
+  case 61: /* unary_expression: "++" unary_expression  */
+#line 577 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_preincrement);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3776 "ansi_c_y.tab.cpp"
+    break;
+
+  case 62: /* unary_expression: "--" unary_expression  */
+#line 583 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_predecrement);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3786 "ansi_c_y.tab.cpp"
+    break;
+
+  case 63: /* unary_expression: '&' cast_expression  */
+#line 589 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_address_of);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3795 "ansi_c_y.tab.cpp"
+    break;
+
+  case 64: /* unary_expression: "&&" gcc_local_label  */
+#line 594 "parser.y"
+        { // this takes the address of a label (a gcc extension)
+          yyval=yyvsp[-1];
+          irep_idt identifier=PARSER.lookup_label(stack(yyvsp[0]).get(ID_C_base_name));
+          set(yyval, ID_address_of);
+          stack(yyval).operands().resize(1);
+          stack(yyval).op0()=stack(yyvsp[0]);
+          stack(yyval).op0().id(ID_label);
+          stack(yyval).op0().set(ID_identifier, identifier);
+        }
+#line 3809 "ansi_c_y.tab.cpp"
+    break;
+
+  case 65: /* unary_expression: '*' cast_expression  */
+#line 604 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_dereference);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3818 "ansi_c_y.tab.cpp"
+    break;
+
+  case 66: /* unary_expression: '+' cast_expression  */
+#line 609 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_unary_plus);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3827 "ansi_c_y.tab.cpp"
+    break;
+
+  case 67: /* unary_expression: '-' cast_expression  */
+#line 614 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_unary_minus);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3836 "ansi_c_y.tab.cpp"
+    break;
+
+  case 68: /* unary_expression: '~' cast_expression  */
+#line 619 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_bitnot);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3845 "ansi_c_y.tab.cpp"
+    break;
+
+  case 69: /* unary_expression: '!' cast_expression  */
+#line 624 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_not);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3854 "ansi_c_y.tab.cpp"
+    break;
+
+  case 70: /* unary_expression: "sizeof" unary_expression  */
+#line 629 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_sizeof);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3863 "ansi_c_y.tab.cpp"
+    break;
+
+  case 71: /* unary_expression: "sizeof" '(' type_name ')'  */
+#line 634 "parser.y"
+        { yyval=yyvsp[-3];
+          set(yyval, ID_sizeof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-1]));
+        }
+#line 3872 "ansi_c_y.tab.cpp"
+    break;
+
+  case 72: /* unary_expression: "__alignof__" unary_expression  */
+#line 639 "parser.y"
+        { // note no parentheses for expressions, just like sizeof
+          yyval=yyvsp[-1];
+          set(yyval, ID_alignof);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3882 "ansi_c_y.tab.cpp"
+    break;
+
+  case 73: /* unary_expression: "__alignof__" '(' type_name ')'  */
+#line 645 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyval).id(ID_alignof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-1]));
+        }
+#line 3892 "ansi_c_y.tab.cpp"
+    break;
+
+  case 75: /* cast_expression: '(' type_name ')' cast_expression  */
+#line 655 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyval, ID_typecast);
+          mto(yyval, yyvsp[0]);
+          stack(yyval).type().swap(stack(yyvsp[-2]));
+        }
+#line 3903 "ansi_c_y.tab.cpp"
+    break;
+
+  case 76: /* cast_expression: "__real__" cast_expression  */
+#line 662 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_complex_real);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3912 "ansi_c_y.tab.cpp"
+    break;
+
+  case 77: /* cast_expression: "__imag__" cast_expression  */
+#line 667 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_complex_imag);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3921 "ansi_c_y.tab.cpp"
+    break;
+
+  case 79: /* multiplicative_expression: multiplicative_expression '*' cast_expression  */
+#line 676 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_mult, yyvsp[0]); }
+#line 3927 "ansi_c_y.tab.cpp"
+    break;
+
+  case 80: /* multiplicative_expression: multiplicative_expression '/' cast_expression  */
+#line 678 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_div, yyvsp[0]); }
+#line 3933 "ansi_c_y.tab.cpp"
+    break;
+
+  case 81: /* multiplicative_expression: multiplicative_expression '%' cast_expression  */
+#line 680 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_mod, yyvsp[0]); }
+#line 3939 "ansi_c_y.tab.cpp"
+    break;
+
+  case 83: /* additive_expression: additive_expression '+' multiplicative_expression  */
+#line 686 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_plus, yyvsp[0]); }
+#line 3945 "ansi_c_y.tab.cpp"
+    break;
+
+  case 84: /* additive_expression: additive_expression '-' multiplicative_expression  */
+#line 688 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_minus, yyvsp[0]); }
+#line 3951 "ansi_c_y.tab.cpp"
+    break;
+
+  case 86: /* shift_expression: shift_expression "<<" additive_expression  */
+#line 694 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_shl, yyvsp[0]); }
+#line 3957 "ansi_c_y.tab.cpp"
+    break;
+
+  case 87: /* shift_expression: shift_expression ">>" additive_expression  */
+#line 696 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_shr, yyvsp[0]); }
+#line 3963 "ansi_c_y.tab.cpp"
+    break;
+
+  case 89: /* relational_expression: relational_expression '<' shift_expression  */
+#line 702 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_lt, yyvsp[0]); }
+#line 3969 "ansi_c_y.tab.cpp"
+    break;
+
+  case 90: /* relational_expression: relational_expression '>' shift_expression  */
+#line 704 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_gt, yyvsp[0]); }
+#line 3975 "ansi_c_y.tab.cpp"
+    break;
+
+  case 91: /* relational_expression: relational_expression "<=" shift_expression  */
+#line 706 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_le, yyvsp[0]); }
+#line 3981 "ansi_c_y.tab.cpp"
+    break;
+
+  case 92: /* relational_expression: relational_expression ">=" shift_expression  */
+#line 708 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_ge, yyvsp[0]); }
+#line 3987 "ansi_c_y.tab.cpp"
+    break;
+
+  case 94: /* equality_expression: equality_expression "==" relational_expression  */
+#line 714 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_equal, yyvsp[0]); }
+#line 3993 "ansi_c_y.tab.cpp"
+    break;
+
+  case 95: /* equality_expression: equality_expression "!=" relational_expression  */
+#line 716 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_notequal, yyvsp[0]); }
+#line 3999 "ansi_c_y.tab.cpp"
+    break;
+
+  case 97: /* and_expression: and_expression '&' equality_expression  */
+#line 722 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_bitand, yyvsp[0]); }
+#line 4005 "ansi_c_y.tab.cpp"
+    break;
+
+  case 99: /* exclusive_or_expression: exclusive_or_expression '^' and_expression  */
+#line 728 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_bitxor, yyvsp[0]); }
+#line 4011 "ansi_c_y.tab.cpp"
+    break;
+
+  case 101: /* inclusive_or_expression: inclusive_or_expression '|' exclusive_or_expression  */
+#line 734 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_bitor, yyvsp[0]); }
+#line 4017 "ansi_c_y.tab.cpp"
+    break;
+
+  case 103: /* logical_and_expression: logical_and_expression "&&" inclusive_or_expression  */
+#line 740 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_and, yyvsp[0]); }
+#line 4023 "ansi_c_y.tab.cpp"
+    break;
+
+  case 105: /* logical_or_expression: logical_or_expression "||" logical_and_expression  */
+#line 746 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_or, yyvsp[0]); }
+#line 4029 "ansi_c_y.tab.cpp"
+    break;
+
+  case 107: /* logical_implication_expression: logical_or_expression "==>" logical_implication_expression  */
+#line 755 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_implies, yyvsp[0]); }
+#line 4035 "ansi_c_y.tab.cpp"
+    break;
+
+  case 109: /* logical_equivalence_expression: logical_equivalence_expression "<==>" logical_implication_expression  */
+#line 764 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_equal, yyvsp[0]); }
+#line 4041 "ansi_c_y.tab.cpp"
+    break;
+
+  case 111: /* conditional_expression: logical_equivalence_expression '?' comma_expression ':' conditional_expression  */
+#line 770 "parser.y"
+        { yyval=yyvsp[-3];
+          stack(yyval).id(ID_if);
+          mto(yyval, yyvsp[-4]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 4052 "ansi_c_y.tab.cpp"
+    break;
+
+  case 112: /* conditional_expression: logical_equivalence_expression '?' ':' conditional_expression  */
+#line 777 "parser.y"
+        { yyval=yyvsp[-2];
+          stack(yyval).id(ID_side_effect);
+          stack(yyval).set(ID_statement, ID_gcc_conditional_expression);
+          mto(yyval, yyvsp[-3]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 4063 "ansi_c_y.tab.cpp"
+    break;
+
+  case 114: /* assignment_expression: cast_expression '=' assignment_expression  */
+#line 788 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign); }
+#line 4069 "ansi_c_y.tab.cpp"
+    break;
+
+  case 115: /* assignment_expression: cast_expression "*=" assignment_expression  */
+#line 790 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_mult); }
+#line 4075 "ansi_c_y.tab.cpp"
+    break;
+
+  case 116: /* assignment_expression: cast_expression "/=" assignment_expression  */
+#line 792 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_div); }
+#line 4081 "ansi_c_y.tab.cpp"
+    break;
+
+  case 117: /* assignment_expression: cast_expression "%=" assignment_expression  */
+#line 794 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_mod); }
+#line 4087 "ansi_c_y.tab.cpp"
+    break;
+
+  case 118: /* assignment_expression: cast_expression "+=" assignment_expression  */
+#line 796 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_plus); }
+#line 4093 "ansi_c_y.tab.cpp"
+    break;
+
+  case 119: /* assignment_expression: cast_expression "-=" assignment_expression  */
+#line 798 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_minus); }
+#line 4099 "ansi_c_y.tab.cpp"
+    break;
+
+  case 120: /* assignment_expression: cast_expression "<<=" assignment_expression  */
+#line 800 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_shl); }
+#line 4105 "ansi_c_y.tab.cpp"
+    break;
+
+  case 121: /* assignment_expression: cast_expression ">>=" assignment_expression  */
+#line 802 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_shr); }
+#line 4111 "ansi_c_y.tab.cpp"
+    break;
+
+  case 122: /* assignment_expression: cast_expression "&=" assignment_expression  */
+#line 804 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_bitand); }
+#line 4117 "ansi_c_y.tab.cpp"
+    break;
+
+  case 123: /* assignment_expression: cast_expression "^=" assignment_expression  */
+#line 806 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_bitxor); }
+#line 4123 "ansi_c_y.tab.cpp"
+    break;
+
+  case 124: /* assignment_expression: cast_expression "|=" assignment_expression  */
+#line 808 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_bitor); }
+#line 4129 "ansi_c_y.tab.cpp"
+    break;
+
+  case 126: /* comma_expression: comma_expression ',' assignment_expression  */
+#line 814 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_comma, yyvsp[0]); }
+#line 4135 "ansi_c_y.tab.cpp"
+    break;
+
+  case 128: /* comma_expression_opt: %empty  */
+#line 823 "parser.y"
+        { init(yyval); stack(yyval).make_nil(); }
+#line 4141 "ansi_c_y.tab.cpp"
+    break;
+
+  case 130: /* declaration: declaration_specifier ';'  */
+#line 831 "parser.y"
+        {
+          // type only, no declarator!
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+        }
+#line 4151 "ansi_c_y.tab.cpp"
+    break;
+
+  case 131: /* declaration: type_specifier ';'  */
+#line 837 "parser.y"
+        {
+          // type only, no identifier!
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+        }
+#line 4161 "ansi_c_y.tab.cpp"
+    break;
+
+  case 135: /* static_assert_declaration: "_Static_assert" '(' assignment_expression ',' assignment_expression ')'  */
+#line 849 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_static_assert(true);
+          mto(yyval, yyvsp[-3]);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 4173 "ansi_c_y.tab.cpp"
+    break;
+
+  case 136: /* @1: %empty  */
+#line 860 "parser.y"
+          {
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-1]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          }
+#line 4183 "ansi_c_y.tab.cpp"
+    break;
+
+  case 137: /* default_declaring_list: declaration_qualifier_list identifier_declarator @1 initializer_opt  */
+#line 866 "parser.y"
+        {
+          // patch on the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4193 "ansi_c_y.tab.cpp"
+    break;
+
+  case 138: /* @2: %empty  */
+#line 872 "parser.y"
+          {
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-1]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          }
+#line 4203 "ansi_c_y.tab.cpp"
+    break;
+
+  case 139: /* default_declaring_list: type_qualifier_list identifier_declarator @2 initializer_opt  */
+#line 878 "parser.y"
+        {
+          // patch on the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4213 "ansi_c_y.tab.cpp"
+    break;
+
+  case 140: /* $@3: %empty  */
+#line 884 "parser.y"
+          {
+            // just add the declarator
+            PARSER.add_declarator(stack(yyvsp[-2]), stack(yyvsp[0]));
+            // Needs to be done before initializer, as we want to see that identifier
+            // already there!
+          }
+#line 4224 "ansi_c_y.tab.cpp"
+    break;
+
+  case 141: /* default_declaring_list: default_declaring_list ',' identifier_declarator $@3 initializer_opt  */
+#line 891 "parser.y"
+        {
+          // patch on the initializer
+          yyval=yyvsp[-4];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4234 "ansi_c_y.tab.cpp"
+    break;
+
+  case 142: /* post_declarator_attribute: "__asm__ (with parentheses)" volatile_or_goto_opt '(' gcc_asm_commands ')'  */
+#line 900 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          stack(yyval).id(ID_asm);
+          stack(yyval).set(ID_flavor, ID_gcc);
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+        }
+#line 4245 "ansi_c_y.tab.cpp"
+    break;
+
+  case 144: /* post_declarator_attributes: post_declarator_attributes post_declarator_attribute  */
+#line 911 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4253 "ansi_c_y.tab.cpp"
+    break;
+
+  case 146: /* post_declarator_attributes_opt: %empty  */
+#line 919 "parser.y"
+        {
+          init(yyval);
+        }
+#line 4261 "ansi_c_y.tab.cpp"
+    break;
+
+  case 148: /* @4: %empty  */
+#line 928 "parser.y"
+          {
+            yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute
+            
+            // the symbol has to be visible during initialization
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-2]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+          }
+#line 4274 "ansi_c_y.tab.cpp"
+    break;
+
+  case 149: /* declaring_list: declaration_specifier declarator post_declarator_attributes_opt @4 initializer_opt  */
+#line 937 "parser.y"
+        {
+          // add the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4284 "ansi_c_y.tab.cpp"
+    break;
+
+  case 150: /* @5: %empty  */
+#line 944 "parser.y"
+          {
+            yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]);
+            
+            // the symbol has to be visible during initialization
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-2]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+          }
+#line 4297 "ansi_c_y.tab.cpp"
+    break;
+
+  case 151: /* declaring_list: type_specifier declarator post_declarator_attributes_opt @5 initializer_opt  */
+#line 953 "parser.y"
+        {
+          // add the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4307 "ansi_c_y.tab.cpp"
+    break;
+
+  case 152: /* declaring_list: "__auto_type" declarator post_declarator_attributes_opt '=' initializer  */
+#line 960 "parser.y"
+        {
+          // handled as typeof(initializer)
+          stack(yyvsp[-4]).id(ID_typeof);
+          stack(yyvsp[-4]).copy_to_operands(stack(yyvsp[0]));
+
+          yyvsp[-3]=merge(yyvsp[-2], yyvsp[-3]);
+
+          // the symbol has to be visible during initialization
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-4]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-3]));
+          // add the initializer
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4326 "ansi_c_y.tab.cpp"
+    break;
+
+  case 153: /* $@6: %empty  */
+#line 976 "parser.y"
+          {
+            // type attribute goes into declarator
+            yyvsp[0]=merge(yyvsp[0], yyvsp[-2]);
+            yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]);
+            PARSER.add_declarator(stack(yyvsp[-4]), stack(yyvsp[-1]));
+          }
+#line 4337 "ansi_c_y.tab.cpp"
+    break;
+
+  case 154: /* declaring_list: declaring_list ',' gcc_type_attribute_opt declarator post_declarator_attributes_opt $@6 initializer_opt  */
+#line 983 "parser.y"
+        {
+          // add in the initializer
+          yyval=yyvsp[-6];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4347 "ansi_c_y.tab.cpp"
+    break;
+
+  case 166: /* declaration_qualifier_list: type_qualifier_list storage_class  */
+#line 1009 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4355 "ansi_c_y.tab.cpp"
+    break;
+
+  case 168: /* declaration_qualifier_list: declaration_qualifier_list gcc_attribute_specifier  */
+#line 1014 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4363 "ansi_c_y.tab.cpp"
+    break;
+
+  case 169: /* declaration_qualifier_list: declaration_qualifier_list declaration_qualifier  */
+#line 1018 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4371 "ansi_c_y.tab.cpp"
+    break;
+
+  case 171: /* type_qualifier_list: type_qualifier_list type_qualifier  */
+#line 1026 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4379 "ansi_c_y.tab.cpp"
+    break;
+
+  case 172: /* type_qualifier_list: type_qualifier_list gcc_attribute_specifier  */
+#line 1033 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4387 "ansi_c_y.tab.cpp"
+    break;
+
+  case 174: /* attribute_type_qualifier_list: attribute_type_qualifier_list attribute_or_type_qualifier  */
+#line 1041 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4395 "ansi_c_y.tab.cpp"
+    break;
+
+  case 177: /* type_qualifier: "_Atomic"  */
+#line 1052 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_atomic); }
+#line 4401 "ansi_c_y.tab.cpp"
+    break;
+
+  case 178: /* type_qualifier: "const"  */
+#line 1053 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_const); }
+#line 4407 "ansi_c_y.tab.cpp"
+    break;
+
+  case 179: /* type_qualifier: "restrict"  */
+#line 1054 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_restrict); }
+#line 4413 "ansi_c_y.tab.cpp"
+    break;
+
+  case 180: /* type_qualifier: "volatile"  */
+#line 1055 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_volatile); }
+#line 4419 "ansi_c_y.tab.cpp"
+    break;
+
+  case 181: /* type_qualifier: "__CPROVER_atomic"  */
+#line 1056 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_cprover_atomic); }
+#line 4425 "ansi_c_y.tab.cpp"
+    break;
+
+  case 182: /* type_qualifier: "__ptr32"  */
+#line 1057 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_ptr32); }
+#line 4431 "ansi_c_y.tab.cpp"
+    break;
+
+  case 183: /* type_qualifier: "__ptr64"  */
+#line 1058 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_ptr64); }
+#line 4437 "ansi_c_y.tab.cpp"
+    break;
+
+  case 184: /* type_qualifier: "__based" '(' comma_expression ')'  */
+#line 1059 "parser.y"
+                                                 { yyval=yyvsp[-3]; set(yyval, ID_msc_based); mto(yyval, yyvsp[-1]); }
+#line 4443 "ansi_c_y.tab.cpp"
+    break;
+
+  case 186: /* alignas_specifier: "_Alignas" '(' comma_expression ')'  */
+#line 1065 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_aligned);
+          stack(yyval).set(ID_size, stack(yyvsp[-1]));
+        }
+#line 4452 "ansi_c_y.tab.cpp"
+    break;
+
+  case 187: /* alignas_specifier: "_Alignas" '(' type_name ')'  */
+#line 1070 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_aligned);
+          stack(yyvsp[-1]).set(ID_type_arg, stack(yyvsp[-1]));
+        }
+#line 4461 "ansi_c_y.tab.cpp"
+    break;
+
+  case 194: /* attribute_type_qualifier_storage_class_list: attribute_type_qualifier_storage_class_list attribute_or_type_qualifier_or_storage_class  */
+#line 1090 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4469 "ansi_c_y.tab.cpp"
+    break;
+
+  case 195: /* basic_declaration_specifier: declaration_qualifier_list basic_type_name gcc_type_attribute_opt  */
+#line 1097 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4477 "ansi_c_y.tab.cpp"
+    break;
+
+  case 196: /* basic_declaration_specifier: basic_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1101 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4485 "ansi_c_y.tab.cpp"
+    break;
+
+  case 197: /* basic_declaration_specifier: basic_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1105 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4493 "ansi_c_y.tab.cpp"
+    break;
+
+  case 198: /* basic_declaration_specifier: basic_declaration_specifier basic_type_name gcc_type_attribute_opt  */
+#line 1109 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4501 "ansi_c_y.tab.cpp"
+    break;
+
+  case 199: /* basic_type_specifier: basic_type_name gcc_type_attribute_opt  */
+#line 1116 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]); // type attribute
+        }
+#line 4509 "ansi_c_y.tab.cpp"
+    break;
+
+  case 200: /* basic_type_specifier: type_qualifier_list basic_type_name gcc_type_attribute_opt  */
+#line 1120 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4517 "ansi_c_y.tab.cpp"
+    break;
+
+  case 201: /* basic_type_specifier: basic_type_specifier type_qualifier  */
+#line 1124 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4525 "ansi_c_y.tab.cpp"
+    break;
+
+  case 202: /* basic_type_specifier: basic_type_specifier basic_type_name gcc_type_attribute_opt  */
+#line 1128 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4533 "ansi_c_y.tab.cpp"
+    break;
+
+  case 203: /* sue_declaration_specifier: declaration_qualifier_list elaborated_type_name  */
+#line 1136 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4541 "ansi_c_y.tab.cpp"
+    break;
+
+  case 204: /* sue_declaration_specifier: sue_type_specifier storage_class  */
+#line 1140 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4549 "ansi_c_y.tab.cpp"
+    break;
+
+  case 205: /* sue_declaration_specifier: sue_declaration_specifier declaration_qualifier  */
+#line 1144 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4557 "ansi_c_y.tab.cpp"
+    break;
+
+  case 207: /* sue_type_specifier: type_qualifier_list elaborated_type_name  */
+#line 1153 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4565 "ansi_c_y.tab.cpp"
+    break;
+
+  case 208: /* sue_type_specifier: sue_type_specifier type_qualifier  */
+#line 1157 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4573 "ansi_c_y.tab.cpp"
+    break;
+
+  case 209: /* typedef_declaration_specifier: typedef_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1164 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4581 "ansi_c_y.tab.cpp"
+    break;
+
+  case 210: /* typedef_declaration_specifier: declaration_qualifier_list typedef_name gcc_type_attribute_opt  */
+#line 1168 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4589 "ansi_c_y.tab.cpp"
+    break;
+
+  case 211: /* typedef_declaration_specifier: typedef_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1172 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4597 "ansi_c_y.tab.cpp"
+    break;
+
+  case 212: /* typeof_declaration_specifier: typeof_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1179 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4605 "ansi_c_y.tab.cpp"
+    break;
+
+  case 213: /* typeof_declaration_specifier: declaration_qualifier_list typeof_specifier gcc_type_attribute_opt  */
+#line 1183 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4613 "ansi_c_y.tab.cpp"
+    break;
+
+  case 214: /* typeof_declaration_specifier: typeof_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1187 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4621 "ansi_c_y.tab.cpp"
+    break;
+
+  case 215: /* atomic_declaration_specifier: atomic_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1194 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4629 "ansi_c_y.tab.cpp"
+    break;
+
+  case 216: /* atomic_declaration_specifier: declaration_qualifier_list atomic_specifier gcc_type_attribute_opt  */
+#line 1198 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4637 "ansi_c_y.tab.cpp"
+    break;
+
+  case 217: /* atomic_declaration_specifier: atomic_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1202 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4645 "ansi_c_y.tab.cpp"
+    break;
+
+  case 218: /* typedef_type_specifier: typedef_name gcc_type_attribute_opt  */
+#line 1209 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4653 "ansi_c_y.tab.cpp"
+    break;
+
+  case 219: /* typedef_type_specifier: type_qualifier_list typedef_name gcc_type_attribute_opt  */
+#line 1213 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4661 "ansi_c_y.tab.cpp"
+    break;
+
+  case 220: /* typedef_type_specifier: typedef_type_specifier type_qualifier gcc_type_attribute_opt  */
+#line 1217 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4669 "ansi_c_y.tab.cpp"
+    break;
+
+  case 221: /* typeof_specifier: "typeof" '(' comma_expression ')'  */
+#line 1224 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_typeof);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 4678 "ansi_c_y.tab.cpp"
+    break;
+
+  case 222: /* typeof_specifier: "typeof" '(' type_name ')'  */
+#line 1229 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_typeof);
+          stack(yyval).set(ID_type_arg, stack(yyvsp[-1]));
+        }
+#line 4687 "ansi_c_y.tab.cpp"
+    break;
+
+  case 224: /* typeof_type_specifier: type_qualifier_list typeof_specifier  */
+#line 1238 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4695 "ansi_c_y.tab.cpp"
+    break;
+
+  case 225: /* typeof_type_specifier: type_qualifier_list typeof_specifier type_qualifier_list  */
+#line 1242 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4703 "ansi_c_y.tab.cpp"
+    break;
+
+  case 226: /* typeof_type_specifier: typeof_specifier type_qualifier_list  */
+#line 1246 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4711 "ansi_c_y.tab.cpp"
+    break;
+
+  case 227: /* atomic_specifier: "_Atomic()" '(' type_name ')'  */
+#line 1253 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyval).id(ID_atomic_type_specifier);
+          stack_type(yyval).subtype()=stack_type(yyvsp[-1]);
+        }
+#line 4721 "ansi_c_y.tab.cpp"
+    break;
+
+  case 229: /* atomic_type_specifier: type_qualifier_list atomic_specifier  */
+#line 1263 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4729 "ansi_c_y.tab.cpp"
+    break;
+
+  case 230: /* atomic_type_specifier: type_qualifier_list atomic_specifier type_qualifier_list  */
+#line 1267 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4737 "ansi_c_y.tab.cpp"
+    break;
+
+  case 231: /* atomic_type_specifier: atomic_specifier type_qualifier_list  */
+#line 1271 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4745 "ansi_c_y.tab.cpp"
+    break;
+
+  case 232: /* msc_decl_identifier: TOK_IDENTIFIER  */
+#line 1278 "parser.y"
+        {
+          stack(yyval).id(stack(yyval).get(ID_identifier));
+        }
+#line 4753 "ansi_c_y.tab.cpp"
+    break;
+
+  case 233: /* msc_decl_identifier: TOK_TYPEDEFNAME  */
+#line 1282 "parser.y"
+        {
+          stack(yyval).id(stack(yyval).get(ID_identifier));
+        }
+#line 4761 "ansi_c_y.tab.cpp"
+    break;
+
+  case 234: /* msc_decl_identifier: "restrict"  */
+#line 1286 "parser.y"
+        {
+          stack(yyval).id(ID_restrict);
+        }
+#line 4769 "ansi_c_y.tab.cpp"
+    break;
+
+  case 236: /* msc_decl_modifier: msc_decl_identifier '(' TOK_STRING ')'  */
+#line 1294 "parser.y"
+        {
+          yyval=yyvsp[-3]; mto(yyval, yyvsp[-1]);
+        }
+#line 4777 "ansi_c_y.tab.cpp"
+    break;
+
+  case 237: /* msc_decl_modifier: msc_decl_identifier '(' TOK_INTEGER ')'  */
+#line 1298 "parser.y"
+        {
+          yyval=yyvsp[-3]; mto(yyval, yyvsp[-1]);
+        }
+#line 4785 "ansi_c_y.tab.cpp"
+    break;
+
+  case 238: /* msc_decl_modifier: msc_decl_identifier '(' msc_decl_identifier '=' msc_decl_identifier ')'  */
+#line 1302 "parser.y"
+        {
+          yyval=yyvsp[-5]; mto(yyval, yyvsp[-3]); mto(yyval, yyvsp[-1]);
+        }
+#line 4793 "ansi_c_y.tab.cpp"
+    break;
+
+  case 239: /* msc_decl_modifier: msc_decl_identifier '(' msc_decl_identifier '=' msc_decl_identifier ',' msc_decl_identifier '=' msc_decl_identifier ')'  */
+#line 1306 "parser.y"
+        {
+          yyval=yyvsp[-9]; mto(yyval, yyvsp[-7]); mto(yyval, yyvsp[-5]); mto(yyval, yyvsp[-3]); mto(yyval, yyvsp[-1]);
+        }
+#line 4801 "ansi_c_y.tab.cpp"
+    break;
+
+  case 240: /* msc_decl_modifier: ','  */
+#line 1309 "parser.y"
+              { init(yyval, ID_nil); }
+#line 4807 "ansi_c_y.tab.cpp"
+    break;
+
+  case 241: /* msc_declspec_seq: msc_decl_modifier  */
+#line 1314 "parser.y"
+        {
+          init(yyval); mto(yyval, yyvsp[0]);
+        }
+#line 4815 "ansi_c_y.tab.cpp"
+    break;
+
+  case 242: /* msc_declspec_seq: msc_declspec_seq msc_decl_modifier  */
+#line 1318 "parser.y"
+        {
+          yyval=yyvsp[-1]; mto(yyval, yyvsp[0]);
+        }
+#line 4823 "ansi_c_y.tab.cpp"
+    break;
+
+  case 243: /* msc_declspec: "__declspec" '(' msc_declspec_seq ')'  */
+#line 1325 "parser.y"
+        {
+          yyval=yyvsp[-3]; set(yyval, ID_msc_declspec);
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+        }
+#line 4832 "ansi_c_y.tab.cpp"
+    break;
+
+  case 244: /* msc_declspec: "__declspec" '(' ')'  */
+#line 1330 "parser.y"
+        {
+          yyval=yyvsp[-2]; set(yyval, ID_msc_declspec);
+        }
+#line 4840 "ansi_c_y.tab.cpp"
+    break;
+
+  case 245: /* msc_declspec_opt: %empty  */
+#line 1337 "parser.y"
+        {
+          init(yyval, ID_nil);
+        }
+#line 4848 "ansi_c_y.tab.cpp"
+    break;
+
+  case 247: /* storage_class: "typedef"  */
+#line 1344 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_typedef); }
+#line 4854 "ansi_c_y.tab.cpp"
+    break;
+
+  case 248: /* storage_class: "extern"  */
+#line 1345 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_extern); }
+#line 4860 "ansi_c_y.tab.cpp"
+    break;
+
+  case 249: /* storage_class: "static"  */
+#line 1346 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_static); }
+#line 4866 "ansi_c_y.tab.cpp"
+    break;
+
+  case 250: /* storage_class: "auto"  */
+#line 1347 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_auto); }
+#line 4872 "ansi_c_y.tab.cpp"
+    break;
+
+  case 251: /* storage_class: "register"  */
+#line 1348 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_register); }
+#line 4878 "ansi_c_y.tab.cpp"
+    break;
+
+  case 252: /* storage_class: "inline"  */
+#line 1349 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_inline); }
+#line 4884 "ansi_c_y.tab.cpp"
+    break;
+
+  case 253: /* storage_class: "_Thread_local"  */
+#line 1350 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_thread_local); }
+#line 4890 "ansi_c_y.tab.cpp"
+    break;
+
+  case 254: /* storage_class: "__asm__"  */
+#line 1351 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_asm); }
+#line 4896 "ansi_c_y.tab.cpp"
+    break;
+
+  case 255: /* storage_class: msc_declspec  */
+#line 1352 "parser.y"
+                           { yyval=yyvsp[0]; }
+#line 4902 "ansi_c_y.tab.cpp"
+    break;
+
+  case 256: /* basic_type_name: "int"  */
+#line 1356 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int); }
+#line 4908 "ansi_c_y.tab.cpp"
+    break;
+
+  case 257: /* basic_type_name: "__int8"  */
+#line 1357 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int8); }
+#line 4914 "ansi_c_y.tab.cpp"
+    break;
+
+  case 258: /* basic_type_name: "__int16"  */
+#line 1358 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int16); }
+#line 4920 "ansi_c_y.tab.cpp"
+    break;
+
+  case 259: /* basic_type_name: "__int32"  */
+#line 1359 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int32); }
+#line 4926 "ansi_c_y.tab.cpp"
+    break;
+
+  case 260: /* basic_type_name: "__int64"  */
+#line 1360 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int64); }
+#line 4932 "ansi_c_y.tab.cpp"
+    break;
+
+  case 261: /* basic_type_name: "char"  */
+#line 1361 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_char); }
+#line 4938 "ansi_c_y.tab.cpp"
+    break;
+
+  case 262: /* basic_type_name: "short"  */
+#line 1362 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_short); }
+#line 4944 "ansi_c_y.tab.cpp"
+    break;
+
+  case 263: /* basic_type_name: "long"  */
+#line 1363 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_long); }
+#line 4950 "ansi_c_y.tab.cpp"
+    break;
+
+  case 264: /* basic_type_name: "float"  */
+#line 1364 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_float); }
+#line 4956 "ansi_c_y.tab.cpp"
+    break;
+
+  case 265: /* basic_type_name: "__float80"  */
+#line 1365 "parser.y"
+                          { yyval=yyvsp[0]; set(yyval, ID_gcc_float80); }
+#line 4962 "ansi_c_y.tab.cpp"
+    break;
+
+  case 266: /* basic_type_name: "__float128"  */
+#line 1366 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_gcc_float128); }
+#line 4968 "ansi_c_y.tab.cpp"
+    break;
+
+  case 267: /* basic_type_name: "__int128"  */
+#line 1367 "parser.y"
+                         { yyval=yyvsp[0]; set(yyval, ID_gcc_int128); }
+#line 4974 "ansi_c_y.tab.cpp"
+    break;
+
+  case 268: /* basic_type_name: "_Decimal32"  */
+#line 1368 "parser.y"
+                            { yyval=yyvsp[0]; set(yyval, ID_gcc_decimal32); }
+#line 4980 "ansi_c_y.tab.cpp"
+    break;
+
+  case 269: /* basic_type_name: "_Decimal64"  */
+#line 1369 "parser.y"
+                            { yyval=yyvsp[0]; set(yyval, ID_gcc_decimal64); }
+#line 4986 "ansi_c_y.tab.cpp"
+    break;
+
+  case 270: /* basic_type_name: "_Decimal128"  */
+#line 1370 "parser.y"
+                             { yyval=yyvsp[0]; set(yyval, ID_gcc_decimal128); }
+#line 4992 "ansi_c_y.tab.cpp"
+    break;
+
+  case 271: /* basic_type_name: "double"  */
+#line 1371 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_double); }
+#line 4998 "ansi_c_y.tab.cpp"
+    break;
+
+  case 272: /* basic_type_name: "signed"  */
+#line 1372 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_signed); }
+#line 5004 "ansi_c_y.tab.cpp"
+    break;
+
+  case 273: /* basic_type_name: "unsigned"  */
+#line 1373 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_unsigned); }
+#line 5010 "ansi_c_y.tab.cpp"
+    break;
+
+  case 274: /* basic_type_name: "void"  */
+#line 1374 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_void); }
+#line 5016 "ansi_c_y.tab.cpp"
+    break;
+
+  case 275: /* basic_type_name: "bool"  */
+#line 1375 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_c_bool); }
+#line 5022 "ansi_c_y.tab.cpp"
+    break;
+
+  case 276: /* basic_type_name: "complex"  */
+#line 1376 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_complex); }
+#line 5028 "ansi_c_y.tab.cpp"
+    break;
+
+  case 277: /* basic_type_name: "__CPROVER_bitvector" '[' comma_expression ']'  */
+#line 1378 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyval, ID_custom_bv);
+          stack(yyval).add(ID_size).swap(stack(yyvsp[-1]));
+        }
+#line 5038 "ansi_c_y.tab.cpp"
+    break;
+
+  case 278: /* basic_type_name: "__CPROVER_floatbv" '[' comma_expression ']' '[' comma_expression ']'  */
+#line 1384 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          set(yyval, ID_custom_floatbv);
+          stack(yyval).add(ID_size).swap(stack(yyvsp[-4]));
+          stack(yyval).add(ID_f).swap(stack(yyvsp[-1]));
+        }
+#line 5049 "ansi_c_y.tab.cpp"
+    break;
+
+  case 279: /* basic_type_name: "__CPROVER_fixedbv" '[' comma_expression ']' '[' comma_expression ']'  */
+#line 1391 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          set(yyval, ID_custom_fixedbv);
+          stack(yyval).add(ID_size).swap(stack(yyvsp[-4]));
+          stack(yyval).add(ID_f).swap(stack(yyvsp[-1]));
+        }
+#line 5060 "ansi_c_y.tab.cpp"
+    break;
+
+  case 280: /* basic_type_name: "__CPROVER_bool"  */
+#line 1397 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_proper_bool); }
+#line 5066 "ansi_c_y.tab.cpp"
+    break;
+
+  case 284: /* array_of_construct: "array_of" '<' type_name '>'  */
+#line 1408 "parser.y"
+        { yyval=yyvsp[-3]; stack_type(yyval).subtype().swap(stack(yyvsp[-2])); }
+#line 5072 "ansi_c_y.tab.cpp"
+    break;
+
+  case 285: /* pragma_packed: %empty  */
+#line 1412 "parser.y"
+        {
+          init(yyval);
+          if(!PARSER.pragma_pack.empty() &&
+             PARSER.pragma_pack.back().is_one())
+            set(yyval, ID_packed);
+        }
+#line 5083 "ansi_c_y.tab.cpp"
+    break;
+
+  case 286: /* $@7: %empty  */
+#line 1424 "parser.y"
+          {
+            // an anon struct/union with body
+          }
+#line 5091 "ansi_c_y.tab.cpp"
+    break;
+
+  case 287: /* aggregate_name: aggregate_key gcc_type_attribute_opt msc_declspec_opt $@7 '{' member_declaration_list_opt '}' gcc_type_attribute_opt pragma_packed  */
+#line 1430 "parser.y"
+        {
+          // save the members
+          stack(yyvsp[-8]).add(ID_components).get_sub().swap(
+            (irept::subt &)stack(yyvsp[-3]).operands());
+
+          // throw in the gcc attributes
+          yyval=merge(yyvsp[-8], merge(yyvsp[-7], merge(yyvsp[-1], yyvsp[0])));
+        }
+#line 5104 "ansi_c_y.tab.cpp"
+    break;
+
+  case 288: /* $@8: %empty  */
+#line 1442 "parser.y"
+          {
+            // A struct/union with tag and body.
+            PARSER.add_tag_with_body(stack(yyvsp[0]));
+            stack(yyvsp[-3]).set(ID_tag, stack(yyvsp[0]));
+          }
+#line 5114 "ansi_c_y.tab.cpp"
+    break;
+
+  case 289: /* aggregate_name: aggregate_key gcc_type_attribute_opt msc_declspec_opt identifier_or_typedef_name $@8 '{' member_declaration_list_opt '}' gcc_type_attribute_opt pragma_packed  */
+#line 1450 "parser.y"
+        {
+          // save the members
+          stack(yyvsp[-9]).add(ID_components).get_sub().swap(
+            (irept::subt &)stack(yyvsp[-3]).operands());
+
+          // throw in the gcc attributes
+          yyval=merge(yyvsp[-9], merge(yyvsp[-8], merge(yyvsp[-1], yyvsp[0])));
+        }
+#line 5127 "ansi_c_y.tab.cpp"
+    break;
+
+  case 290: /* $@9: %empty  */
+#line 1462 "parser.y"
+          {
+            // a struct/union with tag but without body
+            stack(yyvsp[-3]).set(ID_tag, stack(yyvsp[0]));
+          }
+#line 5136 "ansi_c_y.tab.cpp"
+    break;
+
+  case 291: /* aggregate_name: aggregate_key gcc_type_attribute_opt msc_declspec_opt identifier_or_typedef_name $@9 gcc_type_attribute_opt  */
+#line 1467 "parser.y"
+        {
+          stack(yyvsp[-5]).set(ID_components, ID_nil);
+          // type attributes
+          yyval=merge(yyvsp[-5], merge(yyvsp[-4], yyvsp[0]));
+        }
+#line 5146 "ansi_c_y.tab.cpp"
+    break;
+
+  case 292: /* aggregate_key: "struct"  */
+#line 1476 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_struct); }
+#line 5152 "ansi_c_y.tab.cpp"
+    break;
+
+  case 293: /* aggregate_key: "union"  */
+#line 1478 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_union); }
+#line 5158 "ansi_c_y.tab.cpp"
+    break;
+
+  case 294: /* gcc_type_attribute: "packed"  */
+#line 1483 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_packed); }
+#line 5164 "ansi_c_y.tab.cpp"
+    break;
+
+  case 295: /* gcc_type_attribute: "transparent_union"  */
+#line 1485 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_transparent_union); }
+#line 5170 "ansi_c_y.tab.cpp"
+    break;
+
+  case 296: /* gcc_type_attribute: "vector_size" '(' comma_expression ')'  */
+#line 1487 "parser.y"
+        { yyval=yyvsp[-3]; set(yyval, ID_vector); stack(yyval).add(ID_size)=stack(yyvsp[-1]); }
+#line 5176 "ansi_c_y.tab.cpp"
+    break;
+
+  case 297: /* gcc_type_attribute: "aligned"  */
+#line 1489 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_aligned); }
+#line 5182 "ansi_c_y.tab.cpp"
+    break;
+
+  case 298: /* gcc_type_attribute: "aligned" '(' comma_expression ')'  */
+#line 1491 "parser.y"
+        { yyval=yyvsp[-3]; set(yyval, ID_aligned); stack(yyval).set(ID_size, stack(yyvsp[-1])); }
+#line 5188 "ansi_c_y.tab.cpp"
+    break;
+
+  case 299: /* gcc_type_attribute: "mode" '(' identifier ')'  */
+#line 1493 "parser.y"
+        { yyval=yyvsp[-3]; set(yyval, ID_gcc_attribute_mode); stack(yyval).set(ID_size, stack(yyvsp[-1]).get(ID_identifier)); }
+#line 5194 "ansi_c_y.tab.cpp"
+    break;
+
+  case 300: /* gcc_type_attribute: "__gnu_inline__"  */
+#line 1495 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_static); }
+#line 5200 "ansi_c_y.tab.cpp"
+    break;
+
+  case 301: /* gcc_type_attribute: "weak"  */
+#line 1497 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_weak); }
+#line 5206 "ansi_c_y.tab.cpp"
+    break;
+
+  case 302: /* gcc_type_attribute: "alias" '(' TOK_STRING ')'  */
+#line 1499 "parser.y"
+        { yyval=yyvsp[-3]; set(yyval, ID_alias); mto(yyval, yyvsp[-1]); }
+#line 5212 "ansi_c_y.tab.cpp"
+    break;
+
+  case 303: /* gcc_type_attribute: "section" '(' TOK_STRING ')'  */
+#line 1501 "parser.y"
+        { yyval=yyvsp[-3]; set(yyval, ID_section); mto(yyval, yyvsp[-1]); }
+#line 5218 "ansi_c_y.tab.cpp"
+    break;
+
+  case 304: /* gcc_type_attribute: "noreturn"  */
+#line 1503 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_noreturn); }
+#line 5224 "ansi_c_y.tab.cpp"
+    break;
+
+  case 305: /* gcc_type_attribute: "constructor"  */
+#line 1505 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_constructor); }
+#line 5230 "ansi_c_y.tab.cpp"
+    break;
+
+  case 306: /* gcc_type_attribute: "destructor"  */
+#line 1507 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_destructor); }
+#line 5236 "ansi_c_y.tab.cpp"
+    break;
+
+  case 307: /* gcc_attribute: %empty  */
+#line 1512 "parser.y"
+        {
+          init(yyval);
+        }
+#line 5244 "ansi_c_y.tab.cpp"
+    break;
+
+  case 310: /* gcc_attribute_list: gcc_attribute_list ',' gcc_attribute  */
+#line 1521 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], yyvsp[-1]);
+        }
+#line 5252 "ansi_c_y.tab.cpp"
+    break;
+
+  case 311: /* gcc_attribute_specifier: "__attribute__" '(' '(' gcc_attribute_list ')' ')'  */
+#line 1528 "parser.y"
+        { yyval=yyvsp[-2]; }
+#line 5258 "ansi_c_y.tab.cpp"
+    break;
+
+  case 312: /* gcc_attribute_specifier: "_Noreturn"  */
+#line 1530 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_noreturn); }
+#line 5264 "ansi_c_y.tab.cpp"
+    break;
+
+  case 313: /* gcc_type_attribute_opt: %empty  */
+#line 1535 "parser.y"
+        {
+          init(yyval);
+        }
+#line 5272 "ansi_c_y.tab.cpp"
+    break;
+
+  case 316: /* gcc_type_attribute_list: gcc_type_attribute_list gcc_attribute_specifier  */
+#line 1544 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 5280 "ansi_c_y.tab.cpp"
+    break;
+
+  case 317: /* member_declaration_list_opt: %empty  */
+#line 1551 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+        }
+#line 5288 "ansi_c_y.tab.cpp"
+    break;
+
+  case 319: /* member_declaration_list: member_declaration  */
+#line 1559 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+          mto(yyval, yyvsp[0]);
+        }
+#line 5297 "ansi_c_y.tab.cpp"
+    break;
+
+  case 320: /* member_declaration_list: member_declaration_list member_declaration  */
+#line 1564 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          mto(yyval, yyvsp[0]);
+        }
+#line 5306 "ansi_c_y.tab.cpp"
+    break;
+
+  case 323: /* member_declaration: ';'  */
+#line 1574 "parser.y"
+        {
+          init(yyval, ID_declaration);
+        }
+#line 5314 "ansi_c_y.tab.cpp"
+    break;
+
+  case 325: /* member_default_declaring_list: gcc_type_attribute_opt type_qualifier_list member_identifier_declarator  */
+#line 1587 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]);
+
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_member(true);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5327 "ansi_c_y.tab.cpp"
+    break;
+
+  case 326: /* member_default_declaring_list: member_default_declaring_list ',' member_identifier_declarator  */
+#line 1596 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5336 "ansi_c_y.tab.cpp"
+    break;
+
+  case 327: /* member_declaring_list: gcc_type_attribute_opt type_specifier member_declarator  */
+#line 1606 "parser.y"
+        {
+          if(!PARSER.pragma_pack.empty() &&
+             !PARSER.pragma_pack.back().is_zero())
+          {
+            // communicate #pragma pack(n) alignment constraints by
+            // by both setting packing AND alignment; see padding.cpp
+            // for more details
+            init(yyval);
+            set(yyval, ID_packed);
+            yyvsp[-1]=merge(yyvsp[-1], yyval);
+
+            init(yyval);
+            set(yyval, ID_aligned);
+            stack(yyval).set(ID_size, PARSER.pragma_pack.back());
+            yyvsp[-1]=merge(yyvsp[-1], yyval);
+          }
+
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]);
+
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_member(true);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5365 "ansi_c_y.tab.cpp"
+    break;
+
+  case 328: /* member_declaring_list: member_declaring_list ',' member_declarator  */
+#line 1631 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5374 "ansi_c_y.tab.cpp"
+    break;
+
+  case 329: /* member_declarator: declarator bit_field_size_opt gcc_type_attribute_opt  */
+#line 1639 "parser.y"
+        {
+          yyval=yyvsp[-2];
+
+          if(stack(yyvsp[-1]).is_not_nil())
+            make_subtype(yyval, yyvsp[-1]);
+
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5388 "ansi_c_y.tab.cpp"
+    break;
+
+  case 330: /* member_declarator: %empty  */
+#line 1649 "parser.y"
+        {
+          init(yyval, ID_abstract);
+        }
+#line 5396 "ansi_c_y.tab.cpp"
+    break;
+
+  case 331: /* member_declarator: bit_field_size gcc_type_attribute_opt  */
+#line 1653 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack_type(yyval).subtype()=typet(ID_abstract);
+
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5408 "ansi_c_y.tab.cpp"
+    break;
+
+  case 332: /* member_identifier_declarator: identifier_declarator bit_field_size_opt gcc_type_attribute_opt  */
+#line 1664 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          if(stack(yyvsp[-1]).is_not_nil())
+            make_subtype(yyval, yyvsp[-1]);
+          
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5421 "ansi_c_y.tab.cpp"
+    break;
+
+  case 333: /* member_identifier_declarator: bit_field_size gcc_type_attribute_opt  */
+#line 1673 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack_type(yyval).subtype()=typet(ID_abstract);
+
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5433 "ansi_c_y.tab.cpp"
+    break;
+
+  case 334: /* bit_field_size_opt: %empty  */
+#line 1684 "parser.y"
+        {
+          init(yyval, ID_nil);
+        }
+#line 5441 "ansi_c_y.tab.cpp"
+    break;
+
+  case 336: /* bit_field_size: ':' constant_expression  */
+#line 1692 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          set(yyval, ID_c_bit_field);
+          stack_type(yyval).set(ID_size, stack(yyvsp[0]));
+          stack_type(yyval).subtype().id(ID_abstract);
+        }
+#line 5452 "ansi_c_y.tab.cpp"
+    break;
+
+  case 337: /* $@10: %empty  */
+#line 1703 "parser.y"
+          {
+            // an anon enum
+          }
+#line 5460 "ansi_c_y.tab.cpp"
+    break;
+
+  case 338: /* enum_name: enum_key gcc_type_attribute_opt $@10 '{' enumerator_list_opt '}' gcc_type_attribute_opt  */
+#line 1708 "parser.y"
+        {
+          stack(yyvsp[-6]).operands().swap(stack(yyvsp[-2]).operands());
+          yyval=merge(yyvsp[-6], merge(yyvsp[-5], yyvsp[0])); // throw in the gcc attributes
+        }
+#line 5469 "ansi_c_y.tab.cpp"
+    break;
+
+  case 339: /* $@11: %empty  */
+#line 1715 "parser.y"
+          {
+            // an enum with tag
+            stack(yyvsp[-2]).set(ID_tag, stack(yyvsp[0]));
+          }
+#line 5478 "ansi_c_y.tab.cpp"
+    break;
+
+  case 340: /* enum_name: enum_key gcc_type_attribute_opt identifier_or_typedef_name $@11 '{' enumerator_list_opt '}' gcc_type_attribute_opt  */
+#line 1721 "parser.y"
+        {
+          stack(yyvsp[-7]).operands().swap(stack(yyvsp[-2]).operands());
+          yyval=merge(yyvsp[-7], merge(yyvsp[-6], yyvsp[0])); // throw in the gcc attributes
+        }
+#line 5487 "ansi_c_y.tab.cpp"
+    break;
+
+  case 341: /* enum_name: enum_key gcc_type_attribute_opt identifier_or_typedef_name gcc_type_attribute_opt  */
+#line 1729 "parser.y"
+        {
+          stack(yyvsp[-3]).id(ID_c_enum_tag); // tag only
+          stack(yyvsp[-3]).set(ID_tag, stack(yyvsp[-1]));
+          yyval=merge(yyvsp[-3], merge(yyvsp[-2], yyvsp[0])); // throw in the gcc attributes
+        }
+#line 5497 "ansi_c_y.tab.cpp"
+    break;
+
+  case 342: /* enum_key: "enum"  */
+#line 1737 "parser.y"
+        {
+          yyval=yyvsp[0];
+          set(yyval, ID_c_enum);
+        }
+#line 5506 "ansi_c_y.tab.cpp"
+    break;
+
+  case 343: /* enumerator_list_opt: %empty  */
+#line 1745 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+        }
+#line 5514 "ansi_c_y.tab.cpp"
+    break;
+
+  case 345: /* enumerator_list: enumerator_declaration  */
+#line 1753 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+          mto(yyval, yyvsp[0]);
+        }
+#line 5523 "ansi_c_y.tab.cpp"
+    break;
+
+  case 346: /* enumerator_list: enumerator_list ',' enumerator_declaration  */
+#line 1758 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 5532 "ansi_c_y.tab.cpp"
+    break;
+
+  case 347: /* enumerator_list: enumerator_list ','  */
+#line 1763 "parser.y"
+        {
+          yyval=yyvsp[-1];
+        }
+#line 5540 "ansi_c_y.tab.cpp"
+    break;
+
+  case 348: /* enumerator_declaration: identifier_or_typedef_name gcc_type_attribute_opt enumerator_value_opt  */
+#line 1770 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_enum_constant(true);
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-2]));
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 5551 "ansi_c_y.tab.cpp"
+    break;
+
+  case 349: /* enumerator_value_opt: %empty  */
+#line 1780 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).make_nil();
+        }
+#line 5560 "ansi_c_y.tab.cpp"
+    break;
+
+  case 350: /* enumerator_value_opt: '=' constant_expression  */
+#line 1785 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 5568 "ansi_c_y.tab.cpp"
+    break;
+
+  case 352: /* parameter_type_list: parameter_list ',' "..."  */
+#line 1793 "parser.y"
+        {
+          typet tmp(ID_ellipsis);
+          yyval=yyvsp[-2];
+          stack_type(yyval).move_to_subtypes(tmp);
+        }
+#line 5578 "ansi_c_y.tab.cpp"
+    break;
+
+  case 353: /* KnR_parameter_list: KnR_parameter  */
+#line 1802 "parser.y"
+        {
+          init(yyval, ID_parameters);
+          mts(yyval, yyvsp[0]);
+        }
+#line 5587 "ansi_c_y.tab.cpp"
+    break;
+
+  case 354: /* KnR_parameter_list: KnR_parameter_list ',' KnR_parameter  */
+#line 1807 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mts(yyval, yyvsp[0]);
+        }
+#line 5596 "ansi_c_y.tab.cpp"
+    break;
+
+  case 355: /* KnR_parameter: identifier  */
+#line 1814 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type()=typet(ID_KnR);
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5606 "ansi_c_y.tab.cpp"
+    break;
+
+  case 356: /* parameter_list: parameter_declaration  */
+#line 1823 "parser.y"
+        {
+          init(yyval, ID_parameters);
+          mts(yyval, yyvsp[0]);
+        }
+#line 5615 "ansi_c_y.tab.cpp"
+    break;
+
+  case 357: /* parameter_list: parameter_list ',' parameter_declaration  */
+#line 1828 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mts(yyval, yyvsp[0]);
+        }
+#line 5624 "ansi_c_y.tab.cpp"
+    break;
+
+  case 358: /* parameter_declaration: declaration_specifier  */
+#line 1836 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5636 "ansi_c_y.tab.cpp"
+    break;
+
+  case 359: /* parameter_declaration: declaration_specifier parameter_abstract_declarator  */
+#line 1844 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5647 "ansi_c_y.tab.cpp"
+    break;
+
+  case 360: /* parameter_declaration: declaration_specifier identifier_declarator gcc_type_attribute_opt  */
+#line 1851 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5659 "ansi_c_y.tab.cpp"
+    break;
+
+  case 361: /* parameter_declaration: declaration_specifier parameter_typedef_declarator  */
+#line 1859 "parser.y"
+        {
+          // the second tree is really the declarator -- not part
+          // of the type!
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5672 "ansi_c_y.tab.cpp"
+    break;
+
+  case 362: /* parameter_declaration: declaration_qualifier_list  */
+#line 1868 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5684 "ansi_c_y.tab.cpp"
+    break;
+
+  case 363: /* parameter_declaration: declaration_qualifier_list parameter_abstract_declarator  */
+#line 1876 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5695 "ansi_c_y.tab.cpp"
+    break;
+
+  case 364: /* parameter_declaration: declaration_qualifier_list identifier_declarator gcc_type_attribute_opt  */
+#line 1883 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5707 "ansi_c_y.tab.cpp"
+    break;
+
+  case 365: /* parameter_declaration: type_specifier  */
+#line 1891 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5719 "ansi_c_y.tab.cpp"
+    break;
+
+  case 366: /* parameter_declaration: type_specifier parameter_abstract_declarator  */
+#line 1899 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5730 "ansi_c_y.tab.cpp"
+    break;
+
+  case 367: /* parameter_declaration: type_specifier identifier_declarator gcc_type_attribute_opt  */
+#line 1906 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5742 "ansi_c_y.tab.cpp"
+    break;
+
+  case 368: /* parameter_declaration: type_specifier parameter_typedef_declarator  */
+#line 1914 "parser.y"
+        {
+          // the second tree is really the declarator -- not part of the type!
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5754 "ansi_c_y.tab.cpp"
+    break;
+
+  case 369: /* parameter_declaration: type_qualifier_list  */
+#line 1922 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5766 "ansi_c_y.tab.cpp"
+    break;
+
+  case 370: /* parameter_declaration: type_qualifier_list parameter_abstract_declarator  */
+#line 1930 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5777 "ansi_c_y.tab.cpp"
+    break;
+
+  case 371: /* parameter_declaration: type_qualifier_list identifier_declarator gcc_type_attribute_opt  */
+#line 1937 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5789 "ansi_c_y.tab.cpp"
+    break;
+
+  case 374: /* type_name: gcc_type_attribute_opt type_specifier  */
+#line 1953 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 5797 "ansi_c_y.tab.cpp"
+    break;
+
+  case 375: /* type_name: gcc_type_attribute_opt type_specifier abstract_declarator  */
+#line 1957 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[-2]);
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 5806 "ansi_c_y.tab.cpp"
+    break;
+
+  case 376: /* type_name: gcc_type_attribute_opt type_qualifier_list  */
+#line 1962 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 5814 "ansi_c_y.tab.cpp"
+    break;
+
+  case 377: /* type_name: gcc_type_attribute_opt type_qualifier_list abstract_declarator  */
+#line 1966 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[-2]);
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 5823 "ansi_c_y.tab.cpp"
+    break;
+
+  case 378: /* initializer_opt: %empty  */
+#line 1974 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).make_nil();
+        }
+#line 5832 "ansi_c_y.tab.cpp"
+    break;
+
+  case 379: /* initializer_opt: '=' initializer  */
+#line 1979 "parser.y"
+        { yyval = yyvsp[0]; }
+#line 5838 "ansi_c_y.tab.cpp"
+    break;
+
+  case 381: /* initializer: '{' initializer_list_opt '}'  */
+#line 1990 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyval, ID_initializer_list);
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+        }
+#line 5848 "ansi_c_y.tab.cpp"
+    break;
+
+  case 382: /* initializer: '{' initializer_list ',' '}'  */
+#line 1996 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyval, ID_initializer_list);
+          stack(yyval).operands().swap(stack(yyvsp[-2]).operands());
+        }
+#line 5858 "ansi_c_y.tab.cpp"
+    break;
+
+  case 383: /* initializer_list: designated_initializer  */
+#line 2005 "parser.y"
+        {
+          yyval=yyvsp[0];
+          exprt tmp;
+          tmp.swap(stack(yyval));
+          stack(yyval).clear();
+          stack(yyval).move_to_operands(tmp);
+        }
+#line 5870 "ansi_c_y.tab.cpp"
+    break;
+
+  case 384: /* initializer_list: initializer_list ',' designated_initializer  */
+#line 2013 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 5879 "ansi_c_y.tab.cpp"
+    break;
+
+  case 386: /* initializer_list_opt: %empty  */
+#line 2022 "parser.y"
+        {
+          init(yyval);
+          set(yyval, ID_initializer_list);
+          stack(yyval).operands().clear();
+        }
+#line 5889 "ansi_c_y.tab.cpp"
+    break;
+
+  case 388: /* designated_initializer: designator '=' initializer  */
+#line 2032 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_designated_initializer);
+          stack(yyval).add(ID_designator).swap(stack(yyvsp[-2]));
+          mto(yyval, yyvsp[0]);
+        }
+#line 5900 "ansi_c_y.tab.cpp"
+    break;
+
+  case 389: /* designated_initializer: designator initializer  */
+#line 2040 "parser.y"
+        {
+          init(yyval, ID_designated_initializer);
+          stack(yyval).add(ID_designator).swap(stack(yyvsp[-1]));
+          mto(yyval, yyvsp[0]);
+        }
+#line 5910 "ansi_c_y.tab.cpp"
+    break;
+
+  case 390: /* designated_initializer: member_name ':' initializer  */
+#line 2046 "parser.y"
+        {
+          // yet another GCC speciality
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_designated_initializer);
+          exprt designator;
+          exprt member(ID_member);
+          member.set(ID_component_name, stack(yyvsp[-2]).get(ID_C_base_name));
+          designator.move_to_operands(member);
+          stack(yyval).add(ID_designator).swap(designator);
+          mto(yyval, yyvsp[0]);
+        }
+#line 5926 "ansi_c_y.tab.cpp"
+    break;
+
+  case 391: /* designator: '.' member_name  */
+#line 2061 "parser.y"
+        {
+          init(yyval);
+          stack(yyvsp[-1]).id(ID_member);
+          stack(yyvsp[-1]).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+          mto(yyval, yyvsp[-1]);
+        }
+#line 5937 "ansi_c_y.tab.cpp"
+    break;
+
+  case 392: /* designator: '[' comma_expression ']'  */
+#line 2068 "parser.y"
+        {
+          init(yyval);
+          stack(yyvsp[-2]).id(ID_index);
+          mto(yyvsp[-2], yyvsp[-1]);
+          mto(yyval, yyvsp[-2]);
+        }
+#line 5948 "ansi_c_y.tab.cpp"
+    break;
+
+  case 393: /* designator: '[' comma_expression "..." comma_expression ']'  */
+#line 2075 "parser.y"
+        {
+          // TODO
+          init(yyval);
+          stack(yyvsp[-4]).id(ID_index);
+          mto(yyvsp[-4], yyvsp[-3]);
+          mto(yyval, yyvsp[-4]);
+        }
+#line 5960 "ansi_c_y.tab.cpp"
+    break;
+
+  case 394: /* designator: designator '[' comma_expression ']'  */
+#line 2083 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyvsp[-2]).id(ID_index);
+          mto(yyvsp[-2], yyvsp[-1]);
+          mto(yyval, yyvsp[-2]);
+        }
+#line 5971 "ansi_c_y.tab.cpp"
+    break;
+
+  case 395: /* designator: designator '[' comma_expression "..." comma_expression ']'  */
+#line 2090 "parser.y"
+        {
+          // TODO
+          yyval=yyvsp[-5];
+          stack(yyvsp[-4]).id(ID_index);
+          mto(yyvsp[-4], yyvsp[-3]);
+          mto(yyval, yyvsp[-4]);
+        }
+#line 5983 "ansi_c_y.tab.cpp"
+    break;
+
+  case 396: /* designator: designator '.' member_name  */
+#line 2098 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyvsp[-1]).id(ID_member);
+          stack(yyvsp[-1]).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+          mto(yyval, yyvsp[-1]);
+        }
+#line 5994 "ansi_c_y.tab.cpp"
+    break;
+
+  case 409: /* declaration_statement: declaration  */
+#line 2125 "parser.y"
+        {
+          init(yyval);
+          statement(yyval, ID_decl);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6004 "ansi_c_y.tab.cpp"
+    break;
+
+  case 410: /* labeled_statement: identifier_or_typedef_name ':' gcc_attribute_specifier ';'  */
+#line 2134 "parser.y"
+        {
+          /* Only semicolons permitted after the attribute:
+             https://gcc.gnu.org/onlinedocs/gcc/Label-Attributes.html */
+          yyval=yyvsp[-2];
+          statement(yyval, ID_label);
+          irep_idt identifier=PARSER.lookup_label(stack(yyvsp[-3]).get(ID_C_base_name));
+          stack(yyval).set(ID_label, identifier);
+          // attribute ignored
+          statement(yyvsp[-1], ID_skip);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 6020 "ansi_c_y.tab.cpp"
+    break;
+
+  case 411: /* labeled_statement: identifier_or_typedef_name ':' statement  */
+#line 2146 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          statement(yyval, ID_label);
+          irep_idt identifier=PARSER.lookup_label(stack(yyvsp[-2]).get(ID_C_base_name));
+          stack(yyval).set(ID_label, identifier);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6032 "ansi_c_y.tab.cpp"
+    break;
+
+  case 412: /* labeled_statement: "case" constant_expression ':' statement  */
+#line 2154 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_switch_case);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6043 "ansi_c_y.tab.cpp"
+    break;
+
+  case 413: /* labeled_statement: "case" constant_expression "..." constant_expression ':' statement  */
+#line 2161 "parser.y"
+        {
+          // this is a GCC extension
+          yyval=yyvsp[-5];
+          statement(yyval, ID_gcc_switch_case_range);
+          mto(yyval, yyvsp[-4]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6056 "ansi_c_y.tab.cpp"
+    break;
+
+  case 414: /* labeled_statement: "default" ':' statement  */
+#line 2170 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_switch_case);
+          stack(yyval).operands().push_back(nil_exprt());
+          mto(yyval, yyvsp[0]);
+          stack(yyval).set(ID_default, true);
+        }
+#line 6068 "ansi_c_y.tab.cpp"
+    break;
+
+  case 415: /* compound_statement: compound_scope '{' '}'  */
+#line 2181 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          statement(yyval, ID_block);
+          stack(yyval).set(ID_C_end_location, stack(yyvsp[0]).source_location());
+          PARSER.pop_scope();
+        }
+#line 6079 "ansi_c_y.tab.cpp"
+    break;
+
+  case 416: /* compound_statement: compound_scope '{' statement_list '}'  */
+#line 2188 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_block);
+          stack(yyval).set(ID_C_end_location, stack(yyvsp[0]).source_location());
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+          PARSER.pop_scope();
+        }
+#line 6091 "ansi_c_y.tab.cpp"
+    break;
+
+  case 417: /* compound_statement: compound_scope '{' TOK_ASM_STRING '}'  */
+#line 2196 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_C_end_location, stack(yyvsp[0]).source_location());
+          mto(yyval, yyvsp[-1]);
+          PARSER.pop_scope();
+        }
+#line 6103 "ansi_c_y.tab.cpp"
+    break;
+
+  case 418: /* compound_scope: %empty  */
+#line 2207 "parser.y"
+        {
+          unsigned prefix=++PARSER.current_scope().compound_counter;
+          PARSER.new_scope(i2string(prefix)+"::");
+        }
+#line 6112 "ansi_c_y.tab.cpp"
+    break;
+
+  case 419: /* statement_list: statement  */
+#line 2215 "parser.y"
+        {
+          init(yyval);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6121 "ansi_c_y.tab.cpp"
+    break;
+
+  case 420: /* statement_list: statement_list statement  */
+#line 2220 "parser.y"
+        {
+          mto(yyval, yyvsp[0]);
+        }
+#line 6129 "ansi_c_y.tab.cpp"
+    break;
+
+  case 421: /* expression_statement: comma_expression_opt ';'  */
+#line 2227 "parser.y"
+        {
+          yyval=yyvsp[0];
+
+          if(stack(yyvsp[-1]).is_nil())
+            statement(yyval, ID_skip);
+          else
+          {
+            statement(yyval, ID_expression);
+            mto(yyval, yyvsp[-1]);
+          }
+        }
+#line 6145 "ansi_c_y.tab.cpp"
+    break;
+
+  case 422: /* selection_statement: "if" '(' comma_expression ')' statement  */
+#line 2242 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          statement(yyval, ID_ifthenelse);
+          stack(yyval).operands().reserve(3);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+          stack(yyval).copy_to_operands(nil_exprt());
+        }
+#line 6158 "ansi_c_y.tab.cpp"
+    break;
+
+  case 423: /* selection_statement: "if" '(' comma_expression ')' statement "else" statement  */
+#line 2251 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          statement(yyval, ID_ifthenelse);
+          stack(yyval).operands().reserve(3);
+          mto(yyval, yyvsp[-4]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6171 "ansi_c_y.tab.cpp"
+    break;
+
+  case 424: /* selection_statement: "switch" '(' comma_expression ')' statement  */
+#line 2260 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          statement(yyval, ID_switch);
+          stack(yyval).operands().reserve(2);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6183 "ansi_c_y.tab.cpp"
+    break;
+
+  case 427: /* iteration_statement: "while" '(' comma_expression_opt ')' loop_invariant_opt statement  */
+#line 2277 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          statement(yyval, ID_while);
+          stack(yyval).operands().reserve(2);
+          mto(yyval, yyvsp[-3]);
+          mto(yyval, yyvsp[0]);
+
+          if(stack(yyvsp[-1]).is_not_nil())
+            stack(yyval).add(ID_C_spec_loop_invariant).swap(stack(yyvsp[-1]));
+        }
+#line 6198 "ansi_c_y.tab.cpp"
+    break;
+
+  case 428: /* iteration_statement: "do" statement "while" '(' comma_expression ')' loop_invariant_opt ';'  */
+#line 2289 "parser.y"
+        {
+          yyval=yyvsp[-7];
+          statement(yyval, ID_dowhile);
+          stack(yyval).operands().reserve(2);
+          mto(yyval, yyvsp[-3]);
+          mto(yyval, yyvsp[-6]);
+
+          if(stack(yyvsp[-1]).is_not_nil())
+            stack(yyval).add(ID_C_spec_loop_invariant).swap(stack(yyvsp[-1]));
+        }
+#line 6213 "ansi_c_y.tab.cpp"
+    break;
+
+  case 429: /* $@12: %empty  */
+#line 2300 "parser.y"
+          {
+            // In C99 and upwards, for(;;) has a scope
+            if(PARSER.for_has_scope)
+            {
+              unsigned prefix=++PARSER.current_scope().compound_counter;
+              PARSER.new_scope(i2string(prefix)+"::");
+            }
+          }
+#line 6226 "ansi_c_y.tab.cpp"
+    break;
+
+  case 430: /* iteration_statement: "for" $@12 '(' declaration_or_expression_statement comma_expression_opt ';' comma_expression_opt ')' loop_invariant_opt statement  */
+#line 2313 "parser.y"
+        {
+          yyval=yyvsp[-9];
+          statement(yyval, ID_for);
+          stack(yyval).operands().reserve(4);
+          mto(yyval, yyvsp[-6]);
+          mto(yyval, yyvsp[-5]);
+          mto(yyval, yyvsp[-3]);
+          mto(yyval, yyvsp[0]);
+
+          if(stack(yyvsp[-1]).is_not_nil())
+            stack(yyval).add(ID_C_spec_loop_invariant).swap(stack(yyvsp[-1]));
+
+          if(PARSER.for_has_scope)
+            PARSER.pop_scope(); // remove the C99 for-scope
+        }
+#line 6246 "ansi_c_y.tab.cpp"
+    break;
+
+  case 431: /* jump_statement: "goto" comma_expression ';'  */
+#line 2332 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          if(stack(yyvsp[-1]).id()==ID_symbol)
+          {
+            statement(yyval, ID_goto);
+            irep_idt identifier=PARSER.lookup_label(stack(yyvsp[-1]).get(ID_C_base_name));
+            stack(yyval).set(ID_destination, identifier);
+          }
+          else
+          {
+            // this is a gcc extension.
+            // the original grammar uses identifier_or_typedef_name
+            statement(yyval, ID_gcc_computed_goto);
+            mto(yyval, yyvsp[-1]);
+          }
+        }
+#line 6267 "ansi_c_y.tab.cpp"
+    break;
+
+  case 432: /* jump_statement: "goto" typedef_name ';'  */
+#line 2349 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_goto);
+          irep_idt identifier=PARSER.lookup_label(stack(yyvsp[-1]).get(ID_C_base_name));
+          stack(yyval).set(ID_destination, identifier);
+        }
+#line 6278 "ansi_c_y.tab.cpp"
+    break;
+
+  case 433: /* jump_statement: "continue" ';'  */
+#line 2356 "parser.y"
+        { yyval=yyvsp[-1]; statement(yyval, ID_continue); }
+#line 6284 "ansi_c_y.tab.cpp"
+    break;
+
+  case 434: /* jump_statement: "break" ';'  */
+#line 2358 "parser.y"
+        { yyval=yyvsp[-1]; statement(yyval, ID_break); }
+#line 6290 "ansi_c_y.tab.cpp"
+    break;
+
+  case 435: /* jump_statement: "return" ';'  */
+#line 2360 "parser.y"
+        { yyval=yyvsp[-1]; statement(yyval, ID_return); }
+#line 6296 "ansi_c_y.tab.cpp"
+    break;
+
+  case 436: /* jump_statement: "return" comma_expression ';'  */
+#line 2362 "parser.y"
+        { yyval=yyvsp[-2]; statement(yyval, ID_return); mto(yyval, yyvsp[-1]); }
+#line 6302 "ansi_c_y.tab.cpp"
+    break;
+
+  case 437: /* gcc_local_label_statement: "__label__" gcc_local_label_list ';'  */
+#line 2367 "parser.y"
+        { 
+          yyval=yyvsp[-2];
+          statement(yyval, ID_gcc_local_label);
+          
+          // put these into the scope
+          forall_operands(it, stack(yyvsp[-1]))
+          {
+            // labels have a separate name space
+            irep_idt base_name=it->get(ID_identifier);
+            irep_idt id="label-"+id2string(base_name);
+            ansi_c_parsert::identifiert &i=PARSER.current_scope().name_map[id];
+            i.id_class=ANSI_C_LOCAL_LABEL;
+            i.prefixed_name=PARSER.current_scope().prefix+id2string(id);
+            i.base_name=base_name;
+          }
+
+          stack(yyval).add(ID_label).get_sub().swap((irept::subt&)stack(yyvsp[-1]).operands());
+        }
+#line 6325 "ansi_c_y.tab.cpp"
+    break;
+
+  case 438: /* gcc_local_label_list: gcc_local_label  */
+#line 2389 "parser.y"
+        {
+          init(yyval);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6334 "ansi_c_y.tab.cpp"
+    break;
+
+  case 439: /* gcc_local_label_list: gcc_local_label_list ',' gcc_local_label  */
+#line 2394 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6343 "ansi_c_y.tab.cpp"
+    break;
+
+  case 441: /* gcc_asm_statement: "__asm__ (with parentheses)" volatile_or_goto_opt '(' gcc_asm_commands ')' ';'  */
+#line 2405 "parser.y"
+        { yyval=yyvsp[-5];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_gcc);
+          stack(yyval).operands().swap(stack(yyvsp[-2]).operands());
+        }
+#line 6353 "ansi_c_y.tab.cpp"
+    break;
+
+  case 442: /* gcc_asm_statement: "__asm__ (with parentheses)" volatile_or_goto_opt '{' TOK_ASM_STRING '}'  */
+#line 2411 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_gcc);
+          stack(yyval).operands().resize(5);
+          stack(yyval).op0()=stack(yyvsp[-1]);
+        }
+#line 6365 "ansi_c_y.tab.cpp"
+    break;
+
+  case 443: /* msc_asm_statement: "__asm" '{' TOK_ASM_STRING '}'  */
+#line 2422 "parser.y"
+        { yyval=yyvsp[-3];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_msc);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 6375 "ansi_c_y.tab.cpp"
+    break;
+
+  case 444: /* msc_asm_statement: "__asm" TOK_ASM_STRING  */
+#line 2428 "parser.y"
+        { yyval=yyvsp[-1];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_msc);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6385 "ansi_c_y.tab.cpp"
+    break;
+
+  case 445: /* msc_seh_statement: "__try" compound_statement "__except" '(' comma_expression ')' compound_statement  */
+#line 2438 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          statement(yyval, ID_msc_try_except);
+          mto(yyval, yyvsp[-5]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6397 "ansi_c_y.tab.cpp"
+    break;
+
+  case 446: /* msc_seh_statement: "__try" compound_statement "__finally" compound_statement  */
+#line 2447 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_msc_try_finally);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6408 "ansi_c_y.tab.cpp"
+    break;
+
+  case 447: /* msc_seh_statement: "__leave"  */
+#line 2454 "parser.y"
+        {
+          yyval=yyvsp[0];
+          statement(yyval, ID_msc_leave);
+        }
+#line 6417 "ansi_c_y.tab.cpp"
+    break;
+
+  case 448: /* cprover_exception_statement: "__CPROVER_throw" ';'  */
+#line 2462 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          statement(yyval, ID_CPROVER_throw);
+        }
+#line 6426 "ansi_c_y.tab.cpp"
+    break;
+
+  case 449: /* cprover_exception_statement: "__CPROVER_try" compound_statement "__CPROVER_catch" compound_statement  */
+#line 2468 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_CPROVER_try_catch);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6437 "ansi_c_y.tab.cpp"
+    break;
+
+  case 450: /* cprover_exception_statement: "__CPROVER_try" compound_statement "__CPROVER_finally" compound_statement  */
+#line 2476 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_CPROVER_try_finally);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6448 "ansi_c_y.tab.cpp"
+    break;
+
+  case 456: /* gcc_asm_commands: gcc_asm_assembler_template  */
+#line 2502 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[0]);
+        }
+#line 6458 "ansi_c_y.tab.cpp"
+    break;
+
+  case 457: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs  */
+#line 2508 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-1]);
+          stack(yyval).operands()[1]=stack(yyvsp[0]);
+        }
+#line 6469 "ansi_c_y.tab.cpp"
+    break;
+
+  case 458: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs gcc_asm_inputs  */
+#line 2515 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-2]);
+          stack(yyval).operands()[1]=stack(yyvsp[-1]);
+          stack(yyval).operands()[2]=stack(yyvsp[0]);
+        }
+#line 6481 "ansi_c_y.tab.cpp"
+    break;
+
+  case 459: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs gcc_asm_inputs gcc_asm_clobbered_registers  */
+#line 2523 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-3]);
+          stack(yyval).operands()[1]=stack(yyvsp[-2]);
+          stack(yyval).operands()[2]=stack(yyvsp[-1]);
+          stack(yyval).operands()[3]=stack(yyvsp[0]);
+        }
+#line 6494 "ansi_c_y.tab.cpp"
+    break;
+
+  case 460: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs gcc_asm_inputs gcc_asm_clobbered_registers gcc_asm_labels  */
+#line 2532 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-4]);
+          stack(yyval).operands()[1]=stack(yyvsp[-3]);
+          stack(yyval).operands()[2]=stack(yyvsp[-2]);
+          stack(yyval).operands()[3]=stack(yyvsp[-1]);
+          stack(yyval).operands()[4]=stack(yyvsp[0]);
+        }
+#line 6508 "ansi_c_y.tab.cpp"
+    break;
+
+  case 462: /* gcc_asm_outputs: ':' gcc_asm_output_list  */
+#line 2548 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6516 "ansi_c_y.tab.cpp"
+    break;
+
+  case 464: /* gcc_asm_output: string '(' comma_expression ')'  */
+#line 2556 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_output);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6526 "ansi_c_y.tab.cpp"
+    break;
+
+  case 465: /* gcc_asm_output: '[' identifier_or_typedef_name ']' string '(' comma_expression ')'  */
+#line 2563 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_output);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6536 "ansi_c_y.tab.cpp"
+    break;
+
+  case 466: /* gcc_asm_output_list: gcc_asm_output  */
+#line 2572 "parser.y"
+        {
+          init(yyval, irep_idt());
+          mto(yyval, yyvsp[0]);
+        }
+#line 6545 "ansi_c_y.tab.cpp"
+    break;
+
+  case 467: /* gcc_asm_output_list: gcc_asm_output_list ',' gcc_asm_output  */
+#line 2577 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6554 "ansi_c_y.tab.cpp"
+    break;
+
+  case 468: /* gcc_asm_inputs: ':' gcc_asm_input_list  */
+#line 2585 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6562 "ansi_c_y.tab.cpp"
+    break;
+
+  case 470: /* gcc_asm_input: string '(' comma_expression ')'  */
+#line 2593 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_input);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6572 "ansi_c_y.tab.cpp"
+    break;
+
+  case 471: /* gcc_asm_input: '[' identifier_or_typedef_name ']' string '(' comma_expression ')'  */
+#line 2600 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_input);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6582 "ansi_c_y.tab.cpp"
+    break;
+
+  case 472: /* gcc_asm_input_list: gcc_asm_input  */
+#line 2609 "parser.y"
+        {
+          init(yyval, irep_idt());
+          mto(yyval, yyvsp[0]);
+        }
+#line 6591 "ansi_c_y.tab.cpp"
+    break;
+
+  case 473: /* gcc_asm_input_list: gcc_asm_input_list ',' gcc_asm_input  */
+#line 2614 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6600 "ansi_c_y.tab.cpp"
+    break;
+
+  case 474: /* gcc_asm_clobbered_registers: ':' gcc_asm_clobbered_registers_list  */
+#line 2622 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6608 "ansi_c_y.tab.cpp"
+    break;
+
+  case 476: /* gcc_asm_clobbered_register: string  */
+#line 2630 "parser.y"
+        {
+          init(yyval, ID_gcc_asm_clobbered_register);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6617 "ansi_c_y.tab.cpp"
+    break;
+
+  case 477: /* gcc_asm_clobbered_registers_list: gcc_asm_clobbered_register  */
+#line 2638 "parser.y"
+        {
+          init(yyval, irep_idt());
+          mto(yyval, yyvsp[0]);
+        }
+#line 6626 "ansi_c_y.tab.cpp"
+    break;
+
+  case 478: /* gcc_asm_clobbered_registers_list: gcc_asm_clobbered_registers_list ',' gcc_asm_clobbered_register  */
+#line 2643 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6635 "ansi_c_y.tab.cpp"
+    break;
+
+  case 479: /* gcc_asm_labels: ':' gcc_asm_labels_list  */
+#line 2651 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6643 "ansi_c_y.tab.cpp"
+    break;
+
+  case 481: /* gcc_asm_labels_list: gcc_asm_label  */
+#line 2659 "parser.y"
+        {
+          init(yyval);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6652 "ansi_c_y.tab.cpp"
+    break;
+
+  case 482: /* gcc_asm_labels_list: gcc_asm_labels_list ',' gcc_asm_label  */
+#line 2664 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6661 "ansi_c_y.tab.cpp"
+    break;
+
+  case 483: /* gcc_asm_label: gcc_local_label  */
+#line 2672 "parser.y"
+        {
+          yyval=yyvsp[0];
+          irep_idt identifier=PARSER.lookup_label(stack(yyval).get(ID_C_base_name));
+          stack(yyval).id(ID_label);
+          stack(yyval).set(ID_identifier, identifier);
+        }
+#line 6672 "ansi_c_y.tab.cpp"
+    break;
+
+  case 488: /* external_definition: function_definition  */
+#line 2691 "parser.y"
+        {
+          // put into global list of items
+          PARSER.copy_item(to_ansi_c_declaration(stack(yyvsp[0])));
+        }
+#line 6681 "ansi_c_y.tab.cpp"
+    break;
+
+  case 489: /* external_definition: declaration  */
+#line 2696 "parser.y"
+        {
+          PARSER.copy_item(to_ansi_c_declaration(stack(yyvsp[0])));
+        }
+#line 6689 "ansi_c_y.tab.cpp"
+    break;
+
+  case 492: /* asm_definition: "__asm__ (with parentheses)" '(' string ')' ';'  */
+#line 2705 "parser.y"
+        {
+          // Not obvious what to do with this.
+        }
+#line 6697 "ansi_c_y.tab.cpp"
+    break;
+
+  case 493: /* function_definition: function_head requires_opt ensures_opt function_body  */
+#line 2715 "parser.y"
+        {
+          if(stack(yyvsp[-2]).is_not_nil())
+            stack(yyvsp[-3]).add(ID_C_spec_requires).swap(stack(yyvsp[-2]));
+          if(stack(yyvsp[-1]).is_not_nil())
+            stack(yyvsp[-3]).add(ID_C_spec_ensures).swap(stack(yyvsp[-1]));
+          // The head is a declaration with one declarator,
+          // and the body becomes the 'value'.
+          yyval=yyvsp[-3];
+          ansi_c_declarationt &ansi_c_declaration=
+            to_ansi_c_declaration(stack(yyval));
+            
+          assert(ansi_c_declaration.declarators().size()==1);
+          ansi_c_declaration.add_initializer(stack(yyvsp[0]));
+          
+          // Kill the scope that 'function_head' creates.
+          PARSER.pop_scope();
+          
+          // We are no longer in any function.
+          PARSER.set_function(irep_idt());
+        }
+#line 6722 "ansi_c_y.tab.cpp"
+    break;
+
+  case 495: /* KnR_parameter_header_opt: %empty  */
+#line 2743 "parser.y"
+        {
+          init(yyval);
+        }
+#line 6730 "ansi_c_y.tab.cpp"
+    break;
+
+  case 497: /* KnR_parameter_header: KnR_parameter_declaration  */
+#line 2751 "parser.y"
+        {
+          init(yyval, ID_decl_block);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6739 "ansi_c_y.tab.cpp"
+    break;
+
+  case 498: /* KnR_parameter_header: KnR_parameter_header KnR_parameter_declaration  */
+#line 2756 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6748 "ansi_c_y.tab.cpp"
+    break;
+
+  case 501: /* KnR_declaration_qualifier_list: type_qualifier storage_class  */
+#line 2770 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 6756 "ansi_c_y.tab.cpp"
+    break;
+
+  case 502: /* KnR_declaration_qualifier_list: KnR_declaration_qualifier_list declaration_qualifier  */
+#line 2774 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 6764 "ansi_c_y.tab.cpp"
+    break;
+
+  case 503: /* KnR_basic_declaration_specifier: KnR_declaration_qualifier_list basic_type_name gcc_type_attribute_opt  */
+#line 2781 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6772 "ansi_c_y.tab.cpp"
+    break;
+
+  case 504: /* KnR_basic_declaration_specifier: basic_type_specifier storage_class gcc_type_attribute_opt  */
+#line 2785 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6780 "ansi_c_y.tab.cpp"
+    break;
+
+  case 505: /* KnR_basic_declaration_specifier: KnR_basic_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 2789 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6788 "ansi_c_y.tab.cpp"
+    break;
+
+  case 506: /* KnR_basic_declaration_specifier: KnR_basic_declaration_specifier basic_type_name gcc_type_attribute_opt  */
+#line 2793 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6796 "ansi_c_y.tab.cpp"
+    break;
+
+  case 507: /* KnR_typedef_declaration_specifier: typedef_type_specifier storage_class gcc_type_attribute_opt  */
+#line 2801 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6804 "ansi_c_y.tab.cpp"
+    break;
+
+  case 508: /* KnR_typedef_declaration_specifier: KnR_declaration_qualifier_list typedef_name gcc_type_attribute_opt  */
+#line 2805 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6812 "ansi_c_y.tab.cpp"
+    break;
+
+  case 509: /* KnR_typedef_declaration_specifier: KnR_typedef_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 2809 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6820 "ansi_c_y.tab.cpp"
+    break;
+
+  case 510: /* KnR_sue_declaration_specifier: KnR_declaration_qualifier_list aggregate_key identifier_or_typedef_name gcc_type_attribute_opt  */
+#line 2817 "parser.y"
+        {
+          stack(yyvsp[-2]).set(ID_tag, stack(yyvsp[-1]));
+          yyval=merge(yyvsp[-3], merge(yyvsp[-2], yyvsp[0]));
+        }
+#line 6829 "ansi_c_y.tab.cpp"
+    break;
+
+  case 511: /* KnR_sue_declaration_specifier: KnR_declaration_qualifier_list enum_key identifier_or_typedef_name gcc_type_attribute_opt  */
+#line 2822 "parser.y"
+        {
+          stack(yyvsp[-2]).id(ID_c_enum_tag);
+          stack(yyvsp[-2]).set(ID_tag, stack(yyvsp[-1]));
+          yyval=merge(yyvsp[-3], merge(yyvsp[-2], yyvsp[0]));
+        }
+#line 6839 "ansi_c_y.tab.cpp"
+    break;
+
+  case 515: /* KnR_parameter_declaring_list: KnR_declaration_specifier declarator  */
+#line 2838 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 6849 "ansi_c_y.tab.cpp"
+    break;
+
+  case 516: /* KnR_parameter_declaring_list: type_specifier declarator  */
+#line 2844 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 6859 "ansi_c_y.tab.cpp"
+    break;
+
+  case 517: /* KnR_parameter_declaring_list: KnR_parameter_declaring_list ',' declarator  */
+#line 2850 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 6868 "ansi_c_y.tab.cpp"
+    break;
+
+  case 518: /* function_head: identifier_declarator  */
+#line 2858 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          irept return_type(ID_int);
+          stack(yyval).type().swap(return_type);
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6880 "ansi_c_y.tab.cpp"
+    break;
+
+  case 519: /* function_head: declaration_specifier declarator  */
+#line 2866 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6891 "ansi_c_y.tab.cpp"
+    break;
+
+  case 520: /* function_head: type_specifier declarator  */
+#line 2873 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6902 "ansi_c_y.tab.cpp"
+    break;
+
+  case 521: /* function_head: declaration_qualifier_list identifier_declarator  */
+#line 2880 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6913 "ansi_c_y.tab.cpp"
+    break;
+
+  case 522: /* function_head: type_qualifier_list identifier_declarator  */
+#line 2887 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6924 "ansi_c_y.tab.cpp"
+    break;
+
+  case 526: /* paren_attribute_declarator: '(' gcc_type_attribute_list identifier_declarator ')'  */
+#line 2903 "parser.y"
+        {
+          stack_type(yyvsp[-3])=typet(ID_abstract);
+          yyvsp[-2]=merge(yyvsp[-2], yyvsp[-3]); // dest=$2
+          make_subtype(yyvsp[-1], yyvsp[-2]); // dest=$3
+          yyval=yyvsp[-1];
+        }
+#line 6935 "ansi_c_y.tab.cpp"
+    break;
+
+  case 527: /* paren_attribute_declarator: '(' gcc_type_attribute_list identifier_declarator ')' postfixing_abstract_declarator  */
+#line 2910 "parser.y"
+        {
+          stack_type(yyvsp[-4])=typet(ID_abstract);
+          yyvsp[-3]=merge(yyvsp[-3], yyvsp[-4]); // dest=$2
+          make_subtype(yyvsp[-2], yyvsp[-3]); // dest=$3
+          /* note: this is (a pointer to) a function ($5) */
+          /* or an array ($5) with name ($3) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 6949 "ansi_c_y.tab.cpp"
+    break;
+
+  case 528: /* paren_attribute_declarator: '*' paren_attribute_declarator  */
+#line 2920 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 6958 "ansi_c_y.tab.cpp"
+    break;
+
+  case 532: /* parameter_typedef_declarator: typedef_name postfixing_abstract_declarator  */
+#line 2934 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 6967 "ansi_c_y.tab.cpp"
+    break;
+
+  case 535: /* clean_typedef_declarator: '*' parameter_typedef_declarator  */
+#line 2944 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 6976 "ansi_c_y.tab.cpp"
+    break;
+
+  case 536: /* clean_typedef_declarator: '*' attribute_type_qualifier_list parameter_typedef_declarator  */
+#line 2949 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+          do_pointer(yyvsp[-2], yyvsp[-1]);
+        }
+#line 6985 "ansi_c_y.tab.cpp"
+    break;
+
+  case 537: /* clean_postfix_typedef_declarator: '(' clean_typedef_declarator ')'  */
+#line 2957 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 6991 "ansi_c_y.tab.cpp"
+    break;
+
+  case 538: /* clean_postfix_typedef_declarator: '(' clean_typedef_declarator ')' postfixing_abstract_declarator  */
+#line 2959 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          /* or an array ($4)! */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7002 "ansi_c_y.tab.cpp"
+    break;
+
+  case 540: /* paren_typedef_declarator: '*' '(' simple_paren_typedef_declarator ')'  */
+#line 2970 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          do_pointer(yyvsp[-3], yyvsp[-1]);
+        }
+#line 7011 "ansi_c_y.tab.cpp"
+    break;
+
+  case 541: /* paren_typedef_declarator: '*' attribute_type_qualifier_list '(' simple_paren_typedef_declarator ')'  */
+#line 2975 "parser.y"
+        {
+          // not sure where the type qualifiers belong
+          yyval=merge(yyvsp[-3], yyvsp[-1]);
+          do_pointer(yyvsp[-4], yyvsp[-3]);
+        }
+#line 7021 "ansi_c_y.tab.cpp"
+    break;
+
+  case 542: /* paren_typedef_declarator: '*' paren_typedef_declarator  */
+#line 2981 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7030 "ansi_c_y.tab.cpp"
+    break;
+
+  case 543: /* paren_typedef_declarator: '*' attribute_type_qualifier_list paren_typedef_declarator  */
+#line 2986 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+          do_pointer(yyvsp[-2], yyvsp[-1]);
+        }
+#line 7039 "ansi_c_y.tab.cpp"
+    break;
+
+  case 544: /* paren_postfix_typedef_declarator: '(' paren_typedef_declarator ')'  */
+#line 2994 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7045 "ansi_c_y.tab.cpp"
+    break;
+
+  case 545: /* paren_postfix_typedef_declarator: '(' simple_paren_typedef_declarator postfixing_abstract_declarator ')'  */
+#line 2996 "parser.y"
+        {        /* note: this is a function ($3) with a typedef name ($2) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[-1]);
+        }
+#line 7054 "ansi_c_y.tab.cpp"
+    break;
+
+  case 546: /* paren_postfix_typedef_declarator: '(' paren_typedef_declarator ')' postfixing_abstract_declarator  */
+#line 3001 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          /* or an array ($4)! */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7065 "ansi_c_y.tab.cpp"
+    break;
+
+  case 548: /* simple_paren_typedef_declarator: '(' simple_paren_typedef_declarator ')'  */
+#line 3012 "parser.y"
+        { yyval=yyvsp[-1]; }
+#line 7071 "ansi_c_y.tab.cpp"
+    break;
+
+  case 552: /* unary_identifier_declarator: '*' identifier_declarator  */
+#line 3023 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7080 "ansi_c_y.tab.cpp"
+    break;
+
+  case 553: /* unary_identifier_declarator: '^' identifier_declarator  */
+#line 3028 "parser.y"
+        {
+          // This is an Apple extension to C/C++/Objective C.
+          // http://en.wikipedia.org/wiki/Blocks_(C_language_extension)
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7091 "ansi_c_y.tab.cpp"
+    break;
+
+  case 554: /* unary_identifier_declarator: '*' attribute_type_qualifier_list identifier_declarator  */
+#line 3035 "parser.y"
+        {
+          // the type_qualifier_list is for the pointer,
+          // and not the identifier_declarator
+          stack_type(yyvsp[-2]).id(ID_pointer);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]); // dest=$2
+          make_subtype(yyvsp[0], yyvsp[-1]); // dest=$3
+          yyval=yyvsp[0];
+        }
+#line 7105 "ansi_c_y.tab.cpp"
+    break;
+
+  case 555: /* postfix_identifier_declarator: paren_identifier_declarator postfixing_abstract_declarator  */
+#line 3048 "parser.y"
+        {
+          /* note: this is a function or array ($2) with name ($1) */
+          yyval=yyvsp[-1];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7115 "ansi_c_y.tab.cpp"
+    break;
+
+  case 556: /* postfix_identifier_declarator: '(' unary_identifier_declarator ')'  */
+#line 3054 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7121 "ansi_c_y.tab.cpp"
+    break;
+
+  case 557: /* postfix_identifier_declarator: '(' unary_identifier_declarator ')' postfixing_abstract_declarator  */
+#line 3056 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          /* or an array ($4)! */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7132 "ansi_c_y.tab.cpp"
+    break;
+
+  case 558: /* paren_identifier_declarator: identifier  */
+#line 3066 "parser.y"
+        {
+          // We remember the last declarator for the benefit
+          // of function argument scoping.
+          PARSER.current_scope().last_declarator=
+            stack(yyvsp[0]).get(ID_identifier);
+        }
+#line 7143 "ansi_c_y.tab.cpp"
+    break;
+
+  case 559: /* paren_identifier_declarator: '(' paren_identifier_declarator ')'  */
+#line 3073 "parser.y"
+        { yyval=yyvsp[-1]; }
+#line 7149 "ansi_c_y.tab.cpp"
+    break;
+
+  case 566: /* postfixing_abstract_declarator: '(' ')' KnR_parameter_header  */
+#line 3093 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyval, ID_code);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_parameters);
+          stack_type(yyval).set(ID_C_KnR, true);
+        }
+#line 7161 "ansi_c_y.tab.cpp"
+    break;
+
+  case 567: /* $@13: %empty  */
+#line 3101 "parser.y"
+          {
+            // Use last declarator (i.e., function name) to name
+            // the scope.
+            PARSER.new_scope(
+              id2string(PARSER.current_scope().last_declarator)+"::");
+          }
+#line 7172 "ansi_c_y.tab.cpp"
+    break;
+
+  case 568: /* postfixing_abstract_declarator: '(' $@13 KnR_parameter_list ')' KnR_parameter_header_opt  */
+#line 3110 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          set(yyval, ID_code);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_parameters).get_sub().
+            swap((irept::subt &)(stack_type(yyvsp[-2]).subtypes()));
+          PARSER.pop_scope();
+          adjust_KnR_parameters(stack(yyval).add(ID_parameters), stack(yyvsp[0]));
+          stack(yyval).set(ID_C_KnR, true);
+        }
+#line 7187 "ansi_c_y.tab.cpp"
+    break;
+
+  case 570: /* parameter_postfixing_abstract_declarator: '(' ')'  */
+#line 3125 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          set(yyval, ID_code);
+          stack_type(yyval).add(ID_parameters);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7198 "ansi_c_y.tab.cpp"
+    break;
+
+  case 571: /* $@14: %empty  */
+#line 3132 "parser.y"
+          {
+            // Use last declarator (i.e., function name) to name
+            // the scope.
+            PARSER.new_scope(
+              id2string(PARSER.current_scope().last_declarator)+"::");
+          }
+#line 7209 "ansi_c_y.tab.cpp"
+    break;
+
+  case 572: /* parameter_postfixing_abstract_declarator: '(' $@14 parameter_type_list ')' KnR_parameter_header_opt  */
+#line 3140 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          set(yyval, ID_code);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_parameters).get_sub().
+            swap((irept::subt &)(stack_type(yyvsp[-2]).subtypes()));
+          PARSER.pop_scope();
+
+          if(stack(yyvsp[0]).is_not_nil())
+          {
+            adjust_KnR_parameters(stack(yyval).add(ID_parameters), stack(yyvsp[0]));
+            stack(yyval).set(ID_C_KnR, true);
+          }
+        }
+#line 7228 "ansi_c_y.tab.cpp"
+    break;
+
+  case 573: /* array_abstract_declarator: '[' ']'  */
+#line 3158 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          set(yyval, ID_array);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_size).make_nil();
+        }
+#line 7239 "ansi_c_y.tab.cpp"
+    break;
+
+  case 574: /* array_abstract_declarator: '[' attribute_type_qualifier_storage_class_list ']'  */
+#line 3165 "parser.y"
+        {
+          // this is C99: e.g., restrict, const, etc
+          // The type qualifier belongs to the array, not the
+          // contents of the array, nor the size.
+          set(yyvsp[-2], ID_array);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          stack_type(yyvsp[-2]).add(ID_size).make_nil();
+          yyval=merge(yyvsp[-1], yyvsp[-2]);
+        }
+#line 7253 "ansi_c_y.tab.cpp"
+    break;
+
+  case 575: /* array_abstract_declarator: '[' '*' ']'  */
+#line 3175 "parser.y"
+        {
+          // these should be allowed in prototypes only
+          yyval=yyvsp[-2];
+          set(yyval, ID_array);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_size).make_nil();
+        }
+#line 7265 "ansi_c_y.tab.cpp"
+    break;
+
+  case 576: /* array_abstract_declarator: '[' constant_expression ']'  */
+#line 3183 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyval, ID_array);
+          stack_type(yyval).add(ID_size).swap(stack(yyvsp[-1]));
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7276 "ansi_c_y.tab.cpp"
+    break;
+
+  case 577: /* array_abstract_declarator: '[' attribute_type_qualifier_storage_class_list constant_expression ']'  */
+#line 3190 "parser.y"
+        {
+          // The type qualifier belongs to the array, not the
+          // contents of the array, nor the size.
+          set(yyvsp[-3], ID_array);
+          stack_type(yyvsp[-3]).add(ID_size).swap(stack(yyvsp[-1]));
+          stack_type(yyvsp[-3]).subtype()=typet(ID_abstract);
+          yyval=merge(yyvsp[-2], yyvsp[-3]); // dest=$2
+        }
+#line 7289 "ansi_c_y.tab.cpp"
+    break;
+
+  case 578: /* array_abstract_declarator: array_abstract_declarator '[' constant_expression ']'  */
+#line 3199 "parser.y"
+        {
+          // we need to push this down
+          yyval=yyvsp[-3];
+          set(yyvsp[-2], ID_array);
+          stack_type(yyvsp[-2]).add(ID_size).swap(stack(yyvsp[-1]));
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          make_subtype(yyvsp[-3], yyvsp[-2]);
+        }
+#line 7302 "ansi_c_y.tab.cpp"
+    break;
+
+  case 579: /* array_abstract_declarator: array_abstract_declarator '[' '*' ']'  */
+#line 3208 "parser.y"
+        {
+          // these should be allowed in prototypes only
+          // we need to push this down
+          yyval=yyvsp[-3];
+          set(yyvsp[-2], ID_array);
+          stack_type(yyvsp[-2]).add(ID_size).make_nil();
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          make_subtype(yyvsp[-3], yyvsp[-2]);
+        }
+#line 7316 "ansi_c_y.tab.cpp"
+    break;
+
+  case 580: /* unary_abstract_declarator: '*'  */
+#line 3221 "parser.y"
+        {
+          yyval=yyvsp[0];
+          set(yyval, ID_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7326 "ansi_c_y.tab.cpp"
+    break;
+
+  case 581: /* unary_abstract_declarator: '*' attribute_type_qualifier_list  */
+#line 3227 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the (missing) abstract declarator.
+          set(yyvsp[-1], ID_pointer);
+          stack_type(yyvsp[-1]).subtype()=typet(ID_abstract);
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 7338 "ansi_c_y.tab.cpp"
+    break;
+
+  case 582: /* unary_abstract_declarator: '*' abstract_declarator  */
+#line 3235 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7347 "ansi_c_y.tab.cpp"
+    break;
+
+  case 583: /* unary_abstract_declarator: '*' attribute_type_qualifier_list abstract_declarator  */
+#line 3240 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the abstract declarator.
+          stack_type(yyvsp[-2]).id(ID_pointer);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]); // dest=$2
+          make_subtype(yyvsp[0], yyvsp[-1]); // dest=$3
+          yyval=yyvsp[0];
+        }
+#line 7361 "ansi_c_y.tab.cpp"
+    break;
+
+  case 584: /* unary_abstract_declarator: '^'  */
+#line 3250 "parser.y"
+        {
+          // This is an Apple extension to C/C++/Objective C.
+          // http://en.wikipedia.org/wiki/Blocks_(C_language_extension)
+          yyval=yyvsp[0];
+          set(yyval, ID_block_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7373 "ansi_c_y.tab.cpp"
+    break;
+
+  case 585: /* parameter_unary_abstract_declarator: '*'  */
+#line 3261 "parser.y"
+        {
+          yyval=yyvsp[0];
+          set(yyval, ID_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7383 "ansi_c_y.tab.cpp"
+    break;
+
+  case 586: /* parameter_unary_abstract_declarator: '*' attribute_type_qualifier_list  */
+#line 3267 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the (missing) abstract declarator.
+          set(yyvsp[-1], ID_pointer);
+          stack_type(yyvsp[-1]).subtype()=typet(ID_abstract);
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 7395 "ansi_c_y.tab.cpp"
+    break;
+
+  case 587: /* parameter_unary_abstract_declarator: '*' parameter_abstract_declarator  */
+#line 3275 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7404 "ansi_c_y.tab.cpp"
+    break;
+
+  case 588: /* parameter_unary_abstract_declarator: '*' attribute_type_qualifier_list parameter_abstract_declarator  */
+#line 3280 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the (missing) abstract declarator.
+          stack(yyvsp[-2]).id(ID_pointer);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]); // dest=$2
+          make_subtype(yyvsp[0], yyvsp[-1]); // dest=$3
+          yyval=yyvsp[0];
+        }
+#line 7418 "ansi_c_y.tab.cpp"
+    break;
+
+  case 589: /* parameter_unary_abstract_declarator: '^'  */
+#line 3290 "parser.y"
+        {
+          // This is an Apple extension to C/C++/Objective C.
+          // http://en.wikipedia.org/wiki/Blocks_(C_language_extension)
+          yyval=yyvsp[0];
+          set(yyval, ID_block_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7430 "ansi_c_y.tab.cpp"
+    break;
+
+  case 590: /* postfix_abstract_declarator: '(' unary_abstract_declarator ')'  */
+#line 3301 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7436 "ansi_c_y.tab.cpp"
+    break;
+
+  case 591: /* postfix_abstract_declarator: '(' postfix_abstract_declarator ')'  */
+#line 3303 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7442 "ansi_c_y.tab.cpp"
+    break;
+
+  case 592: /* postfix_abstract_declarator: '(' postfixing_abstract_declarator ')'  */
+#line 3305 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7448 "ansi_c_y.tab.cpp"
+    break;
+
+  case 593: /* postfix_abstract_declarator: '(' postfix_abstract_declarator ')' postfixing_abstract_declarator  */
+#line 3307 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function or array ($4) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7458 "ansi_c_y.tab.cpp"
+    break;
+
+  case 594: /* postfix_abstract_declarator: '(' unary_abstract_declarator ')' postfixing_abstract_declarator  */
+#line 3313 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function or array ($4) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7468 "ansi_c_y.tab.cpp"
+    break;
+
+  case 595: /* parameter_postfix_abstract_declarator: '(' parameter_unary_abstract_declarator ')'  */
+#line 3322 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7474 "ansi_c_y.tab.cpp"
+    break;
+
+  case 596: /* parameter_postfix_abstract_declarator: '(' parameter_postfix_abstract_declarator ')'  */
+#line 3324 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7480 "ansi_c_y.tab.cpp"
+    break;
+
+  case 598: /* parameter_postfix_abstract_declarator: '(' parameter_unary_abstract_declarator ')' parameter_postfixing_abstract_declarator  */
+#line 3327 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7490 "ansi_c_y.tab.cpp"
+    break;
+
+
+#line 7494 "ansi_c_y.tab.cpp"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 3334 "parser.y"
+
@@ -0,0 +1,267 @@
+/* generated by minflex from scanner.l */
+#define yylex yyassemblerlex
+#define yytext yyassemblertext
+#define yyleng yyassemblerleng
+#define yyin yyassemblerin
+#define yyout yyassemblerout
+#define yywrap yyassemblerwrap
+#define yyrestart yyassemblerrestart
+#define yylineno yyassemblerlineno
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#define YY_NULL 0
+#define INITIAL 0
+#define GRAMMAR 1
+#define LINE_COMMENT 2
+extern char *yytext;
+extern int yyleng;
+extern FILE *yyin, *yyout;
+static int yy_start=0;
+#define BEGIN yy_start=
+#define YY_START yy_start
+#define YYSTATE YY_START
+static void yy_flush_buffer_();
+#define YY_FLUSH_BUFFER yy_flush_buffer_()
+static void yy_less_(int n);
+#define yyless(n) yy_less_(n)
+#define ECHO do { if(fwrite(yytext, (size_t)yyleng, 1, yyout)) {} } while(0)
+#define yyterminate() return YY_NULL
+#define YY_BREAK break;
+int yywrap();
+#line 1 "scanner.l"
+
+#ifdef _WIN32
+#define YY_NO_UNISTD_H
+static int isatty(int) { return 0; }
+#endif
+
+#define PARSER assembler_parser
+#define YYSTYPE unsigned
+#undef  ECHO
+#define ECHO
+
+#include "assembler_parser.h"
+
+/*** macros for easier rule definition **********************************/
+void assemlber_scanner_init()
+{
+  YY_FLUSH_BUFFER;
+  BEGIN(0);
+}
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) \
+  do { result=(int)fread(buf, 1, max_size, yyin); } while(0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+char *yytext;
+int yyleng;
+FILE *yyin, *yyout;
+static const unsigned short yy_ec[256]={0,0,0,0,0,0,0,0,1,1,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,4,5,0,0,0,0,0,0,0,0,0,6,0,7,7,7,7,7,7,7,7,7,7,0,8,9,0,10,0,0,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,0,12,0,0,13,0,14,15,15,16,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,17,15,15,15,15,15,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+static const int yy_nxt[35][18]={
+{3,3,4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+{6,7,18,8,9,10,11,6,12,5,13,14,15,16,17,17,17,17},
+{19,19,20,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,21,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,29,24},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,31,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{19,19,-1,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,32,24,24,24},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,33},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,34,24,24,24},
+{-1,-1,-1,-1,-1,27,28,25,-1,-1,-1,23,-1,26,24,24,24,24},
+};
+static const int yy_accept[35]={-1,8,3,0,0,12,12,6,4,1,9,9,5,12,9,12,9,9,4,3,2,11,6,9,9,9,9,9,9,9,10,4,9,9,7};
+static const unsigned char yy_live[35]={1,1,1,0,0,1,0,1,0,0,1,1,0,1,1,1,1,1,0,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1};
+static const int yy_sc_start[3]={0,1,2};
+
+static std::vector<char> yy_buf(16384);
+static size_t yy_pos=0, yy_end=0; // unconsumed text is [yy_pos, yy_end)
+static char yy_hold=0;
+static bool yy_held=false;
+static std::vector<int> yy_state_stack;
+
+static void yy_unhold()
+{
+  if(yy_held) { yy_buf[yy_pos]=yy_hold; yy_held=false; }
+}
+
+static void yy_flush_buffer_()
+{
+  yy_unhold();
+  yy_pos=yy_end=0;
+}
+
+static void yy_less_(int n)
+{
+  size_t start=yytext-yy_buf.data();
+  yy_unhold();
+  yy_pos=start+n;
+  yy_hold=yy_buf[yy_pos];
+  yy_held=true;
+  yy_buf[yy_pos]=0;
+  yyleng=n;
+}
+
+// read more input; returns false at end of input
+static bool yy_fill()
+{
+  if(yy_pos>0)
+  {
+    std::memmove(yy_buf.data(), yy_buf.data()+yy_pos, yy_end-yy_pos);
+    yy_end-=yy_pos;
+    yy_pos=0;
+  }
+  if(yy_buf.size()-yy_end<8194)
+    yy_buf.resize(yy_buf.size()*2+8194);
+  if(yyin==nullptr) yyin=stdin;
+  int result;
+  char *buf=yy_buf.data()+yy_end;
+  YY_INPUT(buf, result, 8192);
+  if(result<=0)
+    return false;
+  yy_end+=result;
+  return true;
+}
+
+int yylex()
+{
+  if(yyout==nullptr) yyout=stdout;
+  for(;;)
+  {
+    yy_unhold();
+    int state=yy_sc_start[yy_start];
+    size_t cp=yy_pos, last_pos=0;
+    int rule=-1;
+    for(;;)
+    {
+      if(cp==yy_end)
+      {
+        if(!yy_live[state]) break;
+        size_t off=yy_pos;
+        if(!yy_fill()) break;
+        cp-=off; last_pos-=off;
+      }
+      int n=yy_nxt[state][yy_ec[(unsigned char)yy_buf[cp]]];
+      if(n<0) break;
+      state=n; cp++;
+      if(yy_accept[state]>=0) { rule=yy_accept[state]; last_pos=cp; }
+    }
+    if(rule<0)
+    {
+      if(yy_pos==yy_end)
+      {
+        if(yywrap())
+        {
+          yytext=yy_buf.data()+yy_pos; yyleng=0;
+          switch(yy_start)
+          {
+          case 0:
+            { yyterminate(); /* done! */ }
+            break;
+          case 1:
+            { yyterminate(); /* done! */ }
+            break;
+          case 2:
+            { yyterminate(); /* done! */ }
+            break;
+          default:
+            yyterminate();
+          }
+          return YY_NULL;
+        }
+        continue;
+      }
+      // default rule
+      last_pos=yy_pos+1;
+    }
+    yytext=yy_buf.data()+yy_pos;
+    yyleng=(int)(last_pos-yy_pos);
+    yy_pos=last_pos;
+    yy_hold=yy_buf[yy_pos]; yy_held=true; yy_buf[yy_pos]=0;
+    YY_USER_ACTION
+    switch(rule)
+    {
+    case 0:
+{ BEGIN(GRAMMAR);
+                  yyless(0); /* start again with this character */
+                }
+    YY_BREAK
+    case 1:
+{ PARSER.new_instruction(); BEGIN(LINE_COMMENT); } /* begin comment state */
+    YY_BREAK
+    case 2:
+{ BEGIN(GRAMMAR); } /* end comment state, back GRAMMAR */
+    YY_BREAK
+    case 3:
+{ } /* all characters within comments are ignored */
+    YY_BREAK
+    case 4:
+{ PARSER.new_instruction(); }
+    YY_BREAK
+    case 5:
+{ PARSER.new_instruction(); }
+    YY_BREAK
+    case 6:
+{ } /* skipped */
+    YY_BREAK
+    case 7:
+{ }
+    YY_BREAK
+    case 8:
+{ /* ignore */ }
+    YY_BREAK
+    case 9:
+{ irept identifier(ID_symbol);
+                  identifier.set(ID_identifier, yytext);
+                  PARSER.add_token(identifier);
+                }
+    YY_BREAK
+    case 10:
+{ PARSER.add_token(irept(ID_shr)); }
+    YY_BREAK
+    case 11:
+{ PARSER.add_token(irept(ID_shl)); }
+    YY_BREAK
+    case 12:
+{ std::string s;
+                  s+=yytext[0];
+                  PARSER.add_token(irept(s));
+                }
+    YY_BREAK
+    default:
+      ECHO;
+    }
+  }
+}
+void yyrestart(FILE *f) { yyin=f; yy_flush_buffer_(); }
+
+int yywrap() { return 1; }
+
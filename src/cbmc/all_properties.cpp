@@ -109,7 +109,7 @@ safety_checkert::resultt bmc_all_propertiest::operator()()
         property_id=id2string(
           it->source.pc->source_location.get_function())+".unwind."+
           i2string(it->source.pc->loop_number);
-        goal_map[property_id].description=it->comment;
+        goal_map[property_id].description=id2string(it->comment);
       }
       else
         continue;
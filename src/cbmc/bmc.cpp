@@ -16,6 +16,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/time_stopping.h>
 #include <util/message.h>
 #include <util/json.h>
+#include <util/profiling.h>
 
 #include <langapi/mode.h>
 #include <langapi/languages.h>
@@ -30,10 +31,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-symex/build_goto_trace.h>
 #include <goto-symex/slice.h>
 #include <goto-symex/slice_by_trace.h>
+#include <goto-symex/equation_preprocessor.h>
 #include <goto-symex/memory_model_sc.h>
 #include <goto-symex/memory_model_tso.h>
 #include <goto-symex/memory_model_pso.h>
 
+#include <solvers/sat/cnf.h>
+
 #include "counterexample_beautification.h"
 #include "fault_localization.h"
 #include "bmc.h"
@@ -142,8 +146,11 @@ void bmct::do_conversion()
 
   status() << "converting SSA" << eom;
 
-  // convert SSA
-  equation.convert(prop_conv);
+  // convert SSA, unless it has been converted during symex
+  if(equation.is_streaming())
+    equation.finish_streaming();
+  else
+    equation.convert(prop_conv);
 
   // the 'extra constraints'
   if(!bmc_constraints.empty())
@@ -178,11 +185,50 @@ bmct::run_decision_procedure(prop_convt &prop_conv)
   // stop the time
   absolute_timet sat_start=current_time();
 
-  do_conversion();
+  {
+    profiling_phaset phase("conversion");
+    do_conversion();
+  }
+
+  prop_conv_solvert *prop_conv_solver=
+    dynamic_cast<prop_conv_solvert *>(&prop_conv);
+
+  if(prop_conv_solver!=NULL)
+  {
+    statistics() << "conversion ";
+    prop_conv_solver->output_cache_statistics(statistics());
+    statistics() << eom;
+  }
+
+  if(profiling.enabled)
+  {
+    // the size of the formula, if propositional
+    if(prop_conv_solver!=NULL)
+    {
+      const propt &prop=prop_conv_solver->get_prop();
+      profiling.set_counter("satVariables", prop.no_variables());
+
+      const cnft *cnf=dynamic_cast<const cnft *>(&prop);
+      if(cnf!=NULL)
+        profiling.set_counter("satClauses", cnf->no_clauses());
+
+      const prop_conv_solvert::cachet &cache=
+        prop_conv_solver->get_cache();
+      profiling.set_counter("literalCacheHits",
+        cache.identity_hits+cache.hits);
+      profiling.set_counter("literalCacheMisses", cache.misses);
+    }
+  }
 
   status() << "Running " << prop_conv.decision_procedure_text() << eom;
 
-  decision_proceduret::resultt dec_result=prop_conv.dec_solve();
+  decision_proceduret::resultt dec_result;
+
+  {
+    profiling_phaset phase("solving");
+    dec_result=prop_conv.dec_solve();
+  }
+
   // output runtime
 
   {
@@ -410,6 +456,92 @@ safety_checkert::resultt bmct::run(
   symex.set_message_handler(get_message_handler());
   symex.options=options;
 
+  bool has_threads=false;
+
+  forall_goto_functions(f_it, goto_functions)
+    forall_goto_program_instructions(i_it, f_it->second.body)
+      if(i_it->is_start_thread())
+        has_threads=true;
+
+  // the equations of split paths are appended, which does not
+  // preserve the order of the events of threads
+  if(options.get_unsigned_int_option("split-depth")!=0 &&
+     has_threads)
+  {
+    warning() << "--split-depth is ignored for programs with threads"
+              << eom;
+    symex.options.set_option("split-depth", 0);
+  }
+
+  // The steps of the paths paused at loop bounds are appended
+  // as well, and are converted as symex adds them.
+  const bool incremental_unwinding=options.get_bool_option("incremental");
+
+  if(incremental_unwinding)
+  {
+    if(has_threads)
+    {
+      error() << "--incremental is not supported for programs with threads"
+              << eom;
+      return safety_checkert::ERROR;
+    }
+
+    if(options.get_bool_option("show-vcc") ||
+       options.get_bool_option("program-only") ||
+       !options.get_list_option("cover").empty() ||
+       options.get_option("localize-faults")!="" ||
+       options.get_option("slice-by-trace")!="")
+    {
+      error() << "--incremental cannot be used with --show-vcc, "
+              << "--program-only, --cover, --localize-faults "
+              << "and --slice-by-trace" << eom;
+      return safety_checkert::ERROR;
+    }
+
+    if(!prop_conv.has_set_assumptions())
+    {
+      error() << "--incremental requires a solver with assumptions"
+              << eom;
+      return safety_checkert::ERROR;
+    }
+
+    if(options.get_unsigned_int_option("split-depth")!=0)
+    {
+      warning() << "--split-depth is ignored with --incremental" << eom;
+      symex.options.set_option("split-depth", 0);
+    }
+
+    symex.set_incremental_unwinding(
+      options.get_option("incremental-check"),
+      options.get_unsigned_int_option("unwind-min"));
+
+    prop_conv.set_message_handler(get_message_handler());
+    equation.start_streaming(prop_conv);
+  }
+
+  // The steps are converted as symex adds them, unless the
+  // equation is changed or shown afterwards.
+  if(options.get_bool_option("stream-ssa") &&
+     !incremental_unwinding)
+  {
+    if(has_threads)
+      warning() << "--stream-ssa is ignored for programs with threads"
+                << eom;
+    else if(options.get_bool_option("show-vcc") ||
+            options.get_bool_option("program-only") ||
+            !options.get_list_option("cover").empty() ||
+            options.get_option("localize-faults")!="" ||
+            options.get_option("slice-by-trace")!="")
+      warning() << "--stream-ssa is ignored with --show-vcc, "
+                << "--program-only, --cover, --localize-faults "
+                << "and --slice-by-trace" << eom;
+    else
+    {
+      prop_conv.set_message_handler(get_message_handler());
+      equation.start_streaming(prop_conv);
+    }
+  }
+
   status() << "Starting Bounded Model Checking" << eom;
 
   symex.last_source_location.make_nil();
@@ -420,11 +552,26 @@ safety_checkert::resultt bmct::run(
     setup_unwind();
 
     // perform symbolic execution
-    symex(goto_functions);
+    {
+      profiling_phaset phase("symex");
+      symex(goto_functions);
+    }
 
     // add a partial ordering, if required
     if(equation.has_threads())
     {
+      // the slicer needs the shared reads and writes before they
+      // are tied together by the constraints of the memory model
+      if(options.get_bool_option("slice-formula"))
+      {
+        profiling_phaset phase("slicing");
+        slice(equation);
+        statistics() << "slicing removed "
+                     << equation.count_ignored_SSA_steps()
+                     << " assignments" << eom;
+      }
+
+      profiling_phaset phase("memory model");
       memory_model->set_message_handler(get_message_handler());
       (*memory_model)(equation);
     }
@@ -456,41 +603,123 @@ safety_checkert::resultt bmct::run(
 
   statistics() << "size of program expression: "
                << equation.SSA_steps.size()
-               << " steps" << eom;
+               << " steps, " << symex.phi_nodes
+               << " phi nodes" << eom;
+
+  profiling.set_counter("ssaSteps", equation.SSA_steps.size());
+  profiling.set_counter("phiNodes", symex.phi_nodes);
+
+  if(symex.split_paths!=0)
+  {
+    statistics() << "symex split off " << symex.split_paths
+                 << " paths" << eom;
+    profiling.set_counter("splitPaths", symex.split_paths);
+  }
+
+  if(options.get_bool_option("function-summaries"))
+  {
+    statistics() << "function summaries: "
+                 << symex.function_summary_hits << " hits, "
+                 << symex.function_summary_misses << " misses" << eom;
+    profiling.set_counter(
+      "functionSummaryHits", symex.function_summary_hits);
+    profiling.set_counter(
+      "functionSummaryMisses", symex.function_summary_misses);
+  }
+
+  if(options.get_bool_option("bdd-guards"))
+    profiling.set_counter(
+      "guardBddNodes", symex.guard_bdd.number_of_nodes());
+
+  if(simplify_cache.max_size!=0)
+  {
+    statistics() << "simplifier cache: ";
+    simplify_cache.output_statistics(statistics());
+    statistics() << eom;
+  }
 
   try
   {
-    if(options.get_option("slice-by-trace")!="")
+    if(incremental_unwinding)
+      return incremental(goto_functions);
+
     {
-      symex_slice_by_tracet symex_slice_by_trace(ns);
+      profiling_phaset phase("slicing");
 
-      symex_slice_by_trace.slice_by_trace
-        (options.get_option("slice-by-trace"), equation);
-    }
+      if(options.get_option("slice-by-trace")!="")
+      {
+        symex_slice_by_tracet symex_slice_by_trace(ns);
 
-    if(equation.has_threads())
-    {
-      // we should build a thread-aware SSA slicer
-      statistics() << "no slicing due to threads" << eom;
-    }
-    else
-    {
-      if(options.get_bool_option("slice-formula"))
+        symex_slice_by_trace.slice_by_trace
+          (options.get_option("slice-by-trace"), equation);
+      }
+
+      if(equation.is_streaming())
       {
-        slice(equation);
-        statistics() << "slicing removed "
-                     << equation.count_ignored_SSA_steps()
-                     << " assignments" << eom;
+        // the steps have been converted already
+        if(options.get_bool_option("slice-formula"))
+          warning() << "--slice-formula is ignored with --stream-ssa"
+                    << eom;
+      }
+      else if(equation.has_threads())
+      {
+        // --slice-formula has been done before the memory model; the
+        // last assertion need not be last in the order of the events
+        if(!options.get_bool_option("slice-formula"))
+          statistics() << "no simple slicing due to threads" << eom;
       }
       else
       {
-        if(options.get_list_option("cover").empty())
+        if(options.get_bool_option("slice-formula"))
         {
-          simple_slice(equation);
-          statistics() << "simple slicing removed "
+          slice(equation);
+          statistics() << "slicing removed "
                        << equation.count_ignored_SSA_steps()
                        << " assignments" << eom;
         }
+        else
+        {
+          if(options.get_list_option("cover").empty())
+          {
+            simple_slice(equation);
+            statistics() << "simple slicing removed "
+                         << equation.count_ignored_SSA_steps()
+                         << " assignments" << eom;
+          }
+        }
+      }
+    }
+
+    if(options.get_bool_option("preprocess-formula"))
+    {
+      profiling_phaset phase("preprocessing");
+
+      if(equation.is_streaming())
+        warning() << "--preprocess-formula is ignored with --stream-ssa"
+                  << eom;
+      else if(equation.has_threads())
+        warning() << "--preprocess-formula is ignored for programs "
+                  << "with threads" << eom;
+      else
+      {
+        equation_preprocessort preprocessor(ns);
+        preprocessor(equation);
+
+        statistics() << "preprocessing removed "
+                     << preprocessor.eliminated_assignments
+                     << " assignments and "
+                     << preprocessor.narrowed_bits << " bits ("
+                     << preprocessor.propagated_equalities
+                     << " equalities propagated, "
+                     << preprocessor.inlined_definitions
+                     << " definitions inlined, "
+                     << preprocessor.common_subexpressions
+                     << " common subexpressions)" << eom;
+
+        profiling.set_counter(
+          "preprocessedAssignments", preprocessor.eliminated_assignments);
+        profiling.set_counter(
+          "narrowedBits", preprocessor.narrowed_bits);
       }
     }
 
@@ -500,6 +729,9 @@ safety_checkert::resultt bmct::run(
                    << " remaining after simplification" << eom;
     }
 
+    profiling.set_counter("vccs", symex.total_vccs);
+    profiling.set_counter("remainingVccs", symex.remaining_vccs);
+
     if(options.get_bool_option("show-vcc"))
     {
       show_vcc();
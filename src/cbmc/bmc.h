@@ -14,6 +14,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/hash_cont.h>
 #include <util/options.h>
+#include <util/simplify_expr_cache.h>
 
 #include <solvers/prop/prop.h>
 #include <solvers/prop/prop_conv.h>
@@ -38,12 +39,17 @@ public:
     safety_checkert(ns, _message_handler),
     options(_options),
     ns(_symbol_table, new_symbol_table),
+    simplify_cache(options.get_unsigned_int_option("simplify-cache")),
     equation(ns),
     symex(ns, new_symbol_table, equation),
     prop_conv(_prop_conv),
     ui(ui_message_handlert::PLAIN)
   {
     symex.constant_propagation=options.get_bool_option("propagation");
+    symex.bdd_guards=options.get_bool_option("bdd-guards");
+
+    if(simplify_cache.max_size!=0)
+      ns.set_simplify_cache(&simplify_cache);
   }
 
   virtual resultt run(const goto_functionst &goto_functions);
@@ -69,6 +75,7 @@ protected:
   const optionst &options;
   symbol_tablet new_symbol_table;
   namespacet ns;
+  simplify_expr_cachet simplify_cache;
   symex_target_equationt equation;
   symex_bmct symex;
   prop_convt &prop_conv;
@@ -98,6 +105,12 @@ protected:
   virtual resultt stop_on_fail(
     const goto_functionst &goto_functions,
     prop_convt &solver);
+
+  // unwinding in rounds, with option incremental
+  virtual resultt incremental(
+    const goto_functionst &goto_functions);
+  decision_proceduret::resultt solve_with_assumption(literalt l);
+
   virtual void show_program();
   virtual void report_success();
   virtual void report_failure();
@@ -0,0 +1,323 @@
+/*******************************************************************\
+
+Module: Incremental Loop Unwinding
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <limits>
+#include <set>
+
+#include <util/arith_tools.h>
+#include <util/time_stopping.h>
+
+#include <solvers/prop/literal_expr.h>
+
+#include "bmc.h"
+
+/*******************************************************************\
+
+Function: bmct::solve_with_assumption
+
+  Inputs: a literal
+
+ Outputs:
+
+ Purpose: solves the formula so far with the literal as the only
+          solver assumption
+
+\*******************************************************************/
+
+decision_proceduret::resultt bmct::solve_with_assumption(literalt l)
+{
+  prop_conv.set_assumptions(bvt(1, l));
+
+  absolute_timet sat_start=current_time();
+
+  decision_proceduret::resultt dec_result=prop_conv.dec_solve();
+
+  absolute_timet sat_stop=current_time();
+  status() << "Runtime decision procedure: "
+           << (sat_stop-sat_start) << "s" << eom;
+
+  return dec_result;
+}
+
+/*******************************************************************\
+
+Function: collect_magic_numbers
+
+  Inputs: an expression
+
+ Outputs: adds the positive integer constants in the expression
+
+ Purpose:
+
+\*******************************************************************/
+
+static void collect_magic_numbers(
+  const exprt &expr,
+  std::set<unsigned> &dest)
+{
+  if(expr.id()==ID_constant)
+  {
+    const irep_idt &type_id=expr.type().id();
+    mp_integer value;
+
+    if((type_id==ID_signedbv || type_id==ID_unsignedbv) &&
+       !to_integer(expr, value) &&
+       value>0 && value<=std::numeric_limits<unsigned>::max())
+      dest.insert(integer2unsigned(value));
+  }
+
+  forall_operands(it, expr)
+    collect_magic_numbers(*it, dest);
+}
+
+/*******************************************************************\
+
+Function: magic_numbers
+
+  Inputs: the program
+
+ Outputs: the positive integer constants in the program, which are
+          the likely bounds of its loops
+
+ Purpose:
+
+\*******************************************************************/
+
+static std::set<unsigned> magic_numbers(
+  const goto_functionst &goto_functions)
+{
+  std::set<unsigned> result;
+
+  forall_goto_functions(f_it, goto_functions)
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      collect_magic_numbers(i_it->code, result);
+      collect_magic_numbers(i_it->guard, result);
+    }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: next_bound
+
+  Inputs: the bound of the last round, and the magic numbers
+
+ Outputs: the bound of the next round: the next magic number, as
+          the properties would not be checked with the ones in
+          between, or else the bound larger by one
+
+ Purpose:
+
+\*******************************************************************/
+
+static unsigned next_bound(
+  unsigned bound,
+  const std::set<unsigned> &magic)
+{
+  std::set<unsigned>::const_iterator it=magic.upper_bound(bound);
+  return it==magic.end()?bound+1:*it;
+}
+
+/*******************************************************************\
+
+Function: bmct::incremental
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Checks the properties after each round of unwinding,
+          keeping the state of symex and of the solver. The paths
+          that reach the bound of a loop or recursion are paused
+          by symex, and are resumed with a bound larger by one in
+          the next round, whose steps extend the formula. Thus, the
+          properties of the earlier rounds need not be checked
+          again. The rounds end once no paused path is feasible,
+          or once the bound given by unwind-max has been reached,
+          which closes the paused paths with unwinding assertions
+          or assumptions.
+
+          With magic-numbers, the solver is only run with the
+          bounds that are constants in the program, or that are
+          larger than all of them, and at the end. The bound is
+          raised to the next such constant at once, so that the
+          paused paths are resumed once for the bounds in between.
+
+          With stop-when-unsat, failed properties do not end the
+          rounds. Instead, they are assumed to hold in the later
+          rounds, which end with success once their properties
+          hold. This is the step case of k-induction, for which
+          the state at the start of the loop is arbitrary.
+
+\*******************************************************************/
+
+safety_checkert::resultt bmct::incremental(
+  const goto_functionst &goto_functions)
+{
+  const bool unwind_max_is_set=options.get_option("unwind-max")!="";
+  const unsigned unwind_max=options.get_unsigned_int_option("unwind-max");
+  const bool stop_when_unsat=options.get_bool_option("stop-when-unsat");
+  unsigned bound=options.get_unsigned_int_option("unwind-min");
+
+  std::set<unsigned> magic;
+  if(options.get_bool_option("magic-numbers"))
+    magic=magic_numbers(goto_functions);
+
+  status() << "Passing problem to "
+           << prop_conv.decision_procedure_text() << eom;
+
+  // the 'extra constraints'
+  forall_expr_list(it, bmc_constraints)
+    prop_conv.set_to_true(*it);
+
+  // the properties of the rounds not checked yet
+  literalt violated=const_literal(false);
+
+  // with stop-when-unsat, whether the last check failed
+  bool failed=false;
+
+  while(true)
+  {
+    statistics() << "size of program expression: "
+                 << equation.SSA_steps.size()
+                 << " steps, " << symex.phi_nodes
+                 << " phi nodes, " << symex.paused_paths
+                 << " paths paused" << eom;
+
+    // the properties of the steps added by this round; those of
+    // the earlier rounds hold as the formula is only extended
+    literalt new_violated=equation.convert_new_assertions();
+
+    if(violated.is_false())
+      violated=new_violated;
+    else if(!new_violated.is_false())
+      violated=prop_conv.convert(
+        or_exprt(literal_exprt(violated), literal_exprt(new_violated)));
+
+    const bool check=
+      magic.empty() ||
+      !symex.has_paused_paths() ||
+      magic.find(bound)!=magic.end() ||
+      bound>*magic.rbegin() ||
+      (unwind_max_is_set && bound>=unwind_max);
+
+    if(!check)
+    {
+      bound=next_bound(bound, magic);
+      if(unwind_max_is_set && bound>unwind_max)
+        bound=unwind_max;
+      status() << "Unwinding with bound " << bound << eom;
+
+      symex.set_incremental_bound(bound);
+      symex.resume_paused_paths(goto_functions);
+      continue;
+    }
+
+    if(!violated.is_false())
+    {
+      status() << "Checking the properties with unwinding bound "
+               << bound << eom;
+
+      switch(solve_with_assumption(violated))
+      {
+      case decision_proceduret::D_UNSATISFIABLE:
+        // may help the later rounds
+        prop_conv.set_to_false(literal_exprt(violated));
+
+        if(stop_when_unsat)
+        {
+          status() << "The properties hold with unwinding bound "
+                   << bound << eom;
+          report_success();
+          return SAFE;
+        }
+        break;
+
+      case decision_proceduret::D_SATISFIABLE:
+        if(stop_when_unsat)
+        {
+          status() << "A property fails with unwinding bound "
+                   << bound << ", assuming it in the next round" << eom;
+          prop_conv.set_to_false(literal_exprt(violated));
+          failed=true;
+          break;
+        }
+
+        if(options.get_bool_option("trace"))
+          error_trace();
+
+        report_failure();
+        return UNSAFE;
+
+      default:
+        error() << "decision procedure failed" << eom;
+        return ERROR;
+      }
+
+      violated=const_literal(false);
+    }
+
+    if(!symex.has_paused_paths())
+      break;
+
+    // does any of the paused paths iterate further?
+    literalt continued=prop_conv.convert(
+      and_exprt(
+        literal_exprt(equation.get_stream_assumption()),
+        symex.paused_paths_guard()));
+
+    switch(solve_with_assumption(continued))
+    {
+    case decision_proceduret::D_UNSATISFIABLE:
+      status() << "The loops have been unwound completely" << eom;
+      if(failed)
+      {
+        report_failure();
+        return UNSAFE;
+      }
+      report_success();
+      return SAFE;
+
+    case decision_proceduret::D_SATISFIABLE:
+      break;
+
+    default:
+      error() << "decision procedure failed" << eom;
+      return ERROR;
+    }
+
+    if(unwind_max_is_set && bound>=unwind_max)
+    {
+      // the unwinding assertions are checked by the next round
+      symex.close_paused_paths();
+    }
+    else
+    {
+      bound=next_bound(bound, magic);
+      if(unwind_max_is_set && bound>unwind_max)
+        bound=unwind_max;
+      status() << "Unwinding with bound " << bound << eom;
+
+      symex.set_incremental_bound(bound);
+      symex.resume_paused_paths(goto_functions);
+    }
+  }
+
+  // a failure found with stop-when-unsat is not spurious once
+  // the loops have been unwound completely
+  if(failed)
+  {
+    report_failure();
+    return UNSAFE;
+  }
+
+  report_success();
+  return SAFE;
+}
@@ -17,9 +17,14 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/language.h>
 #include <util/unicode.h>
 #include <util/memory_info.h>
+#include <util/string_container.h>
 #include <util/i2string.h>
+#include <util/prefix.h>
+#include <util/cprover_prefix.h>
+#include <util/profiling.h>
 
 #include <ansi-c/c_preprocess.h>
+#include <ansi-c/ansi_c_entry_point.h>
 
 #include <goto-programs/goto_convert_functions.h>
 #include <goto-programs/remove_function_pointers.h>
@@ -33,6 +38,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-programs/show_properties.h>
 #include <goto-programs/set_properties.h>
 #include <goto-programs/read_goto_binary.h>
+#include <goto-programs/lazy_goto_binary.h>
 #include <goto-programs/string_abstraction.h>
 #include <goto-programs/string_instrumentation.h>
 #include <goto-programs/loop_ids.h>
@@ -40,6 +46,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-programs/remove_skip.h>
 #include <goto-programs/show_goto_functions.h>
 
+#include <linking/static_lifetime_init.h>
+
 #include <goto-instrument/full_slicer.h>
 #include <goto-instrument/nondet_static.h>
 #include <goto-instrument/cover.h>
@@ -180,6 +188,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   else
     options.set_option("simplify", true);
 
+  if(cmdline.isset("simplify-cache"))
+    options.set_option("simplify-cache", cmdline.get_value("simplify-cache"));
+
   if(cmdline.isset("stop-on-fail") ||
      cmdline.isset("dimacs") ||
      cmdline.isset("outfile"))
@@ -304,6 +315,59 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   options.set_option("slice-formula",
        cmdline.isset("slice-formula"));
 
+  // word-level rewriting of the equation
+  options.set_option("preprocess-formula",
+       cmdline.isset("preprocess-formula"));
+
+  // join guards using BDDs
+  options.set_option("bdd-guards",
+       cmdline.isset("bdd-guards"));
+
+  // symex paths split at branches in parallel
+  if(cmdline.isset("split-depth"))
+    options.set_option("split-depth", cmdline.get_value("split-depth"));
+
+  // reuse the values returned by calls of pure functions
+  options.set_option("function-summaries",
+       cmdline.isset("function-summaries"));
+
+  // convert the SSA steps into the formula during symex
+  options.set_option("stream-ssa",
+       cmdline.isset("stream-ssa"));
+
+  // unwind the loops in rounds, checking the properties after each
+  if(cmdline.isset("incremental") ||
+     cmdline.isset("incremental-check"))
+  {
+    options.set_option("incremental", true);
+
+    if(cmdline.isset("incremental-check"))
+      options.set_option("incremental-check",
+                         cmdline.get_value("incremental-check"));
+
+    if(cmdline.isset("unwind-min"))
+      options.set_option("unwind-min", cmdline.get_value("unwind-min"));
+    else
+      options.set_option("unwind-min", 1);
+
+    if(cmdline.isset("unwind-max"))
+      options.set_option("unwind-max", cmdline.get_value("unwind-max"));
+
+    // the loops that are still unwound once unwind-max is reached
+    // fail, unless this is not wanted
+    if(!cmdline.isset("no-unwinding-assertions") &&
+       !options.get_bool_option("partial-loops") &&
+       !cmdline.isset("cover"))
+      options.set_option("unwinding-assertions", true);
+
+    // for the step case of k-induction
+    options.set_option("stop-when-unsat",
+                       cmdline.isset("stop-when-unsat"));
+
+    options.set_option("magic-numbers",
+                       cmdline.isset("magic-numbers"));
+  }
+
   // simplify if conditions and branches
   if(cmdline.isset("no-simplify-if"))
     options.set_option("simplify-if", false);
@@ -317,6 +381,12 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   else
     options.set_option("arrays-uf", "auto");
 
+  if(cmdline.isset("multiplier"))
+    options.set_option("multiplier", cmdline.get_value("multiplier"));
+
+  if(cmdline.isset("divider"))
+    options.set_option("divider", cmdline.get_value("divider"));
+
   if(cmdline.isset("dimacs"))
     options.set_option("dimacs", true);
 
@@ -448,6 +518,17 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   else
     options.set_option("sat-preprocessor", true);
 
+  if(cmdline.isset("portfolio"))
+  {
+    if(unsafe_string2unsigned(cmdline.get_value("portfolio"))==0)
+    {
+      error() << "--portfolio requires at least one solver" << eom;
+      exit(1); // should contemplate EX_USAGE from sysexits.h
+    }
+
+    options.set_option("portfolio", cmdline.get_value("portfolio"));
+  }
+
   options.set_option("pretty-names",
                      !cmdline.isset("no-pretty-names"));
 
@@ -486,6 +567,9 @@ int cbmc_parse_optionst::doit()
   get_command_line_options(options);
   eval_verbosity();
 
+  profiling_reportt profiling_report(
+    ui_message_handler, cmdline.isset("profile"));
+
   //
   // Print a banner
   //
@@ -541,8 +625,12 @@ int cbmc_parse_optionst::doit()
 
   bmct bmc(options, symbol_table, ui_message_handler, prop_conv);
 
-  int get_goto_program_ret=
-    get_goto_program(options, bmc, goto_functions);
+  int get_goto_program_ret;
+
+  {
+    profiling_phaset phase("goto program");
+    get_goto_program_ret=get_goto_program(options, bmc, goto_functions);
+  }
 
   if(get_goto_program_ret!=-1)
     return get_goto_program_ret;
@@ -721,6 +809,18 @@ int cbmc_parse_optionst::get_goto_program(
       clear_parse();
     }
 
+    if(binaries.size()==1 &&
+       cmdline.args.empty() &&
+       cmdline.isset("function"))
+    {
+      int get_function_ret=
+        get_function_from_binary(binaries.front(), goto_functions);
+      if(get_function_ret==0)
+        binaries.clear(); // done
+      else if(get_function_ret!=-1)
+        return get_function_ret;
+    }
+
     for(cmdlinet::argst::const_iterator
         it=binaries.begin();
         it!=binaries.end();
@@ -746,8 +846,12 @@ int cbmc_parse_optionst::get_goto_program(
 
     goto_convert(symbol_table, goto_functions, ui_message_handler);
 
-    if(process_goto_program(options, goto_functions))
-      return 6;
+    {
+      profiling_phaset phase("goto program processing");
+
+      if(process_goto_program(options, goto_functions))
+        return 6;
+    }
 
     // show it?
     if(cmdline.isset("show-loops"))
@@ -793,6 +897,69 @@ int cbmc_parse_optionst::get_goto_program(
 
 /*******************************************************************\
 
+Function: cbmc_parse_optionst::get_function_from_binary
+
+  Inputs: an indexed goto binary
+
+ Outputs: -1 if the binary has no index, 0 on success, and an
+          exit code otherwise
+
+ Purpose: loads only what is reachable from the function given
+          with --function, and builds a new entry point for it
+
+\*******************************************************************/
+
+int cbmc_parse_optionst::get_function_from_binary(
+  const std::string &filename,
+  goto_functionst &goto_functions)
+{
+  lazy_goto_binaryt goto_binary;
+
+  if(goto_binary.open(filename, get_message_handler()) ||
+     !goto_binary.has_function(config.main))
+    return -1; // read all of it
+
+  status() << "Reading function " << config.main
+           << " from GOTO program" << eom;
+
+  // The internal symbols, which include the architecture, but
+  // not the entry point and the initialization, which are
+  // generated again below.
+  std::list<irep_idt> roots;
+  goto_binary.get_symbol_names(roots);
+
+  for(std::list<irep_idt>::iterator it=roots.begin();
+      it!=roots.end();
+      ) // no ++it
+  {
+    if(has_prefix(id2string(*it), CPROVER_PREFIX) &&
+       *it!=goto_functionst::entry_point() &&
+       *it!=INITIALIZE_FUNCTION)
+      ++it;
+    else
+      it=roots.erase(it);
+  }
+
+  roots.push_back(config.main);
+
+  goto_binary.load_symbol(INITIALIZE_FUNCTION, symbol_table, goto_functions);
+  goto_binary.load_reachable(roots, symbol_table, goto_functions);
+
+  statistics() << "Loaded " << goto_binary.symbols_loaded() << " of "
+               << goto_binary.number_of_symbols() << " symbols and "
+               << goto_binary.functions_loaded() << " of "
+               << goto_binary.number_of_functions() << " functions" << eom;
+
+  config.set_from_symbol_table(symbol_table);
+
+  if(ansi_c_entry_point(symbol_table, "main", get_message_handler()))
+    return 6;
+
+  return 0;
+}
+
+/*******************************************************************\
+
 Function: cbmc_parse_optionst::preprocessing
 
   Inputs:
@@ -1047,6 +1214,9 @@ int cbmc_parse_optionst::do_bmc(
   memory_info(debug());
   debug() << eom;
 
+  debug() << "String table: "
+          << string_container.get_statistics() << eom;
+
   // We return '0' if the property holds,
   // and '10' if it is violated.
   return result?0:10;
@@ -1167,14 +1337,42 @@ void cbmc_parse_optionst::help()
     "                              (use --show-loops to get the loop IDs)\n"
     " --show-vcc                   show the verification conditions\n"
     " --slice-formula              remove assignments unrelated to property\n"
+    " --preprocess-formula         propagate and share definitions, and narrow\n"
+    "                              arithmetic, before converting the formula\n"
+    " --bdd-guards                 join guards at merge points using BDDs\n"
+    " --split-depth n              split paths at their first n branches and\n"
+    "                              do symex for the paths in parallel (in a\n"
+    "                              build with THREAD_SAFE_IREP, else in turn)\n"
+    " --function-summaries         reuse the results of calls of functions\n"
+    "                              without side effects and properties\n"
+    " --stream-ssa                 convert the SSA steps into the formula while\n"
+    "                              doing symex (no slicing)\n"
+    " --incremental                unwind the loops in rounds, checking the\n"
+    "                              properties after each, with the same solver\n"
+    " --incremental-check L        unwind just loop L in rounds\n"
+    " --unwind-min nr              start incremental unwinding with bound nr\n"
+    " --unwind-max nr              stop incremental unwinding at bound nr\n"
+    "                              (without it, the rounds do not end for\n"
+    "                              loops that can iterate without bound)\n"
+    " --no-unwinding-assertions    do not fail for loops that are still\n"
+    "                              unwound at unwind-max\n"
+    " --stop-when-unsat            go on unwinding while the properties fail,\n"
+    "                              assuming those of the earlier rounds, and\n"
+    "                              stop once they hold (the step case of\n"
+    "                              k-induction)\n"
+    " --magic-numbers              check the properties only with the bounds\n"
+    "                              that are constants in the program\n"
     " --unwinding-assertions       generate unwinding assertions\n"
     " --partial-loops              permit paths with partial loops\n"
+    " --simplify-cache n           memoise up to n simplifier results\n"
     " --no-pretty-names            do not simplify identifiers\n"
     " --graphml-cex filename       write the counterexample in GraphML format to filename\n"
     "\n"
     "Backend options:\n"
     " --dimacs                     generate CNF in DIMACS format\n"
     " --beautify                   beautify the counterexample (greedy heuristic)\n"
+    " --portfolio n                race n differently configured SAT solvers\n"
+    " --aig                        simplify the formula as and-inverter graph\n"
     " --localize-faults            localize faults (experimental)\n"
     " --smt1                       use default SMT1 solver (obsolete)\n"
     " --smt2                       use default SMT2 solver (Z3)\n"
@@ -1187,11 +1385,16 @@ void cbmc_parse_optionst::help()
     " --outfile filename           output formula to given file\n"
     " --arrays-uf-never            never turn arrays into uninterpreted functions\n"
     " --arrays-uf-always           always turn arrays into uninterpreted functions\n"
+    " --multiplier encoding        encode multiplication with auto (default),\n"
+    "                              shift-add, csd, wallace, dadda or karatsuba\n"
+    " --divider encoding           encode division with auto (default),\n"
+    "                              multiplication, shift or restoring\n"
     "\n"
     "Other options:\n"
     " --version                    show version and exit\n"
     " --xml-ui                     use XML-formatted output\n"
     " --xml-interface              bi-directional XML interface\n"
     " --json-ui                    use JSON-formatted output\n"
+    " --profile                    report time and memory of each phase\n"
     "\n";
 }
@@ -23,6 +23,11 @@ class optionst;
 #define CBMC_OPTIONS \
   "(program-only)(function):(preprocess)(slice-by-trace):" \
   "(no-simplify)(unwind):(unwindset):(slice-formula)(full-slice)" \
+  "(preprocess-formula)" \
+  "(bdd-guards)(split-depth):(stream-ssa)(function-summaries)" \
+  "(incremental)(incremental-check):(unwind-min):(unwind-max):" \
+  "(stop-when-unsat)(magic-numbers)" \
+  "(simplify-cache):" \
   "(debug-level):(no-propagation)(no-simplify-if)" \
   "(document-subgoals)(outfile):(test-preprocessor)" \
   "D:I:(c89)(c99)(c11)(cpp89)(cpp99)(cpp11)" \
@@ -33,7 +38,7 @@ class optionst;
   "(no-assertions)(no-assumptions)" \
   "(xml-ui)(xml-interface)(json-ui)" \
   "(smt1)(smt2)(fpa)(cvc3)(cvc4)(boolector)(yices)(z3)(opensmt)(mathsat)" \
-  "(no-sat-preprocessor)" \
+  "(no-sat-preprocessor)(portfolio):" \
   "(no-pretty-names)(beautify)" \
   "(fixedbv)" \
   "(dimacs)(refine)(max-node-refinement):(refine-arrays)(refine-arithmetic)(aig)" \
@@ -45,12 +50,13 @@ class optionst;
   "(stop-on-fail)(trace)" \
   "(error-label):(verbosity):(no-library)" \
   "(nondet-static)" \
-  "(version)" \
+  "(version)(profile)" \
   "(cover):" \
   "(mm):" \
   "(i386-linux)(i386-macos)(i386-win32)(win32)(winx64)(gcc)" \
   "(ppc-macos)(unsigned-char)" \
   "(arrays-uf-always)(arrays-uf-never)" \
+  "(multiplier):(divider):" \
   "(string-abstraction)(no-arch)(arch):" \
   "(round-to-nearest)(round-to-plus-inf)(round-to-minus-inf)(round-to-zero)" \
   "(graphml-cex):" \
@@ -90,6 +96,10 @@ protected:
 
   bool set_properties(goto_functionst &goto_functions);
 
+  int get_function_from_binary(
+    const std::string &filename,
+    goto_functionst &goto_functions);
+
   void eval_verbosity();
 
   // get any additional stuff before finalizing
@@ -11,8 +11,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <fstream>
 
 #include <util/unicode.h>
+#include <util/i2string.h>
 
 #include <solvers/sat/satcheck.h>
+#include <solvers/sat/satcheck_portfolio.h>
 #include <solvers/refinement/bv_refinement.h>
 #include <solvers/smt1/smt1_dec.h>
 #include <solvers/smt2/smt2_dec.h>
@@ -147,23 +149,23 @@ public:
   cbmc_solver_with_aigpropt(
     prop_convt *_prop_conv,
     propt *_prop,
-    aigt *_aig):
+    propt *_sat):
     cbmc_solver_with_propt(_prop_conv, _prop),
-    aig(_aig)
+    sat(_sat)
   {
-    assert(_aig!=NULL);
+    assert(_sat!=NULL);
   }
 
   ~cbmc_solver_with_aigpropt()
   {
-    // delete prop before the AIG
+    // delete the AIG before the solver it passes the CNF to
     delete prop;
     prop=NULL;
-    delete aig;
+    delete sat;
   }
 
 protected:
-  aigt *aig;
+  propt *sat;
 };
 
 /*******************************************************************\
@@ -200,6 +202,61 @@ protected:
 
 /*******************************************************************\
 
+Function: cbmc_solverst::set_arithmetic_encodings
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Select the encodings of multiplication and division
+
+\*******************************************************************/
+
+void cbmc_solverst::set_arithmetic_encodings(boolbvt &boolbv)
+{
+  const std::string multiplier=options.get_option("multiplier");
+  const std::string divider=options.get_option("divider");
+
+  bv_utilst::multipliert multiplier_encoding;
+  bv_utilst::dividert divider_encoding;
+
+  if(multiplier=="" || multiplier=="auto")
+    multiplier_encoding=bv_utilst::M_AUTO;
+  else if(multiplier=="shift-add")
+    multiplier_encoding=bv_utilst::M_SHIFT_ADD;
+  else if(multiplier=="csd")
+    multiplier_encoding=bv_utilst::M_CSD;
+  else if(multiplier=="wallace")
+    multiplier_encoding=bv_utilst::M_WALLACE;
+  else if(multiplier=="dadda")
+    multiplier_encoding=bv_utilst::M_DADDA;
+  else if(multiplier=="karatsuba")
+    multiplier_encoding=bv_utilst::M_KARATSUBA;
+  else
+  {
+    error() << "unknown multiplier encoding `" << multiplier << "'" << eom;
+    throw 0;
+  }
+
+  if(divider=="" || divider=="auto")
+    divider_encoding=bv_utilst::D_AUTO;
+  else if(divider=="multiplication")
+    divider_encoding=bv_utilst::D_MULTIPLICATION;
+  else if(divider=="shift")
+    divider_encoding=bv_utilst::D_SHIFT;
+  else if(divider=="restoring")
+    divider_encoding=bv_utilst::D_RESTORING;
+  else
+  {
+    error() << "unknown divider encoding `" << divider << "'" << eom;
+    throw 0;
+  }
+
+  boolbv.set_arithmetic_encodings(multiplier_encoding, divider_encoding);
+}
+
+/*******************************************************************\
+
 Function: cbmc_solverst::get_default
 
   Inputs:
@@ -214,10 +271,30 @@ cbmc_solverst::solvert* cbmc_solverst::get_default()
 {
   solvert *solver;
 
-  if(options.get_bool_option("beautify") ||
+  if(options.get_bool_option("aig"))
+  {
+    // nodes may be encoded after solving, hence no simplifier
+    propt* sat = new satcheck_no_simplifiert();
+    aig_prop_solvert* prop = new aig_prop_solvert(*sat);
+    prop->set_message_handler(get_message_handler());
+
+    bv_cbmct* bv_cbmc = new bv_cbmct(ns, *prop);
+
+    if(options.get_option("arrays-uf")=="never")
+      bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
+    else if(options.get_option("arrays-uf")=="always")
+      bv_cbmc->unbounded_array=bv_cbmct::U_ALL;
+
+    set_arithmetic_encodings(*bv_cbmc);
+
+    solver = new cbmc_solver_with_aigpropt(bv_cbmc, prop, sat);
+  }
+  else if(options.get_bool_option("beautify") ||
+     options.get_bool_option("incremental") ||
      !options.get_bool_option("sat-preprocessor")) // no simplifier
   {
-    // simplifier won't work with beautification
+    // simplifier won't work with beautification, nor when the
+    // formula is extended after solving
     propt* prop = new satcheck_no_simplifiert();
     prop->set_message_handler(get_message_handler());
 
@@ -228,27 +305,23 @@ cbmc_solverst::solvert* cbmc_solverst::get_default()
     else if(options.get_option("arrays-uf")=="always")
       bv_cbmc->unbounded_array=bv_cbmct::U_ALL;
 
+    set_arithmetic_encodings(*bv_cbmc);
+
     solver = new cbmc_solver_with_propt(bv_cbmc, prop);
   }
   else // with simplifier
   {
-  #if 1
     propt* prop = new satcheckt();
     prop->set_message_handler(get_message_handler());
     bv_cbmct* bv_cbmc = new bv_cbmct(ns, *prop);
     solver = new cbmc_solver_with_propt(bv_cbmc, prop);
-  #else
-    aigt* aig = new aigt();
-    propt* prop = new aig_propt(*aig);
-    prop->set_message_handler(get_message_handler());
-    bv_cbmct* bv_cbmc = new bv_cbmct(ns, *prop);
-    solver = new cbmc_solver_with_aigpropt(bv_cbmc, prop, aig);
-  #endif
 
     if(options.get_option("arrays-uf")=="never")
       bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
     else if(options.get_option("arrays-uf")=="always")
       bv_cbmc->unbounded_array=bv_cbmct::U_ALL;
+
+    set_arithmetic_encodings(*bv_cbmc);
   }
 
   return solver;
@@ -256,6 +329,84 @@ cbmc_solverst::solvert* cbmc_solverst::get_default()
 
 /*******************************************************************\
 
+Function: cbmc_solverst::get_portfolio
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Get differently configured SAT solvers that race on the
+          same formula
+
+\*******************************************************************/
+
+cbmc_solverst::solvert* cbmc_solverst::get_portfolio()
+{
+  const unsigned size=options.get_unsigned_int_option("portfolio");
+
+  // as in get_default
+  const bool simplifier=
+    !options.get_bool_option("aig") &&
+    !options.get_bool_option("beautify") &&
+    !options.get_bool_option("incremental") &&
+    options.get_bool_option("sat-preprocessor");
+
+  satcheck_portfoliot *portfolio=new satcheck_portfoliot();
+  portfolio->set_message_handler(get_message_handler());
+
+  {
+    cnf_solvert *member=new satcheck_no_simplifiert();
+    portfolio->add_solver(member, member->solver_text());
+  }
+
+  if(simplifier && portfolio->size()<size)
+  {
+    cnf_solvert *member=new satcheckt();
+    portfolio->add_solver(member, member->solver_text());
+  }
+
+  #ifdef SATCHECK_MINISAT2
+  // the others differ by the seed of their random decisions
+  for(unsigned seed=1; portfolio->size()<size; seed++)
+  {
+    satcheck_no_simplifiert *member=new satcheck_no_simplifiert();
+    member->set_random_seed(seed);
+    portfolio->add_solver(
+      member, member->solver_text()+", seed "+i2string(seed));
+  }
+  #endif
+
+  if(portfolio->size()<size)
+    warning() << "only " << portfolio->size()
+              << " differently configured SAT solvers are available"
+              << eom;
+
+  aig_prop_solvert* aig = NULL;
+
+  if(options.get_bool_option("aig"))
+  {
+    aig = new aig_prop_solvert(*portfolio);
+    aig->set_message_handler(get_message_handler());
+  }
+
+  bv_cbmct* bv_cbmc =
+    new bv_cbmct(ns, aig==NULL?(propt &)*portfolio:(propt &)*aig);
+
+  if(options.get_option("arrays-uf")=="never")
+    bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
+  else if(options.get_option("arrays-uf")=="always")
+    bv_cbmc->unbounded_array=bv_cbmct::U_ALL;
+
+  set_arithmetic_encodings(*bv_cbmc);
+
+  if(aig==NULL)
+    return new cbmc_solver_with_propt(bv_cbmc, portfolio);
+  else
+    return new cbmc_solver_with_aigpropt(bv_cbmc, aig, portfolio);
+}
+
+/*******************************************************************\
+
 Function: cbmc_solverst::get_dimacs
 
   Inputs:
@@ -276,7 +427,10 @@ cbmc_solverst::solvert* cbmc_solverst::get_dimacs()
 
   std::string filename=options.get_option("outfile");
 
-  return new cbmc_solver_with_propt(new cbmc_dimacst(ns, *prop, filename), prop);
+  cbmc_dimacst *cbmc_dimacs=new cbmc_dimacst(ns, *prop, filename);
+  set_arithmetic_encodings(*cbmc_dimacs);
+
+  return new cbmc_solver_with_propt(cbmc_dimacs, prop);
 }
 
 /*******************************************************************\
@@ -319,6 +473,8 @@ cbmc_solverst::solvert* cbmc_solverst::get_bv_refinement()
   bv_refinement->do_arithmetic_refinement =
     options.get_bool_option("refine-arithmetic");
 
+  set_arithmetic_encodings(*bv_refinement);
+
   return new cbmc_solver_with_propt(bv_refinement, prop);
 }
 
@@ -523,7 +679,7 @@ void cbmc_solverst::no_incremental_check()
 {
   if(options.get_bool_option("all-properties") ||
      options.get_option("cover")!="" ||
-     options.get_option("incremental-check")!="")
+     options.get_bool_option("incremental"))
   {
     error() << "sorry, this solver does not support incremental solving" << eom;
     throw 0;
@@ -88,6 +88,8 @@ public:
       solver = get_smt1(get_smt1_solver_type());
     else if(options.get_bool_option("smt2"))
       solver = get_smt2(get_smt2_solver_type());
+    else if(options.get_option("portfolio")!="")
+      solver = get_portfolio();
     else
       solver = get_default();
 
@@ -109,6 +111,7 @@ protected:
   language_uit::uit ui;
 
   solvert* get_default();
+  solvert* get_portfolio();
   solvert* get_dimacs();
   solvert* get_bv_refinement();
   solvert* get_smt1(smt1_dect::solvert solver);
@@ -117,6 +120,8 @@ protected:
   smt1_dect::solvert get_smt1_solver_type() const;
   smt2_dect::solvert get_smt2_solver_type() const;
 
+  void set_arithmetic_encodings(boolbvt &boolbv);
+
   //consistency checks during solver creation
   void no_beautification();
   void no_incremental_check();
@@ -50,7 +50,7 @@ void bmct::show_vcc_plain(std::ostream &out)
     if(s_it->source.pc->source_location.is_not_nil())
       out << s_it->source.pc->source_location << "\n";
 
-    if(s_it->comment!="")
+    if(!s_it->comment.empty())
       out << s_it->comment << "\n";
 
     symex_target_equationt::SSA_stepst::const_iterator
@@ -123,7 +123,7 @@ void bmct::show_vcc_json(std::ostream &out)
     if(source_location.is_not_nil())
       object["sourceLocation"]=json(source_location);
 
-    const std::string &s=s_it->comment;
+    const std::string &s=id2string(s_it->comment);
     if(!s.empty())
       object["comment"]=json_stringt(s);
 
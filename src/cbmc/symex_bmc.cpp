@@ -8,6 +8,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <limits>
 
+#ifdef THREAD_SAFE_IREP
+#include <mutex>
+#endif
+
 #include <util/source_location.h>
 #include <util/i2string.h>
 
@@ -30,8 +34,113 @@ symex_bmct::symex_bmct(
   symbol_tablet &_new_symbol_table,
   symex_targett &_target):
   goto_symext(_ns, _new_symbol_table, _target),
-  max_unwind_is_set(false)
+  max_unwind_is_set(false),
+  incremental_unwinding(false),
+  incremental_bound(0)
+{
+}
+
+/*******************************************************************\
+
+Function: symex_bmct::symex_bmct
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symex_bmct::symex_bmct(
+  const symex_bmct &other,
+  const namespacet &_ns,
+  symbol_tablet &_new_symbol_table,
+  symex_targett &_target):
+  goto_symext(other, _ns, _new_symbol_table, _target),
+  max_unwind(other.max_unwind),
+  max_unwind_is_set(other.max_unwind_is_set),
+  loop_limits(other.loop_limits),
+  thread_loop_limits(other.thread_loop_limits),
+  incremental_unwinding(other.incremental_unwinding),
+  incremental_loop(other.incremental_loop),
+  incremental_bound(other.incremental_bound),
+  split_message_handler(other.split_message_handler),
+  body_warnings(other.body_warnings)
 {
+  if(other.message_handler!=NULL)
+    set_message_handler(*other.message_handler);
+}
+
+#ifdef THREAD_SAFE_IREP
+/*******************************************************************\
+
+   Class: locked_message_handlert
+
+ Purpose: passes on the messages of paths that run on threads
+          one at a time
+
+\*******************************************************************/
+
+class locked_message_handlert:public message_handlert
+{
+public:
+  explicit locked_message_handlert(message_handlert &_message_handler):
+    message_handler(_message_handler)
+  {
+    set_verbosity(_message_handler.get_verbosity());
+  }
+
+  virtual void print(unsigned level, const std::string &message)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    message_handler.print(level, message);
+  }
+
+  virtual void print(
+    unsigned level,
+    const std::string &message,
+    int sequence_number,
+    const source_locationt &location)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    message_handler.print(level, message, sequence_number, location);
+  }
+
+protected:
+  message_handlert &message_handler;
+  std::mutex mutex;
+};
+#endif
+
+/*******************************************************************\
+
+Function: symex_bmct::new_split_symex
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+goto_symext *symex_bmct::new_split_symex(
+  const namespacet &_ns,
+  symbol_tablet &_new_symbol_table,
+  symex_targett &_target)
+{
+  #ifdef THREAD_SAFE_IREP
+  // from now on, this instance prints through the lock as well
+  if(!split_message_handler && message_handler!=NULL)
+  {
+    split_message_handler=
+      std::make_shared<locked_message_handlert>(*message_handler);
+    set_message_handler(*split_message_handler);
+  }
+  #endif
+
+  return new symex_bmct(*this, _ns, _new_symbol_table, _target);
 }
 
 /*******************************************************************\
@@ -92,7 +201,9 @@ bool symex_bmct::get_unwind(
     thread_loop_limits[source.thread_nr];
 
   loop_limitst::const_iterator l_it=this_thread_limits.find(id);
-  if(l_it!=this_thread_limits.end())
+  if(is_incremental_loop(id, source.thread_nr))
+    this_loop_limit=incremental_bound;
+  else if(l_it!=this_thread_limits.end())
     this_loop_limit=l_it->second;
   else
   {
@@ -120,6 +231,58 @@ bool symex_bmct::get_unwind(
 
 /*******************************************************************\
 
+Function: symex_bmct::is_incremental_loop
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool symex_bmct::is_incremental_loop(
+  const irep_idt &id,
+  const unsigned thread_nr) const
+{
+  if(!incremental_unwinding)
+    return false;
+
+  if(!incremental_loop.empty())
+    return id==incremental_loop;
+
+  // the limits given for particular loops are kept
+  thread_loop_limitst::const_iterator t_it=
+    thread_loop_limits.find(thread_nr);
+
+  if(t_it!=thread_loop_limits.end() &&
+     t_it->second.find(id)!=t_it->second.end())
+    return false;
+
+  return loop_limits.find(id)==loop_limits.end();
+}
+
+/*******************************************************************\
+
+Function: symex_bmct::pause_at_loop_bound
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool symex_bmct::pause_at_loop_bound(
+  const symex_targett::sourcet &source)
+{
+  return is_incremental_loop(
+    goto_programt::loop_id(source.pc), source.thread_nr);
+}
+
+/*******************************************************************\
+
 Function: symex_bmct::get_unwind_recursion
 
   Inputs:
@@ -144,7 +307,9 @@ bool symex_bmct::get_unwind_recursion(
     thread_loop_limits[thread_nr];
 
   loop_limitst::const_iterator l_it=this_thread_limits.find(id);
-  if(l_it!=this_thread_limits.end())
+  if(is_incremental_loop(id, thread_nr))
+    this_loop_limit=incremental_bound;
+  else if(l_it!=this_thread_limits.end())
     this_loop_limit=l_it->second;
   else
   {
@@ -195,3 +360,23 @@ void symex_bmct::no_body(const irep_idt &identifier)
       "**** WARNING: no body for function " << identifier << eom;
   }
 }
+
+/*******************************************************************\
+
+Function: symex_bmct::pause_at_recursion_bound
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool symex_bmct::pause_at_recursion_bound(
+  const irep_idt &identifier,
+  const unsigned thread_nr)
+{
+  // recursions are bounded as loops are
+  return is_incremental_loop(identifier, thread_nr);
+}
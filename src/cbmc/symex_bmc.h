@@ -9,6 +9,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_CBMC_SYMEX_BMC_H
 #define CPROVER_CBMC_SYMEX_BMC_H
 
+#include <memory>
+
 #include <util/hash_cont.h>
 #include <util/message.h>
 
@@ -50,6 +52,25 @@ public:
     loop_limits[id]=limit;
   }
 
+  // With incremental unwinding, the loops and recursions without a
+  // limit of their own, or just the given loop, are unwound up to a
+  // bound that is raised in rounds; the paths that reach it are
+  // paused.
+
+  void set_incremental_unwinding(
+    const irep_idt &loop_id,
+    unsigned bound)
+  {
+    incremental_unwinding=true;
+    incremental_loop=loop_id;
+    incremental_bound=bound;
+  }
+
+  void set_incremental_bound(unsigned bound)
+  {
+    incremental_bound=bound;
+  }
+
 protected:
   // We have
   // 1) a global limit (max_unwind)
@@ -66,6 +87,14 @@ protected:
   typedef std::map<unsigned, loop_limitst> thread_loop_limitst;
   thread_loop_limitst thread_loop_limits;
 
+  bool incremental_unwinding;
+  irep_idt incremental_loop;
+  unsigned incremental_bound;
+
+  bool is_incremental_loop(
+    const irep_idt &id,
+    const unsigned thread_nr) const;
+
   //
   // overloaded from goto_symext
   //
@@ -78,13 +107,35 @@ protected:
     const symex_targett::sourcet &source,
     unsigned unwind);
 
+  virtual bool pause_at_loop_bound(
+    const symex_targett::sourcet &source);
+
   virtual bool get_unwind_recursion(
     const irep_idt &identifier,
     const unsigned thread_nr,
     unsigned unwind);
 
+  virtual bool pause_at_recursion_bound(
+    const irep_idt &identifier,
+    const unsigned thread_nr);
+
   virtual void no_body(const irep_idt &identifier);
 
+  // for paths split off, which print through the same handler
+  symex_bmct(
+    const symex_bmct &other,
+    const namespacet &_ns,
+    symbol_tablet &_new_symbol_table,
+    symex_targett &_target);
+
+  virtual goto_symext *new_split_symex(
+    const namespacet &_ns,
+    symbol_tablet &_new_symbol_table,
+    symex_targett &_target);
+
+  // shared with the paths split off, which may run on threads
+  std::shared_ptr<message_handlert> split_message_handler;
+
   hash_set_cont<irep_idt, irep_id_hash> body_warnings;
 };
 
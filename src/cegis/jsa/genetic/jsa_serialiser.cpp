@@ -64,19 +64,17 @@ void jsa_serialisert::operator()(jsa_genetic_solutiont &entity,
     const irept &sdu) const
 {
   entity.fitness=jsa_genetic_solutiont::fitnesst(sdu.get_long_long(FITNESS));
-  const irept::named_subt &named_sub=sdu.get_named_sub();
-  typedef irept::named_subt::const_iterator const_iterator;
-  const const_iterator invariant=named_sub.find(INVARIANT);
-  assert(named_sub.end() != invariant);
-  for (const irept &instruction : invariant->second.get_sub())
+  const irept &invariant=sdu.find(INVARIANT);
+  assert(invariant.is_not_nil());
+  for (const irept &instruction : invariant.get_sub())
   {
     jsa_genetic_solutiont::invariantt::value_type instr;
     instr.opcode=__CPROVER_jsa_opcodet(instruction.get_long_long(OPCODE));
     entity.invariant.push_back(instr);
   }
-  const const_iterator predicates=named_sub.find(PREDICATES);
-  assert(named_sub.end() != predicates);
-  for (const irept &predicate : predicates->second.get_sub())
+  const irept &predicates=sdu.find(PREDICATES);
+  assert(predicates.is_not_nil());
+  for (const irept &predicate : predicates.get_sub())
   {
     jsa_genetic_solutiont::predicatet pred;
     for (const irept &instruction : predicate.get_sub())
@@ -90,9 +88,9 @@ void jsa_serialisert::operator()(jsa_genetic_solutiont &entity,
     }
     entity.predicates.push_back(pred);
   }
-  const const_iterator query=named_sub.find(QUERY);
-  assert(named_sub.end() != query);
-  for (const irept &instruction : query->second.get_sub())
+  const irept &query=sdu.find(QUERY);
+  assert(query.is_not_nil());
+  for (const irept &instruction : query.get_sub())
   {
     jsa_genetic_solutiont::queryt::value_type instr;
     instr.opcode=__CPROVER_jsa_opcodet(instruction.get_long_long(OPCODE));
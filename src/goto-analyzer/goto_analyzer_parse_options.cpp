@@ -40,6 +40,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/config.h>
 #include <util/string2int.h>
 #include <util/unicode.h>
+#include <util/profiling.h>
 
 #include <cbmc/version.h>
 
@@ -248,6 +249,9 @@ int goto_analyzer_parse_optionst::doit()
   get_command_line_options(options);
   eval_verbosity();
 
+  profiling_reportt profiling_report(
+    ui_message_handler, cmdline.isset("profile"));
+
   //
   // Print a banner
   //
@@ -260,11 +264,21 @@ int goto_analyzer_parse_optionst::doit()
 
   goto_model.set_message_handler(get_message_handler());
 
-  if(goto_model(cmdline.args))
-    return 6;
+  {
+    profiling_phaset phase("goto program");
+
+    if(goto_model(cmdline.args))
+      return 6;
+  }
+
+  {
+    profiling_phaset phase("goto program processing");
+
+    if(process_goto_program(options))
+      return 6;
+  }
 
-  if(process_goto_program(options))
-    return 6;
+  profiling_phaset analysis_phase("analysis");
 
   if(cmdline.isset("taint"))
   {
@@ -575,5 +589,6 @@ void goto_analyzer_parse_optionst::help()
     "\n"
     "Other options:\n"
     " --version                    show version and exit\n"
+    " --profile                    report time and memory of each phase\n"
     "\n";
 }
@@ -29,7 +29,7 @@ class optionst;
   "(show-goto-functions)(show-loops)" \
   "(show-symbol-table)(show-parse-tree)" \
   "(show-properties)(show-reachable-properties)(property):" \
-  "(verbosity):(version)" \
+  "(verbosity):(version)(profile)" \
   "(gcc)(arch):" \
   "(taint):(show-taint)" \
   "(show-local-may-alias)" \
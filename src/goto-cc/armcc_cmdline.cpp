@@ -44,6 +44,7 @@ static const char *options_no_arg[]=
   "--no-arch",
   "--no-library",
   "--string-abstraction",
+  "--indexed-goto-binary",
 
   // armcc
   "--help",
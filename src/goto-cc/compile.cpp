@@ -680,7 +680,8 @@ bool compilet::write_bin_object_file(
     return true;
   }
 
-  if(write_goto_binary(outfile, lsymbol_table, functions))
+  if(write_goto_binary(
+       outfile, lsymbol_table, functions, goto_binary_version))
     return true;
 
   unsigned cnt=function_body_count(functions);
@@ -744,6 +745,10 @@ compilet::compilet(cmdlinet &_cmdline):
   mode=COMPILE_LINK_EXECUTABLE;
   echo_file_name=false;
   working_directory=get_current_working_directory();
+
+  // version 4 can be loaded lazily, but is larger
+  goto_binary_version=
+    cmdline.isset("indexed-goto-binary")?4:GOTO_BINARY_VERSION;
 }
 
 /*******************************************************************\
@@ -43,6 +43,7 @@ public:
   std::list<irep_idt> seen_modes;
 
   std::string object_file_extension;
+  int goto_binary_version;
   std::string output_file_object, output_file_executable;
 
   compilet(cmdlinet &_cmdline);
@@ -106,6 +106,7 @@ const char *gcc_options_without_argument[]=
   "--big-endian", // NON-GCC
   "--no-arch", // NON-GCC
   "--partial-inlining", // NON-GCC
+  "--indexed-goto-binary", // NON-GCC
   "-h",
   "--help", // NON-GCC
   "-?", // NON-GCC
@@ -462,6 +462,10 @@ int gcc_modet::preprocess(
       // ignore here
       skip_next=true;
     }
+    else if(it->arg=="--indexed-goto-binary")
+    {
+      // ignore here
+    }
     else
       new_argv.push_back(it->arg);
   }
@@ -642,6 +646,10 @@ int gcc_modet::gcc_hybrid_binary()
       // ignore here
       skip_next=true;
     }
+    else if(it->arg=="--indexed-goto-binary")
+    {
+      // ignore here
+    }
     else
       new_argv.push_back(it->arg);
   }
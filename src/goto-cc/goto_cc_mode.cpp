@@ -84,6 +84,8 @@ void goto_cc_modet::help()
   "Usage:                       Purpose:\n"
   "\n"
   " --verbosity #               verbosity level\n"
+  " --indexed-goto-binary       write goto binary format version 4, which\n"
+  "                             cbmc --function loads lazily\n"
   "\n";
 }
 
@@ -48,6 +48,7 @@ const char *non_ms_cl_options[]=
   "--help",
   "--xml",
   "--partial-inlining",
+  "--indexed-goto-binary",
   "--verbosity",
   "--function",
   NULL
@@ -1081,7 +1081,7 @@ void acceleration_utilst::extract_polynomial(
     constant_exprt concrete_term = to_constant_expr(program.eval(coefficient));
     std::map<exprt, int> degrees;
 
-    mp_integer mp = binary2integer(concrete_term.get_value().c_str(), true);
+    mp_integer mp = binary2integer(concrete_term.get_value(), true);
     monomial.coeff = mp.to_long();
 
     if (monomial.coeff == 0) {
@@ -101,7 +101,7 @@ void polynomialt::from_expr(const exprt &expr) {
     unsigned int l;
     constant_exprt const_expr = to_constant_expr(expr);
 
-    mp = binary2integer(const_expr.get_value().c_str(), true);
+    mp = binary2integer(const_expr.get_value(), true);
     l = mp.to_long();
 
     monomialt monomial;
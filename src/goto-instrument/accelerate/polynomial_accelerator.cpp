@@ -408,7 +408,7 @@ bool polynomial_acceleratort::fit_const(goto_programt::instructionst &body,
       std::cout << "Fitting constant, eval'd to: " << expr2c(program.eval(target), ns) << std::endl;
 #endif
       constant_exprt val = to_constant_expr(program.eval(target));
-      mp_integer mp = binary2integer(val.get_value().c_str(), true);
+      mp_integer mp = binary2integer(val.get_value(), true);
       monomialt mon;
       monomialt::termt term;
 
@@ -14,6 +14,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/expr_util.h>
 #include <util/string2int.h>
 #include <util/unicode.h>
+#include <util/simplify_expr_cache.h>
+#include <util/profiling.h>
 
 #include <goto-programs/goto_convert_functions.h>
 #include <goto-programs/remove_function_pointers.h>
@@ -140,12 +142,22 @@ int goto_instrument_parse_optionst::doit()
 
   eval_verbosity();
 
+  profiling_reportt profiling_report(
+    ui_message_handler, cmdline.isset("profile"));
+
   try
   {
     register_languages();
 
-    get_goto_program();
-    instrument_goto_program();
+    {
+      profiling_phaset phase("goto program");
+      get_goto_program();
+    }
+
+    {
+      profiling_phaset phase("instrumentation");
+      instrument_goto_program();
+    }
 
     if(cmdline.isset("unwind"))
     {
@@ -629,6 +641,8 @@ int goto_instrument_parse_optionst::doit()
     {
       status() << "Writing GOTO program to `" << cmdline.args[1] << "'" << eom;
 
+      profiling_phaset phase("writing goto binary");
+
       if(write_goto_binary(
         cmdline.args[1], symbol_table, goto_functions, get_message_handler()))
         return 1;
@@ -954,11 +968,24 @@ void goto_instrument_parse_optionst::instrument_goto_program()
 
     namespacet ns(symbol_table);
 
+    simplify_expr_cachet simplify_cache(
+      unsafe_string2size_t(cmdline.get_value("simplify-cache")));
+
+    if(simplify_cache.max_size!=0)
+      ns.set_simplify_cache(&simplify_cache);
+
     status() << "Propagating Constants" << eom;
 
     constant_propagator_ait constant_propagator_ai(goto_functions, ns);
 
     remove_skip(goto_functions);
+
+    if(simplify_cache.max_size!=0)
+    {
+      statistics() << "simplifier cache: ";
+      simplify_cache.output_statistics(statistics());
+      statistics() << eom;
+    }
   }
 
   // add generic checks, if needed
@@ -1357,6 +1384,8 @@ void goto_instrument_parse_optionst::help()
     "\n"
     "Further transformations:\n"
     " --constant-propagator        propagate constants and simplify expressions\n"
+    " --simplify-cache n           with --constant-propagator: memoise up to\n"
+    "                              n simplifier results\n"
     " --inline                     perform full inlining\n"
     " --add-library                add models of C library functions\n"
     "\n"
@@ -1365,5 +1394,6 @@ void goto_instrument_parse_optionst::help()
     " --version                    show version and exit\n"
     " --xml-ui                     use XML-formatted output\n"
     " --json-ui                    use JSON-formatted output\n"
+    " --profile                    report time and memory of each phase\n"
     "\n";
 }
@@ -54,8 +54,8 @@ Author: Daniel Kroening, kroening@kroening.com
   "(cav11)" \
   "(show-natural-loops)(accelerate)(havoc-loops)" \
   "(error-label):(string-abstraction)" \
-  "(verbosity):(version)(xml-ui)(json-ui)(show-loops)" \
-  "(accelerate)(constant-propagator)" \
+  "(verbosity):(version)(xml-ui)(json-ui)(profile)(show-loops)" \
+  "(accelerate)(constant-propagator)(simplify-cache):" \
   "(k-induction):(step-case)(base-case)" \
   "(show-call-sequences)(check-call-sequence)" \
   "(interpreter)(show-reaching-definitions)(count-eloc)(list-eloc)" \
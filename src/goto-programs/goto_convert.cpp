@@ -9,6 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <cassert>
 
 #include <util/i2string.h>
+#include <util/arith_tools.h>
 #include <util/cprover_prefix.h>
 #include <util/expr_util.h>
 #include <util/prefix.h>
@@ -2461,7 +2462,7 @@ bool goto_convertt::get_string_constant(
         if(it->is_constant())
         {
           unsigned long i=integer2ulong(
-            binary2integer(id2string(to_constant_expr(*it).get_value()), true));
+            binary2integer(to_constant_expr(*it).get_value(), true));
 
           if(i!=0) // to skip terminating 0
             result+=char(i);
@@ -0,0 +1,592 @@
+/*******************************************************************\
+
+Module: Lazy Loading of Indexed Goto Binaries
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#if defined(__linux__) || \
+    defined(__FreeBSD_kernel__) || \
+    defined(__GNU__) || \
+    defined(__unix__) || \
+    defined(__CYGWIN__) || \
+    defined(__MACH__)
+#define HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <streambuf>
+
+#include <util/message.h>
+#include <util/symbol_table.h>
+#include <util/unicode.h>
+
+#include "goto_functions.h"
+#include "read_bin_goto_object.h"
+#include "write_goto_binary.h"
+#include "elf_reader.h"
+#include "lazy_goto_binary.h"
+
+/*******************************************************************\
+
+   Class: memory_streambuft
+
+ Purpose: reading from a region of memory without copying it
+
+\*******************************************************************/
+
+class memory_streambuft:public std::streambuf
+{
+public:
+  memory_streambuft(const char *begin, const char *end)
+  {
+    char *b=const_cast<char *>(begin);
+    setg(b, b, const_cast<char *>(end));
+  }
+};
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::lazy_goto_binaryt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+lazy_goto_binaryt::lazy_goto_binaryt():
+  data(NULL),
+  size(0),
+  mapping(NULL),
+  mapping_size(0),
+  number_of_symbols_loaded(0),
+  number_of_functions_loaded(0),
+  irepconverter(ireps_container)
+{
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::~lazy_goto_binaryt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+lazy_goto_binaryt::~lazy_goto_binaryt()
+{
+  close();
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::close
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: unmaps the file and forgets the index
+
+\*******************************************************************/
+
+void lazy_goto_binaryt::close()
+{
+  #ifdef HAVE_MMAP
+  if(mapping!=NULL)
+    munmap(mapping, mapping_size);
+  #endif
+
+  mapping=NULL;
+  mapping_size=0;
+  buffer.clear();
+  data=NULL;
+  size=0;
+
+  symbol_index.clear();
+  function_index.clear();
+  number_of_symbols_loaded=0;
+  number_of_functions_loaded=0;
+  irepconverter.clear();
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::open
+
+  Inputs: a file name
+
+ Outputs: true if the file cannot be read or has no index
+
+ Purpose: maps an indexed goto binary
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::open(
+  const std::string &filename,
+  message_handlert &message_handler)
+{
+  close();
+
+  messaget message(message_handler);
+
+  // find where the goto binary starts
+  std::size_t start=0;
+
+  {
+    #ifdef _MSC_VER
+    std::ifstream in(widen(filename), std::ios::binary);
+    #else
+    std::ifstream in(filename, std::ios::binary);
+    #endif
+
+    if(!in)
+    {
+      message.error() << "Failed to open `" << filename << "'"
+                      << messaget::eom;
+      return true;
+    }
+
+    char hdr[4];
+    hdr[0]=in.get();
+    hdr[1]=in.get();
+    hdr[2]=in.get();
+    hdr[3]=in.get();
+    in.seekg(0);
+
+    if(hdr[0]==0x7f && hdr[1]=='E' && hdr[2]=='L' && hdr[3]=='F')
+    {
+      try
+      {
+        elf_readert elf_reader(in);
+
+        if(!elf_reader.has_section("goto-cc"))
+          return true;
+
+        for(unsigned i=0; i<elf_reader.number_of_sections; i++)
+          if(elf_reader.section_name(i)=="goto-cc")
+            start=elf_reader.section_offset(i);
+      }
+
+      catch(...)
+      {
+        return true;
+      }
+    }
+    else if(hdr[0]!=0x7f || hdr[1]!='G' || hdr[2]!='B' || hdr[3]!='F')
+      return true;
+  }
+
+  #ifdef HAVE_MMAP
+  int fd=::open(filename.c_str(), O_RDONLY);
+
+  if(fd<0)
+  {
+    message.error() << "Failed to open `" << filename << "'"
+                    << messaget::eom;
+    return true;
+  }
+
+  struct stat st;
+  if(fstat(fd, &st)!=0 || st.st_size==0)
+  {
+    ::close(fd);
+    return true;
+  }
+
+  void *m=mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  if(m==MAP_FAILED)
+  {
+    message.error() << "Failed to map `" << filename << "'"
+                    << messaget::eom;
+    return true;
+  }
+
+  mapping=m;
+  mapping_size=st.st_size;
+  const char *base=static_cast<const char *>(mapping);
+  std::size_t file_size=mapping_size;
+  #else
+  {
+    #ifdef _MSC_VER
+    std::ifstream in(widen(filename), std::ios::binary);
+    #else
+    std::ifstream in(filename, std::ios::binary);
+    #endif
+
+    buffer.assign(
+      std::istreambuf_iterator<char>(in),
+      std::istreambuf_iterator<char>());
+  }
+
+  const char *base=buffer.data();
+  std::size_t file_size=buffer.size();
+  #endif
+
+  // header and version; version 4 fits into one byte
+  if(start+5>file_size ||
+     std::memcmp(base+start, "\177GBF", 4)!=0 ||
+     base[start+4]!=4)
+  {
+    close();
+    return true;
+  }
+
+  data=base+start+5;
+  size=file_size-(start+5);
+
+  if(read_index(filename, message_handler))
+  {
+    close();
+    return true;
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::read
+
+  Inputs: a stream positioned after the version
+
+ Outputs: true on error, false otherwise
+
+ Purpose: reads an indexed goto binary from a stream
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::read(
+  std::istream &in,
+  const std::string &filename,
+  message_handlert &message_handler)
+{
+  close();
+
+  buffer.assign(
+    std::istreambuf_iterator<char>(in),
+    std::istreambuf_iterator<char>());
+
+  data=buffer.data();
+  size=buffer.size();
+
+  if(read_index(filename, message_handler))
+  {
+    close();
+    return true;
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::read_index
+
+  Inputs:
+
+ Outputs: true on error, false otherwise
+
+ Purpose: reads the string table and the index
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::read_index(
+  const std::string &filename,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  std::size_t index_offset=0;
+
+  if(size>=GOTO_BINARY_OFFSET_BYTES)
+    for(unsigned i=0; i<GOTO_BINARY_OFFSET_BYTES; i++)
+      index_offset|=std::size_t((unsigned char)data[i])<<(8*i);
+
+  if(index_offset<GOTO_BINARY_OFFSET_BYTES || index_offset>=size)
+  {
+    message.error() << "`" << filename << "' has a corrupt index"
+                    << messaget::eom;
+    return true;
+  }
+
+  memory_streambuft streambuf(data+index_offset, data+size);
+  std::istream in(&streambuf);
+
+  irepconverter.read_string_table(in);
+
+  for(unsigned i=0; i<2; i++)
+  {
+    indext &index=i==0?symbol_index:function_index;
+    std::size_t count=irepconverter.read_gb_word(in);
+
+    for(std::size_t j=0; j<count && in; j++)
+    {
+      irep_idt identifier=irepconverter.read_gb_string(in);
+      entryt &entry=index[identifier];
+      entry.offset=irepconverter.read_gb_word(in);
+      entry.loaded=false;
+
+      if(entry.offset>=index_offset)
+        in.setstate(std::ios::failbit);
+    }
+  }
+
+  if(!in)
+  {
+    message.error() << "`" << filename << "' has a corrupt index"
+                    << messaget::eom;
+    return true;
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::load_symbol
+
+  Inputs: an identifier
+
+ Outputs: true if there is no such symbol or it is loaded already
+
+ Purpose: adds a symbol to the symbol table
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::load_symbol(
+  const irep_idt &identifier,
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions)
+{
+  indext::iterator it=symbol_index.find(identifier);
+
+  if(it==symbol_index.end() || it->second.loaded)
+    return true;
+
+  it->second.loaded=true;
+  number_of_symbols_loaded++;
+
+  memory_streambuft streambuf(data+it->second.offset, data+size);
+  std::istream in(&streambuf);
+
+  // ireps are not shared between records
+  irepconverter.clear_ireps();
+
+  symbolt sym;
+  read_bin_symbol(in, irepconverter, sym);
+
+  if(!sym.is_type && sym.type.id()==ID_code)
+  {
+    // makes sure there is an empty function
+    // for every function symbol and fixes
+    // the function types.
+    goto_functions.function_map[sym.name].type=to_code_type(sym.type);
+  }
+
+  symbol_table.add(sym);
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::load_function
+
+  Inputs: an identifier
+
+ Outputs: true if there is no such function or it is loaded already
+
+ Purpose: reads the body of a function
+
+\*******************************************************************/
+
+bool lazy_goto_binaryt::load_function(
+  const irep_idt &identifier,
+  goto_functionst &goto_functions)
+{
+  indext::iterator it=function_index.find(identifier);
+
+  if(it==function_index.end() || it->second.loaded)
+    return true;
+
+  it->second.loaded=true;
+  number_of_functions_loaded++;
+
+  memory_streambuft streambuf(data+it->second.offset, data+size);
+  std::istream in(&streambuf);
+
+  irepconverter.clear_ireps();
+
+  read_bin_goto_function(in, irepconverter, goto_functions);
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: find_identifiers_rec
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static void find_identifiers_rec(
+  const irept &src,
+  std::list<irep_idt> &dest,
+  std::set<const void *> &visited)
+{
+  // ireps within a record are shared
+  if(!visited.insert(&src.read()).second)
+    return;
+
+  const irep_idt &identifier=src.get(ID_identifier);
+  if(!identifier.empty())
+    dest.push_back(identifier);
+
+  const irep_idt &c_identifier=src.get(ID_C_identifier);
+  if(!c_identifier.empty())
+    dest.push_back(c_identifier);
+
+  forall_irep(it, src.get_sub())
+    find_identifiers_rec(*it, dest, visited);
+
+  forall_named_irep(it, src.get_named_sub())
+    find_identifiers_rec(it->second, dest, visited);
+
+  forall_named_irep(it, src.get_comments())
+    find_identifiers_rec(it->second, dest, visited);
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::find_identifiers
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: collects anything that might refer to a symbol; this
+          includes the parameters of function types
+
+\*******************************************************************/
+
+void lazy_goto_binaryt::find_identifiers(
+  const irept &src,
+  std::list<irep_idt> &dest)
+{
+  std::set<const void *> visited;
+  find_identifiers_rec(src, dest, visited);
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::load_reachable
+
+  Inputs: the symbols and functions to start from
+
+ Outputs:
+
+ Purpose: loads the given symbols and functions and everything
+          that is referred to from them
+
+\*******************************************************************/
+
+void lazy_goto_binaryt::load_reachable(
+  const std::list<irep_idt> &roots,
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions)
+{
+  std::list<irep_idt> queue=roots;
+
+  while(!queue.empty())
+  {
+    const irep_idt identifier=queue.front();
+    queue.pop_front();
+
+    if(!load_symbol(identifier, symbol_table, goto_functions))
+    {
+      const symbolt &symbol=symbol_table.lookup(identifier);
+      find_identifiers(symbol.type, queue);
+      find_identifiers(symbol.value, queue);
+    }
+
+    if(!load_function(identifier, goto_functions))
+    {
+      const goto_programt &body=
+        goto_functions.function_map[identifier].body;
+
+      forall_goto_program_instructions(i_it, body)
+      {
+        find_identifiers(i_it->code, queue);
+        find_identifiers(i_it->guard, queue);
+      }
+    }
+  }
+
+  goto_functions.compute_location_numbers();
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::load_all
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: loads whatever has not been loaded yet
+
+\*******************************************************************/
+
+void lazy_goto_binaryt::load_all(
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions)
+{
+  for(const auto &it : symbol_index)
+    load_symbol(it.first, symbol_table, goto_functions);
+
+  for(const auto &it : function_index)
+    load_function(it.first, goto_functions);
+
+  goto_functions.compute_location_numbers();
+}
+
+/*******************************************************************\
+
+Function: lazy_goto_binaryt::get_symbol_names
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void lazy_goto_binaryt::get_symbol_names(std::list<irep_idt> &dest) const
+{
+  for(const auto &it : symbol_index)
+    dest.push_back(it.first);
+}
@@ -0,0 +1,132 @@
+/*******************************************************************\
+
+Module: Lazy Loading of Indexed Goto Binaries
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_LAZY_GOTO_BINARY_H
+#define CPROVER_GOTO_PROGRAMS_LAZY_GOTO_BINARY_H
+
+#include <iosfwd>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <util/hash_cont.h>
+#include <util/irep_serialization.h>
+
+class symbol_tablet;
+class goto_functionst;
+class message_handlert;
+
+/*******************************************************************\
+
+   Class: lazy_goto_binaryt
+
+ Purpose: Gives access to the symbols and function bodies of a goto
+          binary in format version 4 (see write_goto_binary_v4)
+          without reading all of it. The file is memory mapped,
+          and only the string table and the index are read when
+          opening it; symbols and functions are deserialised when
+          they are loaded.
+
+\*******************************************************************/
+
+class lazy_goto_binaryt
+{
+public:
+  lazy_goto_binaryt();
+  ~lazy_goto_binaryt();
+
+  // Maps a goto binary, or the goto-cc section of an ELF file.
+  // Returns true if the file cannot be read or has no index;
+  // only the former is reported as an error.
+  bool open(
+    const std::string &filename,
+    message_handlert &message_handler);
+
+  // Reads the rest of the stream, which must be positioned
+  // just after the version of a version 4 goto binary.
+  bool read(
+    std::istream &in,
+    const std::string &filename,
+    message_handlert &message_handler);
+
+  bool has_symbol(const irep_idt &identifier) const
+  {
+    return symbol_index.find(identifier)!=symbol_index.end();
+  }
+
+  bool has_function(const irep_idt &identifier) const
+  {
+    return function_index.find(identifier)!=function_index.end();
+  }
+
+  // The following return true if there is no such symbol or
+  // function, or if it has been loaded before. Function symbols
+  // get an empty function with the right type, as when reading
+  // the whole file.
+  bool load_symbol(
+    const irep_idt &identifier,
+    symbol_tablet &symbol_table,
+    goto_functionst &goto_functions);
+
+  bool load_function(
+    const irep_idt &identifier,
+    goto_functionst &goto_functions);
+
+  // Loads the given symbols and functions, and everything
+  // that is referred to from them, transitively.
+  void load_reachable(
+    const std::list<irep_idt> &roots,
+    symbol_tablet &symbol_table,
+    goto_functionst &goto_functions);
+
+  void load_all(
+    symbol_tablet &symbol_table,
+    goto_functionst &goto_functions);
+
+  // the names of all symbols in the file
+  void get_symbol_names(std::list<irep_idt> &dest) const;
+
+  std::size_t number_of_symbols() const { return symbol_index.size(); }
+  std::size_t number_of_functions() const { return function_index.size(); }
+  std::size_t symbols_loaded() const { return number_of_symbols_loaded; }
+  std::size_t functions_loaded() const { return number_of_functions_loaded; }
+
+protected:
+  // the file contents, starting after the version
+  const char *data;
+  std::size_t size;
+
+  // either mapped, or read into the buffer
+  void *mapping;
+  std::size_t mapping_size;
+  std::vector<char> buffer;
+
+  struct entryt
+  {
+    std::size_t offset;
+    bool loaded;
+  };
+
+  typedef hash_map_cont<irep_idt, entryt, irep_id_hash> indext;
+  indext symbol_index, function_index;
+
+  std::size_t number_of_symbols_loaded, number_of_functions_loaded;
+
+  // the strings are shared by all records
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irepconverter;
+
+  void close();
+  bool read_index(const std::string &filename, message_handlert &);
+
+  void find_identifiers(
+    const irept &src,
+    std::list<irep_idt> &dest);
+};
+
+#endif
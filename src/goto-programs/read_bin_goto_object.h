@@ -14,9 +14,13 @@ Date: May 2007
 #include <iosfwd>
 #include <string>
 
+#include <util/irep.h>
+
 class symbol_tablet;
+class symbolt;
 class goto_functionst;
 class message_handlert;
+class irep_serializationt;
 
 bool read_bin_goto_object(
   std::istream &in,
@@ -25,4 +29,16 @@ bool read_bin_goto_object(
   goto_functionst &goto_functions,
   message_handlert &message_handler);
 
+// the records of the format, shared by all versions that use them
+
+void read_bin_symbol(
+  std::istream &in,
+  irep_serializationt &irepconverter,
+  symbolt &symbol);
+
+irep_idt read_bin_goto_function(
+  std::istream &in,
+  irep_serializationt &irepconverter,
+  goto_functionst &goto_functions);
+
 #endif /*READ_BIN_GOTO_OBJECT_H_*/
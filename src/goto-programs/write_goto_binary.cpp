@@ -6,7 +6,15 @@ Author: CM Wintersteiger
 
 \*******************************************************************/
 
+#include <algorithm>
 #include <fstream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#ifdef THREAD_SAFE_IREP
+#include <thread>
+#endif
 
 #include <util/message.h>
 #include <util/irep_serialization.h>
@@ -16,13 +24,116 @@ Author: CM Wintersteiger
 
 /*******************************************************************\
 
+Function: write_bin_symbol
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Writes a symbol in goto binary format ver 3 and 4
+
+\*******************************************************************/
+
+static void write_bin_symbol(
+  std::ostream &out,
+  const symbolt &sym,
+  irep_serializationt &irepconverter)
+{
+  // Since version 2, symbols are not converted to ireps,
+  // instead they are saved in a custom binary format
+
+  irepconverter.reference_convert(sym.type, out);
+  irepconverter.reference_convert(sym.value, out);
+  irepconverter.reference_convert(sym.location, out);
+
+  irepconverter.write_string_ref(out, sym.name);
+  irepconverter.write_string_ref(out, sym.module);
+  irepconverter.write_string_ref(out, sym.base_name);
+  irepconverter.write_string_ref(out, sym.mode);
+  irepconverter.write_string_ref(out, sym.pretty_name);
+
+  write_gb_word(out, 0); // old: sym.ordering
+
+  unsigned flags=0;
+  flags = (flags << 1) | (int)sym.is_weak;
+  flags = (flags << 1) | (int)sym.is_type;
+  flags = (flags << 1) | (int)sym.is_property;
+  flags = (flags << 1) | (int)sym.is_macro;
+  flags = (flags << 1) | (int)sym.is_exported;
+  flags = (flags << 1) | (int)sym.is_input;
+  flags = (flags << 1) | (int)sym.is_output;
+  flags = (flags << 1) | (int)sym.is_state_var;
+  flags = (flags << 1) | (int)sym.is_parameter;
+  flags = (flags << 1) | (int)sym.is_auxiliary;
+  flags = (flags << 1) | (int)false; // sym.binding;
+  flags = (flags << 1) | (int)sym.is_lvalue;
+  flags = (flags << 1) | (int)sym.is_static_lifetime;
+  flags = (flags << 1) | (int)sym.is_thread_local;
+  flags = (flags << 1) | (int)sym.is_file_local;
+  flags = (flags << 1) | (int)sym.is_extern;
+  flags = (flags << 1) | (int)sym.is_volatile;
+
+  write_gb_word(out, flags);
+}
+
+/*******************************************************************\
+
+Function: write_bin_goto_function
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Writes the body of a goto function in goto binary
+          format ver 3 and 4
+
+\*******************************************************************/
+
+static void write_bin_goto_function(
+  std::ostream &out,
+  const irep_idt &name,
+  const goto_functionst::goto_functiont &function,
+  irep_serializationt &irepconverter)
+{
+  // Since version 2, goto functions are not converted to ireps,
+  // instead they are saved in a custom binary format
+
+  write_gb_string(out, id2string(name)); // name
+  write_gb_word(out, function.body.instructions.size()); // # instructions
+
+  forall_goto_program_instructions(i_it, function.body)
+  {
+    const goto_programt::instructiont &instruction = *i_it;
+
+    irepconverter.reference_convert(instruction.code, out);
+    irepconverter.write_string_ref(out, instruction.function);
+    irepconverter.reference_convert(instruction.source_location, out);
+    write_gb_word(out, (long)instruction.type);
+    irepconverter.reference_convert(instruction.guard, out);
+    irepconverter.write_string_ref(out, irep_idt()); // former event
+    write_gb_word(out, instruction.target_number);
+
+    write_gb_word(out, instruction.targets.size());
+
+    for(const auto & t_it : instruction.targets)
+      write_gb_word(out, t_it->target_number);
+
+    write_gb_word(out, instruction.labels.size());
+
+    for(const auto & l_it : instruction.labels)
+      irepconverter.write_string_ref(out, l_it);
+  }
+}
+
+/*******************************************************************\
+
 Function: goto_programt::write_goto_binary_v3
 
   Inputs:
 
  Outputs:
 
- Purpose: Writes a goto program to disc, using goto binary format ver 2
+ Purpose: Writes a goto program to disc, using goto binary format ver 3
 
 \*******************************************************************/
 
@@ -37,45 +148,7 @@ bool write_goto_binary_v3(
   write_gb_word(out, lsymbol_table.symbols.size());
 
   forall_symbols(it, lsymbol_table.symbols)
-  {
-    // Since version 2, symbols are not converted to ireps,
-    // instead they are saved in a custom binary format
-
-    const symbolt &sym = it->second;
-
-    irepconverter.reference_convert(sym.type, out);
-    irepconverter.reference_convert(sym.value, out);
-    irepconverter.reference_convert(sym.location, out);
-
-    irepconverter.write_string_ref(out, sym.name);
-    irepconverter.write_string_ref(out, sym.module);
-    irepconverter.write_string_ref(out, sym.base_name);
-    irepconverter.write_string_ref(out, sym.mode);
-    irepconverter.write_string_ref(out, sym.pretty_name);
-
-    write_gb_word(out, 0); // old: sym.ordering
-
-    unsigned flags=0;
-    flags = (flags << 1) | (int)sym.is_weak;
-    flags = (flags << 1) | (int)sym.is_type;
-    flags = (flags << 1) | (int)sym.is_property;
-    flags = (flags << 1) | (int)sym.is_macro;
-    flags = (flags << 1) | (int)sym.is_exported;
-    flags = (flags << 1) | (int)sym.is_input;
-    flags = (flags << 1) | (int)sym.is_output;
-    flags = (flags << 1) | (int)sym.is_state_var;
-    flags = (flags << 1) | (int)sym.is_parameter;
-    flags = (flags << 1) | (int)sym.is_auxiliary;
-    flags = (flags << 1) | (int)false; // sym.binding;
-    flags = (flags << 1) | (int)sym.is_lvalue;
-    flags = (flags << 1) | (int)sym.is_static_lifetime;
-    flags = (flags << 1) | (int)sym.is_thread_local;
-    flags = (flags << 1) | (int)sym.is_file_local;
-    flags = (flags << 1) | (int)sym.is_extern;
-    flags = (flags << 1) | (int)sym.is_volatile;
-
-    write_gb_word(out, flags);
-  }
+    write_bin_symbol(out, it->second, irepconverter);
 
   // now write functions, but only those with body
 
@@ -89,42 +162,273 @@ bool write_goto_binary_v3(
   for(const auto & it : functions.function_map)
   {
     if(it.second.body_available())
+      write_bin_goto_function(out, it.first, it.second, irepconverter);
+  }
+
+  //irepconverter.output_map(f);
+  //irepconverter.output_string_map(f);
+
+  return false;
+}
+
+/*******************************************************************\
+
+   Class: goto_binary_chunkt
+
+ Purpose: A range of the records of a version 4 goto binary,
+          serialised independently of all other chunks, either
+          directly into the output or into a buffer
+
+\*******************************************************************/
+
+class goto_binary_chunkt
+{
+public:
+  struct recordt
+  {
+    irep_idt name;
+    const symbolt *symbol;
+    const goto_functionst::goto_functiont *function;
+  };
+
+  typedef std::vector<recordt> recordst;
+
+  goto_binary_chunkt(
+    recordst::const_iterator _begin,
+    recordst::const_iterator _end):
+    begin(_begin),
+    end(_end),
+    out(&buffer),
+    irepconverter(ireps_container),
+    size(0)
+  {
+    irepconverter.set_inline_strings(false);
+  }
+
+  recordst::const_iterator begin, end;
+
+  // relative to the beginning of the chunk
+  std::vector<std::size_t> offsets;
+
+  // the buffer is used unless the chunk is written directly
+  std::ostream *out;
+  std::stringstream buffer;
+
+  bool is_buffered() const
+  {
+    return out==&buffer;
+  }
+
+  // the strings that are referenced
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irepconverter;
+
+  void operator()()
+  {
+    offsets.reserve(end-begin);
+
+    std::streampos start=out->tellp();
+
+    for(recordst::const_iterator it=begin; it!=end; it++)
     {
-      // Since version 2, goto functions are not converted to ireps,
-      // instead they are saved in a custom binary format
+      // no sharing of ireps between records
+      irepconverter.clear_ireps();
+      offsets.push_back(out->tellp()-start);
+
+      if(it->symbol!=NULL)
+        write_bin_symbol(*out, *it->symbol, irepconverter);
+      else
+        write_bin_goto_function(
+          *out, it->name, *it->function, irepconverter);
+    }
 
-      write_gb_string(out, id2string(it.first)); // name
-      write_gb_word(out, it.second.body.instructions.size()); // # instructions
+    size=out->tellp()-start;
+  }
 
-      forall_goto_program_instructions(i_it, it.second.body)
-      {
-        const goto_programt::instructiont &instruction = *i_it;
+  std::size_t size;
+};
 
-        irepconverter.reference_convert(instruction.code, out);
-        irepconverter.write_string_ref(out, instruction.function);
-        irepconverter.reference_convert(instruction.source_location, out);
-        write_gb_word(out, (long)instruction.type);
-        irepconverter.reference_convert(instruction.guard, out);
-        irepconverter.write_string_ref(out, irep_idt()); // former event
-        write_gb_word(out, instruction.target_number);
+/*******************************************************************\
+
+Function: write_index_offset
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: fixed width, least-significant byte first
+
+\*******************************************************************/
+
+static void write_index_offset(std::ostream &out, std::size_t offset)
+{
+  for(unsigned i=0; i<GOTO_BINARY_OFFSET_BYTES; i++)
+    out.put(char((offset>>(8*i))&0xff));
+}
+
+/*******************************************************************\
+
+Function: goto_programt::write_goto_binary_v4
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Writes a goto program to disc, using goto binary format
+          ver 4. Each symbol and each function body is a record
+          that can be read on its own, using the offsets in the
+          index at the end of the file; the strings are shared
+          by all records and are stored with the index. See
+          lazy_goto_binaryt for the reader.
 
-        write_gb_word(out, instruction.targets.size());
+          The records are serialised in chunks, in parallel when
+          ireps are thread safe. The first chunk goes directly
+          into the output, and the offset of the index is filled
+          in at the end. Only if the output cannot seek are all
+          chunks buffered first. The output does not depend on
+          the number of chunks, nor on whether it is buffered.
 
-        for(const auto & t_it : instruction.targets)
-          write_gb_word(out, t_it->target_number);
+\*******************************************************************/
+
+bool write_goto_binary_v4(
+  std::ostream &out,
+  const symbol_tablet &lsymbol_table,
+  const goto_functionst &functions)
+{
+  goto_binary_chunkt::recordst records;
+  records.reserve(
+    lsymbol_table.symbols.size()+functions.function_map.size());
+
+  forall_symbols(it, lsymbol_table.symbols)
+  {
+    goto_binary_chunkt::recordt record;
+    record.name=it->first;
+    record.symbol=&it->second;
+    record.function=NULL;
+    records.push_back(record);
+  }
 
-        write_gb_word(out, instruction.labels.size());
+  std::size_t number_of_symbols=records.size();
 
-        for(const auto & l_it : instruction.labels)
-          irepconverter.write_string_ref(out, l_it);
-      }
+  for(const auto & it : functions.function_map)
+  {
+    if(it.second.body_available())
+    {
+      goto_binary_chunkt::recordt record;
+      record.name=it.first;
+      record.symbol=NULL;
+      record.function=&it.second;
+      records.push_back(record);
     }
   }
 
-  //irepconverter.output_map(f);
-  //irepconverter.output_string_map(f);
+  // at least a few hundred records per chunk
+  std::size_t number_of_chunks=1;
 
-  return false;
+  #ifdef THREAD_SAFE_IREP
+  number_of_chunks=std::max(1u, std::thread::hardware_concurrency());
+  number_of_chunks=std::min(number_of_chunks, records.size()/256+1);
+  #endif
+
+  std::vector<std::unique_ptr<goto_binary_chunkt> > chunks;
+
+  for(std::size_t i=0; i<number_of_chunks; i++)
+    chunks.push_back(std::unique_ptr<goto_binary_chunkt>(
+      new goto_binary_chunkt(
+        records.begin()+records.size()*i/number_of_chunks,
+        records.begin()+records.size()*(i+1)/number_of_chunks)));
+
+  // all offsets are relative to the end of the version,
+  // where the offset of the index is stored
+  std::streampos start=out.tellp();
+  bool seekable=start!=std::streampos(-1);
+
+  if(seekable)
+  {
+    write_index_offset(out, 0); // filled in below
+    chunks.front()->out=&out;
+  }
+
+  #ifdef THREAD_SAFE_IREP
+  std::vector<std::thread> workers;
+
+  for(std::size_t i=1; i<number_of_chunks; i++)
+    workers.push_back(std::thread(std::ref(*chunks[i])));
+
+  (*chunks.front())();
+
+  for(auto &worker : workers)
+    worker.join();
+  #else
+  (*chunks.front())();
+  #endif
+
+  std::size_t index_offset=GOTO_BINARY_OFFSET_BYTES;
+  for(const auto &chunk : chunks)
+    index_offset+=chunk->size;
+
+  if(!seekable)
+    write_index_offset(out, index_offset);
+
+  // the records, and the strings used by any of them
+  irep_serializationt::ireps_containert::string_mapt &string_map=
+    chunks.front()->ireps_container.string_map;
+
+  for(const auto &chunk : chunks)
+  {
+    if(chunk->is_buffered() && chunk->size!=0)
+      out << chunk->buffer.rdbuf();
+
+    const irep_serializationt::ireps_containert::string_mapt &chunk_map=
+      chunk->ireps_container.string_map;
+
+    if(chunk_map.size()>string_map.size())
+      string_map.resize(chunk_map.size(), false);
+
+    for(std::size_t id=0; id<chunk_map.size(); id++)
+      if(chunk_map[id])
+        string_map[id]=true;
+
+    if(chunk!=chunks.front())
+      chunks.front()->ireps_container.binary_strings.insert(
+        chunk->ireps_container.binary_strings.begin(),
+        chunk->ireps_container.binary_strings.end());
+  }
+
+  // the index
+  chunks.front()->irepconverter.write_string_table(out);
+
+  std::size_t offset=GOTO_BINARY_OFFSET_BYTES;
+  std::size_t record_nr=0;
+
+  write_gb_word(out, number_of_symbols);
+
+  for(const auto &chunk : chunks)
+  {
+    for(std::size_t i=0; i<chunk->offsets.size(); i++, record_nr++)
+    {
+      if(record_nr==number_of_symbols)
+        write_gb_word(out, records.size()-number_of_symbols);
+
+      write_gb_string(out, id2string(records[record_nr].name));
+      write_gb_word(out, offset+chunk->offsets[i]);
+    }
+
+    offset+=chunk->size;
+  }
+
+  if(record_nr==number_of_symbols)
+    write_gb_word(out, 0);
+
+  if(seekable)
+  {
+    std::streampos end=out.tellp();
+    out.seekp(start);
+    write_index_offset(out, index_offset);
+    out.seekp(end);
+  }
+
+  return !out;
 }
 
 /*******************************************************************\
@@ -165,6 +469,10 @@ bool write_goto_binary(
       out, lsymbol_table, functions,
       irepconverter);
 
+  case 4:
+    return write_goto_binary_v4(
+      out, lsymbol_table, functions);
+
   default:
     throw "Unknown goto binary version";
   }
@@ -9,8 +9,13 @@ Author: CM Wintersteiger
 #ifndef CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 #define CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 
+// version 4 is indexed for lazy loading, but larger; written
+// with goto-cc --indexed-goto-binary
 #define GOTO_BINARY_VERSION 3
 
+// width of the index offset in the header of version 4
+#define GOTO_BINARY_OFFSET_BYTES 8
+
 #include <iosfwd>
 #include <string>
 
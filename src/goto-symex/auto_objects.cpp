@@ -28,12 +28,12 @@ Function: goto_symext::make_auto_object
 
 exprt goto_symext::make_auto_object(const typet &type)
 {
-  dynamic_counter++;
+  const unsigned dynamic_count=++dynamic_counter;
 
   // produce auto-object symbol
   symbolt symbol;
 
-  symbol.base_name="auto_object"+i2string(dynamic_counter);
+  symbol.base_name="auto_object"+i2string(dynamic_count);
   symbol.name="symex::"+id2string(symbol.base_name);
   symbol.is_lvalue=true;
   symbol.type=type;
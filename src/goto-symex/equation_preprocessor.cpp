@@ -0,0 +1,705 @@
+/*******************************************************************\
+
+Module: Word-Level Preprocessing of the SSA Equation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <algorithm>
+#include <cassert>
+
+#include <util/arith_tools.h>
+#include <util/simplify_expr.h>
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+#include "equation_preprocessor.h"
+
+/*******************************************************************\
+
+Function: is_integer_bv
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static bool is_integer_bv(const typet &type)
+{
+  return type.id()==ID_unsignedbv ||
+         type.id()==ID_signedbv;
+}
+
+/*******************************************************************\
+
+Function: is_word_level
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: types whose definitions are cheap to inline
+
+\*******************************************************************/
+
+static bool is_word_level(const typet &type)
+{
+  return type.id()==ID_bool ||
+         type.id()==ID_unsignedbv ||
+         type.id()==ID_signedbv ||
+         type.id()==ID_bv ||
+         type.id()==ID_c_bool ||
+         type.id()==ID_c_enum ||
+         type.id()==ID_pointer;
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: A single pass in the order of the steps, which is the
+          order of the definitions, followed by a backwards pass
+          that drops the hidden assignments that are no longer used.
+
+\*******************************************************************/
+
+void equation_preprocessort::operator()(symex_target_equationt &equation)
+{
+  assert(!equation.has_threads());
+
+  // Equalities that an assumption implies may be used in the steps
+  // that follow it, as only the assertions after the assumption
+  // depend on those steps. Constraints are global, though.
+  bool has_constraints=false;
+
+  for(const auto &step : equation.SSA_steps)
+  {
+    if(step.ignore)
+      continue;
+
+    count_uses(step);
+
+    if(step.is_constraint())
+      has_constraints=true;
+  }
+
+  for(auto &step : equation.SSA_steps)
+  {
+    if(step.ignore)
+      continue;
+
+    rewrite(step.guard);
+
+    if(step.is_assignment())
+    {
+      rewrite(step.ssa_rhs);
+      define(step);
+      step.cond_expr=equal_exprt(step.ssa_lhs, step.ssa_rhs);
+    }
+    else if(step.cond_expr.is_not_nil() && !step.is_decl())
+    {
+      rewrite(step.cond_expr);
+
+      if(step.is_assume() &&
+         step.guard.is_true() &&
+         !has_constraints)
+        propagate(step.cond_expr);
+    }
+  }
+
+  eliminate(equation);
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::count_uses
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void equation_preprocessort::count_uses(const exprt &expr)
+{
+  if(expr.id()==ID_symbol)
+    use_count[to_symbol_expr(expr).get_identifier()]++;
+  else
+    forall_operands(it, expr)
+      count_uses(*it);
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::count_uses
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the symbols that the conversion of the step, or the
+          trace, refers to
+
+\*******************************************************************/
+
+void equation_preprocessort::count_uses(
+  const symex_target_equationt::SSA_stept &SSA_step)
+{
+  count_uses(SSA_step.guard);
+
+  if(SSA_step.is_assignment())
+  {
+    count_uses(SSA_step.ssa_rhs);
+
+    // the indices in the full lhs are evaluated for the trace
+    if(SSA_step.ssa_full_lhs!=SSA_step.ssa_lhs)
+      count_uses(SSA_step.ssa_full_lhs);
+  }
+  else if(!SSA_step.is_decl())
+    count_uses(SSA_step.cond_expr);
+
+  for(const auto &arg : SSA_step.io_args)
+    count_uses(arg);
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::substitute
+
+  Inputs:
+
+ Outputs: true if nothing was replaced
+
+ Purpose: Replaces symbols by their definitions or values. The
+          operands are copied, such that only the parts that
+          change are unshared.
+
+\*******************************************************************/
+
+bool equation_preprocessort::substitute(exprt &expr) const
+{
+  if(expr.id()==ID_symbol)
+  {
+    substitutiont::const_iterator it=
+      substitution.find(to_symbol_expr(expr).get_identifier());
+
+    if(it==substitution.end())
+      return true;
+
+    expr=it->second;
+    return false;
+  }
+
+  bool result=true;
+  const exprt &const_expr=expr;
+
+  for(std::size_t i=0; i<const_expr.operands().size(); i++)
+  {
+    exprt op=const_expr.operands()[i];
+
+    if(!substitute(op))
+    {
+      expr.operands()[i]=op;
+      result=false;
+    }
+  }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::rewrite
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void equation_preprocessort::rewrite(exprt &expr)
+{
+  if(!substitute(expr))
+    simplify(expr, ns);
+
+  narrow(expr);
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::define
+
+  Inputs: an assignment, whose rhs has been rewritten
+
+ Outputs:
+
+ Purpose: Copies are propagated, a rhs that has been defined
+          before is replaced by the lhs of that definition, and
+          hidden definitions used once are inlined, such that
+          they can be dropped. Visible definitions remain, as the
+          trace shows their values; inlining those would convert
+          their rhs twice.
+
+\*******************************************************************/
+
+void equation_preprocessort::define(
+  symex_target_equationt::SSA_stept &SSA_step)
+{
+  const irep_idt &identifier=SSA_step.ssa_lhs.get_identifier();
+  exprt &rhs=SSA_step.ssa_rhs;
+
+  if(rhs.id()==ID_symbol || rhs.is_constant())
+  {
+    substitution.insert(std::make_pair(identifier, rhs));
+    propagated_equalities++;
+    return;
+  }
+
+  definitionst::const_iterator d_it=definitions.find(rhs);
+
+  if(d_it!=definitions.end())
+  {
+    rhs=d_it->second;
+    substitution.insert(std::make_pair(identifier, rhs));
+    common_subexpressions++;
+    return;
+  }
+
+  definitions.insert(std::make_pair(rhs, SSA_step.ssa_lhs));
+
+  use_countt::const_iterator u_it=use_count.find(identifier);
+
+  if(SSA_step.hidden &&
+     u_it!=use_count.end() &&
+     u_it->second==1 &&
+     is_word_level(ns.follow(rhs.type())))
+  {
+    substitution.insert(std::make_pair(identifier, rhs));
+    inlined_definitions++;
+  }
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::propagate
+
+  Inputs: an unguarded assumption
+
+ Outputs:
+
+ Purpose: equalities with constants or other symbols
+
+\*******************************************************************/
+
+void equation_preprocessort::propagate(const exprt &assumption)
+{
+  if(assumption.id()==ID_and)
+  {
+    forall_operands(it, assumption)
+      propagate(*it);
+  }
+  else if(assumption.id()==ID_symbol)
+  {
+    if(substitution.insert(std::make_pair(
+         to_symbol_expr(assumption).get_identifier(),
+         true_exprt())).second)
+      propagated_equalities++;
+  }
+  else if(assumption.id()==ID_not &&
+          assumption.op0().id()==ID_symbol)
+  {
+    if(substitution.insert(std::make_pair(
+         to_symbol_expr(assumption.op0()).get_identifier(),
+         false_exprt())).second)
+      propagated_equalities++;
+  }
+  else if(assumption.id()==ID_equal &&
+          assumption.operands().size()==2)
+  {
+    const exprt &lhs=assumption.op0();
+    const exprt &rhs=assumption.op1();
+
+    if(lhs==rhs)
+      return;
+
+    if(lhs.id()==ID_symbol &&
+       (rhs.is_constant() || rhs.id()==ID_symbol))
+    {
+      if(substitution.insert(std::make_pair(
+           to_symbol_expr(lhs).get_identifier(), rhs)).second)
+        propagated_equalities++;
+    }
+    else if(rhs.id()==ID_symbol && lhs.is_constant())
+    {
+      if(substitution.insert(std::make_pair(
+           to_symbol_expr(rhs).get_identifier(), lhs)).second)
+        propagated_equalities++;
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::eliminate
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: ignores the hidden assignments to symbols that nothing
+          refers to any more
+
+\*******************************************************************/
+
+void equation_preprocessort::eliminate(symex_target_equationt &equation)
+{
+  use_count.clear();
+
+  for(symex_target_equationt::SSA_stepst::reverse_iterator
+      it=equation.SSA_steps.rbegin();
+      it!=equation.SSA_steps.rend();
+      it++)
+  {
+    if(it->ignore)
+      continue;
+
+    if(it->is_assignment() &&
+       it->hidden &&
+       use_count.find(it->ssa_lhs.get_identifier())==use_count.end())
+    {
+      it->ignore=true;
+      eliminated_assignments++;
+      continue;
+    }
+
+    count_uses(*it);
+  }
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::is_extension
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a typecast that zero- or sign-extends a narrower
+          bit-vector
+
+\*******************************************************************/
+
+bool equation_preprocessort::is_extension(
+  const exprt &expr,
+  extensiont &dest)
+{
+  if(expr.id()!=ID_typecast ||
+     expr.operands().size()!=1)
+    return false;
+
+  const typet &type=expr.type();
+  const typet &op_type=expr.op0().type();
+
+  if(!is_integer_bv(type) || !is_integer_bv(op_type))
+    return false;
+
+  std::size_t width=to_bitvector_type(op_type).get_width();
+
+  if(width>=to_bitvector_type(type).get_width())
+    return false;
+
+  dest.op=expr.op0();
+  dest.width=width;
+  dest.is_signed=op_type.id()==ID_signedbv;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::is_narrow_constant
+
+  Inputs: a constant, and how the other operand is extended
+
+ Outputs:
+
+ Purpose: whether the constant is the extension of a narrower
+          one, which then is returned in the smallest width
+
+\*******************************************************************/
+
+bool equation_preprocessort::is_narrow_constant(
+  const exprt &expr,
+  bool is_signed,
+  extensiont &dest)
+{
+  if(!expr.is_constant() || !is_integer_bv(expr.type()))
+    return false;
+
+  mp_integer value;
+  if(to_integer(expr, value))
+    return false;
+
+  std::size_t width=to_bitvector_type(expr.type()).get_width();
+  const mp_integer range=power(2, width);
+
+  // the value of the bit pattern as the extension sees it
+  if(is_signed && expr.type().id()==ID_unsignedbv &&
+     value>=range/2)
+    value-=range;
+  else if(!is_signed && expr.type().id()==ID_signedbv &&
+          value<0)
+    value+=range;
+
+  std::size_t w=1;
+
+  if(is_signed)
+  {
+    while(value<-power(2, w-1) || value>=power(2, w-1))
+      w++;
+  }
+  else
+  {
+    while(value>=power(2, w))
+      w++;
+  }
+
+  if(w>=width)
+    return false;
+
+  if(is_signed)
+    dest.op=from_integer(value, signedbv_typet(w));
+  else
+    dest.op=from_integer(value, unsignedbv_typet(w));
+
+  dest.width=w;
+  dest.is_signed=is_signed;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::get_extensions
+
+  Inputs: a binary expression
+
+ Outputs: false if the operands are not extended the same way
+
+ Purpose:
+
+\*******************************************************************/
+
+bool equation_preprocessort::get_extensions(
+  const exprt &expr,
+  extensiont &a,
+  extensiont &b)
+{
+  const exprt &op0=expr.op0();
+  const exprt &op1=expr.op1();
+
+  if(op0.type()!=op1.type())
+    return false;
+
+  if(is_extension(op0, a))
+  {
+    if(!is_extension(op1, b) &&
+       !is_narrow_constant(op1, a.is_signed, b))
+      return false;
+  }
+  else if(is_extension(op1, b))
+  {
+    if(!is_narrow_constant(op0, b.is_signed, a))
+      return false;
+  }
+  else
+    return false;
+
+  return a.is_signed==b.is_signed;
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::extend
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the narrow operand in a width that is at least its own
+
+\*******************************************************************/
+
+exprt equation_preprocessort::extend(
+  const extensiont &e,
+  const typet &type)
+{
+  if(e.op.type()==type)
+    return e.op;
+
+  if(e.op.is_constant())
+  {
+    mp_integer value;
+    if(!to_integer(e.op, value))
+      return from_integer(value, type);
+  }
+
+  return typecast_exprt(e.op, type);
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::narrow
+
+  Inputs:
+
+ Outputs: true if nothing was narrowed
+
+ Purpose: bottom-up, such that narrowed operations may in turn
+          be operands of narrower ones
+
+\*******************************************************************/
+
+bool equation_preprocessort::narrow(exprt &expr)
+{
+  bool result=true;
+  const exprt &const_expr=expr;
+
+  for(std::size_t i=0; i<const_expr.operands().size(); i++)
+  {
+    exprt op=const_expr.operands()[i];
+
+    if(!narrow(op))
+    {
+      expr.operands()[i]=op;
+      result=false;
+    }
+  }
+
+  if(!narrow_node(expr))
+    result=false;
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: equation_preprocessort::narrow_node
+
+  Inputs:
+
+ Outputs: true if nothing was narrowed
+
+ Purpose: Sums, differences and products of extended operands are
+          computed in the width that their result needs, and then
+          extended. Relations compare the narrow operands.
+
+\*******************************************************************/
+
+bool equation_preprocessort::narrow_node(exprt &expr)
+{
+  if(expr.operands().size()!=2)
+    return true;
+
+  if(expr.id()==ID_plus ||
+     expr.id()==ID_minus ||
+     expr.id()==ID_mult)
+  {
+    if(!is_integer_bv(expr.type()) ||
+       expr.op0().type()!=expr.type())
+      return true;
+
+    extensiont a, b;
+    if(!get_extensions(expr, a, b))
+      return true;
+
+    std::size_t width=to_bitvector_type(expr.type()).get_width();
+    std::size_t new_width;
+    bool is_signed=a.is_signed;
+
+    if(expr.id()==ID_mult)
+      new_width=a.width+b.width;
+    else
+      new_width=std::max(a.width, b.width)+1;
+
+    // the difference of unsigned operands may be negative
+    if(expr.id()==ID_minus)
+      is_signed=true;
+
+    if(new_width>=width)
+      return true;
+
+    typet new_type;
+
+    if(is_signed)
+      new_type=signedbv_typet(new_width);
+    else
+      new_type=unsignedbv_typet(new_width);
+
+    exprt new_expr(expr.id(), new_type);
+    new_expr.copy_to_operands(extend(a, new_type), extend(b, new_type));
+
+    narrowed_bits+=width-new_width;
+    expr=typecast_exprt(new_expr, expr.type());
+
+    return false;
+  }
+  else if(expr.id()==ID_equal ||
+          expr.id()==ID_notequal ||
+          expr.id()==ID_lt ||
+          expr.id()==ID_le ||
+          expr.id()==ID_gt ||
+          expr.id()==ID_ge)
+  {
+    const typet &op_type=expr.op0().type();
+
+    if(!is_integer_bv(op_type))
+      return true;
+
+    extensiont a, b;
+    if(!get_extensions(expr, a, b))
+      return true;
+
+    // sign-extended operands of an unsigned relation are ordered
+    // differently from their narrow values
+    if(expr.id()!=ID_equal &&
+       expr.id()!=ID_notequal &&
+       a.is_signed &&
+       op_type.id()==ID_unsignedbv)
+      return true;
+
+    std::size_t width=to_bitvector_type(op_type).get_width();
+    std::size_t new_width=std::max(a.width, b.width);
+
+    if(new_width>=width)
+      return true;
+
+    typet new_type;
+
+    if(a.is_signed)
+      new_type=signedbv_typet(new_width);
+    else
+      new_type=unsignedbv_typet(new_width);
+
+    expr.op0()=extend(a, new_type);
+    expr.op1()=extend(b, new_type);
+
+    narrowed_bits+=width-new_width;
+
+    return false;
+  }
+
+  return true;
+}
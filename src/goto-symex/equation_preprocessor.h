@@ -0,0 +1,100 @@
+/*******************************************************************\
+
+Module: Word-Level Preprocessing of the SSA Equation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_SYMEX_EQUATION_PREPROCESSOR_H
+#define CPROVER_GOTO_SYMEX_EQUATION_PREPROCESSOR_H
+
+#include <util/hash_cont.h>
+
+#include "symex_target_equation.h"
+
+class namespacet;
+
+/*******************************************************************\
+
+   Class: equation_preprocessort
+
+ Purpose: Rewrites the equation before it is converted: copies
+          and equalities from assumptions are propagated, hidden
+          definitions used once are inlined, repeated right-hand
+          sides are shared, and arithmetic on extended narrow
+          bit-vectors is done at the width that is needed. Hidden
+          assignments that end up unused are ignored.
+
+\*******************************************************************/
+
+class equation_preprocessort
+{
+public:
+  explicit equation_preprocessort(const namespacet &_ns):
+    eliminated_assignments(0),
+    propagated_equalities(0),
+    inlined_definitions(0),
+    common_subexpressions(0),
+    narrowed_bits(0),
+    ns(_ns)
+  {
+  }
+
+  // the equation must not have threads, nor be streamed
+  void operator()(symex_target_equationt &equation);
+
+  // statistics
+  unsigned eliminated_assignments;
+  unsigned propagated_equalities;
+  unsigned inlined_definitions;
+  unsigned common_subexpressions;
+  std::size_t narrowed_bits;
+
+protected:
+  const namespacet &ns;
+
+  typedef hash_map_cont<irep_idt, unsigned, irep_id_hash> use_countt;
+  use_countt use_count;
+
+  typedef hash_map_cont<irep_idt, exprt, irep_id_hash> substitutiont;
+  substitutiont substitution;
+
+  // right-hand sides of the definitions so far, mapped to their lhs
+  typedef hash_map_cont<exprt, ssa_exprt, irep_hash> definitionst;
+  definitionst definitions;
+
+  void count_uses(const exprt &expr);
+  void count_uses(const symex_target_equationt::SSA_stept &SSA_step);
+
+  bool substitute(exprt &expr) const;
+  void rewrite(exprt &expr);
+
+  void define(symex_target_equationt::SSA_stept &SSA_step);
+  void propagate(const exprt &assumption);
+  void eliminate(symex_target_equationt &equation);
+
+  // a narrow operand of an arithmetic operation or relation
+  struct extensiont
+  {
+    exprt op;
+    std::size_t width;
+    bool is_signed;
+  };
+
+  static bool is_extension(const exprt &expr, extensiont &dest);
+  static bool is_narrow_constant(
+    const exprt &expr,
+    bool is_signed,
+    extensiont &dest);
+  static bool get_extensions(
+    const exprt &expr,
+    extensiont &a,
+    extensiont &b);
+  static exprt extend(const extensiont &e, const typet &type);
+
+  bool narrow(exprt &expr);
+  bool narrow_node(exprt &expr);
+};
+
+#endif
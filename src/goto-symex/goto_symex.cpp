@@ -10,8 +10,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "goto_symex.h"
 
-unsigned goto_symext::nondet_count=0;
-unsigned goto_symext::dynamic_counter=0;
+goto_symext::countert goto_symext::nondet_count(0);
+goto_symext::countert goto_symext::dynamic_counter(0);
 
 /*******************************************************************\
 
@@ -12,12 +12,21 @@ Author: Daniel Kroening, kroening@kroening.com
 /*! \defgroup goto_symex Symbolic execution of goto programs
 */
 
+#include <list>
+#include <set>
+#include <memory>
+
+#ifdef THREAD_SAFE_IREP
+#include <atomic>
+#endif
+
 #include <util/options.h>
 #include <util/byte_operators.h>
 
 #include <goto-programs/goto_functions.h>
 
 #include "goto_symex_state.h"
+#include "guard_bdd.h"
 
 class typet;
 class code_typet;
@@ -47,7 +56,13 @@ public:
     symex_targett &_target):
     total_vccs(0),
     remaining_vccs(0),
+    phi_nodes(0),
+    split_paths(0),
+    paused_paths(0),
+    function_summary_hits(0),
+    function_summary_misses(0),
     constant_propagation(true),
+    bdd_guards(false),
     new_symbol_table(_new_symbol_table),
     ns(_ns),
     target(_target),
@@ -89,17 +104,114 @@ public:
 
   // statistics
   unsigned total_vccs, remaining_vccs;
+  unsigned phi_nodes;
+  unsigned split_paths;
+  unsigned paused_paths;
+  unsigned function_summary_hits, function_summary_misses;
+
+  // With option incremental, the paths that reach the bound of a
+  // loop selected by pause_at_loop_bound are paused at its back
+  // edge instead of being cut off, and likewise those that reach
+  // the bound of a recursion at the call. They are resumed once the bound
+  // has been raised, or are closed with the unwinding assertion or
+  // assumption once the bound is not raised any further.
+  bool has_paused_paths() const
+  {
+    return !pending_paused_paths.empty();
+  }
+
+  // true on the paths that would do further iterations
+  exprt paused_paths_guard() const;
+
+  void resume_paused_paths(const goto_functionst &goto_functions);
+  void close_paused_paths();
 
   bool constant_propagation;
 
+  // join guards at merge points using guard_bdd
+  bool bdd_guards;
+
   optionst options;
   symbol_tablet &new_symbol_table;
 
+  // for joining guards with --bdd-guards
+  guard_bddt guard_bdd;
+
 protected:
   const namespacet &ns;
   symex_targett &target;
   unsigned atomic_section_counter;
 
+  // for the paths split off by split_path: a copy of the
+  // configuration of other that writes to the given target
+  goto_symext(
+    const goto_symext &other,
+    const namespacet &_ns,
+    symbol_tablet &_new_symbol_table,
+    symex_targett &_target);
+
+  // creates the instance that does symex for a path that has
+  // been split off; to be overloaded by derived classes
+  virtual goto_symext *new_split_symex(
+    const namespacet &_ns,
+    symbol_tablet &_new_symbol_table,
+    symex_targett &_target);
+
+  /** symex until all threads of the state have ended */
+  void symex_until_end(
+    statet &state,
+    const goto_functionst &goto_functions);
+
+  // With option split-depth, the first branches of each path
+  // are not merged; the other side of the branch is split off
+  // and run on a separate thread, with its own equation, which
+  // is appended to the target once the paths have ended.
+  struct split_patht;
+  typedef std::list<std::shared_ptr<split_patht> > split_pathst;
+  split_pathst running_split_paths, new_split_paths;
+
+  bool split_path(
+    statet &state,
+    const guardt &guard,
+    goto_programt::const_targett pc);
+
+  void start_split_paths(const goto_functionst &goto_functions);
+
+  void join_split_paths(const goto_functionst &goto_functions);
+
+  struct paused_patht
+  {
+    paused_patht(const statet &_state, const exprt &_cond, bool _is_call):
+      state(_state),
+      cond(_cond),
+      is_call(_is_call)
+    {
+    }
+
+    // the state at the back edge, before its loop counter has
+    // been increased, or at the recursive call
+    statet state;
+
+    // the renamed condition of the back edge, or true for a call
+    exprt cond;
+
+    bool is_call;
+  };
+
+  typedef std::list<paused_patht> paused_pathst;
+  paused_pathst pending_paused_paths;
+
+  paused_patht &add_paused_path(
+    statet &state,
+    const exprt &cond,
+    bool is_call);
+  void pause_path(statet &state, const exprt &cond);
+  void pause_call(statet &state);
+  static bool can_merge_paused_paths(
+    const paused_patht &a,
+    const paused_patht &b);
+  void merge_paused_paths(paused_pathst &paths);
+
   friend class symex_dereference_statet;
 
   void new_name(symbolt &symbol);
@@ -186,6 +298,12 @@ protected:
 
   virtual void loop_bound_exceeded(statet &state, const exprt &guard);
 
+  // whether to pause the paths that reach the bound of the loop
+  virtual bool pause_at_loop_bound(const symex_targett::sourcet &source)
+  {
+    return false;
+  }
+
   // function calls
 
   void pop_frame(statet &state);
@@ -217,6 +335,16 @@ protected:
     const unsigned thread_nr,
     unsigned unwind);
 
+  void recursion_bound_exceeded(statet &state);
+
+  // whether to pause the paths that reach the bound of the recursion
+  virtual bool pause_at_recursion_bound(
+    const irep_idt &identifier,
+    const unsigned thread_nr)
+  {
+    return false;
+  }
+
   void parameter_assignments(
     const irep_idt function_identifier,
     const goto_functionst::goto_functiont &goto_function,
@@ -232,6 +360,47 @@ protected:
     exprt &code,
     const irep_idt &identifier);
 
+  // With option function-summaries, the value returned by a call of
+  // a function without side effects, loops, calls and properties is
+  // reused by the later calls with the same renamed arguments and
+  // the same values of the globals read by the function. The body
+  // is done under a true guard the first time, so that its steps
+  // hold on any path.
+  struct function_summary_infot
+  {
+    function_summary_infot():is_summarisable(false)
+    {
+    }
+
+    bool is_summarisable;
+    std::set<irep_idt> globals_read;
+  };
+
+  typedef hash_map_cont<irep_idt, function_summary_infot, irep_id_hash>
+    function_summary_infost;
+  function_summary_infost function_summary_infos;
+
+  // maps the key of a call to the renamed return value
+  typedef hash_map_cont<exprt, exprt, irep_hash> function_summariest;
+  function_summariest function_summaries;
+
+  const function_summary_infot &get_function_summary_info(
+    const irep_idt &identifier,
+    const goto_functionst::goto_functiont &goto_function);
+
+  exprt function_summary_key(
+    const irep_idt &identifier,
+    const goto_functionst::goto_functiont &goto_function,
+    statet &state,
+    const exprt::operandst &arguments);
+
+  bool apply_function_summary(
+    const irep_idt &identifier,
+    const exprt &key,
+    statet &state);
+
+  void store_function_summary(statet &state);
+
   // exceptions
 
   void symex_throw(statet &state);
@@ -266,8 +435,15 @@ protected:
   virtual void symex_input         (statet &state, const codet &code);
   virtual void symex_output        (statet &state, const codet &code);
 
-  static unsigned nondet_count;
-  static unsigned dynamic_counter;
+  // shared by the threads of split paths
+  #ifdef THREAD_SAFE_IREP
+  typedef std::atomic<unsigned> countert;
+  #else
+  typedef unsigned countert;
+  #endif
+
+  static countert nondet_count;
+  static countert dynamic_counter;
 
   void read(exprt &expr);
   void replace_nondet(exprt &expr);
@@ -29,6 +29,7 @@ Function: goto_symex_statet::goto_symex_statet
 
 goto_symex_statet::goto_symex_statet():
   depth(0),
+  split_depth(0),
   symex_target(NULL),
   atomic_section_id(0),
   record_events(true)
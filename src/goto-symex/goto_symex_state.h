@@ -9,12 +9,20 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_SYMEX_GOTO_SYMEX_STATE_H
 #define CPROVER_GOTO_SYMEX_GOTO_SYMEX_STATE_H
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
 
+#ifdef THREAD_SAFE_IREP
+#include <mutex>
+#endif
+
+#include <util/hash_cont.h>
 #include <util/guard.h>
 #include <util/std_expr.h>
 #include <util/i2string.h>
 #include <util/ssa_expr.h>
+#include <util/sharing_map.h>
 
 #include <pointer-analysis/value_set.h>
 #include <goto-programs/goto_functions.h>
@@ -30,6 +38,9 @@ public:
   // distance from entry
   unsigned depth;
 
+  // the number of branches at which the path has been split
+  unsigned split_depth;
+
   guardt guard;
   symex_targett::sourcet source;
   symex_targett *symex_target;
@@ -48,19 +59,21 @@ public:
   {
     virtual ~renaming_levelt() { }
 
-    typedef std::map<irep_idt, std::pair<ssa_exprt, unsigned> > current_namest;
+    // shared with the copies in goto_statet and in the frames
+    typedef sharing_mapt<irep_idt, std::pair<ssa_exprt, unsigned>,
+                         irep_id_hash> current_namest;
     current_namest current_names;
 
     unsigned current_count(const irep_idt &identifier) const
     {
-      current_namest::const_iterator it=
-        current_names.find(identifier);
-      return it==current_names.end()?0:it->second.second;
+      const std::pair<ssa_exprt, unsigned> *entry=
+        current_names.get(identifier);
+      return entry==nullptr?0:entry->second;
     }
 
     void increase_counter(const irep_idt &identifier)
     {
-      assert(current_names.find(identifier)!=current_names.end());
+      assert(current_names.get(identifier)!=nullptr);
       ++current_names[identifier].second;
     }
 
@@ -95,22 +108,19 @@ public:
 
     void restore_from(const current_namest &other)
     {
-      current_namest::iterator it=current_names.begin();
       for(current_namest::const_iterator
           ito=other.begin();
           ito!=other.end();
           ++ito)
       {
-        while(it!=current_names.end() && it->first<ito->first)
-          ++it;
-        if(it==current_names.end() || ito->first<it->first)
-          current_names.insert(it, *ito);
-        else if(it!=current_names.end())
-        {
-          assert(it->first==ito->first);
-          it->second=ito->second;
-          ++it;
-        }
+        const std::pair<ssa_exprt, unsigned> *entry=
+          current_names.get(ito->first);
+
+        // avoid unsharing what is unchanged
+        if(entry==nullptr ||
+           entry->second!=ito->second.second ||
+           entry->first!=ito->second.first)
+          current_names[ito->first]=ito->second;
       }
     }
 
@@ -122,6 +132,45 @@ public:
 
   struct level2t:public renaming_levelt
   {
+    // With paths that are paused and resumed later on, or split
+    // off and done on threads, the indices are taken from a
+    // counter shared by all paths, which keeps them unique across
+    // the paths.
+    struct index_countert
+    {
+      hash_map_cont<irep_idt, unsigned, irep_id_hash> indices;
+
+      #ifdef THREAD_SAFE_IREP
+      std::mutex mutex;
+      #endif
+    };
+
+    std::shared_ptr<index_countert> index_counter;
+
+    void increase_counter(const irep_idt &identifier)
+    {
+      if(!index_counter)
+      {
+        renaming_levelt::increase_counter(identifier);
+        return;
+      }
+
+      assert(current_names.get(identifier)!=nullptr);
+      unsigned new_index;
+
+      {
+        #ifdef THREAD_SAFE_IREP
+        std::lock_guard<std::mutex> lock(index_counter->mutex);
+        #endif
+
+        unsigned &index=index_counter->indices[identifier];
+        index=std::max(index, current_count(identifier))+1;
+        new_index=index;
+      }
+
+      current_names[identifier].second=new_index;
+    }
+
     level2t() { }
     virtual ~level2t() { }
   } level2;
@@ -130,7 +179,7 @@ public:
   class propagationt
   {
   public:
-    typedef std::map<irep_idt, exprt> valuest;
+    typedef sharing_mapt<irep_idt, exprt, irep_id_hash> valuest;
     valuest values;
     void operator()(exprt &expr);
 
@@ -181,6 +230,8 @@ public:
   // do dereferencing
   value_sett value_set;
 
+  // Copying the maps is constant-time, as they share their
+  // entries with those of the state.
   class goto_statet
   {
   public:
@@ -213,9 +264,9 @@ public:
 
     unsigned level2_current_count(const irep_idt &identifier) const
     {
-      level2t::current_namest::const_iterator it=
-        level2_current_names.find(identifier);
-      return it==level2_current_names.end()?0:it->second.second;
+      const std::pair<ssa_exprt, unsigned> *entry=
+        level2_current_names.get(identifier);
+      return entry==nullptr?0:entry->second;
     }
   };
 
@@ -242,9 +293,15 @@ public:
     typedef std::set<irep_idt> local_objectst;
     local_objectst local_objects;
 
+    // for a call whose summary is produced: its key, and the
+    // guard of the caller, which is restored on return
+    exprt summary_key;
+    guardt summary_guard;
+
     framet():
       return_value(nil_exprt()),
-      hidden_function(false)
+      hidden_function(false),
+      summary_key(nil_exprt())
     {
     }
 
@@ -0,0 +1,363 @@
+/*******************************************************************\
+
+Module: Symbolic Execution -- Guards as BDDs
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <util/std_expr.h>
+
+#include "guard_bdd.h"
+
+/*******************************************************************\
+
+Function: guard_bddt::join
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void guard_bddt::join(guardt &dest, const guardt &src)
+{
+  if(src.is_false() || dest.is_true())
+    return;
+
+  if(dest.is_false() || src.is_true())
+  {
+    dest=src;
+    return;
+  }
+
+  limit_caches();
+
+  dest=as_expr(as_bdd(dest) | as_bdd(src));
+}
+
+/*******************************************************************\
+
+Function: guard_bddt::diff
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void guard_bddt::diff(guardt &g1, const guardt &g2)
+{
+  if(g1.is_true() || g1.is_false() ||
+     g2.is_true() || g2.is_false())
+    return;
+
+  limit_caches();
+
+  const miniBDD::BDD bdd1=as_bdd(g1);
+  const miniBDD::BDD bdd2=as_bdd(g2);
+
+  literalst literals1, literals2;
+  std::map<unsigned, literalst> literals_cache;
+  implied_literals(bdd1, literals1, literals_cache);
+  implied_literals(bdd2, literals2, literals_cache);
+
+  literalst common;
+
+  for(literalst::const_iterator
+      it=literals1.begin();
+      it!=literals1.end();
+      it++)
+  {
+    literalst::const_iterator it2=literals2.find(it->first);
+    if(it2!=literals2.end() && it2->second==it->second)
+      common.insert(*it);
+  }
+
+  if(common.empty())
+    return;
+
+  std::map<unsigned, miniBDD::BDD> restrict_cache;
+  g1=as_expr(restrict_literals(bdd1, common, restrict_cache));
+}
+
+/*******************************************************************\
+
+Function: guard_bddt::limit_caches
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: drops the caches once they are large; the atoms and
+          their variables stay
+
+\*******************************************************************/
+
+void guard_bddt::limit_caches()
+{
+  if(bdd_cache.size()+expr_cache.size()<=max_cache_size)
+    return;
+
+  bdd_cache.clear();
+  expr_cache.clear();
+}
+
+/*******************************************************************\
+
+Function: guard_bddt::as_bdd
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+miniBDD::BDD guard_bddt::as_bdd(const exprt &expr)
+{
+  if(expr.is_true())
+    return mgr.True();
+  else if(expr.is_false())
+    return mgr.False();
+
+  const void *key=&expr.read();
+
+  bdd_cachet::const_iterator c_it=bdd_cache.find(key);
+  if(c_it!=bdd_cache.end())
+    return c_it->second.second;
+
+  miniBDD::BDD result;
+
+  if(expr.id()==ID_and)
+  {
+    result=mgr.True();
+    forall_operands(it, expr)
+      result=result & as_bdd(*it);
+  }
+  else if(expr.id()==ID_or)
+  {
+    result=mgr.False();
+    forall_operands(it, expr)
+      result=result | as_bdd(*it);
+  }
+  else if(expr.id()==ID_not && expr.operands().size()==1)
+    result=!as_bdd(expr.op0());
+  else
+  {
+    atom_mapt::const_iterator a_it=atom_map.find(expr);
+
+    if(a_it!=atom_map.end())
+      result=a_it->second;
+    else
+    {
+      result=mgr.Var("");
+      atoms.push_back(expr);
+      atom_map.insert(std::make_pair(expr, result));
+    }
+  }
+
+  bdd_cache[key]=bdd_cache_entryt(expr, result);
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: conjoin
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a conjunction without nested conjunctions, as guardt::add
+          would build it
+
+\*******************************************************************/
+
+static exprt conjoin(const exprt &a, const exprt &b)
+{
+  if(b.is_true())
+    return a;
+
+  and_exprt result;
+
+  if(b.id()==ID_and)
+  {
+    result.reserve_operands(b.operands().size()+1);
+    result.copy_to_operands(a);
+    forall_operands(it, b)
+      result.copy_to_operands(*it);
+  }
+  else
+    result.copy_to_operands(a, b);
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: guard_bddt::as_expr
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt guard_bddt::as_expr(const miniBDD::BDD &bdd)
+{
+  if(bdd.is_true())
+    return true_exprt();
+  else if(bdd.is_false())
+    return false_exprt();
+
+  expr_cachet::const_iterator c_it=expr_cache.find(bdd.node_number());
+  if(c_it!=expr_cache.end())
+    return c_it->second.second;
+
+  assert(bdd.var()>=1 && bdd.var()<=atoms.size());
+  const exprt &atom=atoms[bdd.var()-1];
+  const miniBDD::BDD &low=bdd.low(), &high=bdd.high();
+
+  exprt result;
+
+  if(low.is_false())
+    result=conjoin(atom, as_expr(high));
+  else if(high.is_false())
+    result=conjoin(not_exprt(atom), as_expr(low));
+  else if(high.is_true())
+    result=or_exprt(atom, as_expr(low));
+  else if(low.is_true())
+    result=or_exprt(not_exprt(atom), as_expr(high));
+  else
+    result=or_exprt(
+      conjoin(atom, as_expr(high)),
+      conjoin(not_exprt(atom), as_expr(low)));
+
+  expr_cache[bdd.node_number()]=expr_cache_entryt(bdd, result);
+
+  // converting the result back is then free
+  bdd_cache[&result.read()]=bdd_cache_entryt(result, bdd);
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: guard_bddt::implied_literals
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the literals on all paths to true, for BDDs other than
+          false
+
+\*******************************************************************/
+
+void guard_bddt::implied_literals(
+  const miniBDD::BDD &bdd,
+  literalst &dest,
+  std::map<unsigned, literalst> &cache)
+{
+  assert(!bdd.is_false());
+
+  dest.clear();
+
+  if(bdd.is_true())
+    return;
+
+  std::map<unsigned, literalst>::const_iterator c_it=
+    cache.find(bdd.node_number());
+
+  if(c_it!=cache.end())
+  {
+    dest=c_it->second;
+    return;
+  }
+
+  const miniBDD::BDD &low=bdd.low(), &high=bdd.high();
+
+  if(low.is_false())
+  {
+    implied_literals(high, dest, cache);
+    dest[bdd.var()]=true;
+  }
+  else if(high.is_false())
+  {
+    implied_literals(low, dest, cache);
+    dest[bdd.var()]=false;
+  }
+  else
+  {
+    // the variable does not occur below, hence only
+    // the literals on both sides remain
+    literalst low_literals, high_literals;
+    implied_literals(low, low_literals, cache);
+    implied_literals(high, high_literals, cache);
+
+    for(literalst::const_iterator
+        it=low_literals.begin();
+        it!=low_literals.end();
+        it++)
+    {
+      literalst::const_iterator h_it=high_literals.find(it->first);
+      if(h_it!=high_literals.end() && h_it->second==it->second)
+        dest.insert(*it);
+    }
+  }
+
+  cache[bdd.node_number()]=dest;
+}
+
+/*******************************************************************\
+
+Function: guard_bddt::restrict_literals
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: sets the given literals, which are implied by the BDD,
+          to true
+
+\*******************************************************************/
+
+miniBDD::BDD guard_bddt::restrict_literals(
+  const miniBDD::BDD &bdd,
+  const literalst &literals,
+  std::map<unsigned, miniBDD::BDD> &cache)
+{
+  if(bdd.is_constant())
+    return bdd;
+
+  std::map<unsigned, miniBDD::BDD>::const_iterator c_it=
+    cache.find(bdd.node_number());
+
+  if(c_it!=cache.end())
+    return c_it->second;
+
+  miniBDD::BDD result;
+  literalst::const_iterator l_it=literals.find(bdd.var());
+
+  if(l_it!=literals.end())
+    result=restrict_literals(
+      l_it->second?bdd.high():bdd.low(), literals, cache);
+  else
+    result=mgr.mk(
+      bdd.var(),
+      restrict_literals(bdd.low(), literals, cache),
+      restrict_literals(bdd.high(), literals, cache));
+
+  cache[bdd.node_number()]=result;
+
+  return result;
+}
@@ -0,0 +1,100 @@
+/*******************************************************************\
+
+Module: Symbolic Execution -- Guards as BDDs
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_SYMEX_GUARD_BDD_H
+#define CPROVER_GOTO_SYMEX_GUARD_BDD_H
+
+#include <map>
+
+#include <util/guard.h>
+#include <util/hash_cont.h>
+
+#include <solvers/miniBDD/miniBDD.h>
+
+/*******************************************************************\
+
+   Class: guard_bddt
+
+ Purpose: Joins guards at merge points by means of BDDs, which
+          are canonical. The atoms of the guards (the guard
+          symbols and branch conditions) become BDD variables in
+          the order in which they are first seen, which is the
+          order of the branches. The result is turned back into
+          an expression that shares the subexpressions for shared
+          BDD nodes, so that the guards do not grow into redundant
+          and/or trees.
+
+\*******************************************************************/
+
+class guard_bddt
+{
+public:
+  // dest:=dest|src
+  void join(guardt &dest, const guardt &src);
+
+  // removes the literals from g1 that are implied by g2 as well,
+  // as in g1-=g2
+  void diff(guardt &g1, const guardt &g2);
+
+  std::size_t number_of_nodes()
+  {
+    return mgr.number_of_nodes();
+  }
+
+protected:
+  miniBDD::mgr mgr;
+
+  // the atoms, indexed by the number of their BDD variable
+  typedef hash_map_cont<exprt, miniBDD::BDD, irep_hash> atom_mapt;
+  atom_mapt atom_map;
+  std::vector<exprt> atoms;
+
+  struct pointer_hash
+  {
+    inline std::size_t operator()(const void *p) const
+    {
+      return (std::size_t)p;
+    }
+  };
+
+  // Guards that have been converted; the key is the shared
+  // representation of the expression, which stays alive
+  // as the expression is kept as well.
+  typedef std::pair<exprt, miniBDD::BDD> bdd_cache_entryt;
+  typedef hash_map_cont<const void *, bdd_cache_entryt, pointer_hash>
+    bdd_cachet;
+  bdd_cachet bdd_cache;
+
+  // The expressions for BDD nodes; the BDD keeps the node alive,
+  // hence its number is not reused.
+  typedef std::pair<miniBDD::BDD, exprt> expr_cache_entryt;
+  typedef std::map<unsigned, expr_cache_entryt> expr_cachet;
+  expr_cachet expr_cache;
+
+  // Both caches only grow, and keep their guards and BDD nodes
+  // alive; they are dropped between joins once they get large.
+  static const std::size_t max_cache_size=1<<16;
+  void limit_caches();
+
+  miniBDD::BDD as_bdd(const exprt &expr);
+  exprt as_expr(const miniBDD::BDD &bdd);
+
+  // the literals that hold on all paths to true
+  typedef std::map<unsigned, bool> literalst;
+  void implied_literals(
+    const miniBDD::BDD &bdd,
+    literalst &dest,
+    std::map<unsigned, literalst> &cache);
+
+  miniBDD::BDD restrict_literals(
+    const miniBDD::BDD &bdd,
+    const literalst &literals,
+    std::map<unsigned, miniBDD::BDD> &cache);
+};
+
+#endif
@@ -25,7 +25,12 @@ Function: memory_model_baset::memory_model_baset
 
 memory_model_baset::memory_model_baset(const namespacet &_ns):
   partial_order_concurrencyt(_ns),
-  var_cnt(0)
+  var_cnt(0),
+  rf_pairs(0),
+  rf_pruned(0),
+  ws_pairs(0),
+  ws_pruned(0),
+  pruned_constraints(0)
 {
 }
 
@@ -91,6 +96,129 @@ bool memory_model_baset::po(event_it e1, event_it e2)
 
 /*******************************************************************\
 
+Function: memory_model_baset::get_guard_conjuncts
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+const memory_model_baset::conjunctst &
+  memory_model_baset::get_guard_conjuncts(event_it e)
+{
+  std::pair<guard_conjunctst::iterator, bool> entry=
+    guard_conjuncts.insert(std::make_pair(e, conjunctst()));
+
+  if(entry.second)
+  {
+    conjunctst &conjuncts=entry.first->second;
+
+    if(e->guard.id()==ID_and)
+    {
+      forall_operands(it, e->guard)
+        conjuncts.insert(*it);
+    }
+    else if(!e->guard.is_true())
+      conjuncts.insert(e->guard);
+  }
+
+  return entry.first->second;
+}
+
+/*******************************************************************\
+
+Function: memory_model_baset::exclusive_guards
+
+  Inputs:
+
+ Outputs: true if the guards of the events contain a conjunct
+          and its negation, respectively
+
+ Purpose:
+
+\*******************************************************************/
+
+bool memory_model_baset::exclusive_guards(event_it e1, event_it e2)
+{
+  const conjunctst &c1=get_guard_conjuncts(e1);
+  const conjunctst &c2=get_guard_conjuncts(e2);
+
+  for(const auto &c : c2)
+  {
+    if(c.is_false())
+      return true;
+    else if(c.id()==ID_not)
+    {
+      if(c1.find(c.op0())!=c1.end())
+        return true;
+    }
+    else if(c1.find(not_exprt(c))!=c1.end())
+      return true;
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: memory_model_baset::guard_implies
+
+  Inputs:
+
+ Outputs: true if the conjuncts of the guard of e2 are conjuncts of
+          that of e1
+
+ Purpose:
+
+\*******************************************************************/
+
+bool memory_model_baset::guard_implies(event_it e1, event_it e2)
+{
+  const conjunctst &c1=get_guard_conjuncts(e1);
+  const conjunctst &c2=get_guard_conjuncts(e2);
+
+  for(const auto &c : c2)
+    if(c1.find(c)==c1.end())
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: memory_model_baset::spawned_after
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the spawn precedes all events of the new thread, and
+          follows the earlier events of its thread
+
+\*******************************************************************/
+
+bool memory_model_baset::spawned_after(event_it e, unsigned thread_nr)
+{
+  // the threads are started in the order of the spawns, and by a
+  // thread with a smaller number
+  while(thread_nr!=0 && thread_nr<=spawns.size())
+  {
+    const event_it spawn=spawns[thread_nr-1];
+
+    if(spawn->source.thread_nr==e->source.thread_nr)
+      return numbering[e]<numbering[spawn];
+
+    thread_nr=spawn->source.thread_nr;
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
 Function: memory_model_baset::read_from
 
   Inputs:
@@ -123,6 +251,18 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
 
       exprt::operandst rf_some_operands;
       rf_some_operands.reserve(a_rec.writes.size());
+      bool pruned=false;
+
+      // the last write of the thread before the read that is done
+      // whenever the read is done
+      event_it shadowing_write=equation.SSA_steps.end();
+
+      for(const auto &w : a_rec.writes)
+        if(po(w, r) &&
+           (shadowing_write==equation.SSA_steps.end() ||
+            po(shadowing_write, w)) &&
+           guard_implies(r, w))
+          shadowing_write=w;
 
       // this is quadratic in #events per address
       for(event_listt::const_iterator
@@ -139,6 +279,19 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
         bool is_rfi=
           w->source.thread_nr==r->source.thread_nr;
 
+        rf_pairs++;
+
+        if(exclusive_guards(r, w) ||
+           (shadowing_write!=equation.SSA_steps.end() &&
+            po(w, shadowing_write)) ||
+           spawned_after(r, w->source.thread_nr))
+        {
+          rf_pruned++;
+          pruned_constraints+=is_rfi?1:2;
+          pruned=true;
+          continue;
+        }
+
         symbol_exprt s=nondet_bool_symbol("rf");
 
         // record the symbol
@@ -172,8 +325,10 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
 
       // uninitialised global symbol like symex_dynamic::dynamic_object*
       // or *$object
-      if(rf_some_operands.empty())
+      if(rf_some_operands.empty() && !pruned)
         continue;
+      else if(rf_some_operands.empty())
+        rf_some=false_exprt(); // no write can be read from
       else if(rf_some_operands.size()==1)
         rf_some=rf_some_operands.front();
       else
@@ -188,4 +343,7 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
         implies_exprt(r->guard, rf_some), "rf-some", r->source);
     }
   }
+
+  statistics() << "Pruned " << rf_pruned << " of " << rf_pairs
+               << " read-from pairs" << eom;
 }
@@ -9,6 +9,8 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 #ifndef CPROVER_MEMORY_MODEL_H
 #define CPROVER_MEMORY_MODEL_H
 
+#include <util/hash_cont.h>
+
 #include "partial_order_concurrency.h"
 
 class memory_model_baset:public partial_order_concurrencyt
@@ -35,6 +37,26 @@ protected:
 
   void read_from(symex_target_equationt &equation);
 
+  // Static pruning of the pairs of events that need no choice
+  // symbol: those whose guards exclude each other, and those
+  // ordered by the spawning of threads. Furthermore, a read cannot
+  // read from a write of its own thread that is followed by another
+  // write done whenever the read is done.
+  unsigned rf_pairs, rf_pruned;
+  unsigned ws_pairs, ws_pruned;
+  unsigned pruned_constraints;
+
+  typedef hash_set_cont<exprt, irep_hash> conjunctst;
+  typedef std::map<event_it, conjunctst> guard_conjunctst;
+  guard_conjunctst guard_conjuncts;
+
+  const conjunctst &get_guard_conjuncts(event_it e);
+  bool exclusive_guards(event_it e1, event_it e2);
+  bool guard_implies(event_it e1, event_it e2);
+
+  // whether e happens before all events of the thread
+  bool spawned_after(event_it e, unsigned thread_nr);
+
   // maps thread numbers to an event list
   typedef std::map<unsigned, event_listt> per_thread_mapt;
 };
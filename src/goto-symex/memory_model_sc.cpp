@@ -302,6 +302,19 @@ void memory_model_sct::write_serialization_external(
            (*w_it2)->source.thread_nr)
           continue;
 
+        ws_pairs++;
+
+        // no order is needed if at most one of them is done,
+        // or if the spawn of a thread orders them
+        if(exclusive_guards(*w_it1, *w_it2) ||
+           spawned_after(*w_it1, (*w_it2)->source.thread_nr) ||
+           spawned_after(*w_it2, (*w_it1)->source.thread_nr))
+        {
+          ws_pruned++;
+          pruned_constraints+=2;
+          continue;
+        }
+
         // ws is a total order, no two elements have the same rank
         // s -> w_evt1 before w_evt2; !s -> w_evt2 before w_evt1
 
@@ -322,6 +335,10 @@ void memory_model_sct::write_serialization_external(
       }
     }
   }
+
+  statistics() << "Pruned " << ws_pruned << " of " << ws_pairs
+               << " write-serialisation pairs, "
+               << pruned_constraints << " constraints in total" << eom;
 }
 
 /*******************************************************************\
@@ -340,6 +357,17 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
 {
   // from-read: (w', w) in ws and (w', r) in rf -> (r, w) in fr
 
+  // the choice symbols by write
+  typedef std::map<event_it, std::vector<choice_symbolst::const_iterator> >
+    choices_by_writet;
+  choices_by_writet choices_by_write;
+
+  for(choice_symbolst::const_iterator
+      c_it=choice_symbols.begin();
+      c_it!=choice_symbols.end();
+      c_it++)
+    choices_by_write[c_it->first.second].push_back(c_it);
+
   for(address_mapt::const_iterator
       a_it=address_map.begin();
       a_it!=address_map.end();
@@ -380,11 +408,19 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
           ws2=before(*w, *w_prime);
         }
 
-        // smells like cubic
-        for(choice_symbolst::const_iterator
-            c_it=choice_symbols.begin();
-            c_it!=choice_symbols.end();
-            c_it++)
+        const std::vector<choice_symbolst::const_iterator> &
+          w_prime_choices=choices_by_write[*w_prime];
+        const std::vector<choice_symbolst::const_iterator> &
+          w_choices=choices_by_write[*w];
+
+        std::vector<choice_symbolst::const_iterator> choices;
+        choices.reserve(w_prime_choices.size()+w_choices.size());
+        choices.insert(
+          choices.end(), w_prime_choices.begin(), w_prime_choices.end());
+        choices.insert(
+          choices.end(), w_choices.begin(), w_choices.end());
+
+        for(const auto &c_it : choices)
         {
           event_it r=c_it->first.first;
           exprt rf=c_it->second;
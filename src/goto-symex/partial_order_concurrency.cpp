@@ -104,7 +104,11 @@ void partial_order_concurrencyt::add_init_writes(
     init_done.insert(a);
   }
 
-  equation.SSA_steps.splice(equation.SSA_steps.begin(), init_steps);
+  for(symex_target_equationt::SSA_stepst::reverse_iterator
+      it=init_steps.rbegin();
+      it!=init_steps.rend();
+      it++)
+    equation.SSA_steps.push_front(std::move(*it));
 }
 
 /*******************************************************************\
@@ -147,6 +151,8 @@ void partial_order_concurrencyt::build_event_lists(
         else // must be write
           a_rec.writes.push_back(e_it);
       }
+      else
+        spawns.push_back(e_it);
 
       // maps an event id to a per-thread counter
       unsigned cnt=counter[thread_nr]++;
@@ -250,7 +256,7 @@ Function: partial_order_concurrencyt::is_shared_write
 
 bool partial_order_concurrencyt::is_shared_write(event_it event) const
 {
-  if(!event->is_shared_write()) return false;
+  if(!event->is_shared_write() || event->ignore) return false;
   const irep_idt obj_identifier=event->ssa_lhs.get_object_name();
   if(obj_identifier=="goto_symex::\\guard") return false;
 
@@ -272,7 +278,7 @@ Function: partial_order_concurrencyt::is_shared_read
 
 bool partial_order_concurrencyt::is_shared_read(event_it event) const
 {
-  if(!event->is_shared_read()) return false;
+  if(!event->is_shared_read() || event->ignore) return false;
   const irep_idt obj_identifier=event->ssa_lhs.get_object_name();
   if(obj_identifier=="goto_symex::\\guard") return false;
 
@@ -56,6 +56,9 @@ protected:
   typedef std::map<event_it, unsigned> numberingt;
   numberingt numbering;
 
+  // the spawn events, in the order of the threads they start
+  event_listt spawns;
+
   // produces the symbol ID for an event
   static inline irep_idt id(event_it event)
   {
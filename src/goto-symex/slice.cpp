@@ -89,6 +89,12 @@ Function: symex_slicet::slice
 
 void symex_slicet::slice(symex_target_equationt &equation)
 {
+  if(equation.has_threads())
+  {
+    slice_threads(equation);
+    return;
+  }
+
   for(symex_target_equationt::SSA_stepst::reverse_iterator
       it=equation.SSA_steps.rbegin();
       it!=equation.SSA_steps.rend();
@@ -220,6 +226,131 @@ void symex_slicet::slice_decl(
 
 /*******************************************************************\
 
+Function: symex_slicet::address
+
+  Inputs: a shared read or write
+
+ Outputs: the shared variable accessed, as named by the memory model
+
+ Purpose:
+
+\*******************************************************************/
+
+irep_idt symex_slicet::address(
+  const symex_target_equationt::SSA_stept &SSA_step)
+{
+  ssa_exprt tmp=SSA_step.ssa_lhs;
+  tmp.remove_level_2();
+  return tmp.get_identifier();
+}
+
+/*******************************************************************\
+
+Function: symex_slicet::get_thread_dependencies
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void symex_slicet::get_thread_dependencies(
+  const symex_target_equationt::SSA_stept &SSA_step)
+{
+  get_symbols(SSA_step.guard);
+
+  switch(SSA_step.type)
+  {
+  case goto_trace_stept::ASSERT:
+  case goto_trace_stept::ASSUME:
+  case goto_trace_stept::GOTO:
+  case goto_trace_stept::CONSTRAINT:
+    get_symbols(SSA_step.cond_expr);
+    break;
+
+  case goto_trace_stept::ASSIGNMENT:
+    if(depends.find(SSA_step.ssa_lhs.get_identifier())!=depends.end())
+      get_symbols(SSA_step.ssa_rhs);
+    break;
+
+  case goto_trace_stept::SHARED_READ:
+    // the value read is that of one of the writes to the variable
+    if(depends.find(SSA_step.ssa_lhs.get_identifier())!=depends.end())
+      read_addresses.insert(address(SSA_step));
+    break;
+
+  case goto_trace_stept::SHARED_WRITE:
+    if(read_addresses.find(address(SSA_step))!=read_addresses.end())
+      depends.insert(SSA_step.ssa_lhs.get_identifier());
+    break;
+
+  default:
+    // spawns, barriers and atomic sections are kept as they are
+    break;
+  }
+}
+
+/*******************************************************************\
+
+Function: symex_slicet::slice_threads
+
+  Inputs: an equation with threads, before the constraints of the
+          memory model have been added
+
+ Outputs:
+
+ Purpose: The memory model ties each shared read in the slice to
+          the writes to the same variable, which may come later in
+          the equation, in other threads. Thus, the dependencies are
+          collected until they no longer grow. The shared reads that
+          are not in the slice are removed as well, as some write can
+          always be read from; the writes are removed for the
+          variables without such reads.
+
+\*******************************************************************/
+
+void symex_slicet::slice_threads(symex_target_equationt &equation)
+{
+  std::size_t size;
+
+  do
+  {
+    size=depends.size()+read_addresses.size();
+
+    for(symex_target_equationt::SSA_stepst::const_reverse_iterator
+        it=equation.SSA_steps.rbegin();
+        it!=equation.SSA_steps.rend();
+        it++)
+      get_thread_dependencies(*it);
+  }
+  while(depends.size()+read_addresses.size()!=size);
+
+  for(auto &SSA_step : equation.SSA_steps)
+  {
+    switch(SSA_step.type)
+    {
+    case goto_trace_stept::ASSIGNMENT:
+    case goto_trace_stept::DECL:
+    case goto_trace_stept::SHARED_READ:
+      if(depends.find(SSA_step.ssa_lhs.get_identifier())==depends.end())
+        SSA_step.ignore=true;
+      break;
+
+    case goto_trace_stept::SHARED_WRITE:
+      if(read_addresses.find(address(SSA_step))==read_addresses.end())
+        SSA_step.ignore=true;
+      break;
+
+    default:
+      break;
+    }
+  }
+}
+
+/*******************************************************************\
+
 Function: symex_slice_classt::collect_open_variables
 
   Inputs: equation - symex trace
@@ -11,7 +11,9 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "symex_target_equation.h"
 
-// slice an equation with respect to the assertions contained therein
+// slice an equation with respect to the assertions contained therein;
+// equations with threads are to be sliced before the memory model
+// adds its constraints
 void slice(symex_target_equationt &equation);
 
 // this simply slices away anything after the last assertion
@@ -69,7 +69,7 @@ void goto_symext::symex_malloc(
   if(lhs.is_nil())
     return; // ignore
 
-  dynamic_counter++;
+  const unsigned dynamic_count=++dynamic_counter;
 
   exprt size=code.op0();
   typet object_type=nil_typet();
@@ -143,7 +143,7 @@ void goto_symext::symex_malloc(
 
       symbolt size_symbol;
 
-      size_symbol.base_name="dynamic_object_size"+i2string(dynamic_counter);
+      size_symbol.base_name="dynamic_object_size"+i2string(dynamic_count);
       size_symbol.name="symex_dynamic::"+id2string(size_symbol.base_name);
       size_symbol.is_lvalue=true;
       size_symbol.type=tmp_size.type();
@@ -161,7 +161,7 @@ void goto_symext::symex_malloc(
   // value
   symbolt value_symbol;
 
-  value_symbol.base_name="dynamic_object"+i2string(dynamic_counter);
+  value_symbol.base_name="dynamic_object"+i2string(dynamic_count);
   value_symbol.name="symex_dynamic::"+id2string(value_symbol.base_name);
   value_symbol.is_lvalue=true;
   value_symbol.type=object_type;
@@ -462,9 +462,7 @@ void goto_symext::symex_cpp_new(
 
   do_array=(code.get(ID_statement)==ID_cpp_new_array);
 
-  dynamic_counter++;
-
-  const std::string count_string(i2string(dynamic_counter));
+  const std::string count_string(i2string(++dynamic_counter));
 
   // value
   symbolt symbol;
@@ -259,6 +259,35 @@ void goto_symext::symex_function_call_symbol(
 
 /*******************************************************************\
 
+Function: goto_symext::recursion_bound_exceeded
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: ends a path at a call whose recursion bound has been
+          reached
+
+\*******************************************************************/
+
+void goto_symext::recursion_bound_exceeded(statet &state)
+{
+  if(options.get_bool_option("partial-loops"))
+  {
+    // it's ok, ignore
+  }
+  else
+  {
+    if(options.get_bool_option("unwinding-assertions"))
+      vcc(false_exprt(), "recursion unwinding assertion", state);
+
+    // add to state guard to prevent further assignments
+    state.guard.add(false_exprt());
+  }
+}
+
+/*******************************************************************\
+
 Function: goto_symext::symex_function_call_code
 
   Inputs:
@@ -295,18 +324,11 @@ void goto_symext::symex_function_call_code(
   // see if it's too much
   if(stop_recursing)
   {
-    if(options.get_bool_option("partial-loops"))
-    {
-      // it's ok, ignore
-    }
+    // unless the path is continued later on
+    if(pause_at_recursion_bound(identifier, state.source.thread_nr))
+      pause_call(state);
     else
-    {
-      if(options.get_bool_option("unwinding-assertions"))
-        vcc(false_exprt(), "recursion unwinding assertion", state);
-
-      // add to state guard to prevent further assignments
-      state.guard.add(false_exprt());
-    }
+      recursion_bound_exceeded(state);
 
     state.source.pc++;
     return;
@@ -339,6 +361,18 @@ void goto_symext::symex_function_call_code(
   for(unsigned i=0; i<arguments.size(); i++)
     state.rename(arguments[i], ns);
 
+  exprt summary_key=nil_exprt();
+
+  if(options.get_bool_option("function-summaries"))
+  {
+    summary_key=
+      function_summary_key(identifier, goto_function, state, arguments);
+
+    if(summary_key.is_not_nil() &&
+       apply_function_summary(identifier, summary_key, state))
+      return;
+  }
+
   // produce a new frame
   assert(!state.call_stack().empty());
   goto_symex_statet::framet &frame=state.new_frame();
@@ -367,6 +401,16 @@ void goto_symext::symex_function_call_code(
   frame.loop_iterations[identifier].is_recursion=true;
   frame.loop_iterations[identifier].count++;
 
+  if(summary_key.is_not_nil())
+  {
+    // the steps of the body are to hold on any path
+    function_summary_misses++;
+    frame.summary_key=summary_key;
+    frame.summary_guard=state.guard;
+    frame.hidden_function=true;
+    state.guard=guardt();
+  }
+
   state.source.is_set=true;
   state.source.pc=goto_function.body.instructions.begin();
 }
@@ -397,23 +441,25 @@ void goto_symext::pop_frame(statet &state)
     state.level1.restore_from(frame.old_level1);
 
     // clear function-locals from L2 renaming
-    for(goto_symex_statet::renaming_levelt::current_namest::iterator
+    std::vector<irep_idt> locals;
+
+    for(goto_symex_statet::renaming_levelt::current_namest::const_iterator
         c_it=state.level2.current_names.begin();
         c_it!=state.level2.current_names.end();
-       ) // no ++c_it
+        ++c_it)
     {
       const irep_idt l1_o_id=c_it->second.first.get_l1_object_identifier();
       // could use iteration over local_objects as l1_o_id is prefix
-      if(frame.local_objects.find(l1_o_id)==frame.local_objects.end())
-      {
-        ++c_it;
-        continue;
-      }
-      goto_symex_statet::renaming_levelt::current_namest::iterator
-        cur=c_it;
-      ++c_it;
-      state.level2.current_names.erase(cur);
+      if(frame.local_objects.find(l1_o_id)!=frame.local_objects.end())
+        locals.push_back(c_it->first);
     }
+
+    // erasing invalidates the iterators
+    for(std::vector<irep_idt>::const_iterator
+        l_it=locals.begin();
+        l_it!=locals.end();
+        ++l_it)
+      state.level2.current_names.erase(*l_it);
   }
 
   state.pop_frame();
@@ -434,6 +480,9 @@ Function: goto_symext::symex_end_of_function
 void goto_symext::symex_end_of_function(statet &state)
 {
   // first record the return
+  if(state.top().summary_key.is_not_nil())
+    store_function_summary(state);
+
   target.function_return(
     state.guard.as_expr(), state.source.pc->function, state.source);
 
@@ -0,0 +1,446 @@
+/*******************************************************************\
+
+Module: Symbolic Execution -- Function Summaries
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+
+#include <util/std_expr.h>
+#include <util/i2string.h>
+#include <util/find_symbols.h>
+
+#include "goto_symex.h"
+
+/*******************************************************************\
+
+Function: has_pointer
+
+  Inputs:
+
+ Outputs: true if a value of the type may contain a pointer
+
+ Purpose:
+
+\*******************************************************************/
+
+static bool has_pointer(const typet &src, const namespacet &ns)
+{
+  const typet &type=ns.follow(src);
+
+  if(type.id()==ID_pointer)
+    return true;
+  else if(type.id()==ID_struct || type.id()==ID_union)
+  {
+    const struct_union_typet::componentst &components=
+      to_struct_union_type(type).components();
+
+    for(const auto &c : components)
+      if(has_pointer(c.type(), ns))
+        return true;
+
+    return false;
+  }
+  else if(type.id()==ID_array || type.id()==ID_vector)
+    return has_pointer(type.subtype(), ns);
+  else
+    return false;
+}
+
+/*******************************************************************\
+
+Function: return_value_identifier
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the global that remove_returns writes the value returned
+          by the function to
+
+\*******************************************************************/
+
+static irep_idt return_value_identifier(const irep_idt &identifier)
+{
+  return id2string(identifier)+"#return_value";
+}
+
+/*******************************************************************\
+
+Function: get_globals_read
+
+  Inputs:
+
+ Outputs: false if the expression has side effects or involves
+          pointers
+
+ Purpose: collects the globals read by the expression
+
+\*******************************************************************/
+
+static bool get_globals_read(
+  const exprt &expr,
+  const irep_idt &return_value,
+  const namespacet &ns,
+  std::set<irep_idt> &globals_read)
+{
+  if(expr.id()==ID_side_effect ||
+     expr.id()==ID_dereference ||
+     expr.id()==ID_address_of)
+    return false;
+
+  if(expr.id()==ID_symbol)
+  {
+    const irep_idt &identifier=to_symbol_expr(expr).get_identifier();
+
+    const symbolt *symbol;
+    if(ns.lookup(identifier, symbol))
+      return false;
+
+    if(symbol->is_static_lifetime &&
+       identifier!=return_value &&
+       symbol->type.id()!=ID_code)
+      globals_read.insert(identifier);
+  }
+
+  forall_operands(it, expr)
+    if(!get_globals_read(*it, return_value, ns, globals_read))
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: may_read_uninitialised_local
+
+  Inputs: a function body without backward gotos
+
+ Outputs: true if a local may be read before it is assigned, as it
+          then has a different value in each call
+
+ Purpose: Tracks the locals that are assigned on all paths. As the
+          jumps go forward, each instruction is visited after all
+          its predecessors.
+
+\*******************************************************************/
+
+static bool may_read_uninitialised_local(const goto_programt &body)
+{
+  typedef std::set<irep_idt> identifierst;
+
+  // the locals assigned on all jumps to the instruction so far
+  typedef std::map<goto_programt::const_targett, identifierst>
+    assigned_at_targett;
+  assigned_at_targett assigned_at_target;
+
+  identifierst declared, assigned;
+  bool reachable=true;
+
+  forall_goto_program_instructions(it, body)
+  {
+    assigned_at_targett::iterator t_it=assigned_at_target.find(it);
+
+    if(t_it!=assigned_at_target.end())
+    {
+      if(reachable)
+      {
+        identifierst both;
+        std::set_intersection(
+          assigned.begin(), assigned.end(),
+          t_it->second.begin(), t_it->second.end(),
+          std::inserter(both, both.end()));
+        assigned.swap(both);
+      }
+      else
+        assigned.swap(t_it->second);
+
+      reachable=true;
+    }
+
+    if(!reachable)
+      continue;
+
+    find_symbols_sett read;
+    find_symbols(it->guard, read);
+
+    const exprt *lhs=nullptr;
+
+    if(it->is_decl())
+    {
+      const irep_idt &identifier=
+        to_symbol_expr(to_code_decl(it->code).symbol()).get_identifier();
+      declared.insert(identifier);
+      assigned.erase(identifier);
+    }
+    else if(it->is_assign())
+    {
+      const code_assignt &assign=to_code_assign(it->code);
+      find_symbols(assign.rhs(), read);
+
+      // a part of the lhs is assigned on top of the old value
+      if(assign.lhs().id()==ID_symbol)
+        lhs=&assign.lhs();
+      else
+        find_symbols(assign.lhs(), read);
+    }
+    else if(!it->is_dead())
+      find_symbols(it->code, read);
+
+    for(const auto &identifier : read)
+      if(declared.count(identifier)!=0 &&
+         assigned.count(identifier)==0)
+        return true;
+
+    if(lhs!=nullptr)
+      assigned.insert(to_symbol_expr(*lhs).get_identifier());
+
+    if(it->is_goto())
+    {
+      for(const auto &target : it->targets)
+      {
+        std::pair<assigned_at_targett::iterator, bool> entry=
+          assigned_at_target.insert(std::make_pair(target, assigned));
+
+        if(!entry.second)
+        {
+          identifierst both;
+          std::set_intersection(
+            assigned.begin(), assigned.end(),
+            entry.first->second.begin(), entry.first->second.end(),
+            std::inserter(both, both.end()));
+          entry.first->second.swap(both);
+        }
+      }
+
+      if(it->guard.is_true())
+        reachable=false;
+    }
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::get_function_summary_info
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: determines whether the calls of the function may share
+          their steps, and the globals that the function reads
+
+\*******************************************************************/
+
+const goto_symext::function_summary_infot &
+  goto_symext::get_function_summary_info(
+    const irep_idt &identifier,
+    const goto_functionst::goto_functiont &goto_function)
+{
+  function_summary_infost::iterator i_it=
+    function_summary_infos.find(identifier);
+
+  if(i_it!=function_summary_infos.end())
+    return i_it->second;
+
+  function_summary_infot &info=function_summary_infos[identifier];
+  info.is_summarisable=false;
+
+  if(has_pointer(goto_function.type.return_type(), ns))
+    return info;
+
+  const irep_idt return_value=return_value_identifier(identifier);
+
+  forall_goto_program_instructions(it, goto_function.body)
+  {
+    switch(it->type)
+    {
+    case SKIP:
+    case LOCATION:
+    case DECL:
+    case DEAD:
+    case END_FUNCTION:
+      break;
+
+    case GOTO:
+      if(it->is_backwards_goto())
+        return info;
+      break;
+
+    case ASSIGN:
+      {
+        // only the locals and the return value may be written
+        const exprt *lhs=&to_code_assign(it->code).lhs();
+
+        while(lhs->id()==ID_index ||
+              lhs->id()==ID_member ||
+              lhs->id()==ID_typecast)
+          lhs=&lhs->op0();
+
+        if(lhs->id()!=ID_symbol)
+          return info;
+
+        const irep_idt &lhs_identifier=
+          to_symbol_expr(*lhs).get_identifier();
+
+        if(lhs_identifier!=return_value &&
+           ns.lookup(lhs_identifier).is_static_lifetime)
+          return info;
+      }
+      break;
+
+    default:
+      // calls, properties, threads, exceptions and the like
+      return info;
+    }
+
+    if(!get_globals_read(it->code, return_value, ns, info.globals_read) ||
+       !get_globals_read(it->guard, return_value, ns, info.globals_read))
+      return info;
+  }
+
+  // the locals that are not assigned are nondeterministic
+  if(may_read_uninitialised_local(goto_function.body))
+    return info;
+
+  info.is_summarisable=true;
+  return info;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::function_summary_key
+
+  Inputs: the function, and the renamed arguments of the call
+
+ Outputs: the key of the call, or nil if its summary is not to be
+          used or produced
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt goto_symext::function_summary_key(
+  const irep_idt &identifier,
+  const goto_functionst::goto_functiont &goto_function,
+  statet &state,
+  const exprt::operandst &arguments)
+{
+  // the events of threads are ordered across the whole equation,
+  // and depth counts the steps actually done
+  if(state.guard.is_false() ||
+     state.threads.size()!=1 ||
+     state.atomic_section_id!=0 ||
+     options.get_option("depth")!="")
+    return nil_exprt();
+
+  const function_summary_infot &info=
+    get_function_summary_info(identifier, goto_function);
+
+  if(!info.is_summarisable)
+    return nil_exprt();
+
+  exprt key(ID_function_call);
+  key.copy_to_operands(symbol_exprt(identifier));
+
+  for(const auto &a : arguments)
+    key.copy_to_operands(a);
+
+  for(const auto &g : info.globals_read)
+  {
+    exprt value=ns.lookup(g).symbol_expr();
+    state.rename(value, ns);
+    key.move_to_operands(value);
+  }
+
+  return key;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::apply_function_summary
+
+  Inputs: the function and the key of the call
+
+ Outputs: true if the call has been done by means of the summary
+
+ Purpose: assigns the value returned by an earlier call with the
+          same key
+
+\*******************************************************************/
+
+bool goto_symext::apply_function_summary(
+  const irep_idt &identifier,
+  const exprt &key,
+  statet &state)
+{
+  function_summariest::const_iterator s_it=function_summaries.find(key);
+
+  if(s_it==function_summaries.end())
+    return false;
+
+  function_summary_hits++;
+
+  // record the return
+  target.function_return(state.guard.as_expr(), identifier, state.source);
+
+  if(s_it->second.is_not_nil())
+  {
+    code_assignt assignment(
+      ns.lookup(return_value_identifier(identifier)).symbol_expr(),
+      s_it->second);
+
+    clean_expr(assignment.lhs(), state, true);
+
+    guardt guard; // NOT the state guard!
+    symex_assign_rec(
+      state,
+      assignment.lhs(),
+      nil_exprt(),
+      assignment.rhs(),
+      guard,
+      symex_targett::HIDDEN);
+  }
+
+  state.source.pc++;
+  return true;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::store_function_summary
+
+  Inputs: the state at the end of a function whose summary is
+          produced
+
+ Outputs:
+
+ Purpose: keeps the renamed return value, and continues with the
+          guard of the caller
+
+\*******************************************************************/
+
+void goto_symext::store_function_summary(statet &state)
+{
+  statet::framet &frame=state.top();
+
+  exprt value=nil_exprt();
+
+  const symbolt *symbol;
+  if(!ns.lookup(return_value_identifier(frame.function_identifier), symbol))
+  {
+    value=symbol->symbol_expr();
+    state.rename(value, ns);
+  }
+
+  function_summaries[frame.summary_key]=value;
+
+  state.guard=frame.summary_guard;
+  frame.summary_key.make_nil();
+}
@@ -76,8 +76,11 @@ void goto_symext::symex_goto(statet &state)
     // continue unwinding?
     if(get_unwind(state.source, unwind))
     {
-      // no!
-      loop_bound_exceeded(state, new_guard);
+      // no! -- unless the path is continued later on
+      if(pause_at_loop_bound(state.source))
+        pause_path(state, new_guard);
+      else
+        loop_bound_exceeded(state, new_guard);
 
       // reset unwinding
       unwind=0;
@@ -171,6 +174,15 @@ void goto_symext::symex_goto(statet &state)
       guard_expr.make_not();
       new_state.guard.add(guard_expr);
     }
+
+    // symex the paths separately instead of merging them
+    if(split_path(state, new_state.guard, new_state_pc))
+    {
+      goto_state_list.pop_back();
+
+      if(goto_state_list.empty())
+        state.top().goto_state_map.erase(new_state_pc);
+    }
   }
 }
 
@@ -245,7 +257,10 @@ void goto_symext::merge_gotos(statet &state)
     merge_value_sets(goto_state, state);
 
     // adjust guard
-    state.guard|=goto_state.guard;
+    if(bdd_guards)
+      guard_bdd.join(state.guard, goto_state.guard);
+    else
+      state.guard|=goto_state.guard;
 
     // adjust depth
     state.depth=std::min(state.depth, goto_state.depth);
@@ -296,13 +311,50 @@ void goto_symext::phi_function(
   const statet::goto_statet &goto_state,
   statet &dest_state)
 {
-  // go over all variables to see what changed
-  hash_set_cont<ssa_exprt, irep_hash> variables;
+  // The L2 renamings of both states share all entries that have
+  // not been written on either path since the fork, hence their
+  // delta contains the variables assigned on either path.
+  statet::level2t::current_namest::delta_viewt delta_view;
+  dest_state.level2.current_names.get_delta_view(
+    goto_state.level2_current_names, delta_view);
+
+  // collected first, as the assignments below change the map
+  std::vector<ssa_exprt> variables;
+  variables.reserve(delta_view.size());
+
+  for(statet::level2t::current_namest::delta_viewt::const_iterator
+      d_it=delta_view.begin();
+      d_it!=delta_view.end();
+      d_it++)
+  {
+    unsigned dest_count=
+      d_it->entry==nullptr?0:d_it->entry->second.second;
+    unsigned goto_count=
+      d_it->other_entry==nullptr?0:d_it->other_entry->second.second;
+
+    if(dest_count==goto_count)
+      continue; // not at all changed
+
+    variables.push_back(
+      d_it->entry==nullptr?
+      d_it->other_entry->second.first:
+      d_it->entry->second.first);
+  }
+
+  // this gets the diff between the guards
+  guardt diff_guard(goto_state.guard);
 
-  goto_state.level2_get_variables(variables);
-  dest_state.level2.get_variables(variables);
+  if(!variables.empty() &&
+     !dest_state.guard.is_false() &&
+     !goto_state.guard.is_false())
+  {
+    if(bdd_guards)
+      guard_bdd.diff(diff_guard, dest_state.guard);
+    else
+      diff_guard-=dest_state.guard;
+  }
 
-  for(hash_set_cont<ssa_exprt, irep_hash>::const_iterator
+  for(std::vector<ssa_exprt>::const_iterator
       it=variables.begin();
       it!=variables.end();
       it++)
@@ -313,10 +365,6 @@ void goto_symext::phi_function(
     if(obj_identifier==guard_identifier)
       continue; // just a guard, don't bother
 
-    if(goto_state.level2_current_count(l1_identifier)==
-       dest_state.level2.current_count(l1_identifier))
-      continue; // not at all changed
-
     // changed!
 
     // shared variables are renamed on every access anyway, we don't need to
@@ -366,12 +414,7 @@ void goto_symext::phi_function(
       rhs=dest_state_rhs;
     else
     {
-      guardt tmp_guard(goto_state.guard);
-
-      // this gets the diff between the guards
-      tmp_guard-=dest_state.guard;
-
-      rhs=if_exprt(tmp_guard.as_expr(), goto_state_rhs, dest_state_rhs);
+      rhs=if_exprt(diff_guard.as_expr(), goto_state_rhs, dest_state_rhs);
       do_simplify(rhs);
     }
 
@@ -387,6 +430,8 @@ void goto_symext::phi_function(
       rhs,
       dest_state.source,
       symex_targett::PHI);
+
+    phi_nodes++;
   }
 }
 
@@ -165,12 +165,41 @@ void goto_symext::operator()(
   state.top().calling_location.pc=state.top().end_of_function;
   state.symex_target=&target;
 
+  // the paths paused at loop bounds and resumed later on
+  // take their L2 indices from a counter they share
+  if(options.get_bool_option("incremental"))
+    state.level2.index_counter=
+      std::make_shared<statet::level2t::index_countert>();
+
   assert(state.top().end_of_function->is_end_function());
 
+  symex_until_end(state, goto_functions);
+}
+
+/*******************************************************************\
+
+Function: goto_symext::symex_until_end
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: symex until all threads have ended, and collect the
+          equations of the paths split off
+
+\*******************************************************************/
+
+void goto_symext::symex_until_end(
+  statet &state,
+  const goto_functionst &goto_functions)
+{
   while(!state.call_stack().empty())
   {
     symex_step(goto_functions, state);
 
+    if(!new_split_paths.empty())
+      start_split_paths(goto_functions);
+
     // is there another thread to execute?
     if(state.call_stack().empty() &&
        state.source.thread_nr+1<state.threads.size())
@@ -180,6 +209,9 @@ void goto_symext::operator()(
       state.switch_to_thread(t);
     }
   }
+
+  if(!running_split_paths.empty())
+    join_split_paths(goto_functions);
 }
 
 /*******************************************************************\
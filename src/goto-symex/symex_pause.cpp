@@ -0,0 +1,379 @@
+/*******************************************************************\
+
+Module: Symbolic Execution -- Pausing Paths at Loop Bounds
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <map>
+#include <vector>
+
+#include <util/std_expr.h>
+#include <util/i2string.h>
+
+#include "goto_symex.h"
+
+/*******************************************************************\
+
+Function: goto_symext::add_paused_path
+
+  Inputs: the state that reaches a bound, and the condition under
+          which it would go on
+
+ Outputs: the paused path
+
+ Purpose: keeps a copy of the state that goes on; the state itself
+          does not
+
+\*******************************************************************/
+
+goto_symext::paused_patht &goto_symext::add_paused_path(
+  statet &state,
+  const exprt &cond,
+  bool is_call)
+{
+  // the events of threads are ordered across the whole equation
+  if(state.threads.size()!=1)
+    throw "paths of programs with threads cannot be paused";
+
+  pending_paused_paths.push_back(paused_patht(state, cond, is_call));
+  statet &paused_state=pending_paused_paths.back().state;
+
+  // the instruction is done again once the path is resumed
+  paused_state.depth--;
+
+  // the states waiting at merge points are merged into this
+  // path only
+  for(auto &frame : paused_state.call_stack())
+    frame.goto_state_map.clear();
+
+  // the guard is replaced by a guard symbol defined to be equal,
+  // so that the guards of the paths merged from the paused paths
+  // do not grow with each round
+  exprt guard_expr=paused_state.guard.as_expr();
+
+  if(!guard_expr.is_true() && guard_expr.id()!=ID_symbol)
+  {
+    symbol_exprt guard_symbol_expr=
+      symbol_exprt(guard_identifier, bool_typet());
+
+    ssa_exprt new_lhs(guard_symbol_expr);
+    paused_state.rename(new_lhs, ns, goto_symex_statet::L1);
+    paused_state.assignment(new_lhs, guard_expr, ns, true, false);
+
+    guardt guard;
+
+    target.assignment(
+      guard.as_expr(),
+      new_lhs, new_lhs, guard_symbol_expr,
+      guard_expr,
+      paused_state.source,
+      symex_targett::GUARD);
+
+    exprt guard_symbol=guard_symbol_expr;
+    paused_state.rename(guard_symbol, ns);
+
+    paused_state.guard.make_true();
+    paused_state.guard.add(guard_symbol);
+  }
+
+  paused_paths++;
+
+  if(cond.is_true())
+    state.guard.make_false();
+  else
+    state.guard.add(not_exprt(cond));
+
+  return pending_paused_paths.back();
+}
+
+/*******************************************************************\
+
+Function: goto_symext::pause_path
+
+  Inputs: the state at the back edge of a loop whose bound has been
+          reached, and the renamed condition of the back edge
+
+ Outputs:
+
+ Purpose: keeps a copy of the state that does the further
+          iterations; the state itself leaves the loop
+
+\*******************************************************************/
+
+void goto_symext::pause_path(statet &state, const exprt &cond)
+{
+  paused_patht &path=add_paused_path(state, cond, false);
+
+  path.state.top().loop_iterations[
+    goto_programt::loop_id(state.source.pc)].count--;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::pause_call
+
+  Inputs: the state at a call whose recursion bound has been
+          reached
+
+ Outputs:
+
+ Purpose: keeps a copy of the state that does the call; the state
+          itself ends
+
+\*******************************************************************/
+
+void goto_symext::pause_call(statet &state)
+{
+  add_paused_path(state, true_exprt(), true);
+}
+
+/*******************************************************************\
+
+Function: goto_symext::paused_paths_guard
+
+  Inputs:
+
+ Outputs: an expression that is true iff one of the paused paths
+          does a further iteration of its loop
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt goto_symext::paused_paths_guard() const
+{
+  exprt::operandst disjuncts;
+
+  for(const auto &path : pending_paused_paths)
+  {
+    guardt guard=path.state.guard;
+    guard.add(path.cond);
+    disjuncts.push_back(guard.as_expr());
+  }
+
+  return disjunction(disjuncts);
+}
+
+/*******************************************************************\
+
+Function: goto_symext::resume_paused_paths
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: continues the paused paths until they end or are paused
+          again, which is sound as their guards are disjoint from
+          those of the steps added since they have been paused
+
+\*******************************************************************/
+
+void goto_symext::resume_paused_paths(const goto_functionst &goto_functions)
+{
+  paused_pathst paths;
+  paths.swap(pending_paused_paths);
+
+  merge_paused_paths(paths);
+
+  for(auto &path : paths)
+    symex_until_end(path.state, goto_functions);
+}
+
+/*******************************************************************\
+
+Function: same_names
+
+  Inputs: two renamings
+
+ Outputs: true iff they map the same identifiers to the same names
+
+ Purpose:
+
+\*******************************************************************/
+
+static bool same_names(
+  const goto_symex_statet::renaming_levelt::current_namest &a,
+  const goto_symex_statet::renaming_levelt::current_namest &b)
+{
+  goto_symex_statet::renaming_levelt::current_namest::delta_viewt delta;
+  a.get_delta_view(b, delta);
+
+  for(const auto &item : delta)
+    if(item.entry==nullptr || item.other_entry==nullptr ||
+       item.entry->second!=item.other_entry->second)
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: same_frames
+
+  Inputs: two frames of the call stacks of paused paths
+
+ Outputs: true iff they are the same but for the states waiting at
+          merge points, which paused paths do not have
+
+ Purpose:
+
+\*******************************************************************/
+
+static bool same_frames(
+  const goto_symex_statet::framet &a,
+  const goto_symex_statet::framet &b)
+{
+  if(a.function_identifier!=b.function_identifier ||
+     a.calling_location.is_set!=b.calling_location.is_set ||
+     (a.calling_location.is_set &&
+      a.calling_location.pc!=b.calling_location.pc) ||
+     a.end_of_function!=b.end_of_function ||
+     a.return_value!=b.return_value ||
+     a.hidden_function!=b.hidden_function ||
+     a.local_objects!=b.local_objects ||
+     a.catch_map!=b.catch_map ||
+     !same_names(a.old_level1, b.old_level1))
+    return false;
+
+  // the guard of the caller that a summary restores is not merged
+  if(a.summary_key.is_not_nil() || b.summary_key.is_not_nil())
+    return false;
+
+  if(a.loop_iterations.size()!=b.loop_iterations.size())
+    return false;
+
+  for(const auto &entry : a.loop_iterations)
+  {
+    goto_symex_statet::framet::loop_iterationst::const_iterator it=
+      b.loop_iterations.find(entry.first);
+
+    if(it==b.loop_iterations.end() ||
+       it->second.count!=entry.second.count ||
+       it->second.is_recursion!=entry.second.is_recursion)
+      return false;
+  }
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::can_merge_paused_paths
+
+  Inputs: two paused paths
+
+ Outputs: true iff they have been paused at the same instruction,
+          in the same frames with the same unwinding
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_symext::can_merge_paused_paths(
+  const paused_patht &a,
+  const paused_patht &b)
+{
+  const statet &sa=a.state, &sb=b.state;
+
+  if(a.is_call!=b.is_call ||
+     sa.source.pc!=sb.source.pc ||
+     sa.atomic_section_id!=sb.atomic_section_id ||
+     sa.threads.front().function_frame!=sb.threads.front().function_frame ||
+     !same_names(sa.level1.current_names, sb.level1.current_names))
+    return false;
+
+  const statet::call_stackt &stack_a=sa.call_stack(),
+                            &stack_b=sb.call_stack();
+
+  if(stack_a.size()!=stack_b.size())
+    return false;
+
+  for(std::size_t i=0; i<stack_a.size(); i++)
+    if(!same_frames(stack_a[i], stack_b[i]))
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::merge_paused_paths
+
+  Inputs: the paused paths to be resumed
+
+ Outputs:
+
+ Purpose: merges the paths that are paused at the same instruction
+          in the same frames, as they would have been merged had
+          they gone on: all but the first are left as states waiting
+          at the instruction, which merge_gotos joins into the first
+          one once it is resumed. Without this, the number of paths
+          grows with each branch in the loop body with each round.
+
+\*******************************************************************/
+
+void goto_symext::merge_paused_paths(paused_pathst &paths)
+{
+  typedef std::map<goto_programt::const_targett,
+                   std::vector<paused_pathst::iterator> > by_pct;
+  by_pct by_pc;
+
+  for(paused_pathst::iterator it=paths.begin(); it!=paths.end(); )
+  {
+    std::vector<paused_pathst::iterator> &candidates=
+      by_pc[it->state.source.pc];
+
+    paused_pathst::iterator base=paths.end();
+
+    for(const auto &c : candidates)
+      if(can_merge_paused_paths(*c, *it))
+      {
+        base=c;
+        break;
+      }
+
+    if(base==paths.end())
+    {
+      candidates.push_back(it);
+      it++;
+      continue;
+    }
+
+    statet &state=base->state;
+
+    state.top().goto_state_map[state.source.pc].push_back(
+      statet::goto_statet(it->state));
+
+    state.l1_history.insert(
+      it->state.l1_history.begin(),
+      it->state.l1_history.end());
+
+    it=paths.erase(it);
+  }
+}
+
+/*******************************************************************\
+
+Function: goto_symext::close_paused_paths
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: ends the paused paths as if their loop or recursion
+          bounds had been exceeded
+
+\*******************************************************************/
+
+void goto_symext::close_paused_paths()
+{
+  for(auto &path : pending_paused_paths)
+    if(path.is_call)
+      recursion_bound_exceeded(path.state);
+    else
+      loop_bound_exceeded(path.state, path.cond);
+
+  pending_paused_paths.clear();
+}
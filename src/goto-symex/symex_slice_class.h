@@ -38,4 +38,14 @@ protected:
   void slice(symex_target_equationt::SSA_stept &SSA_step);
   void slice_assignment(symex_target_equationt::SSA_stept &SSA_step);
   void slice_decl(symex_target_equationt::SSA_stept &SSA_step);
+
+  // for equations with threads: the shared variables that a read
+  // in the slice is done from, whose writes are in the slice
+  symbol_sett read_addresses;
+
+  static irep_idt address(const symex_target_equationt::SSA_stept &SSA_step);
+
+  void slice_threads(symex_target_equationt &equation);
+  void get_thread_dependencies(
+    const symex_target_equationt::SSA_stept &SSA_step);
 };
@@ -0,0 +1,271 @@
+/*******************************************************************\
+
+Module: Symbolic Execution -- Splitting Paths at Branches
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include "goto_symex.h"
+#include "symex_target_equation.h"
+
+// All instances of merge_irept share one table with HASH_CONSING,
+// hence the paths are then done one after the other.
+#if defined(THREAD_SAFE_IREP) && !defined(HASH_CONSING)
+#define SPLIT_PATH_THREADS
+#endif
+
+#ifdef SPLIT_PATH_THREADS
+#include <thread>
+#endif
+
+/*******************************************************************\
+
+   Class: goto_symext::split_patht
+
+ Purpose: A path that has been split off, with its own instance of
+          symex, its own symbol table for the symbols that symex
+          introduces, and its own equation.
+
+\*******************************************************************/
+
+struct goto_symext::split_patht
+{
+  split_patht(const goto_symext &symex, const statet &_state):
+    new_symbol_table(symex.new_symbol_table),
+    ns(symex.ns.get_symbol_table(), new_symbol_table),
+    equation(ns),
+    state(_state)
+  {
+    state.symex_target=&equation;
+  }
+
+  ~split_patht()
+  {
+    #ifdef SPLIT_PATH_THREADS
+    if(thread.joinable())
+      thread.join();
+    #endif
+  }
+
+  symbol_tablet new_symbol_table;
+  namespacet ns;
+  symex_target_equationt equation;
+  std::unique_ptr<goto_symext> symex;
+  statet state;
+
+  #ifdef SPLIT_PATH_THREADS
+  std::thread thread;
+  #endif
+
+  // rethrown by the thread that joins the path
+  std::exception_ptr exception;
+
+  void operator()(const goto_functionst &goto_functions)
+  {
+    try
+    {
+      symex->symex_until_end(state, goto_functions);
+    }
+
+    catch(...)
+    {
+      exception=std::current_exception();
+    }
+  }
+};
+
+/*******************************************************************\
+
+Function: goto_symext::goto_symext
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+goto_symext::goto_symext(
+  const goto_symext &other,
+  const namespacet &_ns,
+  symbol_tablet &_new_symbol_table,
+  symex_targett &_target):
+  total_vccs(0),
+  remaining_vccs(0),
+  phi_nodes(0),
+  split_paths(0),
+  paused_paths(0),
+  function_summary_hits(0),
+  function_summary_misses(0),
+  constant_propagation(other.constant_propagation),
+  bdd_guards(other.bdd_guards),
+  options(other.options),
+  new_symbol_table(_new_symbol_table),
+  ns(_ns),
+  target(_target),
+  atomic_section_counter(0),
+  guard_identifier(other.guard_identifier)
+{
+}
+
+/*******************************************************************\
+
+Function: goto_symext::new_split_symex
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+goto_symext *goto_symext::new_split_symex(
+  const namespacet &_ns,
+  symbol_tablet &_new_symbol_table,
+  symex_targett &_target)
+{
+  return new goto_symext(*this, _ns, _new_symbol_table, _target);
+}
+
+/*******************************************************************\
+
+Function: goto_symext::split_path
+
+  Inputs: the state after the branch, and the guard and the target
+          of the other side of the branch
+
+ Outputs: true if the other side is done as a separate path
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_symext::split_path(
+  statet &state,
+  const guardt &guard,
+  goto_programt::const_targett pc)
+{
+  if(state.split_depth>=options.get_unsigned_int_option("split-depth"))
+    return false;
+
+  // the events of threads are ordered across the whole equation
+  if(state.threads.size()!=1 ||
+     state.atomic_section_id!=0)
+    return false;
+
+  // the guard of the caller is restored at the end of a function
+  // whose summary is produced, which must not drop the branch
+  if(state.top().summary_key.is_not_nil())
+    return false;
+
+  if(dynamic_cast<symex_target_equationt *>(&target)==NULL)
+    return false;
+
+  // keeps the SSA names of the paths distinct
+  if(!state.level2.index_counter)
+    state.level2.index_counter=
+      std::make_shared<statet::level2t::index_countert>();
+
+  state.split_depth++;
+
+  std::shared_ptr<split_patht> path=
+    std::make_shared<split_patht>(*this, state);
+
+  path->symex.reset(
+    new_split_symex(path->ns, path->new_symbol_table, path->equation));
+
+  statet &new_state=path->state;
+  new_state.guard=guard;
+  new_state.source.pc=pc;
+
+  // the branches before the split are merged on this path only
+  for(auto &frame : new_state.call_stack())
+    frame.goto_state_map.clear();
+
+  new_split_paths.push_back(path);
+  split_paths++;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: goto_symext::start_split_paths
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void goto_symext::start_split_paths(const goto_functionst &goto_functions)
+{
+  #ifdef SPLIT_PATH_THREADS
+  for(auto &path : new_split_paths)
+    path->thread=std::thread(std::ref(*path), std::cref(goto_functions));
+  #endif
+
+  // without threads, the paths are done when they are joined
+  running_split_paths.splice(running_split_paths.end(), new_split_paths);
+}
+
+/*******************************************************************\
+
+Function: goto_symext::join_split_paths
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: appends the equations of the paths split off to the
+          target, which is sound as their guards are disjoint and
+          their L2 indices come from a counter they share
+
+\*******************************************************************/
+
+void goto_symext::join_split_paths(const goto_functionst &goto_functions)
+{
+  split_pathst paths;
+  paths.swap(running_split_paths);
+
+  for(auto &path : paths)
+  {
+    #ifdef SPLIT_PATH_THREADS
+    path->thread.join();
+    #else
+    (*path)(goto_functions);
+    #endif
+  }
+
+  for(const auto &path : paths)
+    if(path->exception)
+      std::rethrow_exception(path->exception);
+
+  symex_target_equationt &equation=
+    dynamic_cast<symex_target_equationt &>(target);
+
+  for(auto &path : paths)
+  {
+    for(auto &step : path->equation.SSA_steps)
+      equation.SSA_steps.push_back(std::move(step));
+    path->equation.SSA_steps.clear();
+
+    // the names of the symbols introduced by symex are unique,
+    // other than those of symbols that are the same on all paths
+    forall_symbols(it, path->new_symbol_table.symbols)
+      if(!new_symbol_table.has_symbol(it->first))
+        new_symbol_table.add(it->second);
+
+    total_vccs+=path->symex->total_vccs;
+    remaining_vccs+=path->symex->remaining_vccs;
+    phi_nodes+=path->symex->phi_nodes;
+    split_paths+=path->symex->split_paths;
+    function_summary_hits+=path->symex->function_summary_hits;
+    function_summary_misses+=path->symex->function_summary_misses;
+  }
+}
@@ -33,7 +33,11 @@ Function: symex_target_equationt::symex_target_equationt
 \*******************************************************************/
 
 symex_target_equationt::symex_target_equationt(
-  const namespacet &_ns):ns(_ns)
+  const namespacet &_ns):
+  ns(_ns),
+  stream_conv(NULL),
+  converted_steps(0),
+  stream_io_count(0)
 {
 }
 
@@ -80,7 +84,7 @@ void symex_target_equationt::shared_read(
   SSA_step.atomic_section_id=atomic_section_id;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -110,7 +114,7 @@ void symex_target_equationt::shared_write(
   SSA_step.atomic_section_id=atomic_section_id;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -135,7 +139,7 @@ void symex_target_equationt::spawn(
   SSA_step.type=goto_trace_stept::SPAWN;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -160,7 +164,7 @@ void symex_target_equationt::memory_barrier(
   SSA_step.type=goto_trace_stept::MEMORY_BARRIER;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -187,7 +191,7 @@ void symex_target_equationt::atomic_begin(
   SSA_step.atomic_section_id=atomic_section_id;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -214,7 +218,7 @@ void symex_target_equationt::atomic_end(
   SSA_step.atomic_section_id=atomic_section_id;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -256,7 +260,7 @@ void symex_target_equationt::assignment(
                    assignment_type!=VISIBLE_ACTUAL_PARAMETER);
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -294,7 +298,7 @@ void symex_target_equationt::decl(
   // there so we see the symbols
   SSA_step.cond_expr=equal_exprt(SSA_step.ssa_lhs, SSA_step.ssa_lhs);
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -340,7 +344,7 @@ void symex_target_equationt::location(
   SSA_step.type=goto_trace_stept::LOCATION;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -368,7 +372,7 @@ void symex_target_equationt::function_call(
   SSA_step.source=source;
   SSA_step.identifier=identifier;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -396,7 +400,7 @@ void symex_target_equationt::function_return(
   SSA_step.source=source;
   SSA_step.identifier=identifier;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -426,7 +430,7 @@ void symex_target_equationt::output(
   SSA_step.io_args=args;
   SSA_step.io_id=output_id;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -459,7 +463,7 @@ void symex_target_equationt::output_fmt(
   SSA_step.formatted=true;
   SSA_step.format_string=fmt;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -489,7 +493,7 @@ void symex_target_equationt::input(
   SSA_step.io_args=args;
   SSA_step.io_id=input_id;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -517,7 +521,7 @@ void symex_target_equationt::assumption(
   SSA_step.type=goto_trace_stept::ASSUME;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -547,7 +551,7 @@ void symex_target_equationt::assertion(
   SSA_step.source=source;
   SSA_step.comment=msg;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -575,7 +579,7 @@ void symex_target_equationt::goto_instruction(
   SSA_step.type=goto_trace_stept::GOTO;
   SSA_step.source=source;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -605,7 +609,7 @@ void symex_target_equationt::constraint(
   SSA_step.source=source;
   SSA_step.comment=msg;
 
-  merge_ireps(SSA_step);
+  step_added(SSA_step);
 }
 
 /*******************************************************************\
@@ -882,28 +886,234 @@ void symex_target_equationt::convert_io(
 
   for(auto & it : SSA_steps)
     if(!it.ignore)
+      convert_io_args(it, dec_proc, io_count);
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::convert_io_args
+
+  Inputs: step, decision procedure, the number of I/O symbols
+          introduced so far
+
+ Outputs: -
+
+ Purpose: converts the I/O arguments of a step
+
+\*******************************************************************/
+
+void symex_target_equationt::convert_io_args(
+  SSA_stept &SSA_step,
+  decision_proceduret &dec_proc,
+  unsigned &io_count)
+{
+  for(const auto & o_it : SSA_step.io_args)
+  {
+    exprt tmp=o_it;
+
+    if(tmp.is_constant() ||
+       tmp.id()==ID_string_constant)
+      SSA_step.converted_io_args.push_back(tmp);
+    else
     {
-      for(const auto & o_it : it.io_args)
-      {
-        exprt tmp=o_it;
-
-        if(tmp.is_constant() ||
-           tmp.id()==ID_string_constant)
-          it.converted_io_args.push_back(tmp);
-        else
-        {
-          symbol_exprt symbol;
-          symbol.type()=tmp.type();
-          symbol.set_identifier("symex::io::"+i2string(io_count++));
-
-          equal_exprt eq(tmp, symbol);
-          merge_irep(eq);
-
-          dec_proc.set_to(eq, true);
-          it.converted_io_args.push_back(symbol);
-        }
-      }
+      symbol_exprt symbol;
+      symbol.type()=tmp.type();
+      symbol.set_identifier("symex::io::"+i2string(io_count++));
+
+      equal_exprt eq(tmp, symbol);
+      if(!is_streaming())
+        merge_irep(eq);
+
+      dec_proc.set_to(eq, true);
+      SSA_step.converted_io_args.push_back(symbol);
     }
+  }
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::start_streaming
+
+  Inputs: converter
+
+ Outputs: -
+
+ Purpose: converts the steps so far, and any further steps when
+          they are added
+
+\*******************************************************************/
+
+void symex_target_equationt::start_streaming(prop_convt &prop_conv)
+{
+  assert(!is_streaming());
+
+  stream_conv=&prop_conv;
+  converted_steps=0;
+  stream_assumption=const_literal(true);
+  stream_disjuncts.clear();
+  stream_io_count=0;
+
+  convert_new_steps();
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::finish_streaming
+
+  Inputs: -
+
+ Outputs: -
+
+ Purpose: converts the remaining steps, which symex may have added
+          without notifying the equation, and the assertions
+
+\*******************************************************************/
+
+void symex_target_equationt::finish_streaming()
+{
+  assert(is_streaming());
+
+  convert_new_steps();
+
+  // We do (NOT a1) OR (NOT a2) ..., as in convert_assertions
+  if(!stream_disjuncts.empty())
+    stream_conv->set_to_true(disjunction(stream_disjuncts));
+
+  stream_disjuncts.clear();
+  stream_conv=NULL;
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::convert_new_assertions
+
+  Inputs: -
+
+ Outputs: a literal that is true iff one of the assertions added
+          since the last call is violated
+
+ Purpose: converts the remaining steps, keeping the assertions
+          apart from the constraints
+
+\*******************************************************************/
+
+literalt symex_target_equationt::convert_new_assertions()
+{
+  assert(is_streaming());
+
+  convert_new_steps();
+
+  literalt violated;
+
+  if(stream_disjuncts.empty())
+    violated=const_literal(false);
+  else
+    violated=stream_conv->convert(disjunction(stream_disjuncts));
+
+  stream_disjuncts.clear();
+
+  return violated;
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::step_added
+
+  Inputs: the step that has been added last
+
+ Outputs: -
+
+ Purpose:
+
+\*******************************************************************/
+
+void symex_target_equationt::step_added(SSA_stept &SSA_step)
+{
+  if(is_streaming())
+    convert_new_steps();
+  else
+    merge_ireps(SSA_step);
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::convert_new_steps
+
+  Inputs: -
+
+ Outputs: -
+
+ Purpose:
+
+\*******************************************************************/
+
+void symex_target_equationt::convert_new_steps()
+{
+  for(SSA_stepst::iterator
+      it=SSA_steps.begin()+converted_steps;
+      it!=SSA_steps.end();
+      it++)
+    convert_step(*it);
+
+  converted_steps=SSA_steps.size();
+}
+
+/*******************************************************************\
+
+Function: symex_target_equationt::convert_step
+
+  Inputs: step
+
+ Outputs: -
+
+ Purpose: converts a step as convert() does, with the assumptions
+          so far kept as a single literal
+
+\*******************************************************************/
+
+void symex_target_equationt::convert_step(SSA_stept &SSA_step)
+{
+  prop_convt &prop_conv=*stream_conv;
+
+  // the steps are not sliced when streaming
+  assert(!SSA_step.ignore);
+
+  SSA_step.guard_literal=prop_conv.convert(SSA_step.guard);
+
+  if(SSA_step.is_assignment())
+  {
+    prop_conv.set_to_true(SSA_step.cond_expr);
+
+    SSA_step.ssa_rhs.make_nil();
+    SSA_step.cond_expr.make_nil();
+  }
+  else if(SSA_step.is_decl())
+    prop_conv.convert(SSA_step.cond_expr);
+  else if(SSA_step.is_assume())
+  {
+    SSA_step.cond_literal=prop_conv.convert(SSA_step.cond_expr);
+
+    stream_assumption=prop_conv.convert(
+      and_exprt(
+        literal_exprt(stream_assumption),
+        literal_exprt(SSA_step.cond_literal)));
+  }
+  else if(SSA_step.is_assert())
+  {
+    implies_exprt implication(
+      literal_exprt(stream_assumption),
+      SSA_step.cond_expr);
+
+    SSA_step.cond_literal=prop_conv.convert(implication);
+
+    stream_disjuncts.push_back(literal_exprt(!SSA_step.cond_literal));
+  }
+  else if(SSA_step.is_goto())
+    SSA_step.cond_literal=prop_conv.convert(SSA_step.cond_expr);
+  else if(SSA_step.is_constraint())
+    prop_conv.set_to_true(SSA_step.cond_expr);
+
+  convert_io_args(SSA_step, prop_conv, stream_io_count);
 }
 
 
@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <list>
 #include <iosfwd>
 
+#include <util/chunked_vector.h>
 #include <util/merge_irep.h>
 
 #include <goto-programs/goto_program.h>
@@ -162,6 +163,30 @@ public:
   void convert_guards(prop_convt &prop_conv);
   void convert_io(decision_proceduret &decision_procedure);
 
+  // Converts the steps as symex adds them, rather than all at
+  // once by convert(). The steps must not be sliced or reordered
+  // afterwards. The expressions of the assignments are dropped
+  // once converted, as traces do not use them.
+  void start_streaming(prop_convt &prop_conv);
+  void finish_streaming();
+
+  bool is_streaming() const
+  {
+    return stream_conv!=NULL;
+  }
+
+  // For solving incrementally while streaming: converts the steps
+  // added since the last call, and returns a literal that is true
+  // iff one of their assertions is violated. The literal is meant
+  // to be a solver assumption, not a constraint.
+  literalt convert_new_assertions();
+
+  // the conjunction of the assumptions converted so far
+  literalt get_stream_assumption() const
+  {
+    return stream_assumption;
+  }
+
   exprt make_expression() const;
 
   class SSA_stept
@@ -202,7 +227,7 @@ public:
     // for ASSUME/ASSERT/GOTO/CONSTRAINT
     exprt cond_expr;
     literalt cond_literal;
-    std::string comment;
+    irep_idt comment;
 
     // for INPUT/OUTPUT
     irep_idt format_string, io_id;
@@ -261,18 +286,15 @@ public:
     return i;
   }
 
-  typedef std::list<SSA_stept> SSA_stepst;
+  // The steps are never moved, hence references and iterators
+  // to them remain valid while steps are added.
+  typedef chunked_vectort<SSA_stept> SSA_stepst;
   SSA_stepst SSA_steps;
 
   SSA_stepst::iterator get_SSA_step(unsigned s)
   {
-    SSA_stepst::iterator it=SSA_steps.begin();
-    for(; s!=0; s--)
-    {
-      assert(it!=SSA_steps.end());
-      it++;
-    }
-    return it;
+    assert(s<=SSA_steps.size());
+    return SSA_steps.begin()+s;
   }
 
   void output(std::ostream &out) const;
@@ -299,14 +321,25 @@ protected:
   // for enforcing sharing in the expressions stored
   merge_irept merge_irep;
   void merge_ireps(SSA_stept &SSA_step);
-};
 
-extern inline bool operator<(
-  const symex_target_equationt::SSA_stepst::const_iterator a,
-  const symex_target_equationt::SSA_stepst::const_iterator b)
-{
-  return &(*a)<&(*b);
-}
+  void convert_io_args(
+    SSA_stept &SSA_step,
+    decision_proceduret &decision_procedure,
+    unsigned &io_count);
+
+  // called once a step is complete
+  void step_added(SSA_stept &SSA_step);
+
+  // for streaming
+  prop_convt *stream_conv;
+  SSA_stepst::size_type converted_steps;
+  literalt stream_assumption;
+  exprt::operandst stream_disjuncts;
+  unsigned stream_io_count;
+
+  void convert_new_steps();
+  void convert_step(SSA_stept &SSA_step);
+};
 
 std::ostream &operator<<(std::ostream &out, const symex_target_equationt::SSA_stept &step);
 std::ostream &operator<<(std::ostream &out, const symex_target_equationt &equation);
@@ -0,0 +1,230 @@
+/* generated by minflex from scanner.l */
+#define yylex yyjsonlex
+#define yytext yyjsontext
+#define yyleng yyjsonleng
+#define yyin yyjsonin
+#define yyout yyjsonout
+#define yywrap yyjsonwrap
+#define yyrestart yyjsonrestart
+#define yylineno yyjsonlineno
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#define YY_NULL 0
+#define INITIAL 0
+extern char *yytext;
+extern int yyleng;
+extern FILE *yyin, *yyout;
+static int yy_start=0;
+#define BEGIN yy_start=
+#define YY_START yy_start
+#define YYSTATE YY_START
+static void yy_flush_buffer_();
+#define YY_FLUSH_BUFFER yy_flush_buffer_()
+static void yy_less_(int n);
+#define yyless(n) yy_less_(n)
+#define ECHO do { if(fwrite(yytext, (size_t)yyleng, 1, yyout)) {} } while(0)
+#define yyterminate() return YY_NULL
+#define YY_BREAK break;
+#define yywrap() 1
+#line 1 "scanner.l"
+// Strictly follows http://www.json.org/
+#ifdef _WIN32
+#define YY_NO_UNISTD_H
+static int isatty(int) { return 0; }
+#endif
+
+#define PARSER json_parser
+
+#include "json_parser.h"
+#include "json_y.tab.h"
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) \
+  do { result=(int)fread(buf, 1, max_size, yyin); } while(0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+char *yytext;
+int yyleng;
+FILE *yyin, *yyout;
+static const unsigned short yy_ec[256]={0,0,0,0,0,0,0,0,0,1,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,0,0,0,0,0,0,0,4,0,5,6,0,7,8,8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,11,0,0,0,12,13,0,0,0,0,0,14,0,15,0,0,0,16,17,18,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+static const int yy_nxt[46][20]={
+{9,7,8,2,9,10,9,5,6,9,9,9,9,3,9,4,9,9,1,9},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,11,-1,-1,-1},
+{13,13,13,12,13,13,13,13,13,13,14,13,13,13,13,13,13,13,13,13},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,15,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,16},
+{-1,-1,-1,-1,-1,-1,18,-1,-1,19,-1,-1,17,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,18,20,20,19,-1,-1,17,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,21,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,23},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{13,13,13,24,13,13,13,13,13,13,14,13,13,13,13,13,13,13,13,13},
+{13,13,13,25,13,13,13,13,13,13,14,13,13,13,13,13,13,13,13,13},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,27,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,29,30,-1,28,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,31,31,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,32,33,-1,28,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,18,20,20,19,-1,-1,17,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,18,-1,-1,19,-1,-1,17,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,18,34,34,19,-1,-1,17,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{13,13,13,24,13,13,13,13,13,13,14,13,13,13,13,13,13,13,13,13},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,36,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,28,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,28,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,28,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,31,31,39,-1,-1,38,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,28,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,28,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,18,34,34,19,-1,-1,17,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,40,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,42,43,-1,41,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,44,45,-1,41,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,41,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,41,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,41,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,41,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,41,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+};
+static const int yy_accept[46]={-1,6,5,6,6,1,1,5,5,6,6,-1,0,-1,-1,-1,-1,-1,-1,-1,1,1,1,-1,0,0,-1,-1,1,-1,-1,1,-1,-1,1,2,-1,4,-1,-1,3,1,-1,-1,-1,-1};
+static const unsigned char yy_live[46]={1,1,1,1,1,1,1,0,0,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,0,1,1,1,1,1};
+static const int yy_sc_start[1]={0};
+
+static std::vector<char> yy_buf(16384);
+static size_t yy_pos=0, yy_end=0; // unconsumed text is [yy_pos, yy_end)
+static char yy_hold=0;
+static bool yy_held=false;
+static std::vector<int> yy_state_stack;
+
+static void yy_unhold()
+{
+  if(yy_held) { yy_buf[yy_pos]=yy_hold; yy_held=false; }
+}
+
+static void yy_flush_buffer_()
+{
+  yy_unhold();
+  yy_pos=yy_end=0;
+}
+
+static void yy_less_(int n)
+{
+  size_t start=yytext-yy_buf.data();
+  yy_unhold();
+  yy_pos=start+n;
+  yy_hold=yy_buf[yy_pos];
+  yy_held=true;
+  yy_buf[yy_pos]=0;
+  yyleng=n;
+}
+
+// read more input; returns false at end of input
+static bool yy_fill()
+{
+  if(yy_pos>0)
+  {
+    std::memmove(yy_buf.data(), yy_buf.data()+yy_pos, yy_end-yy_pos);
+    yy_end-=yy_pos;
+    yy_pos=0;
+  }
+  if(yy_buf.size()-yy_end<8194)
+    yy_buf.resize(yy_buf.size()*2+8194);
+  if(yyin==nullptr) yyin=stdin;
+  int result;
+  char *buf=yy_buf.data()+yy_end;
+  YY_INPUT(buf, result, 8192);
+  if(result<=0)
+    return false;
+  yy_end+=result;
+  return true;
+}
+
+int yylex()
+{
+  if(yyout==nullptr) yyout=stdout;
+  for(;;)
+  {
+    yy_unhold();
+    int state=yy_sc_start[yy_start];
+    size_t cp=yy_pos, last_pos=0;
+    int rule=-1;
+    for(;;)
+    {
+      if(cp==yy_end)
+      {
+        if(!yy_live[state]) break;
+        size_t off=yy_pos;
+        if(!yy_fill()) break;
+        cp-=off; last_pos-=off;
+      }
+      int n=yy_nxt[state][yy_ec[(unsigned char)yy_buf[cp]]];
+      if(n<0) break;
+      state=n; cp++;
+      if(yy_accept[state]>=0) { rule=yy_accept[state]; last_pos=cp; }
+    }
+    if(rule<0)
+    {
+      if(yy_pos==yy_end)
+      {
+        if(yywrap())
+        {
+          yytext=yy_buf.data()+yy_pos; yyleng=0;
+          switch(yy_start)
+          {
+          default:
+            yyterminate();
+          }
+          return YY_NULL;
+        }
+        continue;
+      }
+      // default rule
+      last_pos=yy_pos+1;
+    }
+    yytext=yy_buf.data()+yy_pos;
+    yyleng=(int)(last_pos-yy_pos);
+    yy_pos=last_pos;
+    yy_hold=yy_buf[yy_pos]; yy_held=true; yy_buf[yy_pos]=0;
+    YY_USER_ACTION
+    switch(rule)
+    {
+    case 0:
+{ return TOK_STRING; }
+    YY_BREAK
+    case 1:
+{ return TOK_NUMBER; }
+    YY_BREAK
+    case 2:
+{ return TOK_TRUE; }
+    YY_BREAK
+    case 3:
+{ return TOK_FALSE; }
+    YY_BREAK
+    case 4:
+{ return TOK_NULL; }
+    YY_BREAK
+    case 5:
+{ /* eat */ }
+    YY_BREAK
+    case 6:
+{ return yytext[0]; }
+    YY_BREAK
+    default:
+      ECHO;
+    }
+  }
+}
+void yyrestart(FILE *f) { yyin=f; yy_flush_buffer_(); }
+
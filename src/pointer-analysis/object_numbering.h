@@ -13,6 +13,80 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/expr.h>
 #include <util/numbering.h>
 
+#ifdef THREAD_SAFE_IREP
+
+#include <deque>
+#include <mutex>
+
+// The numbering is shared by the value sets of all threads, e.g.,
+// of symex for split paths. The objects are kept in a deque, as
+// references to them must remain valid while other threads add
+// objects.
+
+class object_numberingt
+{
+public:
+  typedef unsigned int number_type;
+
+  number_type number(const exprt &a)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::pair<numberst::const_iterator, bool> result=
+      numbers.insert(
+      std::pair<exprt, number_type>
+      (a, number_type(numbers.size())));
+
+    if(result.second) // inserted?
+      objects.push_back(a);
+
+    return result.first->second;
+  }
+
+  const exprt &operator[](number_type n) const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return objects[n];
+  }
+
+  bool get_number(const exprt &a, number_type &n) const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    numberst::const_iterator it=numbers.find(a);
+
+    if(it==numbers.end())
+      return true;
+
+    n=it->second;
+    return false;
+  }
+
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return objects.size();
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    objects.clear();
+    numbers.clear();
+  }
+
+protected:
+  mutable std::mutex mutex;
+  std::deque<exprt> objects;
+
+  typedef hash_map_cont<exprt, number_type, irep_hash> numberst;
+  numberst numbers;
+};
+
+#else
+
 typedef hash_numbering<exprt, irep_hash> object_numberingt;
 
 #endif
+
+#endif
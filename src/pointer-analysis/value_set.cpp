@@ -8,6 +8,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <cassert>
 #include <ostream>
+#include <list>
 
 #include <util/symbol_table.h>
 #include <util/simplify_expr.h>
@@ -85,10 +86,7 @@ value_sett::entryt &value_sett::get_entry(
   else
     index=e.identifier;
 
-  std::pair<valuest::iterator, bool> r=
-    values.insert(std::pair<idt, entryt>(index, e));
-
-  return r.first->second;
+  return values.insert(valuest::value_type(index, e)).first;
 }
 
 /*******************************************************************\
@@ -277,36 +275,40 @@ bool value_sett::make_union(const value_sett::valuest &new_values)
 {
   bool result=false;
 
-  valuest::iterator v_it=values.begin();
+  // only the entries that are not shared need to be looked at
+  valuest::delta_viewt delta_view;
+  values.get_delta_view(new_values, delta_view);
 
-  for(valuest::const_iterator
-      it=new_values.begin();
-      it!=new_values.end();
-      ) // no it++
+  for(valuest::delta_viewt::const_iterator
+      it=delta_view.begin();
+      it!=delta_view.end();
+      it++)
   {
-    if(v_it==values.end() || it->first<v_it->first)
+    const valuest::value_type *new_entry=it->other_entry;
+
+    if(new_entry==nullptr)
+      continue; // only here
+
+    // the delta view may be stale once we have written
+    const entryt *e=values.get(new_entry->first);
+
+    if(e==nullptr)
     {
-      values.insert(v_it, *it);
+      values.insert(*new_entry);
       result=true;
-      it++;
-      continue;
-    }
-    else if(v_it->first<it->first)
-    {
-      v_it++;
       continue;
     }
 
-    assert(v_it->first==it->first);
+    const entryt &new_e=new_entry->second;
 
-    entryt &e=v_it->second;
-    const entryt &new_e=it->second;
+    // check before writing, which would unshare the entry
+    object_mapt tmp(e->object_map);
 
-    if(make_union(e.object_map, new_e.object_map))
+    if(make_union(tmp, new_e.object_map))
+    {
+      values[new_entry->first].object_map=tmp;
       result=true;
-
-    v_it++;
-    it++;
+    }
   }
 
   return result;
@@ -1402,7 +1404,10 @@ void value_sett::do_free(
 
   // mark these as 'may be invalid'
   // this, unfortunately, destroys the sharing
-  for(valuest::iterator v_it=values.begin();
+  typedef std::list<std::pair<idt, object_mapt> > changest;
+  changest changes;
+
+  for(valuest::const_iterator v_it=values.begin();
       v_it!=values.end();
       v_it++)
   {
@@ -1442,8 +1447,15 @@ void value_sett::do_free(
     }
 
     if(changed)
-      v_it->second.object_map=new_object_map;
+      changes.push_back(std::make_pair(v_it->first, new_object_map));
   }
+
+  // writing invalidates the iterators
+  for(changest::const_iterator
+      c_it=changes.begin();
+      c_it!=changes.end();
+      c_it++)
+    values[c_it->first].object_map=c_it->second;
 }
 
 /*******************************************************************\
@@ -45,7 +45,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "pointer_offset_sum.h"
 
 // global data, horrible
+#ifdef THREAD_SAFE_IREP
+std::atomic<unsigned> value_set_dereferencet::invalid_counter(0);
+#else
 unsigned int value_set_dereferencet::invalid_counter=0;
+#endif
 
 /*******************************************************************\
 
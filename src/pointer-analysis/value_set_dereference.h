@@ -12,6 +12,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <set>
 #include <string>
 
+#ifdef THREAD_SAFE_IREP
+#include <atomic>
+#endif
+
 #include <util/hash_cont.h>
 #include <util/std_expr.h>
 
@@ -80,7 +84,11 @@ private:
   symbol_tablet &new_symbol_table;
   const optionst &options;
   dereference_callbackt &dereference_callback;
+  #ifdef THREAD_SAFE_IREP
+  static std::atomic<unsigned> invalid_counter;
+  #else
   static unsigned invalid_counter;
+  #endif
 
   bool dereference_type_compare(
     const typet &object_type,
@@ -690,7 +690,7 @@ void cvc_convt::convert_expr(const exprt &expr)
       {
         std::size_t w=value.size()/4;
 
-        mp_integer i=binary2integer(id2string(value), false);
+        mp_integer i=binary2integer(value, false);
         std::string hex=integer2string(i, 16);
 
         while(hex.size()<w) hex="0"+hex;
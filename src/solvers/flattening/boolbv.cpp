@@ -140,21 +140,30 @@ Function: boolbvt::convert_bv
 const bvt& boolbvt::convert_bv(const exprt &expr)
 {
   // check cache first
-  std::pair<bv_cachet::iterator, bool> cache_result=
-    bv_cache.insert(std::make_pair(expr, bvt()));
+  std::pair<bvt *, bool> cache_result=bv_cache.insert(expr);
+
+  if(expr.id()==ID_mult || expr.id()==ID_div || expr.id()==ID_mod)
+  {
+    operator_statisticst &s=operator_statistics[expr.id()];
+    if(cache_result.second)
+      s.misses++;
+    else
+      s.hits++;
+  }
+
   if(!cache_result.second)
   {
     //std::cerr << "Cache hit on " << expr << "\n";
-    return cache_result.first->second;
+    return *cache_result.first;
   }
 
-  // Iterators into hash_maps supposedly stay stable
-  // even though we are inserting more elements recursively.
+  // The entry stays where it is even though we are
+  // inserting more elements recursively.
 
-  cache_result.first->second=convert_bitvector(expr);
+  *cache_result.first=convert_bitvector(expr);
 
   // check
-  forall_literals(it, cache_result.first->second)
+  forall_literals(it, *cache_result.first)
   {
     if(freeze_all && !it->is_constant()) prop.set_frozen(*it);
     if(it->var_no()==literalt::unused_var_no())
@@ -164,7 +173,32 @@ const bvt& boolbvt::convert_bv(const exprt &expr)
     }
   }
 
-  return cache_result.first->second;
+  return *cache_result.first;
+}
+
+/*******************************************************************\
+
+Function: boolbvt::output_cache_statistics
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void boolbvt::output_cache_statistics(std::ostream &out) const
+{
+  SUB::output_cache_statistics(out);
+
+  out << "\nbit-vector cache: ";
+  bv_cache.output_statistics(out);
+
+  for(const auto &s : operator_statistics)
+    out << "\n  " << s.first << ": "
+        << s.second.hits << " hits, "
+        << s.second.misses << " misses";
 }
 
 /*******************************************************************\
@@ -350,7 +384,7 @@ bvt boolbvt::convert_bitvector(const exprt &expr)
     assert(expr.operands().size()==2);
     bvt bv0=convert_bitvector(expr.op0());
     bvt bv1=convert_bitvector(expr.op1());
-    float_utilst float_utils(prop);
+    float_utilst float_utils(prop, bv_utils);
     float_utils.spec=to_floatbv_type(expr.type());
     bvt bv=expr.id()==ID_float_debug1?
       float_utils.debug1(bv0, bv1):
@@ -645,7 +679,7 @@ literalt boolbvt::convert_rest(const exprt &expr)
 
     if(expr.op0().type().id()==ID_floatbv)
     {
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=to_floatbv_type(expr.op0().type());
       return float_utils.is_NaN(bv);
     }
@@ -661,7 +695,7 @@ literalt boolbvt::convert_rest(const exprt &expr)
 
     if(expr.op0().type().id()==ID_floatbv)
     {
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=to_floatbv_type(expr.op0().type());
       return prop.land(
         !float_utils.is_infinity(bv),
@@ -679,7 +713,7 @@ literalt boolbvt::convert_rest(const exprt &expr)
 
     if(expr.op0().type().id()==ID_floatbv)
     {
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=to_floatbv_type(expr.op0().type());
       return float_utils.is_infinity(bv);
     }
@@ -695,7 +729,7 @@ literalt boolbvt::convert_rest(const exprt &expr)
 
     if(expr.op0().type().id()==ID_floatbv)
     {
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=to_floatbv_type(expr.op0().type());
       return float_utils.is_normal(bv);
     }
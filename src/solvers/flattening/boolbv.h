@@ -13,6 +13,8 @@ Author: Daniel Kroening, kroening@kroening.com
 // convert expression to boolean formula
 //
 
+#include <map>
+
 #include <util/hash_cont.h>
 #include <util/mp_arith.h>
 #include <util/expr.h>
@@ -37,7 +39,6 @@ public:
     arrayst(_ns, _prop),
     unbounded_array(U_NONE),
     boolbv_width(_ns),
-    bv_utils(_prop),
     functions(*this),
     map(_prop, _ns, boolbv_width)
   {
@@ -57,6 +58,8 @@ public:
     bv_cache.clear();
   }
 
+  virtual void output_cache_statistics(std::ostream &out) const override;
+
   virtual void post_process() override
   {
     post_process_quantifiers();
@@ -87,11 +90,17 @@ public:
     return map;
   }
 
+  void set_arithmetic_encodings(
+    bv_utilst::multipliert multiplier,
+    bv_utilst::dividert divider)
+  {
+    bv_utils.multiplier_encoding=multiplier;
+    bv_utils.divider_encoding=divider;
+  }
+
   boolbv_widtht boolbv_width;
 
 protected:
-  bv_utilst bv_utils;
-
   // uninterpreted functions
   functionst functions;
 
@@ -111,9 +120,19 @@ protected:
 
   bvt conversion_failed(const exprt &expr);
 
-  typedef hash_map_cont<const exprt, bvt, irep_hash> bv_cachet;
+  typedef conversion_cachet<bvt> bv_cachet;
   bv_cachet bv_cache;
 
+  // the cache for the operators that are expensive to convert
+  struct operator_statisticst
+  {
+    unsigned long long hits, misses;
+    operator_statisticst():hits(0), misses(0) { }
+  };
+
+  typedef std::map<irep_idt, operator_statisticst> operator_statistics_mapt;
+  operator_statistics_mapt operator_statistics;
+
   bool type_conversion(
     const typet &src_type, const bvt &src,
     const typet &dest_type, bvt &dest);
@@ -127,7 +127,7 @@ bvt boolbvt::convert_add_sub(const exprt &expr)
         if(type.subtype().id()==ID_floatbv)
         {
           // needs to change due to rounding mode
-          float_utilst float_utils(prop);
+          float_utilst float_utils(prop, bv_utils);
           float_utils.spec=to_floatbv_type(subtype);
           tmp_result=float_utils.add_sub(tmp_result, tmp_op, subtract);
         }
@@ -146,7 +146,7 @@ bvt boolbvt::convert_add_sub(const exprt &expr)
     else if(type.id()==ID_floatbv)
     {
       // needs to change due to rounding mode
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=to_floatbv_type(arithmetic_type);
       bv=float_utils.add_sub(bv, op, subtract);
     }
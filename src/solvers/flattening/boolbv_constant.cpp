@@ -6,6 +6,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <util/arith_tools.h>
+
 #include "boolbv.h"
 
 /*******************************************************************\
@@ -89,9 +91,9 @@ bvt boolbvt::convert_constant(const constant_exprt &expr)
           expr_type.id()==ID_c_bit_field ||
           expr_type.id()==ID_incomplete_c_enum)
   {
-    const std::string &binary=id2string(expr.get_value());
+    const irep_idt &value=expr.get_value();
 
-    if(binary.size()!=width)
+    if(binary_width(value)!=width)
     {
       error().source_location=expr.find_source_location();
       error() << "wrong value length in constant: "
@@ -100,10 +102,7 @@ bvt boolbvt::convert_constant(const constant_exprt &expr)
     }
 
     for(std::size_t i=0; i<width; i++)
-    {
-      bool bit=(binary[binary.size()-i-1]=='1');
-      bv[i]=const_literal(bit);
-    }
+      bv[i]=const_literal(binary_bit(value, i));
 
     return bv;
   }
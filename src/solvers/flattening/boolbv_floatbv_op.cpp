@@ -41,7 +41,7 @@ bvt boolbvt::convert_floatbv_typecast(const floatbv_typecast_exprt &expr)
   if(src_type==dest_type) // redundant type cast?
     return bv0;
 
-  float_utilst float_utils(prop);
+  float_utilst float_utils(prop, bv_utils);
 
   float_utils.set_rounding_mode(convert_bv(op1));
 
@@ -116,7 +116,7 @@ bvt boolbvt::convert_floatbv_op(const exprt &expr)
     throw "float op with mixed types";
   }
 
-  float_utilst float_utils(prop);
+  float_utilst float_utils(prop, bv_utils);
 
   float_utils.set_rounding_mode(bv2);
 
@@ -333,11 +333,11 @@ exprt boolbvt::bv_get_cache(const exprt &expr) const
     return get(expr);
 
   // look up literals in cache
-  bv_cachet::const_iterator it=bv_cache.find(expr);
-  if(it==bv_cache.end())
+  const bvt *bv=bv_cache.find(expr);
+  if(bv==NULL)
     return nil_exprt();
 
-  return bv_get(it->second, expr.type());
+  return bv_get(*bv, expr.type());
 }
 
 /*******************************************************************\
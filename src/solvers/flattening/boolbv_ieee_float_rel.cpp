@@ -44,7 +44,7 @@ literalt boolbvt::convert_ieee_float_rel(const exprt &expr)
     if(bv0.size()==bv1.size() && !bv0.empty() &&
        bvtype0==IS_FLOAT && bvtype1==IS_FLOAT)
     {
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=to_floatbv_type(op0.type());
 
       if(rel==ID_ieee_float_equal)
@@ -81,7 +81,7 @@ bvt boolbvt::convert_unary_minus(const unary_exprt &expr)
 
       if(type.subtype().id()==ID_floatbv)
       {
-        float_utilst float_utils(prop);
+        float_utilst float_utils(prop, bv_utils);
         float_utils.spec=to_floatbv_type(subtype);
         tmp_result=float_utils.negate(tmp_op);
       }
@@ -109,7 +109,7 @@ bvt boolbvt::convert_unary_minus(const unary_exprt &expr)
   else if(bvtype==IS_FLOAT && op_bvtype==IS_FLOAT)
   {
     assert(!no_overflow);
-    float_utilst float_utils(prop);
+    float_utilst float_utils(prop, bv_utils);
     float_utils.spec=to_floatbv_type(expr.type());
     return float_utils.negate(op_bv);
   }
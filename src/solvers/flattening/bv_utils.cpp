@@ -6,6 +6,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <algorithm>
 #include <cassert>
 
 #include <util/arith_tools.h>
@@ -952,24 +953,19 @@ bvt bv_utilst::wallace_tree(const std::vector<bvt> &pps)
 
 /*******************************************************************\
 
-Function: bv_utilst::unsigned_multiplier
+Function: bv_utilst::shift_add_multiplier
 
   Inputs:
 
  Outputs:
 
- Purpose:
+ Purpose: The product modulo 2^width, adding one partial product
+          after the other.
 
 \*******************************************************************/
 
-bvt bv_utilst::unsigned_multiplier(const bvt &_op0, const bvt &_op1)
+bvt bv_utilst::shift_add_multiplier(const bvt &op0, const bvt &op1)
 {
-  #if 1
-  bvt op0=_op0, op1=_op1;
-
-  if(is_constant(op1))
-    std::swap(op0, op1);
-
   bvt product;
   product.resize(op0.size());
 
@@ -993,16 +989,26 @@ bvt bv_utilst::unsigned_multiplier(const bvt &_op0, const bvt &_op1)
     }
 
   return product;
-  #else
-  // Wallace tree multiplier. This is disabled, as runtimes have
-  // been observed to go up by 5%-10%, and on some models even by 20%.
+}
 
-  // build the usual quadratic number of partial products
+/*******************************************************************\
 
-  bvt op0=_op0, op1=_op1;
+Function: bv_utilst::wallace_multiplier
 
-  if(is_constant(op1))
-    std::swap(op0, op1);
+  Inputs:
+
+ Outputs:
+
+ Purpose: The product modulo 2^width, summing the partial products
+          with a Wallace tree. Runtimes have been observed to go up
+          by 5%-10% over shift-and-add, and on some models even by
+          20%.
+
+\*******************************************************************/
+
+bvt bv_utilst::wallace_multiplier(const bvt &op0, const bvt &op1)
+{
+  // build the usual quadratic number of partial products
 
   std::vector<bvt> pps;
   pps.reserve(op0.size());
@@ -1028,8 +1034,347 @@ bvt bv_utilst::unsigned_multiplier(const bvt &_op0, const bvt &_op1)
     return zeros(op0.size());
   else
     return wallace_tree(pps);
+}
 
-  #endif
+/*******************************************************************\
+
+Function: bv_utilst::dadda_tree
+
+  Inputs: The bits of each weight; the result has as many bits
+          as there are columns
+
+ Outputs: The sum of all bits, modulo 2^(number of columns)
+
+ Purpose: Reduces the columns to the Dadda heights 2, 3, 4, 6, 9,
+          13, ..., using no more adders than needed to meet the
+          next height, and adds the remaining two rows.
+
+\*******************************************************************/
+
+bvt bv_utilst::dadda_tree(std::vector<bvt> &columns)
+{
+  std::size_t width=columns.size();
+  std::size_t max_height=0;
+
+  for(const auto &c : columns)
+    max_height=std::max(max_height, c.size());
+
+  std::vector<std::size_t> heights(1, 2);
+  while(heights.back()<max_height)
+    heights.push_back(heights.back()*3/2);
+  heights.pop_back();
+
+  for(std::size_t stage=heights.size(); stage>0; stage--)
+  {
+    const std::size_t height=heights[stage-1];
+
+    // carries go into the next column before it is reduced
+    for(std::size_t col=0; col<width; col++)
+    {
+      bvt &c=columns[col];
+
+      while(c.size()>height)
+      {
+        literalt sum, carry_out;
+
+        if(c.size()==height+1)
+        {
+          sum=prop.lxor(c[0], c[1]);
+          carry_out=prop.land(c[0], c[1]);
+          c.erase(c.begin(), c.begin()+2);
+        }
+        else
+        {
+          sum=full_adder(c[0], c[1], c[2], carry_out);
+          c.erase(c.begin(), c.begin()+3);
+        }
+
+        c.push_back(sum);
+
+        // carries out of the top column are truncated
+        if(col+1<width)
+          columns[col+1].push_back(carry_out);
+      }
+    }
+  }
+
+  bvt a=zeros(width), b=zeros(width);
+
+  for(std::size_t col=0; col<width; col++)
+  {
+    assert(columns[col].size()<=2);
+    if(columns[col].size()>=1)
+      a[col]=columns[col][0];
+    if(columns[col].size()==2)
+      b[col]=columns[col][1];
+  }
+
+  return add(a, b);
+}
+
+/*******************************************************************\
+
+Function: bv_utilst::dadda_multiplier
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: The product modulo 2^width, with the partial product bits
+          above the width left out, summed by a Dadda tree.
+
+\*******************************************************************/
+
+bvt bv_utilst::dadda_multiplier(const bvt &op0, const bvt &op1)
+{
+  std::size_t width=op0.size();
+  std::vector<bvt> columns(width);
+
+  for(std::size_t i=0; i<width; i++)
+    if(op0[i]!=const_literal(false))
+      for(std::size_t j=0; i+j<width; j++)
+      {
+        literalt l=prop.land(op0[i], op1[j]);
+        if(l!=const_literal(false))
+          columns[i+j].push_back(l);
+      }
+
+  return dadda_tree(columns);
+}
+
+/*******************************************************************\
+
+Function: bv_utilst::karatsuba_full_product
+
+  Inputs: Two bit-vectors of the same width n
+
+ Outputs: Their product, with 2n bits
+
+ Purpose: Karatsuba: with a=ah*2^m+al and b=bh*2^m+bl, the middle
+          term al*bh+ah*bl is (al+ah)*(bl+bh)-al*bl-ah*bh, which
+          takes three multiplications instead of four.
+
+\*******************************************************************/
+
+bvt bv_utilst::karatsuba_full_product(const bvt &op0, const bvt &op1)
+{
+  assert(op0.size()==op1.size());
+
+  std::size_t width=op0.size();
+
+  assert(karatsuba_min_width>=4);
+
+  if(width<karatsuba_min_width)
+    return shift_add_multiplier(
+      zero_extension(op0, width*2),
+      zero_extension(op1, width*2));
+
+  // the high half is at least as wide as the low half
+  std::size_t m=width/2, h=width-m;
+
+  bvt a_low=extract(op0, 0, m-1), a_high=extract(op0, m, width-1);
+  bvt b_low=extract(op1, 0, m-1), b_high=extract(op1, m, width-1);
+
+  bvt z0=karatsuba_full_product(a_low, b_low);
+  bvt z2=karatsuba_full_product(a_high, b_high);
+
+  bvt a_sum=add(zero_extension(a_low, h+1), zero_extension(a_high, h+1));
+  bvt b_sum=add(zero_extension(b_low, h+1), zero_extension(b_high, h+1));
+  bvt z1=karatsuba_full_product(a_sum, b_sum);
+
+  // the middle term is not negative and fits into 2h+2 bits
+  bvt middle=sub(z1, zero_extension(z0, 2*h+2));
+  middle=sub(middle, zero_extension(z2, 2*h+2));
+
+  bvt result=zero_extension(z0, width*2);
+
+  // padded to 2n bits, or cut there, as the bits beyond are zero
+  bvt shifted=concatenate(zeros(m), middle);
+  shifted.resize(width*2, const_literal(false));
+  result=add(result, shifted);
+
+  return add(result, concatenate(zeros(2*m), z2));
+}
+
+/*******************************************************************\
+
+Function: bv_utilst::karatsuba_multiplier
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: The product modulo 2^n: with op0=xh*2^m+xl and op1
+          likewise, it is xl*yl plus the cross products shifted by
+          m; xh*yh is shifted out entirely. Only the full product of
+          the low halves benefits from Karatsuba, the cross products
+          are again truncated products of n-m bits.
+
+\*******************************************************************/
+
+bvt bv_utilst::karatsuba_multiplier(const bvt &op0, const bvt &op1)
+{
+  std::size_t width=op0.size();
+
+  assert(karatsuba_min_width>=4);
+
+  if(width<karatsuba_min_width)
+    return shift_add_multiplier(op0, op1);
+
+  // the low half is at least as wide as the high half
+  std::size_t m=(width+1)/2, h=width-m;
+
+  bvt x_low=extract(op0, 0, m-1), x_high=extract(op0, m, width-1);
+  bvt y_low=extract(op1, 0, m-1), y_high=extract(op1, m, width-1);
+
+  bvt result=karatsuba_full_product(x_low, y_low);
+  result.resize(width);
+
+  if(h!=0)
+  {
+    bvt cross=add(
+      karatsuba_multiplier(x_high, extract_lsb(y_low, h)),
+      karatsuba_multiplier(extract_lsb(x_low, h), y_high));
+
+    result=add(result, concatenate(zeros(m), cross));
+  }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: bv_utilst::constant_multiplier
+
+  Inputs: A bit-vector and a constant of the same width
+
+ Outputs: Their product modulo 2^width
+
+ Purpose: Recodes the constant into canonical signed digits, i.e.,
+          digits -1, 0, 1 with no two adjacent ones non-zero, and
+          adds or subtracts the correspondingly shifted operand.
+          A run of ones such as 0111 1111 takes one subtraction
+          instead of seven additions. Falls back to shift-and-add
+          when the recoding has no fewer non-zero digits.
+
+\*******************************************************************/
+
+bvt bv_utilst::constant_multiplier(const bvt &op, const bvt &constant)
+{
+  std::size_t width=op.size();
+
+  mp_integer value=0;
+  std::size_t binary_digits=0;
+
+  for(std::size_t i=constant.size(); i>0; i--)
+  {
+    value*=2;
+    if(constant[i-1].is_true())
+    {
+      value+=1;
+      binary_digits++;
+    }
+  }
+
+  std::vector<int> digits;
+  std::size_t csd_digits=0;
+
+  while(value!=0)
+  {
+    int digit=0;
+
+    if(value%2!=0)
+    {
+      digit=(value%4==1)?1:-1;
+      value-=digit;
+
+      // digits at or above the width do not contribute
+      if(digits.size()<width)
+        csd_digits++;
+    }
+
+    digits.push_back(digit);
+    value/=2;
+  }
+
+  if(csd_digits>=binary_digits)
+    return shift_add_multiplier(constant, op);
+
+  bvt product;
+
+  // the most significant digit is positive, hence start there
+  for(std::size_t i=std::min(digits.size(), width); i>0; i--)
+  {
+    int digit=digits[i-1];
+
+    if(digit==0)
+      continue;
+
+    bvt shifted=shift(op, LEFT, i-1);
+
+    if(product.empty())
+      product=digit>0?shifted:negate(shifted);
+    else
+      product=add_sub(product, shifted, digit<0);
+  }
+
+  if(product.empty())
+    return zeros(width);
+
+  return product;
+}
+
+/*******************************************************************\
+
+Function: bv_utilst::unsigned_multiplier
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bvt bv_utilst::unsigned_multiplier(const bvt &_op0, const bvt &_op1)
+{
+  bvt op0=_op0, op1=_op1;
+
+  if(is_constant(op1))
+    std::swap(op0, op1);
+
+  switch(multiplier_encoding)
+  {
+  case M_SHIFT_ADD: return shift_add_multiplier(op0, op1);
+  case M_WALLACE: return wallace_multiplier(op0, op1);
+  case M_DADDA: return dadda_multiplier(op0, op1);
+  case M_KARATSUBA: return karatsuba_multiplier(op0, op1);
+
+  case M_CSD:
+    if(is_constant(op0))
+      return constant_multiplier(op1, op0);
+    else
+      return shift_add_multiplier(op0, op1);
+
+  case M_AUTO:
+    if(is_constant(op0))
+      return constant_multiplier(op1, op0);
+    else
+    {
+      std::size_t width=std::max(significant_width(op0),
+                                 significant_width(op1));
+
+      if(width>=auto_karatsuba_min_width)
+        return karatsuba_multiplier(op0, op1);
+      else if(width>=auto_dadda_min_width)
+        return dadda_multiplier(op0, op1);
+      else
+        return shift_add_multiplier(op0, op1);
+    }
+
+  default:
+    assert(false);
+  }
 }
 
 /*******************************************************************\
@@ -1352,38 +1697,88 @@ void bv_utilst::unsigned_divider(
   bvt &res,
   bvt &rem)
 {
-  std::size_t width=op0.size();
-
-  // check if we divide by a power of two
-  #if 0
+  switch(divider_encoding)
   {
-    std::size_t one_count=0, non_const_count=0, one_pos=0;
+  case D_MULTIPLICATION: multiplication_divider(op0, op1, res, rem); break;
+  case D_RESTORING: restoring_divider(op0, op1, res, rem); break;
 
-    for(std::size_t i=0; i<op1.size(); i++)
-    {
-      literalt l=op1[i];
-      if(l.is_true())
-      {
-        one_count++;
-        one_pos=i;
-      }
-      else if(!l.is_false())
-        non_const_count++;
-    }
+  case D_SHIFT:
+  case D_AUTO:
+    if(!power_of_two_divider(op0, op1, res, rem))
+      multiplication_divider(op0, op1, res, rem);
+    break;
+
+  default:
+    assert(false);
+  }
+}
+
+/*******************************************************************\
+
+Function: bv_utilst::power_of_two_divider
+
+  Inputs:
+
+ Outputs: false if the divisor is not a constant power of two
+
+ Purpose: Division by 2^k is a shift, and the remainder a mask.
+
+\*******************************************************************/
+
+bool bv_utilst::power_of_two_divider(
+  const bvt &op0,
+  const bvt &op1,
+  bvt &res,
+  bvt &rem)
+{
+  std::size_t one_count=0, non_const_count=0, one_pos=0;
 
-    if(non_const_count==0 && one_count==1 && one_pos!=0)
+  for(std::size_t i=0; i<op1.size(); i++)
+  {
+    literalt l=op1[i];
+    if(l.is_true())
     {
-      // it is a power of two!
-      res=shift(op0, LRIGHT, one_pos);
-
-      // remainder is just a mask
-      rem=op0;
-      for(std::size_t i=one_pos; i<rem.size(); i++)
-        rem[i]=const_literal(false);
-      return;
+      one_count++;
+      one_pos=i;
     }
+    else if(!l.is_false())
+      non_const_count++;
   }
-  #endif
+
+  if(non_const_count!=0 || one_count!=1)
+    return false;
+
+  // it is a power of two!
+  res=shift(op0, LRIGHT, one_pos);
+
+  // remainder is just a mask
+  rem=op0;
+  for(std::size_t i=one_pos; i<rem.size(); i++)
+    rem[i]=const_literal(false);
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: bv_utilst::multiplication_divider
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Result and remainder are fresh variables, constrained by
+          res*op1+rem=op0 and rem<op1 unless op1 is zero.
+
+\*******************************************************************/
+
+void bv_utilst::multiplication_divider(
+  const bvt &op0,
+  const bvt &op1,
+  bvt &res,
+  bvt &rem)
+{
+  std::size_t width=op0.size();
 
   // division by zero test
 
@@ -1425,6 +1820,60 @@ void bv_utilst::unsigned_divider(
     prop.limplies(is_not_zero, lt_or_le(true, res, op0, UNSIGNED)));
 }
 
+/*******************************************************************\
+
+Function: bv_utilst::restoring_divider
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Long division: one bit of the dividend after the other is
+          shifted into the partial remainder, and the divisor is
+          subtracted whenever it fits. As with the encoding above,
+          result and remainder are unconstrained if op1 is zero.
+
+\*******************************************************************/
+
+void bv_utilst::restoring_divider(
+  const bvt &op0,
+  const bvt &op1,
+  bvt &res,
+  bvt &rem)
+{
+  std::size_t width=op0.size();
+
+  // the partial remainder is below op1, but needs one more bit
+  // once shifted
+  bvt partial=zeros(width+1);
+  bvt divisor_inverted=inverted(zero_extension(op1, width+1));
+  bvt quotient(width);
+
+  for(std::size_t i=width; i>0; i--)
+  {
+    partial.pop_back();
+    partial.insert(partial.begin(), op0[i-1]);
+
+    // the carry of partial-op1 is set iff op1 fits
+    bvt difference=partial;
+    literalt fits;
+    adder(difference, divisor_inverted, const_literal(true), fits);
+
+    quotient[i-1]=fits;
+    partial=select(fits, difference, partial);
+  }
+
+  literalt is_not_zero=prop.lor(op1);
+
+  res.resize(width);
+  rem.resize(width);
+  for(std::size_t i=0; i<width; i++)
+  {
+    res[i]=prop.lselect(is_not_zero, quotient[i], prop.new_variable());
+    rem[i]=prop.lselect(is_not_zero, partial[i], prop.new_variable());
+  }
+}
+
 
 #ifdef COMPACT_EQUAL_CONST
 // TODO : use for lt_or_le as well
@@ -1857,6 +2306,30 @@ bool bv_utilst::is_constant(const bvt &bv)
 
 /*******************************************************************\
 
+Function: bv_utilst::significant_width
+
+  Inputs: a bit vector
+
+ Outputs: its width without the top bits that are false or copy
+          the bit below, as those of an extended operand do
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t bv_utilst::significant_width(const bvt &bv)
+{
+  std::size_t width=bv.size();
+
+  while(width>1 &&
+        (bv[width-1].is_false() || bv[width-1]==bv[width-2]))
+    width--;
+
+  return width;
+}
+
+/*******************************************************************\
+
 Function: bv_utilst::cond_implies_equal
 
   Inputs:
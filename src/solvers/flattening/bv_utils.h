@@ -21,14 +21,60 @@ Author: Daniel Kroening, kroening@kroening.com
 // but seems to give a run-time penalty.
 //#define COMPACT_EQUAL_CONST
 
+// The widths from which the automatic choice of the multiplier uses
+// a Dadda tree, and Karatsuba, for two variable operands, counted
+// without the bits that only extend them; see
+// unit/arith_encodings --benchmark. Karatsuba gives a smaller CNF
+// from 64 bits on, but the solver takes longer on it, hence the
+// higher bound.
+#ifndef AUTO_DADDA_MIN_WIDTH
+#define AUTO_DADDA_MIN_WIDTH 6
+#endif
+
+#ifndef AUTO_KARATSUBA_MIN_WIDTH
+#define AUTO_KARATSUBA_MIN_WIDTH 128
+#endif
+
 
 class bv_utilst
 {
 public:
-  inline bv_utilst(propt &_prop):prop(_prop) { }
+  inline bv_utilst(propt &_prop):
+    multiplier_encoding(M_SHIFT_ADD),
+    divider_encoding(D_MULTIPLICATION),
+    karatsuba_min_width(16),
+    auto_dadda_min_width(AUTO_DADDA_MIN_WIDTH),
+    auto_karatsuba_min_width(AUTO_KARATSUBA_MIN_WIDTH),
+    prop(_prop)
+  {
+  }
 
   typedef enum { SIGNED, UNSIGNED } representationt;
 
+  // The encodings of multiplication and division. The defaults are
+  // shift-and-add and the multiplication constraint. M_CSD recodes
+  // constant operands into signed digits, and D_SHIFT turns division
+  // by a constant power of two into a shift; see unit/arith_encodings.
+  // M_AUTO and D_AUTO choose for each operation, from the widths of
+  // the operands and whether one of them is constant.
+  typedef enum
+  {
+    M_SHIFT_ADD, M_CSD, M_WALLACE, M_DADDA, M_KARATSUBA, M_AUTO
+  } multipliert;
+  typedef enum { D_MULTIPLICATION, D_SHIFT, D_RESTORING, D_AUTO } dividert;
+
+  multipliert multiplier_encoding;
+  dividert divider_encoding;
+
+  // below this width, Karatsuba falls back to shift-and-add; it
+  // must be at least 4, as below that the sums of the halves would
+  // be no narrower than the operands
+  std::size_t karatsuba_min_width;
+
+  // with M_AUTO, the significant widths from which two variable
+  // operands are multiplied with a Dadda tree, and with Karatsuba
+  std::size_t auto_dadda_min_width, auto_karatsuba_min_width;
+
   bvt build_constant(const mp_integer &i, std::size_t width);
 
   bvt incrementer(const bvt &op, literalt carry_in);
@@ -210,6 +256,27 @@ protected:
   bvt cond_negate_no_overflow(const bvt &bv, const literalt cond);
 
   bvt wallace_tree(const std::vector<bvt> &pps);
+
+  bvt shift_add_multiplier(const bvt &op0, const bvt &op1);
+  bvt wallace_multiplier(const bvt &op0, const bvt &op1);
+  bvt dadda_multiplier(const bvt &op0, const bvt &op1);
+  bvt dadda_tree(std::vector<bvt> &columns);
+  bvt karatsuba_multiplier(const bvt &op0, const bvt &op1);
+  bvt karatsuba_full_product(const bvt &op0, const bvt &op1);
+  bvt constant_multiplier(const bvt &op, const bvt &constant);
+  static std::size_t significant_width(const bvt &bv);
+
+  bool power_of_two_divider(
+    const bvt &op0, const bvt &op1,
+    bvt &res, bvt &rem);
+
+  void multiplication_divider(
+    const bvt &op0, const bvt &op1,
+    bvt &res, bvt &rem);
+
+  void restoring_divider(
+    const bvt &op0, const bvt &op1,
+    bvt &res, bvt &rem);
 };
 
 #endif
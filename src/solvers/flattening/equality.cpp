@@ -173,8 +173,6 @@ void equalityt::add_equality_constraints(const typestructt &typestruct)
 
   // generate equality constraints
 
-  bv_utilst bv_utils(prop);
-
   for(equalitiest::const_iterator
       it=typestruct.equalities.begin();
       it!=typestruct.equalities.end();
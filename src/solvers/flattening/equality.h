@@ -16,12 +16,18 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <solvers/prop/prop_conv.h>
 
+#include "bv_utils.h"
+
 class equalityt:public prop_conv_solvert
 {
 public:
   equalityt(
     const namespacet &_ns,
-    propt &_prop):prop_conv_solvert(_ns, _prop) { }
+    propt &_prop):
+    prop_conv_solvert(_ns, _prop),
+    bv_utils(_prop)
+  {
+  }
 
   virtual literalt equality(const exprt &e1, const exprt &e2);
 
@@ -33,6 +39,8 @@ public:
   }
 
 protected:
+  bv_utilst bv_utils;
+
   typedef hash_map_cont<const exprt, unsigned, irep_hash> elementst;
   typedef std::map<std::pair<unsigned, unsigned>, literalt> equalitiest;
   typedef std::map<unsigned, exprt> elements_revt;
@@ -69,6 +69,14 @@ public:
   {
   }
 
+  // uses the encodings of multiplication and division of _bv_utils,
+  // which must be over the same propt
+  float_utilst(propt &_prop, const bv_utilst &_bv_utils):
+    prop(_prop),
+    bv_utils(_bv_utils)
+  {
+  }
+
   void set_rounding_mode(const bvt &);
 
   virtual ~float_utilst()
@@ -6,19 +6,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
-#include <set>
-#include <stack>
+#include <algorithm>
 
 #include "aig_prop.h"
 
-// Tries to compact AIGs corresponding to xor and equality
-// Needed to match the performance of the native CNF back-end.
-#define USE_AIG_COMPACT
-
-// Use the Plaisted-Greenbaum encoding, again, needed to match the
-// native CNF back-end.
-#define USE_PG
-
 /*******************************************************************\
 
 Function: aig_prop_baset::land
@@ -111,7 +102,104 @@ literalt aig_prop_baset::land(literalt a, literalt b)
   if(a==neg(b)) return const_literal(false);
   if(a==b) return a;
 
-  return dest.new_and_node(a, b);
+  literalt r=rewrite_and(a, b);
+
+  if(r.var_no()!=literalt::unused_var_no())
+  {
+    rewritten_nodes++;
+    return r;
+  }
+
+  // structural hashing, with ordered operands
+  if(b<a)
+    std::swap(a, b);
+
+  std::pair<and_nodest::iterator, bool> entry=
+    and_nodes.insert(std::make_pair(std::make_pair(a, b), literalt()));
+
+  if(!entry.second)
+  {
+    hashed_nodes++;
+    return entry.first->second;
+  }
+
+  entry.first->second=dest.new_and_node(a, b);
+  return entry.first->second;
+}
+
+/*******************************************************************\
+
+Function: aig_prop_baset::rewrite_and
+
+  Inputs: two non-constant literals that are neither equal nor
+          complementary
+
+ Outputs: a literal equivalent to the conjunction, or an unused
+          literal if no rule applies
+
+ Purpose: Two-level rewriting, where an operand is an AND node
+          (Brummayer and Biere, "Local Two-Level And-Inverter
+          Graph Minimization without Blowup")
+
+\*******************************************************************/
+
+literalt aig_prop_baset::rewrite_and(literalt a, literalt b)
+{
+  for(unsigned i=0; i<2; i++, std::swap(a, b))
+  {
+    if(!is_and(a))
+      continue;
+
+    const literalt x=dest.get_node(a).a;
+    const literalt y=dest.get_node(a).b;
+
+    if(!a.sign())
+    {
+      // contradiction: (x&y)&!x = false
+      if(b==neg(x) || b==neg(y))
+        return const_literal(false);
+
+      // idempotence: (x&y)&x = x&y
+      if(b==x || b==y)
+        return a;
+
+      if(is_and(b) && !b.sign())
+      {
+        const literalt u=dest.get_node(b).a;
+        const literalt v=dest.get_node(b).b;
+
+        // contradiction: (x&y)&(!x&v) = false
+        if(u==neg(x) || u==neg(y) || v==neg(x) || v==neg(y))
+          return const_literal(false);
+      }
+    }
+    else
+    {
+      // subsumption: !(x&y)&!x = !x
+      if(b==neg(x) || b==neg(y))
+        return b;
+
+      // substitution: !(x&y)&x = !y&x
+      if(b==x)
+        return land(neg(y), b);
+      if(b==y)
+        return land(neg(x), b);
+
+      if(is_and(b) && b.sign())
+      {
+        const literalt u=dest.get_node(b).a;
+        const literalt v=dest.get_node(b).b;
+
+        // resolution: !(x&y)&!(x&!y) = !x
+        if((u==x && v==neg(y)) || (v==x && u==neg(y)))
+          return neg(x);
+        if((u==y && v==neg(x)) || (v==y && u==neg(x)))
+          return neg(y);
+      }
+    }
+  }
+
+  return literalt();
 }
 
 /*******************************************************************\
@@ -279,7 +367,7 @@ void aig_prop_baset::set_equal(literalt a, literalt b)
 
 /*******************************************************************\
 
-Function: aig_prop_solvert::l_get
+Function: aig_prop_solvert::aig_prop_solvert
 
   Inputs:
 
@@ -289,9 +377,60 @@ Function: aig_prop_solvert::l_get
 
 \*******************************************************************/
 
+aig_prop_solvert::aig_prop_solvert(propt &_solver):
+  aig_prop_constraintt(aig),
+  solver(_solver),
+  converted_constraints(0),
+  ite_gates(0),
+  majority_gates(0)
+{
+  // node n is variable n of the solver, which doesn't use 0
+  aig.new_node();
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::l_get
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Evaluates the nodes from the values of the inputs. With
+          the Plaisted-Greenbaum encoding, the variable of a node
+          need not have the value of the node.
+
+\*******************************************************************/
+
 tvt aig_prop_solvert::l_get(literalt a) const
 {
-  return solver.l_get(a);
+  if(a.is_true())
+    return tvt(true);
+  else if(a.is_false())
+    return tvt(false);
+
+  // the operands of a node precede it
+  for(std::size_t n=values.size(); n<aig.nodes.size(); n++)
+  {
+    const aigt::nodet &node=aig.nodes[n];
+
+    if(node.is_and())
+    {
+      tvt value_a=node.a.is_constant()?tvt(node.a.is_true()):
+        (node.a.sign()?!values[node.a.var_no()]:values[node.a.var_no()]);
+      tvt value_b=node.b.is_constant()?tvt(node.b.is_true()):
+        (node.b.sign()?!values[node.b.var_no()]:values[node.b.var_no()]);
+
+      values.push_back(value_a && value_b);
+    }
+    else if(n==0)
+      values.push_back(tvt::unknown());
+    else
+      values.push_back(solver.l_get(literalt(n, false)));
+  }
+
+  const tvt &value=values[a.var_no()];
+  return a.sign()?!value:value;
 }
 
 /*******************************************************************\
@@ -310,413 +449,352 @@ propt::resultt aig_prop_solvert::prop_solve()
 {
   status() << "converting AIG, "
            << aig.nodes.size() << " nodes" << eom;
+
   convert_aig();
 
+  statistics() << "AIG: " << hashed_nodes
+               << " nodes found by structural hashing, "
+               << rewritten_nodes << " by rewriting; "
+               << ite_gates << " ITE and "
+               << majority_gates << " majority encodings" << eom;
+
+  values.clear();
+  solver.set_assumptions(assumptions);
+
   return solver.prop_solve();
 }
 
 /*******************************************************************\
 
-Function: aig_prop_solvert::compute_phase
+Function: aig_prop_solvert::usage_count
 
-  Inputs: Two vectors of bools of size aig.nodes.size()
+  Inputs:
 
- Outputs: These vectors filled in with per node phase information
+ Outputs:
 
- Purpose: Compute the phase information needed for Plaisted-Greenbaum encoding
+ Purpose: counts the uses of the nodes, for the compact encodings
 
 \*******************************************************************/
 
-void aig_prop_solvert::compute_phase(
-  std::vector<bool> &n_pos,
-  std::vector<bool> &n_neg)
+void aig_prop_solvert::usage_count()
 {
-  std::stack<literalt> queue;
-
-  // Get phases of constraints
-  for(aig_plus_constraintst::constraintst::const_iterator
-      c_it=aig.constraints.begin();
-      c_it!=aig.constraints.end();
-      c_it++)
-    queue.push(*c_it);
-
-  while(!queue.empty())
-  {
-    literalt l=queue.top();
-    queue.pop();
-
-    if(l.is_constant()) continue;
-
-    bool sign=l.sign();
-    unsigned var_no=l.var_no();
+  p_usage_count.assign(aig.nodes.size(), 0);
+  n_usage_count.assign(aig.nodes.size(), 0);
 
-    // already set?
-    if(sign?n_neg[var_no]:n_pos[var_no]) continue; // done already
+  bvt uses;
+  uses.reserve(aig.nodes.size()*2);
 
-    // set
-    sign?n_neg[var_no]=1:n_pos[var_no]=1;
+  for(const auto &c : aig.constraints)
+    uses.push_back(c);
 
-    const aigt::nodet &node=aig.nodes[var_no];
+  for(const auto &a : assumptions)
+    uses.push_back(a);
 
+  for(const auto &node : aig.nodes)
     if(node.is_and())
     {
-      queue.push(node.a^sign);
-      queue.push(node.b^sign);
+      uses.push_back(node.a);
+      uses.push_back(node.b);
     }
-  }
-
-  // Count
-  unsigned pos_only=0, neg_only=0, mixed=0;
 
-  for(unsigned n=0; n<aig.nodes.size(); n++)
-  {
-    if(aig.nodes[n].is_and())
+  forall_literals(it, uses)
+    if(!it->is_constant())
     {
-      if(n_neg[n] && n_pos[n])
-        mixed++;
-      else if(n_pos[n])
-        pos_only++;
-      else if(n_neg[n])
-        neg_only++;
+      if(it->sign())
+        ++n_usage_count[it->var_no()];
+      else
+        ++p_usage_count[it->var_no()];
     }
-  }
-
-  statistics() << "Pos only: " << pos_only << "\n"
-               << "Neg only: " << neg_only << "\n"
-               << "Mixed: " << mixed << eom;
 }
 
+/*******************************************************************\
+
+Function: aig_prop_solvert::require
+
+  Inputs: a literal that is to be constrained to be true
+
+ Outputs:
+
+ Purpose: Queues the node in the polarity needed: a positive
+          literal needs the node to imply its operands, and a
+          negative literal needs the converse.
+
+\*******************************************************************/
+
+void aig_prop_solvert::require(literalt l)
+{
+  if(l.is_constant() || !aig.get_node(l).is_and())
+    return;
+
+  std::vector<bool> &encoded=l.sign()?neg_encoded:pos_encoded;
+
+  if(encoded[l.var_no()])
+    return;
+
+  encoded[l.var_no()]=true;
+  queue.push_back(l);
+}
 
 /*******************************************************************\
 
-Function: aig_prop_solvert::usage_count
+Function: aig_prop_solvert::add_clause
 
-  Inputs: Two vectors of unsigned of size aig.nodes.size()
+  Inputs: a clause that encodes node o, in terms of other nodes
 
- Outputs: These vectors filled in with per node usage information
+ Outputs:
 
- Purpose: Compact encoding for single usage variable
+ Purpose:
 
 \*******************************************************************/
 
-void aig_prop_solvert::usage_count(
-  std::vector<unsigned> &p_usage_count,
-  std::vector<unsigned> &n_usage_count)
+void aig_prop_solvert::add_clause(const bvt &clause, literalt o)
 {
-  for(aig_plus_constraintst::constraintst::const_iterator
-      c_it=aig.constraints.begin();
-      c_it!=aig.constraints.end();
-      c_it++)
-  {
-    if (!((*c_it).is_constant()))
-    {
-      if ((*c_it).sign()) {
-        ++n_usage_count[(*c_it).var_no()];
-      } else {
-        ++p_usage_count[(*c_it).var_no()];
-      }
+  solver.lcnf(clause);
 
-    }
-  }
+  forall_literals(it, clause)
+    if(it->var_no()!=o.var_no())
+      require(*it);
+}
 
-  for (unsigned n=0; n<aig.nodes.size(); n++)
-  {
-    const aigt::nodet &node=aig.nodes[n];
+/*******************************************************************\
 
-    if (node.is_and()) {
-      if (node.a.sign()) {
-        ++n_usage_count[node.a.var_no()];
-      } else {
-        ++p_usage_count[node.a.var_no()];
-      }
+Function: aig_prop_solvert::get_body
 
-      if (node.b.sign()) {
-        ++n_usage_count[node.b.var_no()];
-      } else {
-        ++p_usage_count[node.b.var_no()];
-      }
+  Inputs:
 
-    }
-  }
+ Outputs: the conjuncts of the node
+
+ Purpose: Inlines the operands that are AND nodes used only here,
+          which removes the overhead introduced by land and lor
+          for bvt.
 
+\*******************************************************************/
+
+void aig_prop_solvert::get_body(literalt o, bvt &body) const
+{
+  const aigt::nodet &node=aig.get_node(o);
 
-  #if 1
-  // Compute stats
-  unsigned unused = 0;
-  unsigned usedOncePositive = 0;
-  unsigned usedOnceNegative = 0;
-  unsigned usedTwicePositive = 0;
-  unsigned usedTwiceNegative = 0;
-  unsigned usedTwiceMixed = 0;
-  unsigned usedThreeTimes = 0;
-  unsigned usedMore = 0;
+  body.resize(2);
+  body[0]=node.a;
+  body[1]=node.b;
 
-  for (unsigned n=0; n<aig.nodes.size(); n++)
+  for(std::size_t i=0; i<body.size(); i++)
   {
-    switch (p_usage_count[n] + n_usage_count[n])
-    {
-    case 0: ++unused; break;
-    case 1:
-      if(p_usage_count[n] == 1)
-        ++usedOncePositive;
-      else
-        ++usedOnceNegative;
-      break;
+    literalt l=body[i];
 
-    case 2 :
-      if (p_usage_count[n] >= 2)
-      {
-        ++usedTwicePositive;
-      }
-      else if (n_usage_count[n] >= 2)
-      {
-        ++usedTwiceNegative;
-      }
-      else
-      {
-        assert(p_usage_count[n] == 1 && n_usage_count[n] == 1);
-        ++usedTwiceMixed;
-      }
-      break;
-    case 3: ++usedThreeTimes; break;
-    default: ++usedMore; break;
+    if(!l.is_constant() &&
+       !l.sign() &&                       // used positively...
+       aig.get_node(l).is_and() &&        // ... is a gate ...
+       p_usage_count[l.var_no()]==1 &&    // ... only used here
+       n_usage_count[l.var_no()]==0)
+    {
+      const aigt::nodet &rep=aig.get_node(l);
+      body[i]=rep.a;
+      body.push_back(rep.b);
+      --i; // repeat the process
     }
   }
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::is_single_use_and
 
-  statistics() << "Unused: " << unused << " "
-               << "Used once: " << usedOncePositive + usedOnceNegative
-               << " (P: " << usedOncePositive
-               << ", N: " << usedOnceNegative << ") "
-               << "Used twice: " << usedTwicePositive + usedTwiceNegative + usedTwiceMixed
-               << " (P: " << usedTwicePositive
-               << ", N: " << usedTwiceNegative
-               << ", M: " << usedTwiceMixed << ") "
-               << "Used three times: " << usedThreeTimes << " "
-               << "Used more: " << usedMore
-               << eom;
-  #endif
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool aig_prop_solvert::is_single_use_and(literalt l) const
+{
+  return !l.is_constant() &&
+         l.sign() &&
+         aig.get_node(l).is_and() &&
+         p_usage_count[l.var_no()]==0 &&
+         n_usage_count[l.var_no()]==1;
 }
 
 /*******************************************************************\
 
-Function: aig_prop_solvert::convert_node
+Function: aig_prop_solvert::convert_ite
 
-  Inputs: The node to convert, the phases required and the usage counts.
+  Inputs: a node in the polarity needed, and its conjuncts
 
- Outputs: The node converted to CNF in the solver object.
+ Outputs: true if the node has been encoded
 
- Purpose: Convert one AIG node, including special handling of a couple of cases
+ Purpose: Recognises o = !(x&y) & !(!x&z) = !(x?y:z), which
+          lxor, lequal and lselect produce, and encodes it
+          without variables for the inner nodes.
 
 \*******************************************************************/
 
-void aig_prop_solvert::convert_node(
-  unsigned n,
-  const aigt::nodet &node,
-  bool n_pos, bool n_neg,
-  std::vector<unsigned> &p_usage_count,
-  std::vector<unsigned> &n_usage_count)
+bool aig_prop_solvert::convert_ite(literalt l, const bvt &body)
 {
-  if (p_usage_count[n] > 0 || n_usage_count[n] > 0)
-  {
-    literalt o=literalt(n, false);
-    bvt body(2);
-    body[0]=node.a;
-    body[1]=node.b;
+  assert(body.size()==2);
 
-#ifdef USE_AIG_COMPACT
-    // Inline positive literals
-    // This should remove the overhead introduced by land and lor for bvt
+  if(!is_single_use_and(body[0]) || !is_single_use_and(body[1]))
+    return false;
 
-    for (bvt::size_type i = 0; i < body.size(); i++)
-    {
-      literalt l = body[i];
-
-      if (!l.sign() &&                      // Used positively...
-          aig.nodes[l.var_no()].is_and() && // ... is a gate ...
-          p_usage_count[l.var_no()] == 1 && // ... only used here.
-          n_usage_count[l.var_no()] == 0) {
-
-        const aigt::nodet &rep = aig.nodes[l.var_no()];
-        body[i] = rep.a;
-        body.push_back(rep.b);
-        --i;                         // Repeat the process
-        --p_usage_count[l.var_no()]; // Supress generation of inlined node
-      }
-    }
+  const aigt::nodet &left=aig.get_node(body[0]);
+  const aigt::nodet &right=aig.get_node(body[1]);
 
-    // TODO : Could check the array for duplicates / complementary literals
-    // but this should be found by the SAT preprocessor.
-    // TODO : Likewise could find things that are constrained, esp the output
-    // and backwards constant propagate.  Again may not be worth it.
-
-    // lxor and lselect et al. are difficult to express in AIGs.
-    // Doing so introduces quite a bit of overhead.
-    // This should recognise the AIGs they produce and
-    // handle them in a more efficient way.
-
-    // Recognise something of the form:
-    //
-    //  neg(o) = lor(land(a,b), land(neg(a),c))
-    //      o  = land(lneg(land(a,b)), lneg(land(neg(a),c)))
-    //
-    // Note that lxor and lselect generate the negation of this
-    // but will still be recognised because the negation is
-    // recorded where it is used
-
-    if(body.size() == 2 && body[0].sign() && body[1].sign())
-    {
-      const aigt::nodet &left = aig.nodes[body[0].var_no()];
-      const aigt::nodet &right = aig.nodes[body[1].var_no()];
+  const literalt left_ops[]={ left.a, left.b };
+  const literalt right_ops[]={ right.a, right.b };
 
-      if(left.is_and() && right.is_and())
+  for(unsigned i=0; i<2; i++)
+    for(unsigned j=0; j<2; j++)
+      if(left_ops[i]==neg(right_ops[j]))
       {
-        if(left.a == neg(right.a))
+        literalt x=left_ops[i];
+        literalt y=left_ops[1-i];
+        literalt z=right_ops[1-j];
+        literalt o(l.var_no(), false);
+
+        bvt lits(3);
+
+        if(l.sign())
         {
-          if (p_usage_count[body[0].var_no()] == 0 &&
-              n_usage_count[body[0].var_no()] == 1 &&
-              p_usage_count[body[1].var_no()] == 0 &&
-              n_usage_count[body[1].var_no()] == 1)
-          {
-            bvt lits(3);
-
-            if (n_neg)
-            {
-              lits[0] = left.a;
-              lits[1] = right.b;
-              lits[2] = o;
-              solver.lcnf(lits);
-
-              lits[0] = neg(left.a);
-              lits[1] = left.b;
-              lits[2] = o;
-              solver.lcnf(lits);
-            }
-
-            if (n_pos)
-            {
-              lits[0] = left.a;
-              lits[1] = neg(right.b);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-
-              lits[0] = neg(left.a);
-              lits[1] = neg(left.b);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-            }
-
-            // Supress generation
-            --n_usage_count[body[0].var_no()];
-            --n_usage_count[body[1].var_no()];
-
-            return;
-          }
+          lits[0]=o; lits[1]=neg(x); lits[2]=y;
+          add_clause(lits, o);
+          lits[0]=o; lits[1]=x; lits[2]=z;
+          add_clause(lits, o);
         }
+        else
+        {
+          lits[0]=neg(o); lits[1]=neg(x); lits[2]=neg(y);
+          add_clause(lits, o);
+          lits[0]=neg(o); lits[1]=x; lits[2]=neg(z);
+          add_clause(lits, o);
+        }
+
+        ite_gates++;
+        return true;
       }
-    }
 
+  return false;
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::convert_majority
+
+  Inputs: a node in the polarity needed, and its conjuncts
+
+ Outputs: true if the node has been encoded
+
+ Purpose: Recognises o = !(a&b) & !(a&c) & !(b&c), the negated
+          carry, and encodes it without variables for the inner
+          nodes.
+
+\*******************************************************************/
+
+bool aig_prop_solvert::convert_majority(literalt l, const bvt &body)
+{
+  assert(body.size()==3);
+
+  for(const auto &b : body)
+    if(!is_single_use_and(b))
+      return false;
 
-    // Likewise, carry has an improved encoding which is generated
-    // by the CNF encoding
-    if (body.size() == 3 && body[0].sign() && body[1].sign() && body[2].sign())
+  const aigt::nodet &first=aig.get_node(body[0]);
+  const aigt::nodet &second=aig.get_node(body[1]);
+  const aigt::nodet &third=aig.get_node(body[2]);
+
+  // a and b are the operands of the first node; the second one
+  // holds one of them and c, and the third one the other and c
+  literalt a=first.a, b=first.b, c;
+
+  auto other=[](const aigt::nodet &node, literalt x, literalt &y)
+  {
+    if(node.a==x) { y=node.b; return true; }
+    if(node.b==x) { y=node.a; return true; }
+    return false;
+  };
+
+  literalt c2;
+
+  if(other(second, a, c) && other(third, b, c2) && c==c2)
+  {
+  }
+  else if(other(second, b, c) && other(third, a, c2) && c==c2)
+  {
+  }
+  else
+    return false;
+
+  literalt o(l.var_no(), false);
+  const literalt pairs[3][2]={ { a, b }, { a, c }, { b, c } };
+  bvt lits(3);
+
+  for(unsigned i=0; i<3; i++)
+  {
+    if(l.sign())
     {
-      const aigt::nodet &left = aig.nodes[body[0].var_no()];
-      const aigt::nodet &mid = aig.nodes[body[1].var_no()];
-      const aigt::nodet &right = aig.nodes[body[2].var_no()];
-
-      if (left.is_and() && mid.is_and() && right.is_and()) {
-        if (p_usage_count[body[0].var_no()] == 0 &&
-            n_usage_count[body[0].var_no()] == 1 &&
-            p_usage_count[body[1].var_no()] == 0 &&
-            n_usage_count[body[1].var_no()] == 1 &&
-            p_usage_count[body[2].var_no()] == 0 &&
-            n_usage_count[body[2].var_no()] == 1) {
-
-          literalt a = left.a;
-          literalt b = left.b;
-          literalt c = mid.a;
-
-          if (a == right.b && b == mid.b && c == right.a) {
-
-            // A (negative) carry -- 1 if at most one input is 1
-            bvt lits(3);
-
-            if (n_neg)
-            {
-              lits[0] = a;
-              lits[1] = b;
-              lits[2] = o;
-              solver.lcnf(lits);
-
-              lits[0] = a;
-              lits[1] = c;
-              lits[2] = o;
-              solver.lcnf(lits);
-
-              lits[0] = b;
-              lits[1] = c;
-              lits[2] = o;
-              solver.lcnf(lits);
-            }
-
-            if (n_pos)
-            {
-              lits[0] = neg(a);
-              lits[1] = neg(b);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-
-              lits[0] = neg(a);
-              lits[1] = neg(c);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-
-              lits[0] = neg(b);
-              lits[1] = neg(c);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-            }
-
-            // Supress generation
-            --n_usage_count[body[0].var_no()];
-            --n_usage_count[body[1].var_no()];
-            --n_usage_count[body[2].var_no()];
-
-            return;
-          }
-        }
-      }
+      lits[0]=o; lits[1]=pairs[i][0]; lits[2]=pairs[i][1];
+    }
+    else
+    {
+      lits[0]=neg(o); lits[1]=neg(pairs[i][0]); lits[2]=neg(pairs[i][1]);
     }
 
-    // TODO : these special cases are fragile and could be improved.
-    // They don't handle cases where the construction is partially constant
-    // folded.  Also the usage constraints are sufficient for improvement
-    // but reductions may still be possible with looser restrictions.
-#endif
+    add_clause(lits, o);
+  }
 
-    if(n_pos)
-    {
-      bvt lits(2);
-      lits[1]=neg(o);
+  majority_gates++;
+  return true;
+}
 
-      forall_literals(it, body)
-      {
-        lits[0]=pos(*it);
-        solver.lcnf(lits);
-      }
-    }
+/*******************************************************************\
 
-    if(n_neg)
-    {
-      bvt lits;
+Function: aig_prop_solvert::convert_node
 
-      forall_literals(it, body)
-        lits.push_back(neg(*it));
+  Inputs: a node, in the polarity needed
 
-      lits.push_back(pos(o));
-      solver.lcnf(lits);
-    }
+ Outputs:
 
+ Purpose:
+
+\*******************************************************************/
+
+void aig_prop_solvert::convert_node(literalt l)
+{
+  literalt o(l.var_no(), false);
+
+  bvt body;
+  get_body(o, body);
+
+  if(body.size()==2 && convert_ite(l, body))
+    return;
+
+  if(body.size()==3 && convert_majority(l, body))
+    return;
+
+  if(l.sign())
+  {
+    // the conjuncts imply o
+    bvt lits;
+    lits.reserve(body.size()+1);
+
+    forall_literals(it, body)
+      lits.push_back(neg(*it));
+
+    lits.push_back(o);
+    add_clause(lits, o);
+  }
+  else
+  {
+    // o implies the conjuncts
+    bvt lits(2);
+    lits[0]=neg(o);
+
+    forall_literals(it, body)
+    {
+      lits[1]=*it;
+      add_clause(lits, o);
+    }
   }
 }
 
@@ -728,55 +806,36 @@ Function: aig_prop_solvert::convert_aig
 
  Outputs:
 
- Purpose:
+ Purpose: encodes the nodes that the new constraints and the
+          assumptions depend on, and passes the new constraints
 
 \*******************************************************************/
 
 void aig_prop_solvert::convert_aig()
 {
-  // 1. Do variables
-  while(solver.no_variables()<=aig.nodes.size())
+  while(solver.no_variables()<aig.nodes.size())
     solver.new_variable();
 
-  // Usage count for inlining
+  pos_encoded.resize(aig.nodes.size(), false);
+  neg_encoded.resize(aig.nodes.size(), false);
 
-  std::vector<unsigned> p_usage_count;
-  std::vector<unsigned> n_usage_count;
-  p_usage_count.resize(aig.nodes.size(), 0);
-  n_usage_count.resize(aig.nodes.size(), 0);
+  usage_count();
 
-  this->usage_count(p_usage_count, n_usage_count);
+  for(std::size_t i=converted_constraints; i<aig.constraints.size(); i++)
+    require(aig.constraints[i]);
 
+  forall_literals(it, assumptions)
+    require(*it);
 
-  #ifdef USE_PG
-  // Get phases
-  std::vector<bool> n_pos, n_neg;
-  n_pos.resize(aig.nodes.size(), false);
-  n_neg.resize(aig.nodes.size(), false);
-
-  this->compute_phase(n_pos, n_neg);
-  #endif
-
-  // 2. Do nodes
-  for(std::size_t n = aig.nodes.size() - 1; n != 0; n--)
+  while(!queue.empty())
   {
-    if(aig.nodes[n].is_and())
-      {
-#ifdef USE_PG
-        convert_node(n, aig.nodes[n], n_pos[n], n_neg[n], p_usage_count, n_usage_count);
-#else
-        convert_node(n, aig.nodes[n], true, true, p_usage_count, n_usage_count);
-#endif
-      }
+    literalt l=queue.back();
+    queue.pop_back();
+    convert_node(l);
   }
-  // Skip zero as it is not used or a valid literal
-
-
-  // 3. Do constraints
-  for(const auto & c_it : aig.constraints)
-    solver.l_set_to(c_it, true);
 
-  // HACK!
-  aig.nodes.clear();
+  for(std::size_t i=converted_constraints; i<aig.constraints.size(); i++)
+    solver.l_set_to(aig.constraints[i], true);
 
+  converted_constraints=aig.constraints.size();
 }
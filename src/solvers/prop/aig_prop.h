@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <cassert>
 
 #include <util/threeval.h>
+#include <util/hash_cont.h>
 #include <solvers/prop/prop.h>
 
 #include "aig.h"
@@ -19,7 +20,10 @@ Author: Daniel Kroening, kroening@kroening.com
 class aig_prop_baset:public propt
 {
 public:
-  explicit inline aig_prop_baset(aigt &_dest):dest(_dest)
+  explicit inline aig_prop_baset(aigt &_dest):
+    hashed_nodes(0),
+    rewritten_nodes(0),
+    dest(_dest)
   {
   }
 
@@ -59,8 +63,30 @@ public:
   virtual resultt prop_solve()
   { assert(0); return P_ERROR; }
 
+  // nodes found by structural hashing, and by rewriting
+  std::size_t hashed_nodes, rewritten_nodes;
+
 protected:
   aigt &dest;
+
+  struct and_hasht
+  {
+    std::size_t operator()(const std::pair<literalt, literalt> &p) const
+    {
+      return (std::size_t(p.first.get())<<16)^p.second.get();
+    }
+  };
+
+  typedef hash_map_cont<std::pair<literalt, literalt>, literalt, and_hasht>
+    and_nodest;
+  and_nodest and_nodes;
+
+  bool is_and(literalt a) const
+  {
+    return !a.is_constant() && dest.get_node(a).is_and();
+  }
+
+  literalt rewrite_and(literalt a, literalt b);
 };
 
 class aig_prop_constraintt:public aig_prop_baset
@@ -86,14 +112,23 @@ public:
   }
 };
 
+/*******************************************************************\
+
+   Class: aig_prop_solvert
+
+ Purpose: Builds an AIG, and passes the CNF of the nodes that the
+          constraints and assumptions depend on to the solver when
+          solving. The nodes are encoded lazily, in the polarity
+          needed (Plaisted-Greenbaum), and the solver may be called
+          again after adding nodes and constraints. The solver must
+          not eliminate variables, as a node may be encoded later on.
+
+\*******************************************************************/
+
 class aig_prop_solvert:public aig_prop_constraintt
 {
 public:
-  explicit inline aig_prop_solvert(propt &_solver):
-    aig_prop_constraintt(aig),
-    solver(_solver)
-  {
-  }
+  explicit aig_prop_solvert(propt &_solver);
 
   aig_plus_constraintst aig;
 
@@ -104,6 +139,18 @@ public:
   virtual tvt l_get(literalt a) const;
   virtual resultt prop_solve();
 
+  virtual void set_assumptions(const bvt &_assumptions)
+  { assumptions=_assumptions; }
+
+  virtual bool has_set_assumptions() const
+  { return solver.has_set_assumptions(); }
+
+  virtual bool is_in_conflict(literalt a) const
+  { return solver.is_in_conflict(a); }
+
+  virtual bool has_is_in_conflict() const
+  { return solver.has_is_in_conflict(); }
+
   virtual void set_message_handler(message_handlert &m)
   {
     aig_prop_constraintt::set_message_handler(m);
@@ -112,11 +159,35 @@ public:
 
 protected:
   propt &solver;
+  bvt assumptions;
+
+  // the constraints that have been passed to the solver
+  std::size_t converted_constraints;
+
+  // the polarities in which the nodes have been encoded
+  std::vector<bool> pos_encoded, neg_encoded;
+
+  typedef std::vector<unsigned> usage_countt;
+  usage_countt p_usage_count, n_usage_count;
+
+  // the nodes still to be encoded, with their polarity
+  std::vector<literalt> queue;
+
+  // the values of the nodes, computed from the inputs
+  mutable std::vector<tvt> values;
+
+  // gates found by the compact encoding
+  std::size_t ite_gates, majority_gates;
 
   void convert_aig();
-  void usage_count(std::vector<unsigned> &p_usage_count, std::vector<unsigned> &n_usage_count);
-  void compute_phase(std::vector<bool> &n_pos, std::vector<bool> &n_neg);
-  void convert_node(unsigned n, const aigt::nodet &node, bool n_pos, bool n_neg, std::vector<unsigned> &p_usage_count, std::vector<unsigned> &n_usage_count);
+  void usage_count();
+  void require(literalt l);
+  void add_clause(const bvt &clause, literalt o);
+  void convert_node(literalt o);
+  void get_body(literalt o, bvt &body) const;
+  bool is_single_use_and(literalt l) const;
+  bool convert_ite(literalt o, const bvt &body);
+  bool convert_majority(literalt o, const bvt &body);
 };
 
 #endif
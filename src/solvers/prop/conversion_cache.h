@@ -0,0 +1,191 @@
+/*******************************************************************\
+
+Module: Cache for the Conversion of Expressions
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_SOLVERS_PROP_CONVERSION_CACHE_H
+#define CPROVER_SOLVERS_PROP_CONVERSION_CACHE_H
+
+#include <algorithm>
+#include <ostream>
+
+#include <util/expr.h>
+#include <util/hash_cont.h>
+
+// Maps expressions to the result of their conversion, e.g., a
+// literal or a vector of literals. Expressions are first looked up
+// by the address of their shared representation, which avoids
+// hashing and comparing whole trees when the same subexpression is
+// converted again; the entry holds a reference to the expression,
+// so the address cannot be reused while the entry exists. Failing
+// that, they are looked up by structure, with the operands of
+// commutative operators in a canonical order, such that a*b and b*a
+// share the result.
+
+template<typename T>
+class conversion_cachet
+{
+public:
+  conversion_cachet():
+    identity_hits(0),
+    hits(0),
+    misses(0)
+  {
+  }
+
+  // Returns the entry, and true if it is new. Entries do not move
+  // when others are inserted.
+  std::pair<T *, bool> insert(const exprt &expr)
+  {
+    #ifdef SHARING
+    typename identity_mapt::const_iterator i_it=
+      identity_map.find(&expr.read());
+
+    if(i_it!=identity_map.end())
+    {
+      identity_hits++;
+      return std::make_pair(i_it->second.value, false);
+    }
+    #endif
+
+    std::pair<typename mapt::iterator, bool> result;
+
+    if(is_canonical(expr))
+      result=map.insert(std::make_pair(expr, T()));
+    else
+      result=map.insert(std::make_pair(canonical(expr), T()));
+
+    T *value=&result.first->second;
+
+    if(result.second)
+    {
+      misses++;
+
+      #ifdef SHARING
+      identity_entryt &entry=identity_map[&expr.read()];
+      entry.expr=expr;
+      entry.value=value;
+      #endif
+    }
+    else
+      hits++;
+
+    return std::make_pair(value, result.second);
+  }
+
+  // returns NULL if not found
+  const T *find(const exprt &expr) const
+  {
+    #ifdef SHARING
+    typename identity_mapt::const_iterator i_it=
+      identity_map.find(&expr.read());
+
+    if(i_it!=identity_map.end())
+      return i_it->second.value;
+    #endif
+
+    typename mapt::const_iterator it=
+      is_canonical(expr)?map.find(expr):map.find(canonical(expr));
+
+    if(it==map.end())
+      return NULL;
+
+    return &it->second;
+  }
+
+  void clear()
+  {
+    map.clear();
+    identity_map.clear();
+  }
+
+  std::size_t size() const
+  {
+    return map.size();
+  }
+
+  // statistics
+  unsigned long long identity_hits, hits, misses;
+
+  void output_statistics(std::ostream &out) const
+  {
+    out << size() << " entries, "
+        << identity_hits << " hits by address, "
+        << hits << " hits by structure, "
+        << misses << " misses";
+  }
+
+protected:
+  typedef hash_map_cont<exprt, T, irep_hash> mapt;
+  mapt map;
+
+  struct identity_entryt
+  {
+    exprt expr;
+    T *value;
+  };
+
+  struct pointer_hash
+  {
+    inline std::size_t operator()(const void *p) const
+    {
+      return (std::size_t)p;
+    }
+  };
+
+  typedef hash_map_cont<const void *, identity_entryt, pointer_hash>
+    identity_mapt;
+  identity_mapt identity_map;
+
+  static bool is_commutative(const exprt &expr)
+  {
+    const irep_idt &id=expr.id();
+
+    if(id!=ID_plus && id!=ID_mult &&
+       id!=ID_bitand && id!=ID_bitor && id!=ID_bitxor &&
+       id!=ID_and && id!=ID_or && id!=ID_xor &&
+       id!=ID_equal && id!=ID_notequal)
+      return false;
+
+    const exprt::operandst &operands=expr.operands();
+
+    if(operands.size()<2)
+      return false;
+
+    // pointer arithmetic, for one, mixes the types
+    for(const auto &op : operands)
+      if(op.type()!=operands.front().type())
+        return false;
+
+    return true;
+  }
+
+  static bool operand_less(const exprt &a, const exprt &b)
+  {
+    return a.compare(b)<0;
+  }
+
+  static bool is_canonical(const exprt &expr)
+  {
+    return !is_commutative(expr) ||
+           std::is_sorted(
+             expr.operands().begin(),
+             expr.operands().end(),
+             operand_less);
+  }
+
+  static exprt canonical(const exprt &expr)
+  {
+    exprt result=expr;
+    std::sort(
+      result.operands().begin(),
+      result.operands().end(),
+      operand_less);
+    return result;
+  }
+};
+
+#endif
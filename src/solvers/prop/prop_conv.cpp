@@ -235,10 +235,10 @@ bool prop_conv_solvert::get_bool(const exprt &expr, tvt &value) const
 
   // check cache
 
-  cachet::const_iterator cache_result=cache.find(expr);
-  if(cache_result==cache.end()) return true;
+  const literalt *cache_result=cache.find(expr);
+  if(cache_result==NULL) return true;
 
-  value=prop.l_get(cache_result->second);
+  value=prop.l_get(*cache_result);
   return false;
 }
 
@@ -266,17 +266,16 @@ literalt prop_conv_solvert::convert(const exprt &expr)
   }
   // check cache first
 
-  std::pair<cachet::iterator, bool> result=
-    cache.insert(std::pair<exprt, literalt>(expr, literalt()));
+  std::pair<literalt *, bool> result=cache.insert(expr);
 
   if(!result.second)
-    return result.first->second;
+    return *result.first;
 
   literalt literal=convert_bool(expr);
 
   // insert into cache
 
-  result.first->second=literal;
+  *result.first=literal;
   if(freeze_all && !literal.is_constant()) prop.set_frozen(literal);
 
   #if 0
@@ -645,12 +644,15 @@ Function: prop_conv_solvert::solve
 
 decision_proceduret::resultt prop_conv_solvert::dec_solve()
 {
-  // post-processing isn't incremental yet
-  if(!post_processing_done)
+  // post-processing isn't incremental yet, and is thus done again
+  // for all of the formula once it has been extended
+  if(!post_processing_done ||
+     prop.no_variables()!=post_processed_variables)
   {
     print(8, "Post-processing");
     post_process();
     post_processing_done=true;
+    post_processed_variables=prop.no_variables();
   }
 
   print(7, "Solving with "+prop.solver_text());
@@ -724,3 +726,21 @@ void prop_conv_solvert::print_assignment(std::ostream &out) const
       it++)
     out << it->first << " = " << prop.l_get(it->second) << "\n";
 }
+
+/*******************************************************************\
+
+Function: prop_conv_solvert::output_cache_statistics
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void prop_conv_solvert::output_cache_statistics(std::ostream &out) const
+{
+  out << "literal cache: ";
+  cache.output_statistics(out);
+}
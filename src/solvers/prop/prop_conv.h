@@ -17,6 +17,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/expr.h>
 #include <util/std_expr.h>
 
+#include "conversion_cache.h"
 #include "literal.h"
 #include "literal_expr.h"
 #include "prop.h"
@@ -73,6 +74,7 @@ public:
     equality_propagation(true),
     freeze_all(false),
     post_processing_done(false),
+    post_processed_variables(0),
     prop(_prop) { }
 
   virtual ~prop_conv_solvert() { }
@@ -99,6 +101,9 @@ public:
   // get literal for expression, if available
   virtual bool literal(const exprt &expr, literalt &literal) const;
 
+  // the propositional solver, e.g., for its statistics
+  const propt &get_prop() const { return prop; }
+
   bool use_cache;
   bool equality_propagation;
   bool freeze_all; // freezing variables (for incremental solving)
@@ -106,15 +111,20 @@ public:
   virtual void clear_cache() { cache.clear();}
 
   typedef std::map<irep_idt, literalt> symbolst;
-  typedef hash_map_cont<exprt, literalt, irep_hash> cachet;
+  typedef conversion_cachet<literalt> cachet;
 
   const cachet &get_cache() const { return cache; }
+
+  // hits and misses of the caches
+  virtual void output_cache_statistics(std::ostream &out) const;
   const symbolst &get_symbols() const { return symbols; }
 
 protected:
   virtual void post_process();
 
   bool post_processing_done;
+  // the size of the formula when last post-processed
+  std::size_t post_processed_variables;
 
   // get a _boolean_ value from counterexample if not valid
   virtual bool get_bool(const exprt &expr, tvt &value) const;
@@ -323,7 +323,7 @@ void bv_refinementt::check_SAT(approximationt &a)
     if(a.over_state<max_node_refinement)
     {
       bvt r;
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=spec;
       float_utils.rounding_mode_bits.set(rounding_mode);
 
@@ -350,7 +350,7 @@ void bv_refinementt::check_SAT(approximationt &a)
       a.over_state=MAX_STATE;
 
       bvt r;
-      float_utilst float_utils(prop);
+      float_utilst float_utils(prop, bv_utils);
       float_utils.spec=spec;
       float_utils.rounding_mode_bits.set(rounding_mode);
 
@@ -483,7 +483,7 @@ void bv_refinementt::check_UNSAT(approximationt &a)
 
     a.under_assumptions.reserve(a.op0_bv.size()+a.op1_bv.size());
 
-    float_utilst float_utils(prop);
+    float_utilst float_utils(prop, bv_utils);
     float_utils.spec=spec;
 
     // the fraction without hidden bit
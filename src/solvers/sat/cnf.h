@@ -70,6 +70,12 @@ public:
     return clause_counter;
   }
 
+  // Asks a prop_solve() running in another thread to give up
+  // with P_ERROR. The request holds until clear_interrupt().
+  virtual void interrupt() { }
+  virtual void clear_interrupt() { }
+  virtual bool has_interrupt() const { return false; }
+
 protected:
   typedef enum { INIT, SAT, UNSAT, ERROR } statust;
   statust status;
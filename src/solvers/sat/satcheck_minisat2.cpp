@@ -106,6 +106,65 @@ void satcheck_minisat2_baset<T>::set_polarity(literalt a, bool value)
 
 /*******************************************************************\
 
+Function: satcheck_minisat2_baset::set_random_seed
+
+  Inputs: a non-zero seed
+
+ Outputs:
+
+ Purpose: makes a few of the decisions random, and randomises the
+          initial activity of the variables that are yet to be
+          added
+
+\*******************************************************************/
+
+template<typename T>
+void satcheck_minisat2_baset<T>::set_random_seed(double seed)
+{
+  assert(seed!=0);
+  solver->random_seed=seed;
+  solver->random_var_freq=0.02;
+  solver->rnd_init_act=true;
+}
+
+/*******************************************************************\
+
+Function: satcheck_minisat2_baset::interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: may be called while another thread solves
+
+\*******************************************************************/
+
+template<typename T>
+void satcheck_minisat2_baset<T>::interrupt()
+{
+  solver->interrupt();
+}
+
+/*******************************************************************\
+
+Function: satcheck_minisat2_baset::clear_interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+template<typename T>
+void satcheck_minisat2_baset<T>::clear_interrupt()
+{
+  solver->clearInterrupt();
+}
+
+/*******************************************************************\
+
 Function: satcheck_minisat_no_simplifiert::solver_text
 
   Inputs:
@@ -245,7 +304,11 @@ propt::resultt satcheck_minisat2_baset<T>::prop_solve()
         Minisat::vec<Minisat::Lit> solver_assumptions;
         convert(assumptions, solver_assumptions);
 
-        if(solver->solve(solver_assumptions))
+        using Minisat::lbool;
+
+        lbool result=solver->solveLimited(solver_assumptions);
+
+        if(result==l_True)
         {
           messaget::status() <<
             "SAT checker: instance is SATISFIABLE" << eom;
@@ -253,6 +316,14 @@ propt::resultt satcheck_minisat2_baset<T>::prop_solve()
           status=SAT;
           return P_SATISFIABLE;
         }
+        else if(result==l_Undef)
+        {
+          // the solver remains usable
+          messaget::status() <<
+            "SAT checker: interrupted" << eom;
+          status=INIT;
+          return P_ERROR;
+        }
         else
         {
           messaget::status() <<
@@ -463,3 +534,8 @@ bool satcheck_minisat_simplifiert::is_eliminated(literalt a) const
 
   return solver->isEliminated(a.var_no());
 }
+
+// set_polarity and set_random_seed are not virtual, and are thus
+// not instantiated along with the derived classes
+template class satcheck_minisat2_baset<Minisat::Solver>;
+template class satcheck_minisat2_baset<Minisat::SimpSolver>;
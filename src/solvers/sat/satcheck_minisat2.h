@@ -41,10 +41,17 @@ public:
   // extra MiniSat feature: default branching decision
   void set_polarity(literalt a, bool value);
 
+  // extra MiniSat feature: some random decisions, for diversity
+  void set_random_seed(double seed);
+
   virtual bool is_in_conflict(literalt a) const override;
   virtual bool has_set_assumptions() const override final { return true; }
   virtual bool has_is_in_conflict() const override final { return true; }
 
+  virtual void interrupt() override final;
+  virtual void clear_interrupt() override final;
+  virtual bool has_interrupt() const override final { return true; }
+
 protected:
   T *solver;
 
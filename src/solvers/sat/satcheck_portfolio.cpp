@@ -0,0 +1,381 @@
+/*******************************************************************\
+
+Module: Portfolio of SAT Solvers
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <mutex>
+#include <thread>
+
+#include <util/threeval.h>
+
+#include "satcheck_portfolio.h"
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::add_solver
+
+  Inputs: a solver to which no clauses have been passed yet, and
+          the description of its configuration
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::add_solver(
+  cnf_solvert *solver,
+  const std::string &description)
+{
+  assert(solver!=NULL);
+  assert(clause_counter==0);
+
+  membert member;
+  member.solver=std::unique_ptr<cnf_solvert>(solver);
+  member.description=description;
+  members.push_back(std::move(member));
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::solver_text
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+const std::string satcheck_portfoliot::solver_text()
+{
+  std::string result="portfolio of";
+
+  for(std::size_t i=0; i<members.size(); i++)
+    result+=(i==0?" ":", ")+members[i].description;
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::lcnf
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: passes the clause to all solvers
+
+\*******************************************************************/
+
+void satcheck_portfoliot::lcnf(const bvt &bv)
+{
+  for(auto &m : members)
+  {
+    // the variables are numbered here
+    m.solver->set_no_variables(_no_variables);
+    m.solver->lcnf(bv);
+  }
+
+  clause_counter++;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::prop_solve
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Solves on a thread for each solver. The first solver
+          to give an answer interrupts the others; those that
+          cannot be interrupted are waited for, as the solvers
+          are not to be touched while they run.
+
+\*******************************************************************/
+
+propt::resultt satcheck_portfoliot::prop_solve()
+{
+  assert(status!=ERROR);
+  assert(!members.empty());
+
+  messaget::status() <<
+    (no_variables()-1) << " variables, " <<
+    no_clauses() << " clauses, " <<
+    members.size() << " solvers" << eom;
+
+  for(auto &m : members)
+  {
+    m.solver->set_no_variables(_no_variables);
+    m.solver->set_assumptions(assumptions);
+    m.solver->clear_interrupt();
+  }
+
+  std::mutex mutex;
+  bool answered=false;
+  resultt result=P_ERROR;
+
+  auto solve=[&](std::size_t i)
+  {
+    resultt r;
+
+    try
+    {
+      r=members[i].solver->prop_solve();
+    }
+
+    catch(...)
+    {
+      r=P_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(answered || r==P_ERROR)
+      return;
+
+    answered=true;
+    result=r;
+    winner=i;
+
+    for(std::size_t j=0; j<members.size(); j++)
+      if(j!=i)
+        members[j].solver->interrupt();
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(members.size());
+
+  for(std::size_t i=0; i<members.size(); i++)
+    threads.push_back(std::thread(solve, i));
+
+  for(auto &t : threads)
+    t.join();
+
+  switch(result)
+  {
+  case P_SATISFIABLE:
+    status=SAT;
+    break;
+
+  case P_UNSATISFIABLE:
+    status=UNSAT;
+    break;
+
+  case P_ERROR:
+    messaget::error() << "no solver of the portfolio answered" << eom;
+    status=ERROR;
+    return P_ERROR;
+  }
+
+  messaget::status() <<
+    "Portfolio: " << members[winner].description <<
+    " answered first, instance is " <<
+    (result==P_SATISFIABLE?"SATISFIABLE":"UNSATISFIABLE") << eom;
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::l_get
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the assignment of the solver that answered
+
+\*******************************************************************/
+
+tvt satcheck_portfoliot::l_get(literalt a) const
+{
+  if(a.is_true())
+    return tvt(true);
+  else if(a.is_false())
+    return tvt(false);
+
+  if(status!=SAT)
+    return tvt::unknown();
+
+  return members[winner].solver->l_get(a);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::set_assignment
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::set_assignment(literalt a, bool value)
+{
+  members[winner].solver->set_assignment(a, value);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::set_assumptions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the assumptions are passed to the solvers when solving
+
+\*******************************************************************/
+
+void satcheck_portfoliot::set_assumptions(const bvt &_assumptions)
+{
+  assumptions=_assumptions;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::has_set_assumptions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool satcheck_portfoliot::has_set_assumptions() const
+{
+  for(const auto &m : members)
+    if(!m.solver->has_set_assumptions())
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::is_in_conflict
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the final conflict of the solver that answered
+
+\*******************************************************************/
+
+bool satcheck_portfoliot::is_in_conflict(literalt a) const
+{
+  assert(status==UNSAT);
+  return members[winner].solver->is_in_conflict(a);
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::has_is_in_conflict
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool satcheck_portfoliot::has_is_in_conflict() const
+{
+  for(const auto &m : members)
+    if(!m.solver->has_is_in_conflict())
+      return false;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::set_frozen
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::set_frozen(literalt a)
+{
+  for(auto &m : members)
+  {
+    m.solver->set_no_variables(_no_variables);
+    m.solver->set_frozen(a);
+  }
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::interrupt()
+{
+  for(auto &m : members)
+    m.solver->interrupt();
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::clear_interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_portfoliot::clear_interrupt()
+{
+  for(auto &m : members)
+    m.solver->clear_interrupt();
+}
+
+/*******************************************************************\
+
+Function: satcheck_portfoliot::has_interrupt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool satcheck_portfoliot::has_interrupt() const
+{
+  for(const auto &m : members)
+    if(!m.solver->has_interrupt())
+      return false;
+
+  return true;
+}
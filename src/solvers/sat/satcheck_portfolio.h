@@ -0,0 +1,73 @@
+/*******************************************************************\
+
+Module: Portfolio of SAT Solvers
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_SATCHECK_PORTFOLIO_H
+#define CPROVER_SATCHECK_PORTFOLIO_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cnf.h"
+
+/*******************************************************************\
+
+   Class: satcheck_portfoliot
+
+ Purpose: Passes the clauses to differently configured solvers,
+          which race on separate threads; the first answer is
+          taken, and the other solvers are interrupted.
+
+\*******************************************************************/
+
+class satcheck_portfoliot:public cnf_solvert
+{
+public:
+  satcheck_portfoliot():winner(0)
+  {
+  }
+
+  // Takes ownership of the solver, which is to be fresh. Give it
+  // no message handler, as the solvers run concurrently.
+  void add_solver(cnf_solvert *solver, const std::string &description);
+
+  std::size_t size() const { return members.size(); }
+
+  virtual const std::string solver_text() override;
+  virtual resultt prop_solve() override;
+  virtual tvt l_get(literalt a) const override;
+
+  virtual void lcnf(const bvt &bv) override;
+  virtual void set_assignment(literalt a, bool value) override;
+  virtual void set_assumptions(const bvt &_assumptions) override;
+  virtual bool has_set_assumptions() const override;
+  virtual bool is_in_conflict(literalt a) const override;
+  virtual bool has_is_in_conflict() const override;
+  virtual void set_frozen(literalt a) override;
+
+  virtual void interrupt() override;
+  virtual void clear_interrupt() override;
+  virtual bool has_interrupt() const override;
+
+protected:
+  struct membert
+  {
+    std::unique_ptr<cnf_solvert> solver;
+    std::string description;
+  };
+
+  typedef std::vector<membert> memberst;
+  memberst members;
+
+  // the member that gave the last answer
+  std::size_t winner;
+
+  bvt assumptions;
+};
+
+#endif
@@ -2867,7 +2867,7 @@ void smt2_convt::convert_constant(const constant_exprt &expr)
      expr_type.id()==ID_incomplete_c_enum ||
      expr_type.id()==ID_c_bit_field)
   {
-    mp_integer value=binary2integer(id2string(expr.get_value()), false);
+    mp_integer value=binary2integer(expr.get_value(), false);
 
     std::size_t width=boolbv_width(expr_type);
 
@@ -3326,7 +3326,7 @@ void smt2_convt::convert_rounding_mode_FPA(const exprt &expr)
   {
     const constant_exprt &cexpr=to_constant_expr(expr);
 
-    mp_integer value=binary2integer(id2string(cexpr.get_value()), false);
+    mp_integer value=binary2integer(cexpr.get_value(), false);
 
     if(value==0)
       out << "roundNearestTiesToEven";
@@ -16,6 +16,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/options.h>
 #include <util/memory_info.h>
 #include <util/unicode.h>
+#include <util/profiling.h>
 
 #include <ansi-c/ansi_c_language.h>
 #include <cpp/cpp_language.h>
@@ -218,13 +219,24 @@ int symex_parse_optionst::doit()
 
   eval_verbosity();
 
+  profiling_reportt profiling_report(
+    ui_message_handler, cmdline.isset("profile"));
+
   goto_model.set_message_handler(get_message_handler());
 
-  if(goto_model(cmdline.args))
-    return 6;
+  {
+    profiling_phaset phase("goto program");
+
+    if(goto_model(cmdline.args))
+      return 6;
+  }
+
+  {
+    profiling_phaset phase("goto program processing");
 
-  if(process_goto_program(options))
-    return 6;
+    if(process_goto_program(options))
+      return 6;
+  }
 
   label_properties(goto_model);
 
@@ -250,6 +262,8 @@ int symex_parse_optionst::doit()
 
   try
   {
+    profiling_phaset phase("path search");
+
     const namespacet ns(goto_model.symbol_table);
     path_searcht path_search(ns);
 
@@ -763,5 +777,6 @@ void symex_parse_optionst::help()
     "Other options:\n"
     " --version                    show version and exit\n"
     " --xml-ui                     use XML-formatted output\n"
+    " --profile                    report time and memory of each phase\n"
     "\n";
 }
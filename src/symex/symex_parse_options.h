@@ -32,7 +32,7 @@ class optionst;
   "(16)(32)(64)(LP64)(ILP64)(LLP64)(ILP32)(LP32)" \
   "(little-endian)(big-endian)" \
   "(error-label):(verbosity):(no-library)" \
-  "(version)" \
+  "(version)(profile)" \
   "(bfs)(dfs)(locs)" \
   "(cover):" \
   "(i386-linux)(i386-macos)(i386-win32)(win32)(winx64)(gcc)" \
@@ -64,17 +64,17 @@ bool to_integer(const constant_exprt &expr, mp_integer &int_value)
   }
   else if(type_id==ID_unsignedbv)
   {
-    int_value=binary2integer(id2string(value), false);
+    int_value=binary2integer(value, false);
     return false;
   }
   else if(type_id==ID_signedbv)
   {
-    int_value=binary2integer(id2string(value), true);
+    int_value=binary2integer(value, true);
     return false;
   }
   else if(type_id==ID_c_bool)
   {
-    int_value=binary2integer(id2string(value), false);
+    int_value=binary2integer(value, false);
     return false;
   }
   else if(type_id==ID_c_enum)
@@ -82,12 +82,12 @@ bool to_integer(const constant_exprt &expr, mp_integer &int_value)
     const typet &subtype=to_c_enum_type(type).subtype();
     if(subtype.id()==ID_signedbv)
     {
-      int_value=binary2integer(id2string(value), true);
+      int_value=binary2integer(value, true);
       return false;
     }
     else if(subtype.id()==ID_unsignedbv)
     {
-      int_value=binary2integer(id2string(value), false);
+      int_value=binary2integer(value, false);
       return false;
     }
   }
@@ -96,12 +96,12 @@ bool to_integer(const constant_exprt &expr, mp_integer &int_value)
     const typet &subtype=type.subtype();
     if(subtype.id()==ID_signedbv)
     {
-      int_value=binary2integer(id2string(value), true);
+      int_value=binary2integer(value, true);
       return false;
     }
     else if(subtype.id()==ID_unsignedbv)
     {
-      int_value=binary2integer(id2string(value), false);
+      int_value=binary2integer(value, false);
       return false;
     }
   }
@@ -144,35 +144,35 @@ constant_exprt from_integer(
   {
     std::size_t width=to_unsignedbv_type(type).get_width();
     constant_exprt result(type);
-    result.set_value(integer2binary(int_value, width));
+    result.set_value(integer2binary_id(int_value, width));
     return result;
   }
   else if(type_id==ID_bv)
   {
     std::size_t width=to_bv_type(type).get_width();
     constant_exprt result(type);
-    result.set_value(integer2binary(int_value, width));
+    result.set_value(integer2binary_id(int_value, width));
     return result;
   }
   else if(type_id==ID_signedbv)
   {
     std::size_t width=to_signedbv_type(type).get_width();
     constant_exprt result(type);
-    result.set_value(integer2binary(int_value, width));
+    result.set_value(integer2binary_id(int_value, width));
     return result;
   }
   else if(type_id==ID_c_enum)
   {
     std::size_t width=to_c_enum_type(type).subtype().get_unsigned_int(ID_width);
     constant_exprt result(type);
-    result.set_value(integer2binary(int_value, width));
+    result.set_value(integer2binary_id(int_value, width));
     return result;
   }
   else if(type_id==ID_c_bool)
   {
     std::size_t width=to_c_bool_type(type).get_width();
     constant_exprt result(type);
-    result.set_value(integer2binary(int_value, width));
+    result.set_value(integer2binary_id(int_value, width));
     return result;
   }
   else if(type_id==ID_bool)
@@ -195,7 +195,7 @@ constant_exprt from_integer(
   {
     std::size_t width=to_c_bit_field_type(type).get_width();
     constant_exprt result(type);
-    result.set_value(integer2binary(int_value, width));
+    result.set_value(integer2binary_id(int_value, width));
     return result;
   }
 
@@ -208,6 +208,114 @@ constant_exprt from_integer(
 
 /*******************************************************************\
 
+Function: binary2integer
+
+  Inputs: a bit-vector value, and whether it is signed
+
+ Outputs: its integer value
+
+ Purpose:
+
+\*******************************************************************/
+
+mp_integer binary2integer(const irep_idt &value, bool is_signed)
+{
+  unsigned no=value.get_no();
+
+  if(!string_containert::is_binary(no))
+    return binary2integer(id2string(value), is_signed);
+
+  std::size_t width=string_containert::binary_width(no);
+  mp_integer::ullong_t bits=string_containert::binary_value(no);
+
+  if(is_signed && (bits>>(width-1))&1)
+  {
+    if(width<64)
+      bits|=~mp_integer::ullong_t(0)<<width;
+
+    return mp_integer(mp_integer::llong_t(bits));
+  }
+
+  return mp_integer(bits);
+}
+
+/*******************************************************************\
+
+Function: integer2binary_id
+
+  Inputs: an integer, and a width
+
+ Outputs: the bit-vector value of the integer, which is cut off
+          or sign-extended to the width
+
+ Purpose:
+
+\*******************************************************************/
+
+irep_idt integer2binary_id(const mp_integer &n, std::size_t width)
+{
+  bool neg=n.is_negative();
+
+  if(width>=1 && width<=64 && (neg?n.is_long():n.is_ulong()))
+  {
+    mp_integer::ullong_t bits=
+      neg?mp_integer::ullong_t(n.to_long()):n.to_ulong();
+
+    return irep_idt(string_container.get_binary(bits, width), 0);
+  }
+
+  return integer2binary(n, width);
+}
+
+/*******************************************************************\
+
+Function: binary_width
+
+  Inputs: a bit-vector value
+
+ Outputs: the number of bits
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t binary_width(const irep_idt &value)
+{
+  unsigned no=value.get_no();
+
+  if(string_containert::is_binary(no))
+    return string_containert::binary_width(no);
+
+  return value.size();
+}
+
+/*******************************************************************\
+
+Function: binary_bit
+
+  Inputs: a bit-vector value, and the number of a bit, where
+          the least significant one is 0
+
+ Outputs: the bit
+
+ Purpose:
+
+\*******************************************************************/
+
+bool binary_bit(const irep_idt &value, std::size_t bit_nr)
+{
+  unsigned no=value.get_no();
+
+  if(string_containert::is_binary(no))
+    return string_containert::binary_bit(no, bit_nr);
+
+  const std::string &s=id2string(value);
+  assert(bit_nr<s.size());
+  return s[s.size()-bit_nr-1]=='1';
+}
+
+/*******************************************************************\
+
 Function: address_bits
 
   Inputs:
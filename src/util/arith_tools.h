@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_ARITH_TOOLS_H
 
 #include "mp_arith.h"
+#include "irep.h"
 
 class exprt;
 class constant_exprt;
@@ -25,6 +26,15 @@ bool to_integer(const constant_exprt &expr, mp_integer &int_value);
 // returns 'nil' on error
 constant_exprt from_integer(const mp_integer &int_value, const typet &type);
 
+// Bit-vector values, i.e., the strings of '0' and '1' of constants,
+// most significant bit first. These do not convert to or from the
+// string when the value is held in the number of the irep_idt, which
+// is the case for most constants; see string_containert.
+mp_integer binary2integer(const irep_idt &, bool is_signed);
+irep_idt integer2binary_id(const mp_integer &, std::size_t width);
+std::size_t binary_width(const irep_idt &);
+bool binary_bit(const irep_idt &, std::size_t bit_nr);
+
 // ceil(log2(size))
 mp_integer address_bits(const mp_integer &size);
 
@@ -203,7 +203,7 @@ Function: bv_arithmetict::to_expr
 exprt bv_arithmetict::to_expr() const
 {
   constant_exprt result(spec.to_type());
-  result.set_value(integer2binary(value, spec.width));
+  result.set_value(integer2binary_id(value, spec.width));
   return result;
 }
 
@@ -472,5 +472,5 @@ void bv_arithmetict::from_expr(const exprt &expr)
 {
   assert(expr.is_constant());
   spec=expr.type();
-  value=binary2integer(expr.get_string(ID_value), spec.is_signed);
+  value=binary2integer(expr.get(ID_value), spec.is_signed);
 }
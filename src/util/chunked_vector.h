@@ -0,0 +1,351 @@
+/*******************************************************************\
+
+Module: Sequences Stored in Chunks
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_CHUNKED_VECTOR_H
+#define CPROVER_UTIL_CHUNKED_VECTOR_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*******************************************************************\
+
+   Class: chunked_vectort
+
+ Purpose: A sequence that stores its elements in chunks of a fixed
+          number of elements, which avoids the per-element node
+          and allocation of std::list, and which, unlike
+          std::vector and std::deque, never moves elements.
+          Elements can be added at either end. References and
+          iterators remain valid when elements are added; the
+          iterators hold the position of the element counted from
+          an origin that does not change when elements are added
+          at the front. end() is the position after the last
+          element, hence it refers to the next element added at
+          the back.
+
+\*******************************************************************/
+
+template<class T, std::size_t chunk_size=256>
+class chunked_vectort
+{
+public:
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+
+  class const_iterator
+  {
+  public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T *pointer;
+    typedef const T &reference;
+
+    const_iterator():container(nullptr), index(0)
+    {
+    }
+
+    reference operator*() const { return container->at_index(index); }
+    pointer operator->() const { return &container->at_index(index); }
+
+    reference operator[](difference_type n) const
+    {
+      return container->at_index(index+n);
+    }
+
+    const_iterator &operator++() { ++index; return *this; }
+    const_iterator &operator--() { --index; return *this; }
+
+    const_iterator operator++(int)
+    {
+      const_iterator tmp(*this);
+      ++index;
+      return tmp;
+    }
+
+    const_iterator operator--(int)
+    {
+      const_iterator tmp(*this);
+      --index;
+      return tmp;
+    }
+
+    const_iterator &operator+=(difference_type n) { index+=n; return *this; }
+    const_iterator &operator-=(difference_type n) { index-=n; return *this; }
+
+    const_iterator operator+(difference_type n) const
+    {
+      return const_iterator(container, index+n);
+    }
+
+    const_iterator operator-(difference_type n) const
+    {
+      return const_iterator(container, index-n);
+    }
+
+    friend difference_type operator-(
+      const const_iterator &a,
+      const const_iterator &b)
+    {
+      return a.index-b.index;
+    }
+
+    // the order of the elements in the sequence
+    friend bool operator==(const const_iterator &a, const const_iterator &b)
+    {
+      return a.index==b.index;
+    }
+
+    friend bool operator!=(const const_iterator &a, const const_iterator &b)
+    {
+      return a.index!=b.index;
+    }
+
+    friend bool operator<(const const_iterator &a, const const_iterator &b)
+    {
+      return a.index<b.index;
+    }
+
+    friend bool operator>(const const_iterator &a, const const_iterator &b)
+    {
+      return a.index>b.index;
+    }
+
+    friend bool operator<=(const const_iterator &a, const const_iterator &b)
+    {
+      return a.index<=b.index;
+    }
+
+    friend bool operator>=(const const_iterator &a, const const_iterator &b)
+    {
+      return a.index>=b.index;
+    }
+
+  protected:
+    const chunked_vectort *container;
+    difference_type index;
+
+    const_iterator(const chunked_vectort *_container, difference_type _index):
+      container(_container),
+      index(_index)
+    {
+    }
+
+    friend class chunked_vectort;
+  };
+
+  class iterator:public const_iterator
+  {
+  public:
+    typedef T *pointer;
+    typedef T &reference;
+
+    iterator()
+    {
+    }
+
+    reference operator*() const { return mutable_container()->at_index(this->index); }
+    pointer operator->() const { return &mutable_container()->at_index(this->index); }
+
+    reference operator[](difference_type n) const
+    {
+      return mutable_container()->at_index(this->index+n);
+    }
+
+    iterator &operator++() { ++this->index; return *this; }
+    iterator &operator--() { --this->index; return *this; }
+
+    iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++this->index;
+      return tmp;
+    }
+
+    iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --this->index;
+      return tmp;
+    }
+
+    iterator &operator+=(difference_type n) { this->index+=n; return *this; }
+    iterator &operator-=(difference_type n) { this->index-=n; return *this; }
+
+    iterator operator+(difference_type n) const
+    {
+      return iterator(mutable_container(), this->index+n);
+    }
+
+    iterator operator-(difference_type n) const
+    {
+      return iterator(mutable_container(), this->index-n);
+    }
+
+  protected:
+    iterator(chunked_vectort *_container, difference_type _index):
+      const_iterator(_container, _index)
+    {
+    }
+
+    // only constructed from a container that is not const
+    chunked_vectort *mutable_container() const
+    {
+      return const_cast<chunked_vectort *>(this->container);
+    }
+
+    friend class chunked_vectort;
+  };
+
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  chunked_vectort():origin(0), first(0), last(0)
+  {
+  }
+
+  chunked_vectort(const chunked_vectort &other):origin(0), first(0), last(0)
+  {
+    for(const auto &element : other)
+      push_back(element);
+  }
+
+  chunked_vectort(chunked_vectort &&other):origin(0), first(0), last(0)
+  {
+    swap(other);
+  }
+
+  chunked_vectort &operator=(const chunked_vectort &other)
+  {
+    chunked_vectort tmp(other);
+    swap(tmp);
+    return *this;
+  }
+
+  chunked_vectort &operator=(chunked_vectort &&other)
+  {
+    clear();
+    swap(other);
+    return *this;
+  }
+
+  ~chunked_vectort()
+  {
+    clear();
+  }
+
+  void swap(chunked_vectort &other)
+  {
+    chunks.swap(other.chunks);
+    std::swap(origin, other.origin);
+    std::swap(first, other.first);
+    std::swap(last, other.last);
+  }
+
+  size_type size() const { return last-first; }
+  bool empty() const { return first==last; }
+
+  iterator begin() { return iterator(this, first); }
+  iterator end() { return iterator(this, last); }
+  const_iterator begin() const { return const_iterator(this, first); }
+  const_iterator end() const { return const_iterator(this, last); }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  reference front() { return at_index(first); }
+  reference back() { return at_index(last-1); }
+  const_reference front() const { return at_index(first); }
+  const_reference back() const { return at_index(last-1); }
+
+  reference operator[](size_type n) { return at_index(first+n); }
+  const_reference operator[](size_type n) const { return at_index(first+n); }
+
+  void push_back(const T &element) { emplace_back(element); }
+  void push_back(T &&element) { emplace_back(std::move(element)); }
+  void push_front(const T &element) { emplace_front(element); }
+  void push_front(T &&element) { emplace_front(std::move(element)); }
+
+  template<typename... Args>
+  void emplace_back(Args &&... args)
+  {
+    if(std::size_t(last-origin)==chunks.size()*chunk_size)
+      chunks.push_back(chunkt(new slott[chunk_size]));
+
+    new(slot(last)) T(std::forward<Args>(args)...);
+    last++;
+  }
+
+  template<typename... Args>
+  void emplace_front(Args &&... args)
+  {
+    if(first==origin)
+    {
+      chunks.insert(chunks.begin(), chunkt(new slott[chunk_size]));
+      origin-=chunk_size;
+    }
+
+    new(slot(first-1)) T(std::forward<Args>(args)...);
+    first--;
+  }
+
+  void clear()
+  {
+    for(difference_type i=first; i!=last; i++)
+      at_index(i).~T();
+
+    chunks.clear();
+    origin=first=last=0;
+  }
+
+  // the memory allocated for the elements
+  size_type capacity() const
+  {
+    return chunks.size()*chunk_size;
+  }
+
+protected:
+  typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type slott;
+  typedef std::unique_ptr<slott[]> chunkt;
+  std::vector<chunkt> chunks;
+
+  // the position of the first slot of the first chunk, and those
+  // of the first element and of the one after the last element
+  difference_type origin, first, last;
+
+  void *slot(difference_type index)
+  {
+    const std::size_t offset=index-origin;
+    assert(offset<chunks.size()*chunk_size);
+    return &chunks[offset/chunk_size][offset%chunk_size];
+  }
+
+  T &at_index(difference_type index)
+  {
+    assert(index>=first && index<last);
+    return *static_cast<T *>(slot(index));
+  }
+
+  const T &at_index(difference_type index) const
+  {
+    return const_cast<chunked_vectort *>(this)->at_index(index);
+  }
+};
+
+#endif
@@ -370,13 +370,13 @@ void exprt::negate()
       }
       else if(type_id==ID_unsignedbv)
       {
-        mp_integer int_value=binary2integer(id2string(value), false);
+        mp_integer int_value=binary2integer(value, false);
         typet _type=type();
         *this=from_integer(-int_value, _type);
       }
       else if(type_id==ID_signedbv)
       {
-        mp_integer int_value=binary2integer(id2string(value), true);
+        mp_integer int_value=binary2integer(value, true);
         typet _type=type();
         *this=from_integer(-int_value, _type);
       }
@@ -501,12 +501,12 @@ bool exprt::is_one() const
 {
   if(is_constant())
   {
-    const std::string &value=get_string(ID_value);
+    const irep_idt &value=get(ID_value);
     const irep_idt &type_id=type().id_string();
 
     if(type_id==ID_integer || type_id==ID_natural)
     {
-      mp_integer int_value=string2integer(value);
+      mp_integer int_value=string2integer(id2string(value));
       if(int_value==1) return true;
     }
     else if(type_id==ID_rational)
@@ -573,17 +573,17 @@ bool exprt::sum(const exprt &expr)
   }
   else if(type_id==ID_unsignedbv || type_id==ID_signedbv)
   {
-    set(ID_value, integer2binary(
-      binary2integer(get_string(ID_value), false)+
-      binary2integer(expr.get_string(ID_value), false),
+    set(ID_value, integer2binary_id(
+      binary2integer(get(ID_value), false)+
+      binary2integer(expr.get(ID_value), false),
       unsafe_string2unsigned(type().get_string(ID_width))));
     return false;
   }
   else if(type_id==ID_fixedbv)
   {
-    set(ID_value, integer2binary(
-      binary2integer(get_string(ID_value), false)+
-      binary2integer(expr.get_string(ID_value), false),
+    set(ID_value, integer2binary_id(
+      binary2integer(get(ID_value), false)+
+      binary2integer(expr.get(ID_value), false),
       unsafe_string2unsigned(type().get_string(ID_width))));
     return false;
   }
@@ -637,9 +637,9 @@ bool exprt::mul(const exprt &expr)
   else if(type_id==ID_unsignedbv || type_id==ID_signedbv)
   {
     // the following works for signed and unsigned integers
-    set(ID_value, integer2binary(
-      binary2integer(get_string(ID_value), false)*
-      binary2integer(expr.get_string(ID_value), false),
+    set(ID_value, integer2binary_id(
+      binary2integer(get(ID_value), false)*
+      binary2integer(expr.get(ID_value), false),
       unsafe_string2unsigned(type().get_string(ID_width))));
     return false;
   }
@@ -700,9 +700,9 @@ bool exprt::subtract(const exprt &expr)
   }
   else if(type_id==ID_unsignedbv || type_id==ID_signedbv)
   {
-    set(ID_value, integer2binary(
-      binary2integer(get_string(ID_value), false)-
-      binary2integer(expr.get_string(ID_value), false),
+    set(ID_value, integer2binary_id(
+      binary2integer(get(ID_value), false)-
+      binary2integer(expr.get(ID_value), false),
       unsafe_string2unsigned(type().get_string(ID_width))));
     return false;
   }
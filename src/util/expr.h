@@ -13,6 +13,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "type.h"
 
+#ifdef HASH_CONSING
+#include "merge_irep.h"
+#endif
+
 #define forall_operands(it, expr) \
   if((expr).has_operands()) \
     for(exprt::operandst::const_iterator it=(expr).operands().begin(), \
@@ -50,7 +54,15 @@ public:
   // constructors
   inline exprt() { }
   inline explicit exprt(const irep_idt &_id):irept(_id) { }
-  inline exprt(const irep_idt &_id, const typet &_type):irept(_id) { add(ID_type, _type); }
+  inline exprt(const irep_idt &_id, const typet &_type):irept(_id)
+  {
+    #ifdef HASH_CONSING
+    // equal types share one node
+    add(ID_type, merge_irept::hash_consed(_type));
+    #else
+    add(ID_type, _type);
+    #endif
+  }
 
   // returns the type of the expression
   inline typet &type() { return static_cast<typet &>(add(ID_type)); }
@@ -61,7 +61,7 @@ Function: fixedbvt::from_expr
 void fixedbvt::from_expr(const constant_exprt &expr)
 {
   spec=to_fixedbv_type(expr.type());
-  v=binary2integer(id2string(expr.get_value()), true);
+  v=binary2integer(expr.get_value(), true);
 }
 
 /*******************************************************************\
@@ -118,7 +118,7 @@ constant_exprt fixedbvt::to_expr() const
   type.set_integer_bits(spec.integer_bits);
   constant_exprt expr(type);
   assert(spec.width!=0);
-  expr.set_value(integer2binary(v, spec.width));
+  expr.set_value(integer2binary_id(v, spec.width));
   return expr;
 }
 
@@ -915,7 +915,7 @@ Function: ieee_floatt::to_expr
 constant_exprt ieee_floatt::to_expr() const
 {
   constant_exprt result(spec.to_type());
-  result.set_value(integer2binary(pack(), spec.width()));
+  result.set_value(integer2binary_id(pack(), spec.width()));
   return result;
 }
 
@@ -1425,7 +1425,7 @@ Function: ieee_floatt::from_expr
 void ieee_floatt::from_expr(const constant_exprt &expr)
 {
   spec=to_floatbv_type(expr.type());
-  unpack(binary2integer(id2string(expr.get_value()), false));
+  unpack(binary2integer(expr.get_value(), false));
 }
 
 /*******************************************************************\
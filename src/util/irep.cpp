@@ -15,7 +15,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "string_hash.h"
 #include "irep_hash.h"
 
-#ifdef SUB_IS_LIST
+#if defined(SUB_IS_LIST) || defined(NAMED_SUB_IS_FORWARD_LIST)
 #include <algorithm>
 #endif
 
@@ -23,12 +23,165 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #endif
 
+#ifdef THREAD_SAFE_IREP
+#include <mutex>
+#endif
+
+#ifndef THREAD_SAFE_IREP
 irept nil_rep_storage;
+#endif
 
 #ifdef SHARING
 irept::dt irept::empty_d;
 #endif
 
+/*******************************************************************\
+
+   Class: irep_counterst
+
+ Purpose: The number of nodes allocated and freed by a thread, for
+          profiling. Each thread counts on its own, which keeps the
+          threads off a shared counter, and the counts of all
+          threads are summed up when read. When a thread ends, its
+          counts are added to those of the finished threads. As
+          with the pool, the counters have no destructor, so that
+          nodes freed afterwards can still be counted.
+
+\*******************************************************************/
+
+#ifdef THREAD_SAFE_IREP
+struct irep_counterst
+{
+  // only written by the thread itself
+  std::atomic<std::size_t> allocations, deallocations;
+  // the list of the threads that are running
+  irep_counterst *prev, *next;
+  enum { NEW, REGISTERED, RELEASED } state;
+
+  void add_thread();
+  void release();
+};
+
+static std::mutex irep_counters_mutex;
+static irep_counterst *irep_counters_list=nullptr;
+static std::atomic<std::size_t>
+  irep_finished_allocations(0), irep_finished_deallocations(0);
+
+static thread_local irep_counterst irep_counters=
+  { {0}, {0}, nullptr, nullptr, irep_counterst::NEW };
+
+// releases the counters of the thread when the thread ends
+struct irep_counters_releasert
+{
+  ~irep_counters_releasert()
+  {
+    irep_counters.release();
+  }
+};
+
+/*******************************************************************\
+
+Function: irep_counterst::add_thread
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Makes the counters of the thread visible to the others
+
+\*******************************************************************/
+
+void irep_counterst::add_thread()
+{
+  // constructed on first use in each thread
+  static thread_local irep_counters_releasert releaser;
+  (void)releaser;
+
+  std::lock_guard<std::mutex> lock(irep_counters_mutex);
+
+  prev=nullptr;
+  next=irep_counters_list;
+  if(next!=nullptr)
+    next->prev=this;
+  irep_counters_list=this;
+  state=REGISTERED;
+}
+
+/*******************************************************************\
+
+Function: irep_counterst::release
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Adds the counts to those of the finished threads; nodes
+          counted afterwards go there directly
+
+\*******************************************************************/
+
+void irep_counterst::release()
+{
+  std::lock_guard<std::mutex> lock(irep_counters_mutex);
+
+  irep_finished_allocations+=allocations;
+  irep_finished_deallocations+=deallocations;
+
+  if(prev!=nullptr)
+    prev->next=next;
+  else
+    irep_counters_list=next;
+  if(next!=nullptr)
+    next->prev=prev;
+
+  state=RELEASED;
+}
+
+static inline void count_irep_node(
+  std::atomic<std::size_t> &counter,
+  std::atomic<std::size_t> &finished)
+{
+  if(irep_counters.state!=irep_counterst::REGISTERED)
+  {
+    if(irep_counters.state==irep_counterst::RELEASED)
+    {
+      finished++;
+      return;
+    }
+
+    irep_counters.add_thread();
+  }
+
+  // no other thread writes the counter, hence a plain store
+  // does, which avoids the locked increment
+  counter.store(
+    counter.load(std::memory_order_relaxed)+1,
+    std::memory_order_relaxed);
+}
+
+static inline void count_irep_allocation()
+{
+  count_irep_node(irep_counters.allocations, irep_finished_allocations);
+}
+
+static inline void count_irep_deallocation()
+{
+  count_irep_node(irep_counters.deallocations, irep_finished_deallocations);
+}
+#else
+static std::size_t irep_allocations=0, irep_deallocations=0;
+
+static inline void count_irep_allocation()
+{
+  irep_allocations++;
+}
+
+static inline void count_irep_deallocation()
+{
+  irep_deallocations++;
+}
+#endif
+
 /*******************************************************************\
 
 Function: named_subt_lower_bound
@@ -41,7 +194,7 @@ Function: named_subt_lower_bound
 
 \*******************************************************************/
 
-#ifdef SUB_IS_LIST
+#if defined(SUB_IS_LIST) || defined(NAMED_SUB_IS_FORWARD_LIST)
 static inline bool named_subt_order(
   const std::pair<irep_namet, irept> &a,
   const irep_namet &b)
@@ -64,6 +217,33 @@ static inline irept::named_subt::iterator named_subt_lower_bound(
 
 /*******************************************************************\
 
+Function: named_subt_before_lower_bound
+
+  Inputs:
+
+ Outputs: iterator to the element preceding the lower bound
+
+ Purpose: forward lists can only be modified after a position
+
+\*******************************************************************/
+
+#ifdef NAMED_SUB_IS_FORWARD_LIST
+static inline irept::named_subt::iterator named_subt_before_lower_bound(
+  irept::named_subt &s, const irep_namet &id)
+{
+  irept::named_subt::iterator before=s.before_begin();
+
+  for(irept::named_subt::iterator it=s.begin();
+      it!=s.end() && it->first<id;
+      it++)
+    before=it;
+
+  return before;
+}
+#endif
+
+/*******************************************************************\
+
 Function: get_nil_irep
 
   Inputs:
@@ -76,9 +256,15 @@ Function: get_nil_irep
 
 const irept &get_nil_irep()
 {
+  #ifdef THREAD_SAFE_IREP
+  // initialization of local statics is thread-safe
+  static const irept nil_rep(ID_nil);
+  return nil_rep;
+  #else
   if(nil_rep_storage.id().empty()) // initialized?
     nil_rep_storage.id(ID_nil);
   return nil_rep_storage;
+  #endif
 }
 
 /*******************************************************************\
@@ -103,6 +289,7 @@ void irept::detach()
   if(data==&empty_d)
   {
     data=new dt;
+    count_irep_allocation();
 
     #ifdef IREP_DEBUG
     std::cout << "ALLOCATED " << data << std::endl;
@@ -112,6 +299,7 @@ void irept::detach()
   {
     dt *old_data(data);
     data=new dt(*old_data);
+    count_irep_allocation();
 
     #ifdef IREP_DEBUG
     std::cout << "ALLOCATED " << data << std::endl;
@@ -156,8 +344,9 @@ void irept::remove_ref(dt *old_data)
   std::cout << "R: " << old_data << " " << old_data->ref_count << std::endl;
   #endif
 
-  old_data->ref_count--;
-  if(old_data->ref_count==0)
+  // decrement and test must be one step when ireps are shared
+  // between threads
+  if(--old_data->ref_count==0)
   {
     #ifdef IREP_DEBUG
     std::cout << "D: " << pretty() << std::endl;
@@ -169,6 +358,7 @@ void irept::remove_ref(dt *old_data)
 
     // may cause recursive call
     delete old_data;
+    count_irep_deallocation();
 
     #ifdef IREP_DEBUG
     std::cout << "DONE\n";
@@ -203,9 +393,8 @@ void irept::nonrecursive_destructor(dt *old_data)
     if(d==&empty_d) continue;
 
     assert(d->ref_count!=0);
-    d->ref_count--;
 
-    if(d->ref_count==0)
+    if(--d->ref_count==0)
     {
       stack.reserve(stack.size()+
                     d->named_sub.size()+
@@ -241,11 +430,273 @@ void irept::nonrecursive_destructor(dt *old_data)
 
       // now delete, won't do recursion
       delete d;
+      count_irep_deallocation();
     }
   }
 }
 #endif
 
+/*******************************************************************\
+
+   Class: irep_pool_listt
+
+ Purpose: The free nodes of the pool for irept::dt. Nodes are cut
+          from large chunks, and nodes that are deleted go onto the
+          free list for reuse. Chunks are never given back, as
+          ireps with static storage duration may be destroyed after
+          any destructor of the pool would run. With
+          THREAD_SAFE_IREP, each thread has its own list, which is
+          handed over to a shared list when the thread ends; the
+          list itself has no destructor, so that it can still be
+          used afterwards.
+
+\*******************************************************************/
+
+#ifdef IREP_POOL
+struct irep_pool_nodet
+{
+  irep_pool_nodet *next;
+};
+
+static const std::size_t irep_pool_node_size=
+  sizeof(irept::dt)<sizeof(irep_pool_nodet)?
+  sizeof(irep_pool_nodet):sizeof(irept::dt);
+
+static const std::size_t irep_pool_chunk_size=4096*irep_pool_node_size;
+
+struct irep_pool_listt
+{
+  irep_pool_nodet *free;
+  // the part of the current chunk that has not been handed out
+  char *next, *end;
+
+  void refill();
+
+  #ifdef THREAD_SAFE_IREP
+  // set once the nodes have been handed over
+  bool released;
+
+  void release();
+  #endif
+};
+
+#ifdef THREAD_SAFE_IREP
+static std::mutex irep_pool_mutex;
+static irep_pool_nodet *irep_pool_shared_free=nullptr;
+
+static thread_local irep_pool_listt irep_pool_list=
+  { nullptr, nullptr, nullptr, false };
+
+// releases the list of the thread when the thread ends
+struct irep_pool_releasert
+{
+  ~irep_pool_releasert()
+  {
+    irep_pool_list.release();
+  }
+};
+#else
+static irep_pool_listt irep_pool_list={ nullptr, nullptr, nullptr };
+#endif
+
+/*******************************************************************\
+
+Function: irep_pool_listt::refill
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Takes the nodes that other threads have left behind,
+          or else a new chunk
+
+\*******************************************************************/
+
+void irep_pool_listt::refill()
+{
+  #ifdef THREAD_SAFE_IREP
+  if(!released)
+  {
+    // constructed on first use in each thread
+    static thread_local irep_pool_releasert releaser;
+    (void)releaser;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(irep_pool_mutex);
+
+    if(irep_pool_shared_free!=nullptr)
+    {
+      free=irep_pool_shared_free;
+      irep_pool_shared_free=nullptr;
+      return;
+    }
+  }
+  #endif
+
+  next=static_cast<char *>(::operator new(irep_pool_chunk_size));
+  end=next+irep_pool_chunk_size;
+}
+
+/*******************************************************************\
+
+Function: irep_pool_listt::release
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Hands the free nodes over to the other threads; nodes
+          deleted afterwards go to the other threads directly
+
+\*******************************************************************/
+
+#ifdef THREAD_SAFE_IREP
+void irep_pool_listt::release()
+{
+  released=true;
+
+  for(; next!=end; next+=irep_pool_node_size)
+  {
+    irep_pool_nodet *node=reinterpret_cast<irep_pool_nodet *>(next);
+    node->next=free;
+    free=node;
+  }
+
+  if(free==nullptr)
+    return;
+
+  irep_pool_nodet *last=free;
+  while(last->next!=nullptr)
+    last=last->next;
+
+  std::lock_guard<std::mutex> lock(irep_pool_mutex);
+  last->next=irep_pool_shared_free;
+  irep_pool_shared_free=free;
+  free=nullptr;
+}
+#endif
+
+/*******************************************************************\
+
+Function: irept::dt::operator new
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void *irept::dt::operator new(std::size_t size)
+{
+  assert(size==sizeof(dt));
+
+  irep_pool_listt &list=irep_pool_list;
+
+  if(list.free==nullptr && list.next==list.end)
+    list.refill();
+
+  if(list.free!=nullptr)
+  {
+    irep_pool_nodet *node=list.free;
+    list.free=node->next;
+    return node;
+  }
+
+  void *result=list.next;
+  list.next+=irep_pool_node_size;
+  return result;
+}
+
+/*******************************************************************\
+
+Function: irept::dt::operator delete
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void irept::dt::operator delete(void *ptr)
+{
+  if(ptr==nullptr)
+    return;
+
+  irep_pool_listt &list=irep_pool_list;
+  irep_pool_nodet *node=static_cast<irep_pool_nodet *>(ptr);
+
+  #ifdef THREAD_SAFE_IREP
+  if(list.released)
+  {
+    std::lock_guard<std::mutex> lock(irep_pool_mutex);
+    node->next=irep_pool_shared_free;
+    irep_pool_shared_free=node;
+    return;
+  }
+  #endif
+
+  node->next=list.free;
+  list.free=node;
+}
+#endif
+
+/*******************************************************************\
+
+Function: irept::number_of_allocations
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t irept::number_of_allocations()
+{
+  #ifdef THREAD_SAFE_IREP
+  std::lock_guard<std::mutex> lock(irep_counters_mutex);
+
+  std::size_t result=irep_finished_allocations;
+  for(const irep_counterst *c=irep_counters_list; c!=nullptr; c=c->next)
+    result+=c->allocations;
+  return result;
+  #else
+  return irep_allocations;
+  #endif
+}
+
+/*******************************************************************\
+
+Function: irept::number_of_deallocations
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t irept::number_of_deallocations()
+{
+  #ifdef THREAD_SAFE_IREP
+  std::lock_guard<std::mutex> lock(irep_counters_mutex);
+
+  std::size_t result=irep_finished_deallocations;
+  for(const irep_counterst *c=irep_counters_list; c!=nullptr; c=c->next)
+    result+=c->deallocations;
+  return result;
+  #else
+  return irep_deallocations;
+  #endif
+}
+
 /*******************************************************************\
 
 Function: irept::move_to_named_sub
@@ -305,7 +756,7 @@ const irep_idt &irept::get(const irep_namet &name) const
   const named_subt &s=
     is_comment(name)?get_comments():get_named_sub();
 
-  #ifdef SUB_IS_LIST
+  #if defined(SUB_IS_LIST) || defined(NAMED_SUB_IS_FORWARD_LIST)
   named_subt::const_iterator it=named_subt_lower_bound(s, name);
 
   if(it==s.end() ||
@@ -450,6 +901,11 @@ void irept::remove(const irep_namet &name)
   named_subt::iterator it=named_subt_lower_bound(s, name);
 
   if(it!=s.end() && it->first==name) s.erase(it);
+  #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+  named_subt::iterator before=named_subt_before_lower_bound(s, name);
+  named_subt::iterator it=std::next(before);
+
+  if(it!=s.end() && it->first==name) s.erase_after(before);
   #else
   s.erase(name);
   #endif
@@ -472,7 +928,7 @@ const irept &irept::find(const irep_namet &name) const
   const named_subt &s=
     is_comment(name)?get_comments():get_named_sub();
 
-  #ifdef SUB_IS_LIST
+  #if defined(SUB_IS_LIST) || defined(NAMED_SUB_IS_FORWARD_LIST)
   named_subt::const_iterator it=named_subt_lower_bound(s, name);
 
   if(it==s.end() ||
@@ -512,6 +968,15 @@ irept &irept::add(const irep_namet &name)
      it->first!=name)
     it=s.insert(it, std::make_pair(name, irept()));
 
+  return it->second;
+  #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+  named_subt::iterator before=named_subt_before_lower_bound(s, name);
+  named_subt::iterator it=std::next(before);
+
+  if(it==s.end() ||
+     it->first!=name)
+    it=s.insert_after(before, std::make_pair(name, irept()));
+
   return it->second;
   #else
   return s[name];
@@ -544,6 +1009,17 @@ irept &irept::add(const irep_namet &name, const irept &irep)
   else
     it->second=irep;
 
+  return it->second;
+  #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+  named_subt::iterator before=named_subt_before_lower_bound(s, name);
+  named_subt::iterator it=std::next(before);
+
+  if(it==s.end() ||
+     it->first!=name)
+    it=s.insert_after(before, std::make_pair(name, irep));
+  else
+    it->second=irep;
+
   return it->second;
   #else
   std::pair<named_subt::iterator, bool> entry=
@@ -582,6 +1058,17 @@ bool operator==(const irept &i1, const irept &i2)
   if(i1.data==i2.data) return true;
   #endif
 
+  #ifdef HASH_CONSING
+  // there is exactly one representative for each irep in the table
+  if(i1.is_merged() && i2.is_merged())
+  {
+    #ifdef IREP_HASH_STATS
+    ++irep_cmp_ne_cnt;
+    #endif
+    return false;
+  }
+  #endif
+
   if(i1.id()!=i2.id() ||
      i1.get_sub()!=i2.get_sub() || // recursive call
      i1.get_named_sub()!=i2.get_named_sub()) // recursive call
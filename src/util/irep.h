@@ -19,13 +19,32 @@ Author: Daniel Kroening, kroening@kroening.com
 //#define HASH_CODE
 #define USE_MOVE
 //#define SUB_IS_LIST
+//#define NAMED_SUB_IS_FORWARD_LIST
+//#define HASH_CONSING
+//#define IREP_POOL
+
+#if defined(HASH_CONSING) && !defined(SHARING)
+#error "HASH_CONSING requires SHARING"
+#endif
+
+#if defined(IREP_POOL) && !defined(SHARING)
+#error "IREP_POOL requires SHARING"
+#endif
 
 #ifdef SUB_IS_LIST
 #include <list>
+#elif defined(NAMED_SUB_IS_FORWARD_LIST)
+#include <forward_list>
+#include <iterator>
 #else
 #include <map>
 #endif
 
+// Set THREAD_SAFE_IREP in config.inc to share ireps between threads.
+#ifdef THREAD_SAFE_IREP
+#include <atomic>
+#endif
+
 #ifdef USE_DSTRING
 #include "dstring.h"
 #endif
@@ -98,6 +117,19 @@ public:
 
   #ifdef SUB_IS_LIST
   typedef std::list<std::pair<irep_namet, irept> > named_subt;
+  #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+  // Sorted by name. The list head is a single pointer, compared to
+  // 48 bytes for an empty std::map, and the nodes are smaller.
+  class named_subt:
+    public std::forward_list<std::pair<irep_namet, irept> >
+  {
+  public:
+    // linear, but there are only a handful of named subs
+    inline size_type size() const
+    {
+      return std::distance(begin(), end());
+    }
+  };
   #else
   typedef std::map<irep_namet, irept> named_subt;
   #endif
@@ -250,6 +282,12 @@ public:
 
   friend bool full_eq(const irept &a, const irept &b);
 
+  #ifdef HASH_CONSING
+  // true iff this is the representative held by the hash-consing table
+  inline bool is_merged() const { return read().merged; }
+  friend class merge_irept;
+  #endif
+
   std::string pretty(unsigned indent=0, unsigned max_indent=0) const;
 
 protected:
@@ -261,10 +299,17 @@ public:
   {
   private:
     friend class irept;
+    #ifdef HASH_CONSING
+    friend class merge_irept;
+    #endif
 
     #ifdef SHARING
+    #ifdef THREAD_SAFE_IREP
+    std::atomic<unsigned> ref_count;
+    #else
     unsigned ref_count;
     #endif
+    #endif
 
     #ifdef USE_DSTRING
     dstring data;
@@ -280,6 +325,16 @@ public:
     mutable std::size_t hash_code;
     #endif
 
+    #ifdef HASH_CONSING
+    bool merged;
+    #endif
+
+    #ifdef IREP_POOL
+    // nodes are recycled through free lists instead of the heap
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr);
+    #endif
+
     void clear()
     {
       #ifdef USE_DSTRING
@@ -311,6 +366,9 @@ public:
       #ifdef HASH_CODE
          , hash_code(0)
       #endif
+      #ifdef HASH_CONSING
+         , merged(false)
+      #endif
     {
     }
     #else
@@ -321,6 +379,24 @@ public:
     {
     }
     #endif
+
+    #if defined(SHARING) && defined(THREAD_SAFE_IREP)
+    // std::atomic cannot be copied; copies start out unshared
+    dt(const dt &d):
+      ref_count(1),
+      data(d.data),
+      named_sub(d.named_sub),
+      comments(d.comments),
+      sub(d.sub)
+      #ifdef HASH_CODE
+      , hash_code(d.hash_code)
+      #endif
+      #ifdef HASH_CONSING
+      , merged(false)
+      #endif
+    {
+    }
+    #endif
   };
 
 protected:
@@ -344,6 +420,9 @@ public:
     #ifdef HASH_CODE
     data->hash_code=0;
     #endif
+    #ifdef HASH_CONSING
+    data->merged=false;
+    #endif
     return *data;
   }
 
@@ -364,6 +443,11 @@ public:
     return data;
   }
   #endif
+
+  // for profiling: the number of nodes allocated
+  // and freed so far, in all threads
+  static std::size_t number_of_allocations();
+  static std::size_t number_of_deallocations();
 };
 
 struct irep_hash
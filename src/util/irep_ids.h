@@ -0,0 +1,742 @@
+// Generated by irep_ids_convert
+
+#ifndef CPROVER_IREP_IDS_H
+#define CPROVER_IREP_IDS_H
+
+#define ID_let dstring(1, 0)
+#define ID_nil dstring(2, 0)
+#define ID_type dstring(3, 0)
+#define ID_operands dstring(4, 0)
+#define ID_bool dstring(5, 0)
+#define ID_c_bool dstring(6, 0)
+#define ID_proper_bool dstring(7, 0)
+#define ID_signedbv dstring(8, 0)
+#define ID_unsignedbv dstring(9, 0)
+#define ID_verilog_signedbv dstring(10, 0)
+#define ID_verilog_unsignedbv dstring(11, 0)
+#define ID_floatbv dstring(12, 0)
+#define ID_fixedbv dstring(13, 0)
+#define ID_x86_extended dstring(14, 0)
+#define ID_C_source_location dstring(15, 0) // #source_location
+#define ID_C_end_location dstring(16, 0) // #end_location
+#define ID_C_is_padding dstring(17, 0) // #is_padding
+#define ID_file dstring(18, 0)
+#define ID_line dstring(19, 0)
+#define ID_column dstring(20, 0)
+#define ID_comment dstring(21, 0)
+#define ID_property dstring(22, 0)
+#define ID_property_class dstring(23, 0)
+#define ID_property_id dstring(24, 0)
+#define ID_function dstring(25, 0)
+#define ID_code dstring(26, 0)
+#define ID_typecast dstring(27, 0)
+#define ID_static_cast dstring(28, 0)
+#define ID_dynamic_cast dstring(29, 0)
+#define ID_const_cast dstring(30, 0)
+#define ID_reinterpret_cast dstring(31, 0)
+#define ID_index dstring(32, 0)
+#define ID_index_range dstring(33, 0)
+#define ID_ptrmember dstring(34, 0)
+#define ID_member dstring(35, 0)
+#define ID_member_name dstring(36, 0)
+#define ID_C_member_name dstring(37, 0) // #member_name
+#define ID_equal dstring(38, 0) // =
+#define ID_implies dstring(39, 0) // =>
+#define ID_iff dstring(40, 0) // <=>
+#define ID_and dstring(41, 0)
+#define ID_nand dstring(42, 0)
+#define ID_or dstring(43, 0)
+#define ID_nor dstring(44, 0)
+#define ID_xor dstring(45, 0)
+#define ID_xnor dstring(46, 0)
+#define ID_not dstring(47, 0)
+#define ID_bitand dstring(48, 0)
+#define ID_bitor dstring(49, 0)
+#define ID_bitnot dstring(50, 0)
+#define ID_bitxor dstring(51, 0)
+#define ID_bitnand dstring(52, 0)
+#define ID_bitnor dstring(53, 0)
+#define ID_bitxnor dstring(54, 0)
+#define ID_notequal dstring(55, 0)
+#define ID_if dstring(56, 0)
+#define ID_symbol dstring(57, 0)
+#define ID_next_symbol dstring(58, 0)
+#define ID_nondet_symbol dstring(59, 0)
+#define ID_predicate dstring(60, 0)
+#define ID_predicate_symbol dstring(61, 0)
+#define ID_predicate_next_symbol dstring(62, 0)
+#define ID_nondet_bool dstring(63, 0)
+#define ID_empty dstring(64, 0)
+#define ID_side_effect dstring(65, 0)
+#define ID_statement dstring(66, 0)
+#define ID_statement_expression dstring(67, 0)
+#define ID_value dstring(68, 0)
+#define ID_constant dstring(69, 0)
+#define ID_block dstring(70, 0)
+#define ID_decl dstring(71, 0)
+#define ID_dead dstring(72, 0)
+#define ID_assign dstring(73, 0)
+#define ID_assign_div dstring(74, 0)
+#define ID_assign_mult dstring(75, 0) // assign*
+#define ID_assign_plus dstring(76, 0) // assign+
+#define ID_assign_minus dstring(77, 0) // assign-
+#define ID_assign_mod dstring(78, 0)
+#define ID_assign_shl dstring(79, 0)
+#define ID_assign_shr dstring(80, 0)
+#define ID_assign_ashr dstring(81, 0)
+#define ID_assign_lshr dstring(82, 0)
+#define ID_assign_bitand dstring(83, 0)
+#define ID_assign_bitxor dstring(84, 0)
+#define ID_assign_bitor dstring(85, 0)
+#define ID_assume dstring(86, 0)
+#define ID_assert dstring(87, 0)
+#define ID_assertion dstring(88, 0)
+#define ID_goto dstring(89, 0)
+#define ID_gcc_computed_goto dstring(90, 0)
+#define ID_ifthenelse dstring(91, 0)
+#define ID_label dstring(92, 0)
+#define ID_break dstring(93, 0)
+#define ID_continue dstring(94, 0)
+#define ID_function_call dstring(95, 0)
+#define ID_return dstring(96, 0)
+#define ID_skip dstring(97, 0)
+#define ID_arguments dstring(98, 0)
+#define ID_array dstring(99, 0)
+#define ID_size dstring(100, 0)
+#define ID_pointer dstring(101, 0)
+#define ID_block_pointer dstring(102, 0)
+#define ID_switch dstring(103, 0)
+#define ID_switch_case dstring(104, 0)
+#define ID_gcc_switch_case_range dstring(105, 0)
+#define ID_for dstring(106, 0)
+#define ID_while dstring(107, 0)
+#define ID_dowhile dstring(108, 0)
+#define ID_int dstring(109, 0)
+#define ID_integer dstring(110, 0)
+#define ID_natural dstring(111, 0)
+#define ID_real dstring(112, 0)
+#define ID_rational dstring(113, 0)
+#define ID_complex dstring(114, 0)
+#define ID_signed dstring(115, 0)
+#define ID_unsigned dstring(116, 0)
+#define ID_asm dstring(117, 0)
+#define ID_gcc_asm_input dstring(118, 0)
+#define ID_gcc_asm_output dstring(119, 0)
+#define ID_gcc_asm_clobbered_register dstring(120, 0)
+#define ID_incomplete_array dstring(121, 0)
+#define ID_incomplete_struct dstring(122, 0)
+#define ID_incomplete_union dstring(123, 0)
+#define ID_incomplete_class dstring(124, 0)
+#define ID_incomplete_c_enum dstring(125, 0)
+#define ID_C_incomplete dstring(126, 0) // #incomplete
+#define ID_identifier dstring(127, 0)
+#define ID_name dstring(128, 0)
+#define ID_cpp_name dstring(129, 0)
+#define ID_component_cpp_name dstring(130, 0)
+#define ID_C_id_class dstring(131, 0) // #id_class
+#define ID_declaration dstring(132, 0)
+#define ID_declaration_list dstring(133, 0)
+#define ID_declarator dstring(134, 0)
+#define ID_struct dstring(135, 0)
+#define ID_c_bit_field dstring(136, 0)
+#define ID_union dstring(137, 0)
+#define ID_class dstring(138, 0)
+#define ID_merged_type dstring(139, 0)
+#define ID_range dstring(140, 0)
+#define ID_from dstring(141, 0)
+#define ID_to dstring(142, 0)
+#define ID_module dstring(143, 0)
+#define ID_module_instance dstring(144, 0)
+#define ID_macromodule dstring(145, 0)
+#define ID_primitive_module_instance dstring(146, 0)
+#define ID_module_items dstring(147, 0)
+#define ID_module_source dstring(148, 0)
+#define ID_parameter_decl dstring(149, 0)
+#define ID_local_parameter_decl dstring(150, 0)
+#define ID_parameter dstring(151, 0)
+#define ID_component_name dstring(152, 0)
+#define ID_component_number dstring(153, 0)
+#define ID_tag dstring(154, 0)
+#define ID_default dstring(155, 0)
+#define ID_C_default_value dstring(156, 0) // #default_value
+#define ID_base_name dstring(157, 0)
+#define ID_C_base_name dstring(158, 0) // #base_name
+#define ID_string dstring(159, 0)
+#define ID_C_string_constant dstring(160, 0) // #string_constant
+#define ID_string_constant dstring(161, 0)
+#define ID_width dstring(162, 0)
+#define ID_components dstring(163, 0)
+#define ID_bv dstring(164, 0)
+#define ID_f dstring(165, 0)
+#define ID_ports dstring(166, 0)
+#define ID_port dstring(167, 0)
+#define ID_offset dstring(168, 0)
+#define ID_with dstring(169, 0)
+#define ID_trans dstring(170, 0)
+#define ID_throw dstring(171, 0)
+#define ID_catch dstring(172, 0)
+#define ID_try_catch dstring(173, 0)
+#define ID_noexcept dstring(174, 0)
+#define ID_CPROVER_throw dstring(175, 0)
+#define ID_CPROVER_try_catch dstring(176, 0)
+#define ID_CPROVER_try_finally dstring(177, 0)
+#define ID_protection dstring(178, 0)
+#define ID_private dstring(179, 0)
+#define ID_public dstring(180, 0)
+#define ID_protected dstring(181, 0)
+#define ID_virtual dstring(182, 0)
+#define ID_volatile dstring(183, 0)
+#define ID_const dstring(184, 0)
+#define ID_constexpr dstring(185, 0)
+#define ID_inline dstring(186, 0)
+#define ID_forall dstring(187, 0)
+#define ID_exists dstring(188, 0)
+#define ID_forever dstring(189, 0)
+#define ID_repeat dstring(190, 0)
+#define ID_extractbit dstring(191, 0)
+#define ID_extractbits dstring(192, 0)
+#define ID_reference dstring(193, 0)
+#define ID_C_reference dstring(194, 0) // #reference
+#define ID_C_rvalue_reference dstring(195, 0) // #rvalue_reference
+#define ID_true dstring(196, 0)
+#define ID_false dstring(197, 0)
+#define ID_address_of dstring(198, 0)
+#define ID_dereference dstring(199, 0)
+#define ID_C_lvalue dstring(200, 0) // #lvalue
+#define ID_C_base dstring(201, 0) // #base
+#define ID_destination dstring(202, 0)
+#define ID_main dstring(203, 0)
+#define ID_expression dstring(204, 0)
+#define ID_free dstring(205, 0)
+#define ID_malloc dstring(206, 0)
+#define ID_cpp_new dstring(207, 0)
+#define ID_cpp_delete dstring(208, 0)
+#define ID_cpp_new_array dstring(209, 0) // cpp_new[]
+#define ID_cpp_delete_array dstring(210, 0) // cpp_delete[]
+#define ID_java_new dstring(211, 0)
+#define ID_java_new_array dstring(212, 0)
+#define ID_java_string_literal dstring(213, 0)
+#define ID_printf dstring(214, 0)
+#define ID_input dstring(215, 0)
+#define ID_output dstring(216, 0)
+#define ID_output_register dstring(217, 0)
+#define ID_inout dstring(218, 0)
+#define ID_nondet dstring(219, 0)
+#define ID_NULL dstring(220, 0)
+#define ID_null dstring(221, 0)
+#define ID_nullptr dstring(222, 0)
+#define ID_c_enum dstring(223, 0)
+#define ID_enumeration dstring(224, 0)
+#define ID_elements dstring(225, 0)
+#define ID_unknown dstring(226, 0)
+#define ID_uninitialized dstring(227, 0)
+#define ID_invalid dstring(228, 0)
+#define ID_C_invalid_object dstring(229, 0) // #invalid_object
+#define ID_pointer_offset dstring(230, 0)
+#define ID_pointer_object dstring(231, 0)
+#define ID_invalid_pointer dstring(232, 0) // invalid-pointer
+#define ID_ieee_float_equal dstring(233, 0)
+#define ID_ieee_float_notequal dstring(234, 0)
+#define ID_isnan dstring(235, 0)
+#define ID_lambda dstring(236, 0)
+#define ID_array_of dstring(237, 0)
+#define ID_array_equal dstring(238, 0)
+#define ID_array_set dstring(239, 0)
+#define ID_array_copy dstring(240, 0)
+#define ID_mod dstring(241, 0)
+#define ID_rem dstring(242, 0)
+#define ID_shr dstring(243, 0)
+#define ID_ashr dstring(244, 0)
+#define ID_lshr dstring(245, 0)
+#define ID_shl dstring(246, 0)
+#define ID_rol dstring(247, 0)
+#define ID_ror dstring(248, 0)
+#define ID_comma dstring(249, 0)
+#define ID_concatenation dstring(250, 0)
+#define ID_infinity dstring(251, 0)
+#define ID_return_type dstring(252, 0)
+#define ID_typedef dstring(253, 0)
+#define ID_extern dstring(254, 0)
+#define ID_static dstring(255, 0)
+#define ID_auto dstring(256, 0)
+#define ID_register dstring(257, 0)
+#define ID_thread_local dstring(258, 0)
+#define ID_thread dstring(259, 0)
+#define ID_C_thread_local dstring(260, 0) // #thread_local
+#define ID_C_static_lifetime dstring(261, 0) // #static_lifetime
+#define ID_mutable dstring(262, 0)
+#define ID_void dstring(263, 0)
+#define ID_int8 dstring(264, 0)
+#define ID_int16 dstring(265, 0)
+#define ID_int32 dstring(266, 0)
+#define ID_int64 dstring(267, 0)
+#define ID_ptr32 dstring(268, 0)
+#define ID_ptr64 dstring(269, 0)
+#define ID_char dstring(270, 0)
+#define ID_short dstring(271, 0)
+#define ID_long dstring(272, 0)
+#define ID_longlong dstring(273, 0)
+#define ID_float dstring(274, 0)
+#define ID_double dstring(275, 0)
+#define ID_byte dstring(276, 0)
+#define ID_boolean dstring(277, 0)
+#define ID_long_double dstring(278, 0)
+#define ID_signed_char dstring(279, 0)
+#define ID_unsigned_char dstring(280, 0)
+#define ID_signed_int dstring(281, 0)
+#define ID_unsigned_int dstring(282, 0)
+#define ID_signed_long_int dstring(283, 0)
+#define ID_unsigned_long_int dstring(284, 0)
+#define ID_signed_short_int dstring(285, 0)
+#define ID_unsigned_short_int dstring(286, 0)
+#define ID_signed_long_long_int dstring(287, 0)
+#define ID_unsigned_long_long_int dstring(288, 0)
+#define ID_signed_int128 dstring(289, 0)
+#define ID_unsigned_int128 dstring(290, 0)
+#define ID_case dstring(291, 0)
+#define ID_casex dstring(292, 0)
+#define ID_casez dstring(293, 0)
+#define ID_case_item dstring(294, 0)
+#define ID_C_inlined dstring(295, 0) // #inlined
+#define ID_C_hide dstring(296, 0) // #hide
+#define ID_hide dstring(297, 0)
+#define ID_abs dstring(298, 0)
+#define ID_sign dstring(299, 0)
+#define ID_access dstring(300, 0)
+#define ID_C_access dstring(301, 0) // #access
+#define ID_postincrement dstring(302, 0)
+#define ID_postdecrement dstring(303, 0)
+#define ID_preincrement dstring(304, 0)
+#define ID_predecrement dstring(305, 0)
+#define ID_integer_bits dstring(306, 0)
+#define ID_KnR dstring(307, 0)
+#define ID_C_KnR dstring(308, 0) // #KnR
+#define ID_constraint_select_one dstring(309, 0)
+#define ID_cond dstring(310, 0)
+#define ID_bv_literals dstring(311, 0)
+#define ID_isfinite dstring(312, 0)
+#define ID_isinf dstring(313, 0)
+#define ID_isnormal dstring(314, 0)
+#define ID_AG dstring(315, 0)
+#define ID_AF dstring(316, 0)
+#define ID_AX dstring(317, 0)
+#define ID_EG dstring(318, 0)
+#define ID_EF dstring(319, 0)
+#define ID_EX dstring(320, 0)
+#define ID_U dstring(321, 0)
+#define ID_R dstring(322, 0)
+#define ID_A dstring(323, 0)
+#define ID_F dstring(324, 0)
+#define ID_E dstring(325, 0)
+#define ID_G dstring(326, 0)
+#define ID_X dstring(327, 0)
+#define ID_continuous_assign dstring(328, 0)
+#define ID_blocking_assign dstring(329, 0)
+#define ID_non_blocking_assign dstring(330, 0)
+#define ID_alignof dstring(331, 0)
+#define ID_gcc_builtin_va_arg dstring(332, 0)
+#define ID_gcc_builtin_types_compatible_p dstring(333, 0)
+#define ID_gcc_builtin_va_arg_next dstring(334, 0)
+#define ID_gcc_builtin_va_list dstring(335, 0)
+#define ID_gcc_float80 dstring(336, 0)
+#define ID_gcc_float128 dstring(337, 0)
+#define ID_gcc_int128 dstring(338, 0)
+#define ID_gcc_decimal32 dstring(339, 0)
+#define ID_gcc_decimal64 dstring(340, 0)
+#define ID_gcc_decimal128 dstring(341, 0)
+#define ID_builtin_offsetof dstring(342, 0)
+#define ID_0 dstring(343, 0)
+#define ID_1 dstring(344, 0)
+#define ID_8 dstring(345, 0)
+#define ID_16 dstring(346, 0)
+#define ID_32 dstring(347, 0)
+#define ID_64 dstring(348, 0)
+#define ID_128 dstring(349, 0)
+#define ID_sizeof dstring(350, 0)
+#define ID_type_arg dstring(351, 0)
+#define ID_expr_arg dstring(352, 0)
+#define ID_expression_list dstring(353, 0)
+#define ID_initializer_list dstring(354, 0)
+#define ID_gcc_conditional_expression dstring(355, 0)
+#define ID_gcc_local_label dstring(356, 0)
+#define ID_gcc dstring(357, 0)
+#define ID_msc dstring(358, 0)
+#define ID_typeof dstring(359, 0)
+#define ID_ellipsis dstring(360, 0)
+#define ID_flavor dstring(361, 0)
+#define ID_ge dstring(362, 0) // >=
+#define ID_le dstring(363, 0) // <=
+#define ID_gt dstring(364, 0) // >
+#define ID_lt dstring(365, 0) // <
+#define ID_plus dstring(366, 0) // +
+#define ID_minus dstring(367, 0) // -
+#define ID_unary_minus dstring(368, 0) // unary-
+#define ID_unary_plus dstring(369, 0) // unary+
+#define ID_mult dstring(370, 0) // *
+#define ID_div dstring(371, 0) // /
+#define ID_power dstring(372, 0) // **
+#define ID_factorial_power dstring(373, 0)
+#define ID_component dstring(374, 0)
+#define ID_pretty_name dstring(375, 0)
+#define ID_C_class dstring(376, 0) // #class
+#define ID_C_interface dstring(377, 0) // #interface
+#define ID_interface dstring(378, 0)
+#define ID_targets dstring(379, 0)
+#define ID_location dstring(380, 0)
+#define ID_labels dstring(381, 0)
+#define ID_event dstring(382, 0)
+#define ID_guard dstring(383, 0)
+#define ID_designated_initializer dstring(384, 0)
+#define ID_designator dstring(385, 0)
+#define ID_member_designator dstring(386, 0)
+#define ID_index_designator dstring(387, 0)
+#define ID_offset_designator dstring(388, 0)
+#define ID_C_constant dstring(389, 0) // #constant
+#define ID_C_volatile dstring(390, 0) // #volatile
+#define ID_C_restricted dstring(391, 0) // #restricted
+#define ID_C_identifier dstring(392, 0) // #identifier
+#define ID_C_implicit dstring(393, 0) // #implicit
+#define ID_C_ptr32 dstring(394, 0) // #ptr32
+#define ID_C_ptr64 dstring(395, 0) // #ptr64
+#define ID_C_atomic dstring(396, 0) // #atomic
+#define ID_restrict dstring(397, 0)
+#define ID_byte_extract_big_endian dstring(398, 0)
+#define ID_byte_extract_little_endian dstring(399, 0)
+#define ID_byte_update_big_endian dstring(400, 0)
+#define ID_byte_update_little_endian dstring(401, 0)
+#define ID_replication dstring(402, 0)
+#define ID_dummy dstring(403, 0)
+#define ID_init dstring(404, 0)
+#define ID_cprover_atomic dstring(405, 0)
+#define ID_atomic dstring(406, 0)
+#define ID_atomic_type_specifier dstring(407, 0)
+#define ID_atomic_begin dstring(408, 0)
+#define ID_atomic_end dstring(409, 0)
+#define ID_start_thread dstring(410, 0)
+#define ID_end_thread dstring(411, 0)
+#define ID_specc_notify dstring(412, 0)
+#define ID_specc_par dstring(413, 0)
+#define ID_specc_wait dstring(414, 0)
+#define ID_specc_event dstring(415, 0)
+#define ID_bp_enforce dstring(416, 0)
+#define ID_bp_abortif dstring(417, 0)
+#define ID_bp_constrain dstring(418, 0)
+#define ID_bp_schoose dstring(419, 0)
+#define ID_bp_dead dstring(420, 0)
+#define ID_instance dstring(421, 0)
+#define ID_cover dstring(422, 0)
+#define ID_coverage_criterion dstring(423, 0)
+#define ID_initializer dstring(424, 0)
+#define ID_anonymous dstring(425, 0)
+#define ID_C_is_anonymous dstring(426, 0) // #is_anonymous
+#define ID_is_macro dstring(427, 0)
+#define ID_is_enum_constant dstring(428, 0)
+#define ID_is_inline dstring(429, 0)
+#define ID_is_extern dstring(430, 0)
+#define ID_is_global dstring(431, 0)
+#define ID_is_thread_local dstring(432, 0)
+#define ID_is_parameter dstring(433, 0)
+#define ID_is_member dstring(434, 0)
+#define ID_is_type dstring(435, 0)
+#define ID_is_register dstring(436, 0)
+#define ID_is_typedef dstring(437, 0)
+#define ID_is_static dstring(438, 0)
+#define ID_is_template dstring(439, 0)
+#define ID_is_static_assert dstring(440, 0)
+#define ID_is_virtual dstring(441, 0)
+#define ID_C_is_virtual dstring(442, 0) // #is_virtual
+#define ID_literal dstring(443, 0)
+#define ID_member_initializers dstring(444, 0)
+#define ID_member_initializer dstring(445, 0)
+#define ID_method_qualifier dstring(446, 0)
+#define ID_methods dstring(447, 0)
+#define ID_constructor dstring(448, 0)
+#define ID_destructor dstring(449, 0)
+#define ID_bases dstring(450, 0)
+#define ID_base dstring(451, 0)
+#define ID_from_base dstring(452, 0)
+#define ID_operator dstring(453, 0)
+#define ID_template dstring(454, 0)
+#define ID_template_class_instance dstring(455, 0)
+#define ID_template_function_instance dstring(456, 0)
+#define ID_template_type dstring(457, 0)
+#define ID_template_args dstring(458, 0)
+#define ID_template_parameter dstring(459, 0)
+#define ID_template_parameters dstring(460, 0)
+#define ID_C_template dstring(461, 0) // #template
+#define ID_C_template_arguments dstring(462, 0) // #template_arguments
+#define ID_typename dstring(463, 0)
+#define ID_C dstring(464, 0)
+#define ID_cpp dstring(465, 0)
+#define ID_java dstring(466, 0)
+#define ID_SpecC dstring(467, 0)
+#define ID_SystemC dstring(468, 0)
+#define ID_decl_block dstring(469, 0)
+#define ID_decl_type dstring(470, 0)
+#define ID_genvar dstring(471, 0)
+#define ID_realtime dstring(472, 0)
+#define ID_parameters dstring(473, 0)
+#define ID_parameter_assignments dstring(474, 0)
+#define ID_named_parameter_assignment dstring(475, 0)
+#define ID_specify dstring(476, 0)
+#define ID_pullup dstring(477, 0)
+#define ID_pulldown dstring(478, 0)
+#define ID_automatic dstring(479, 0)
+#define ID_rcmos dstring(480, 0)
+#define ID_cmos dstring(481, 0)
+#define ID_nmos dstring(482, 0)
+#define ID_pmos dstring(483, 0)
+#define ID_rnmos dstring(484, 0)
+#define ID_rpmos dstring(485, 0)
+#define ID_wchar_t dstring(486, 0)
+#define ID_char16_t dstring(487, 0)
+#define ID_char32_t dstring(488, 0)
+#define ID_size_t dstring(489, 0)
+#define ID_ssize_t dstring(490, 0)
+#define ID_inst dstring(491, 0)
+#define ID_inst_builtin dstring(492, 0)
+#define ID_always dstring(493, 0)
+#define ID_initial dstring(494, 0)
+#define ID_mode dstring(495, 0)
+#define ID_this dstring(496, 0)
+#define ID_C_this dstring(497, 0) // #this
+#define ID_reduction_and dstring(498, 0)
+#define ID_reduction_or dstring(499, 0)
+#define ID_reduction_nand dstring(500, 0)
+#define ID_reduction_nor dstring(501, 0)
+#define ID_reduction_xor dstring(502, 0)
+#define ID_reduction_xnor dstring(503, 0)
+#define ID_C_zero_initializer dstring(504, 0) // #zero_initializer
+#define ID_body dstring(505, 0)
+#define ID_entity dstring(506, 0)
+#define ID_temporary_object dstring(507, 0)
+#define ID_overflow_plus dstring(508, 0) // overflow-+
+#define ID_overflow_minus dstring(509, 0) // overflow--
+#define ID_overflow_mult dstring(510, 0) // overflow-*
+#define ID_overflow_unary_minus dstring(511, 0) // overflow-unary-
+#define ID_object_descriptor dstring(512, 0)
+#define ID_dynamic_object dstring(513, 0)
+#define ID_object_size dstring(514, 0)
+#define ID_good_pointer dstring(515, 0)
+#define ID_integer_address dstring(516, 0)
+#define ID_integer_address_object dstring(517, 0)
+#define ID_null_object dstring(518, 0)
+#define ID_static_object dstring(519, 0)
+#define ID_stack_object dstring(520, 0)
+#define ID_C_is_failed_symbol dstring(521, 0) // #is_failed_symbol
+#define ID_C_failed_symbol dstring(522, 0) // #failed_symbol
+#define ID_list dstring(523, 0)
+#define ID_map dstring(524, 0)
+#define ID_set dstring(525, 0)
+#define ID_storage dstring(526, 0)
+#define ID_friend dstring(527, 0)
+#define ID_explicit dstring(528, 0)
+#define ID_storage_spec dstring(529, 0)
+#define ID_member_spec dstring(530, 0)
+#define ID_msc_declspec dstring(531, 0)
+#define ID_packed dstring(532, 0)
+#define ID_C_packed dstring(533, 0) // #packed
+#define ID_transparent_union dstring(534, 0)
+#define ID_C_transparent_union dstring(535, 0) // #transparent_union
+#define ID_aligned dstring(536, 0)
+#define ID_C_alignment dstring(537, 0) // #alignment
+#define ID_vector dstring(538, 0)
+#define ID_abstract dstring(539, 0)
+#define ID_bit dstring(540, 0)
+#define ID_logic dstring(541, 0)
+#define ID_chandle dstring(542, 0)
+#define ID_reg dstring(543, 0)
+#define ID_wire dstring(544, 0)
+#define ID_tri dstring(545, 0)
+#define ID_tri1 dstring(546, 0)
+#define ID_supply0 dstring(547, 0)
+#define ID_wand dstring(548, 0)
+#define ID_triand dstring(549, 0)
+#define ID_tri0 dstring(550, 0)
+#define ID_supply1 dstring(551, 0)
+#define ID_wor dstring(552, 0)
+#define ID_trior dstring(553, 0)
+#define ID_trireg dstring(554, 0)
+#define ID_function_application dstring(555, 0)
+#define ID_cpp_declarator dstring(556, 0)
+#define ID_cpp_linkage_spec dstring(557, 0)
+#define ID_cpp_namespace_spec dstring(558, 0)
+#define ID_cpp_storage_spec dstring(559, 0)
+#define ID_cpp_using dstring(560, 0)
+#define ID_cpp_declaration dstring(561, 0)
+#define ID_cpp_static_assert dstring(562, 0)
+#define ID_cpp_member_spec dstring(563, 0)
+#define ID_C_c_type dstring(564, 0) // #c_type
+#define ID_namespace dstring(565, 0)
+#define ID_linkage dstring(566, 0)
+#define ID_decltype dstring(567, 0)
+#define ID_buf dstring(568, 0)
+#define ID_bufif0 dstring(569, 0)
+#define ID_bufif1 dstring(570, 0)
+#define ID_notif0 dstring(571, 0)
+#define ID_notif1 dstring(572, 0)
+#define ID_task dstring(573, 0)
+#define ID_C_little_endian dstring(574, 0) // #little_endian
+#define ID_C_offset dstring(575, 0) // #offset
+#define ID_C_tag_only_declaration dstring(576, 0) // #tag_only_declaration
+#define ID_struct_tag dstring(577, 0)
+#define ID_union_tag dstring(578, 0)
+#define ID_c_enum_tag dstring(579, 0)
+#define ID_enum_constant dstring(580, 0)
+#define ID_bit_select dstring(581, 0)
+#define ID_part_select dstring(582, 0)
+#define ID_indexed_part_select_plus dstring(583, 0)
+#define ID_indexed_part_select_minus dstring(584, 0)
+#define ID_generate_block dstring(585, 0)
+#define ID_generate_assign dstring(586, 0)
+#define ID_generate_skip dstring(587, 0)
+#define ID_generate_case dstring(588, 0)
+#define ID_generate_if dstring(589, 0)
+#define ID_generate_for dstring(590, 0)
+#define ID_delay dstring(591, 0)
+#define ID_verilog_cycle_delay dstring(592, 0)
+#define ID_sva_cycle_delay dstring(593, 0)
+#define ID_sva_sequence_throughout dstring(594, 0)
+#define ID_sva_sequence_concatenation dstring(595, 0)
+#define ID_sva_sequence_first_match dstring(596, 0)
+#define ID_sva_always dstring(597, 0)
+#define ID_sva_nexttime dstring(598, 0)
+#define ID_sva_s_nexttime dstring(599, 0)
+#define ID_sva_eventually dstring(600, 0)
+#define ID_sva_s_eventually dstring(601, 0)
+#define ID_sva_until dstring(602, 0)
+#define ID_sva_s_until dstring(603, 0)
+#define ID_sva_until_with dstring(604, 0)
+#define ID_sva_s_until_with dstring(605, 0)
+#define ID_sva_overlapped_implication dstring(606, 0)
+#define ID_sva_non_overlapped_implication dstring(607, 0)
+#define ID_hierarchical_identifier dstring(608, 0)
+#define ID_named_port_connection dstring(609, 0)
+#define ID_named_block dstring(610, 0)
+#define ID_verilog_primitive_module dstring(611, 0)
+#define ID_verilog_module dstring(612, 0)
+#define ID_verilog_case_equality dstring(613, 0)
+#define ID_verilog_case_inequality dstring(614, 0)
+#define ID_event_guard dstring(615, 0)
+#define ID_posedge dstring(616, 0)
+#define ID_negedge dstring(617, 0)
+#define ID_pointer_and_address_pair dstring(618, 0)
+#define ID_user_specified_predicate dstring(619, 0)
+#define ID_user_specified_parameter_predicates dstring(620, 0)
+#define ID_user_specified_return_predicates dstring(621, 0)
+#define ID_unassigned dstring(622, 0)
+#define ID_new_object dstring(623, 0)
+#define ID_complex_real dstring(624, 0)
+#define ID_complex_imag dstring(625, 0)
+#define ID_imag dstring(626, 0)
+#define ID_msc_try_except dstring(627, 0)
+#define ID_msc_try_finally dstring(628, 0)
+#define ID_msc_leave dstring(629, 0)
+#define ID_msc_uuidof dstring(630, 0)
+#define ID_msc_if_exists dstring(631, 0)
+#define ID_msc_if_not_exists dstring(632, 0)
+#define ID_msc_underlying_type dstring(633, 0)
+#define ID_msc_based dstring(634, 0)
+#define ID_alias dstring(635, 0)
+#define ID_auto_object dstring(636, 0)
+#define ID_ssa_object dstring(637, 0)
+#define ID_ptr_object dstring(638, 0)
+#define ID_C_c_sizeof_type dstring(639, 0) // #c_sizeof_type
+#define ID_array_update dstring(640, 0)
+#define ID_struct_update dstring(641, 0)
+#define ID_union_update dstring(642, 0)
+#define ID_update dstring(643, 0)
+#define ID_float_debug1 dstring(644, 0)
+#define ID_float_debug2 dstring(645, 0)
+#define ID_static_assert dstring(646, 0)
+#define ID_gcc_attribute_mode dstring(647, 0)
+#define ID_built_in dstring(648, 0) // <built-in>
+#define ID_exception_list dstring(649, 0)
+#define ID_exception_id dstring(650, 0)
+#define ID_priority dstring(651, 0)
+#define ID_predicate_passive_symbol dstring(652, 0)
+#define ID_all dstring(653, 0)
+#define ID_when dstring(654, 0)
+#define ID_cw_va_arg_typeof dstring(655, 0)
+#define ID_fence dstring(656, 0)
+#define ID_sync dstring(657, 0)
+#define ID_lwsync dstring(658, 0)
+#define ID_isync dstring(659, 0)
+#define ID_WRfence dstring(660, 0)
+#define ID_RRfence dstring(661, 0)
+#define ID_RWfence dstring(662, 0)
+#define ID_WWfence dstring(663, 0)
+#define ID_RRcumul dstring(664, 0)
+#define ID_RWcumul dstring(665, 0)
+#define ID_WWcumul dstring(666, 0)
+#define ID_WRcumul dstring(667, 0)
+#define ID_claim dstring(668, 0)
+#define ID_generic_selection dstring(669, 0)
+#define ID_generic_associations dstring(670, 0)
+#define ID_generic_association dstring(671, 0)
+#define ID_floatbv_plus dstring(672, 0)
+#define ID_floatbv_minus dstring(673, 0)
+#define ID_floatbv_mult dstring(674, 0)
+#define ID_floatbv_div dstring(675, 0)
+#define ID_floatbv_rem dstring(676, 0)
+#define ID_floatbv_sin dstring(677, 0)
+#define ID_floatbv_cos dstring(678, 0)
+#define ID_floatbv_typecast dstring(679, 0)
+#define ID_read dstring(680, 0)
+#define ID_write dstring(681, 0)
+#define ID_native dstring(682, 0)
+#define ID_final dstring(683, 0)
+#define ID__start dstring(684, 0)
+#define ID_compound_literal dstring(685, 0)
+#define ID_custom_bv dstring(686, 0)
+#define ID_custom_unsignedbv dstring(687, 0)
+#define ID_custom_signedbv dstring(688, 0)
+#define ID_custom_fixedbv dstring(689, 0)
+#define ID_custom_floatbv dstring(690, 0)
+#define ID_C_SSA_symbol dstring(691, 0) // #SSA_symbol
+#define ID_C_full_identifier dstring(692, 0) // #full_identifier
+#define ID_L0 dstring(693, 0)
+#define ID_L1 dstring(694, 0)
+#define ID_L2 dstring(695, 0)
+#define ID_already_typechecked dstring(696, 0)
+#define ID_C_va_arg_type dstring(697, 0) // #va_arg_type
+#define ID_smt2_symbol dstring(698, 0)
+#define ID_VHDL dstring(699, 0)
+#define ID_Verilog dstring(700, 0)
+#define ID_verilog_realtime dstring(701, 0)
+#define ID_onehot dstring(702, 0)
+#define ID_onehot0 dstring(703, 0)
+#define ID_verilog_star_event dstring(704, 0)
+#define ID_verilog_attribute dstring(705, 0)
+#define ID_time dstring(706, 0)
+#define ID_fork dstring(707, 0)
+#define ID_disable dstring(708, 0)
+#define ID_wait dstring(709, 0)
+#define ID_deassign dstring(710, 0)
+#define ID_force dstring(711, 0)
+#define ID_release dstring(712, 0)
+#define ID_popcount dstring(713, 0)
+#define ID_function_type dstring(714, 0)
+#define ID_noreturn dstring(715, 0)
+#define ID_C_noreturn dstring(716, 0) // #noreturn
+#define ID_process dstring(717, 0)
+#define ID_signal dstring(718, 0)
+#define ID_weak dstring(719, 0)
+#define ID_is_weak dstring(720, 0)
+#define ID_C_spec_loop_invariant dstring(721, 0) // #spec_loop_invariant
+#define ID_C_spec_requires dstring(722, 0) // #spec_requires
+#define ID_C_spec_ensures dstring(723, 0) // #spec_ensures
+#define ID_virtual_function dstring(724, 0)
+#define ID_C_element_type dstring(725, 0) // #element_type
+#define ID_working_directory dstring(726, 0)
+#define ID_section dstring(727, 0)
+#define ID_msb dstring(728, 0)
+#define ID_lsb dstring(729, 0)
+#define ID_verilog_signed_vector dstring(730, 0)
+#define ID_verilog_unsigned_vector dstring(731, 0)
+#define ID_verilog_array dstring(732, 0)
+#define ID_low dstring(733, 0)
+#define ID_high dstring(734, 0)
+#define ID_bswap dstring(735, 0)
+
+#endif
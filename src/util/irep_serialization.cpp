@@ -8,11 +8,13 @@ Date: May 2007
 
 \*******************************************************************/
 
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 
 #include "irep_serialization.h"
 #include "string_hash.h"
+#include "string_container.h"
 
 /*******************************************************************\
 
@@ -321,11 +323,29 @@ Function: irep_serializationt::read_gb_string
 \*******************************************************************/
 
 irep_idt irep_serializationt::read_gb_string(std::istream &in)
+{
+  std::size_t length=read_gb_chars(in);
+  return irep_idt(std::string(read_buffer.data(), length));
+}
+
+/*******************************************************************\
+
+Function: irep_serializationt::read_gb_chars
+
+  Inputs: a stream
+
+ Outputs: the length of the string
+
+ Purpose: reads a string from the stream into the read buffer
+
+\*******************************************************************/
+
+std::size_t irep_serializationt::read_gb_chars(std::istream &in)
 {
   char c;
   size_t length=0;
 
-  while((c = in.get()) != 0)
+  while((c = in.get()) != 0 && in)
   {
     if(length>=read_buffer.size())
       read_buffer.resize(read_buffer.size()*2, 0);
@@ -338,7 +358,7 @@ irep_idt irep_serializationt::read_gb_string(std::istream &in)
     length++;
   }
 
-  return irep_idt(std::string(read_buffer.data(), length));
+  return length;
 }
 
 /*******************************************************************\
@@ -358,16 +378,129 @@ void irep_serializationt::write_string_ref(
   const irep_idt &s)
 {
   size_t id=irep_id_hash()(s);
-  if(id>=ireps_container.string_map.size())
-    ireps_container.string_map.resize(id+1, false);
+  bool is_new;
 
-  if(ireps_container.string_map[id])
-    write_gb_word(out, id);
+  if(string_containert::is_binary(id))
+    is_new=ireps_container.binary_strings.insert(id).second;
   else
   {
+    if(id>=ireps_container.string_map.size())
+      ireps_container.string_map.resize(id+1, false);
+
+    is_new=!ireps_container.string_map[id];
     ireps_container.string_map[id]=true;
-    write_gb_word(out, id);
+  }
+
+  write_gb_word(out, id);
+
+  if(is_new && inline_strings)
     write_gb_string(out, id2string(s));
+}
+
+/*******************************************************************\
+
+Function: irep_serializationt::write_string_table
+
+  Inputs: an output stream
+
+ Outputs: nothing
+
+ Purpose: outputs all strings referenced so far, for use
+          with references that were written without the string
+
+\*******************************************************************/
+
+void irep_serializationt::write_string_table(std::ostream &out)
+{
+  const ireps_containert::string_mapt &string_map=
+    ireps_container.string_map;
+
+  // Sorted, each string is stored as the length of the prefix it
+  // shares with the previous one, and the rest. Identifiers share
+  // long prefixes, such as the function they belong to.
+  std::vector<std::pair<const std::string *, std::size_t> > strings;
+
+  for(std::size_t id=0; id<string_map.size(); id++)
+    if(string_map[id])
+      strings.push_back(
+        std::make_pair(&string_container.get_string(id), id));
+
+  for(const auto &id : ireps_container.binary_strings)
+    strings.push_back(
+      std::make_pair(&string_container.get_string(id), id));
+
+  std::sort(
+    strings.begin(),
+    strings.end(),
+    [](const std::pair<const std::string *, std::size_t> &a,
+       const std::pair<const std::string *, std::size_t> &b)
+    {
+      return *a.first<*b.first;
+    });
+
+  write_gb_word(out, strings.size());
+
+  const std::string *previous=NULL;
+
+  for(const auto &s : strings)
+  {
+    std::size_t prefix=0;
+
+    if(previous!=NULL)
+      while(prefix<previous->size() &&
+            prefix<s.first->size() &&
+            (*previous)[prefix]==(*s.first)[prefix])
+        prefix++;
+
+    write_gb_word(out, s.second);
+    write_gb_word(out, prefix);
+    write_gb_string(out, s.first->substr(prefix));
+
+    previous=s.first;
+  }
+}
+
+/*******************************************************************\
+
+Function: irep_serializationt::read_string_table
+
+  Inputs: a stream
+
+ Outputs: nothing
+
+ Purpose: reads a table written by write_string_table; string
+          references read later are resolved using it
+
+\*******************************************************************/
+
+void irep_serializationt::read_string_table(std::istream &in)
+{
+  std::size_t count=read_gb_word(in);
+  std::string previous;
+
+  for(std::size_t i=0; i<count && in; i++)
+  {
+    std::size_t id=read_gb_word(in);
+    std::size_t prefix=read_gb_word(in);
+
+    if(prefix>previous.size())
+      throw std::string("string table corrupt");
+
+    previous.resize(prefix);
+    previous.append(read_buffer.data(), read_gb_chars(in));
+
+    if(string_containert::is_binary(id))
+    {
+      ireps_container.binary_string_rev_map[id]=previous;
+      continue;
+    }
+
+    if(id>=ireps_container.string_rev_map.size())
+      ireps_container.string_rev_map.resize(1+id*2,
+        std::pair<bool,irep_idt>( false, irep_idt() ));
+
+    ireps_container.string_rev_map[id]=
+      std::pair<bool,irep_idt>(true, previous);
   }
 }
 
@@ -387,6 +520,19 @@ irep_idt irep_serializationt::read_string_ref(std::istream &in)
 {
   std::size_t id = read_gb_word(in);
 
+  if(string_containert::is_binary(id))
+  {
+    ireps_containert::binary_string_rev_mapt::const_iterator it=
+      ireps_container.binary_string_rev_map.find(id);
+
+    if(it!=ireps_container.binary_string_rev_map.end())
+      return it->second;
+
+    irep_idt s=read_gb_string(in);
+    ireps_container.binary_string_rev_map[id]=s;
+    return s;
+  }
+
   if(id>=ireps_container.string_rev_map.size())
     ireps_container.string_rev_map.resize(1+id*2,
       std::pair<bool,irep_idt>( false, irep_idt() ));
@@ -16,6 +16,7 @@ Date: May 2007
 #include <string>
 #include <vector>
 
+#include "hash_cont.h"
 #include "irep_hash_container.h"
 #include "irep.h"
 
@@ -41,18 +42,35 @@ public:
     typedef std::vector<std::pair<bool, irep_idt> > string_rev_mapt;
     string_rev_mapt string_rev_map;
 
+    // the bit-vector values that are held in their number,
+    // which is too large for the above, see string_containert
+    typedef hash_set_cont<std::size_t> binary_string_sett;
+    binary_string_sett binary_strings;
+
+    typedef hash_map_cont<std::size_t, irep_idt> binary_string_rev_mapt;
+    binary_string_rev_mapt binary_string_rev_map;
+
     void clear()
+    {
+      clear_ireps();
+      string_map.clear();
+      string_rev_map.clear();
+      binary_strings.clear();
+      binary_string_rev_map.clear();
+    }
+
+    // forget the ireps, but keep the strings
+    void clear_ireps()
     {
       irep_full_hash_container.clear();
       ireps_on_write.clear();
       ireps_on_read.clear();
-      string_map.clear();
-      string_rev_map.clear();
     }
   };
 
   explicit irep_serializationt(ireps_containert &ic):
-    ireps_container(ic)
+    ireps_container(ic),
+    inline_strings(true)
   {
     read_buffer.resize(1, 0);
     clear();
@@ -68,6 +86,13 @@ public:
   void write_string_ref(std::ostream &, const irep_idt &);
 
   void clear() { ireps_container.clear(); }
+  void clear_ireps() { ireps_container.clear_ireps(); }
+
+  // When not inlined, strings are written as references only,
+  // and need to be written separately using write_string_table.
+  void set_inline_strings(bool value) { inline_strings=value; }
+  void write_string_table(std::ostream &);
+  void read_string_table(std::istream &);
 
   static std::size_t read_gb_word(std::istream &);
   irep_idt read_gb_string(std::istream &);
@@ -75,7 +100,9 @@ public:
 private:
   ireps_containert &ireps_container;
   std::vector<char> read_buffer;
+  bool inline_strings;
 
+  std::size_t read_gb_chars(std::istream &);
   void write_irep(std::ostream &, const irept &irep);
   void read_irep(std::istream &, irept &irep);
 };
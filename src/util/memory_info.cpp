@@ -16,6 +16,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <malloc.h>
 #endif
 
+#if defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)
+#include <sys/resource.h>
+#endif
+
 #ifdef _WIN32
 #include <windows.h>
 #include <psapi.h>
@@ -75,3 +79,32 @@ void memory_info(std::ostream &out)
   out << "  size_allocated: " << (double)t.size_allocated/1000000 << "m\n";
   #endif
 }
+
+/*******************************************************************\
+
+Function: peak_memory_usage
+
+  Inputs:
+
+ Outputs: peak resident set size in bytes, 0 if not known
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t peak_memory_usage()
+{
+  #if defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage)!=0)
+    return 0;
+
+  #ifdef __APPLE__
+  return usage.ru_maxrss; // bytes
+  #else
+  return std::size_t(usage.ru_maxrss)*1024; // kilobytes
+  #endif
+  #else
+  return 0;
+  #endif
+}
@@ -6,6 +6,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <cstddef>
 #include <iosfwd>
 
 void memory_info(std::ostream &);
+
+// peak resident set size in bytes, 0 if not known
+std::size_t peak_memory_usage();
@@ -63,8 +63,8 @@ bool to_be_merged_irept::operator == (const to_be_merged_irept &other) const
   const irept::named_subt &named_sub=get_named_sub();
   const irept::named_subt &o_named_sub=other.get_named_sub();
 
-  if(sub.size()!=o_sub.size()) return true;
-  if(named_sub.size()!=o_named_sub.size()) return true;
+  if(sub.size()!=o_sub.size()) return false;
+  if(named_sub.size()!=o_named_sub.size()) return false;
 
   {
     irept::subt::const_iterator s_it=sub.begin();
@@ -129,10 +129,17 @@ const merged_irept &merged_irepst::merged(const irept &irep)
     #ifdef SUB_IS_LIST
     dest_named_sub.push_back(
       std::make_pair(it->first, merged(it->second))); // recursive call
+    #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+    dest_named_sub.push_front(
+      std::make_pair(it->first, merged(it->second))); // recursive call
     #else
     dest_named_sub[it->first]=merged(it->second); // recursive call
     #endif
 
+  #ifdef NAMED_SUB_IS_FORWARD_LIST
+  dest_named_sub.reverse(); // restore the order
+  #endif
+
   std::pair<to_be_merged_irep_storet::const_iterator, bool> result=
     to_be_merged_irep_store.insert(to_be_merged_irept(new_irep));
 
@@ -176,9 +183,16 @@ Function: merge_irept::merged
 
 const irept& merge_irept::merged(const irept &irep)
 {
+  #ifdef HASH_CONSING
+  if(irep.is_merged())
+    return irep; // nothing to do
+
+  irep_storet &irep_store=merge_irept::irep_store();
+  #else
   irep_storet::const_iterator entry=irep_store.find(irep);
   if(entry!=irep_store.end())
     return *entry;
+  #endif
 
   irept new_irep(irep.id());
 
@@ -196,10 +210,17 @@ const irept& merge_irept::merged(const irept &irep)
     #ifdef SUB_IS_LIST
     dest_named_sub.push_back(
       std::make_pair(it->first, merged(it->second))); // recursive call
+    #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+    dest_named_sub.push_front(
+      std::make_pair(it->first, merged(it->second))); // recursive call
     #else
     dest_named_sub[it->first]=merged(it->second); // recursive call
     #endif
 
+  #ifdef NAMED_SUB_IS_FORWARD_LIST
+  dest_named_sub.reverse(); // restore the order
+  #endif
+
   const irept::named_subt &src_comments=irep.get_comments();
   irept::named_subt &dest_comments=new_irep.get_comments();
 
@@ -207,15 +228,184 @@ const irept& merge_irept::merged(const irept &irep)
     #ifdef SUB_IS_LIST
     dest_comments.push_back(
       std::make_pair(it->first, merged(it->second))); // recursive call
+    #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+    dest_comments.push_front(
+      std::make_pair(it->first, merged(it->second))); // recursive call
     #else
     dest_comments[it->first]=merged(it->second); // recursive call
     #endif
 
+  #ifdef NAMED_SUB_IS_FORWARD_LIST
+  dest_comments.reverse(); // restore the order
+  #endif
+
+  #ifdef HASH_CONSING
+  // only takes effect if new_irep ends up in the table
+  new_irep.data->merged=true;
+  #endif
+
   return *irep_store.insert(new_irep).first;
 }
 
 /*******************************************************************\
 
+Function: merge_irept::irep_store
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the global hash-consing table
+
+\*******************************************************************/
+
+#ifdef HASH_CONSING
+merge_irept::irep_storet &merge_irept::irep_store()
+{
+  static irep_storet store;
+  return store;
+}
+#endif
+
+/*******************************************************************\
+
+Function: merge_irept::has_comments
+
+  Inputs:
+
+ Outputs: true iff the irep or any of its operands has comments
+
+ Purpose:
+
+\*******************************************************************/
+
+#ifdef HASH_CONSING
+bool merge_irept::has_comments(const irept &irep)
+{
+  if(!irep.get_comments().empty())
+    return true;
+
+  forall_irep(it, irep.get_sub())
+    if(has_comments(*it))
+      return true;
+
+  forall_named_irep(it, irep.get_named_sub())
+    if(has_comments(it->second))
+      return true;
+
+  return false;
+}
+#endif
+
+/*******************************************************************\
+
+Function: merge_irept::hash_consed
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the representative of an irep that has no comments
+
+\*******************************************************************/
+
+#ifdef HASH_CONSING
+const irept &merge_irept::hash_consed(const irept &irep)
+{
+  if(irep.is_merged() || has_comments(irep))
+    return irep;
+
+  const irept &representative=merge_irept().merged(irep);
+
+  // an earlier irep with comments may have become the representative
+  if(has_comments(representative))
+    return irep;
+
+  return representative;
+}
+#endif
+
+/*******************************************************************\
+
+Function: merge_irept::node_hash::operator()
+
+  Inputs: irep whose operands are in the table
+
+ Outputs:
+
+ Purpose: hash that does not recurse into the operands
+
+\*******************************************************************/
+
+#ifdef HASH_CONSING
+std::size_t merge_irept::node_hash::operator()(const irept &irep) const
+{
+  std::size_t result=hash_string(irep.id());
+
+  const irept::subt &sub=irep.get_sub();
+  const irept::named_subt &named_sub=irep.get_named_sub();
+
+  forall_irep(it, sub)
+    result=hash_combine(result, (std::size_t)&it->read());
+
+  forall_named_irep(it, named_sub)
+  {
+    result=hash_combine(result, hash_string(it->first));
+    result=hash_combine(result, (std::size_t)&it->second.read());
+  }
+
+  result=hash_finalize(result, named_sub.size()+sub.size());
+
+  return result;
+}
+#endif
+
+/*******************************************************************\
+
+Function: merge_irept::node_eq::operator()
+
+  Inputs: ireps whose operands are in the table
+
+ Outputs:
+
+ Purpose: equality that does not recurse into the operands;
+          comments are disregarded
+
+\*******************************************************************/
+
+#ifdef HASH_CONSING
+bool merge_irept::node_eq::operator()(
+  const irept &i1,
+  const irept &i2) const
+{
+  if(i1.id()!=i2.id()) return false;
+
+  const irept::subt &sub1=i1.get_sub();
+  const irept::subt &sub2=i2.get_sub();
+  const irept::named_subt &named_sub1=i1.get_named_sub();
+  const irept::named_subt &named_sub2=i2.get_named_sub();
+
+  if(sub1.size()!=sub2.size()) return false;
+  if(named_sub1.size()!=named_sub2.size()) return false;
+
+  for(std::size_t i=0; i<sub1.size(); i++)
+    if(&sub1[i].read()!=&sub2[i].read())
+      return false;
+
+  irept::named_subt::const_iterator it1=named_sub1.begin();
+  irept::named_subt::const_iterator it2=named_sub2.begin();
+
+  for(; it1!=named_sub1.end(); it1++, it2++)
+    if(it1->first!=it2->first ||
+       &it1->second.read()!=&it2->second.read())
+      return false;
+
+  return true;
+}
+#endif
+
+/*******************************************************************\
+
 Function: merge_full_irept::operator()
 
   Inputs:
@@ -268,10 +458,17 @@ const irept& merge_full_irept::merged(const irept &irep)
     #ifdef SUB_IS_LIST
     dest_named_sub.push_back(
       std::make_pair(it->first, merged(it->second))); // recursive call
+    #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+    dest_named_sub.push_front(
+      std::make_pair(it->first, merged(it->second))); // recursive call
     #else
     dest_named_sub[it->first]=merged(it->second); // recursive call
     #endif
 
+  #ifdef NAMED_SUB_IS_FORWARD_LIST
+  dest_named_sub.reverse(); // restore the order
+  #endif
+
   const irept::named_subt &src_comments=irep.get_comments();
   irept::named_subt &dest_comments=new_irep.get_comments();
 
@@ -279,9 +476,16 @@ const irept& merge_full_irept::merged(const irept &irep)
     #ifdef SUB_IS_LIST
     dest_comments.push_back(
       std::make_pair(it->first, merged(it->second))); // recursive call
+    #elif defined(NAMED_SUB_IS_FORWARD_LIST)
+    dest_comments.push_front(
+      std::make_pair(it->first, merged(it->second))); // recursive call
     #else
     dest_comments[it->first]=merged(it->second); // recursive call
     #endif
 
+  #ifdef NAMED_SUB_IS_FORWARD_LIST
+  dest_comments.reverse(); // restore the order
+  #endif
+
   return *irep_store.insert(new_irep).first;
 }
@@ -94,17 +94,53 @@ protected:
 // Warning: the below uses irep_hash, as opposed to irep_full_hash,
 // i.e., any comments will be disregarded during merging. Use
 // merge_full_irept if any comments are of importance.
+//
+// With HASH_CONSING (see irep.h), all instances share one table for
+// the lifetime of the process, and the ireps it returns compare equal
+// iff they are the same pointer.
 
 class merge_irept
 {
 public:
   void operator()(irept &);
 
+  #ifdef HASH_CONSING
+  // number of distinct ireps in the global table
+  static std::size_t size() { return irep_store().size(); }
+
+  // The representative of an irep, used when ireps are constructed.
+  // As the table disregards comments, ireps that have any, or whose
+  // representative has any, are returned as they are.
+  static const irept &hash_consed(const irept &);
+  #endif
+
 protected:
+  #ifdef HASH_CONSING
+  // The operands of anything in the table are in the table as well,
+  // so nodes can be hashed and compared by the identity of their
+  // operands instead of recursively.
+  struct node_hash
+  {
+    std::size_t operator()(const irept &irep) const;
+  };
+
+  struct node_eq
+  {
+    bool operator()(const irept &i1, const irept &i2) const;
+  };
+
+  typedef hash_set_cont<irept, node_hash, node_eq> irep_storet;
+  static irep_storet &irep_store();
+  #else
   typedef hash_set_cont<irept, irep_hash> irep_storet;
   irep_storet irep_store;
+  #endif
 
   const irept & merged(const irept &irep);
+
+  #ifdef HASH_CONSING
+  static bool has_comments(const irept &irep);
+  #endif
 };
 
 class merge_full_irept
@@ -118,11 +118,32 @@ Function: integer2binary
 
 const std::string integer2binary(const mp_integer &n, std::size_t width)
 {
-  mp_integer a(n);
-
   if(width==0) return "";
 
-  bool neg=a.is_negative();
+  bool neg=n.is_negative();
+
+  // this is a tuned implementation for values that fit into
+  // a machine word, which avoids converting to base 2 and padding
+  if(neg?n.is_long():n.is_ulong())
+  {
+    const std::size_t word_bits=sizeof(mp_integer::ullong_t)*8;
+
+    mp_integer::ullong_t bits=
+      neg?(mp_integer::ullong_t)n.to_long():n.to_ulong();
+
+    // the fill sign-extends beyond the machine word
+    std::string result(width, neg?'1':'0');
+
+    for(std::size_t i=0; i<width && i<word_bits; i++, bits>>=1)
+      if((bits&1)==0)
+        result[width-i-1]='0';
+      else
+        result[width-i-1]='1';
+
+    return result;
+  }
+
+  mp_integer a(n);
 
   if(neg)
   {
@@ -196,30 +217,37 @@ const mp_integer binary2integer(const std::string &n, bool is_signed)
   if(n.empty())
     return 0;
 
-  if(n.size()<=(sizeof(unsigned long)*8))
+  const std::size_t word_bits=sizeof(mp_integer::ullong_t)*8;
+
+  if(n.size()<=word_bits)
   {
-    // this is a tuned implementation for short integers
+    // this is a tuned implementation for short integers,
+    // which constructs a single mp_integer
 
-    unsigned long mask=1;
-    mask=mask << (n.size()-1);
-    mp_integer top_bit=(n[0]=='1') ? mask : 0;
-    if(is_signed) top_bit.negate();
-    mask>>=1;
-    unsigned long other_bits=0;
+    mp_integer::ullong_t bits=0;
 
-    for(std::string::const_iterator it=++n.begin();
+    for(std::string::const_iterator it=n.begin();
         it!=n.end();
         ++it)
     {
+      bits<<=1;
+
       if(*it=='1')
-        other_bits+=mask;
+        bits|=1;
       else if(*it!='0')
         return 0;
+    }
+
+    if(is_signed && n[0]=='1')
+    {
+      // sign extend to the full word
+      if(n.size()<word_bits)
+        bits|=~((mp_integer::ullong_t(1)<<n.size())-1);
 
-      mask>>=1;
+      return mp_integer((mp_integer::llong_t)bits);
     }
 
-    return top_bit+other_bits;
+    return mp_integer(bits);
   }
 
   #if 0
@@ -21,10 +21,15 @@ class struct_tag_typet;
 class struct_typet;
 class c_enum_typet;
 class c_enum_tag_typet;
+class simplify_expr_cachet;
 
 class namespace_baset
 {
 public:
+  namespace_baset():simplify_cache(NULL)
+  {
+  }
+
   // service methods
   const symbolt &lookup(const irep_idt &name) const
   {
@@ -54,6 +59,20 @@ public:
   // these do the actual lookup
   virtual unsigned get_max(const std::string &prefix) const=0;
   virtual bool lookup(const irep_idt &name, const symbolt *&symbol) const=0;
+
+  // optional, used by simplify(); owned by the caller
+  void set_simplify_cache(simplify_expr_cachet *_simplify_cache)
+  {
+    simplify_cache=_simplify_cache;
+  }
+
+  simplify_expr_cachet *get_simplify_cache() const
+  {
+    return simplify_cache;
+  }
+
+protected:
+  simplify_expr_cachet *simplify_cache;
 };
 
 /*! \brief TO_BE_DOCUMENTED
@@ -0,0 +1,195 @@
+/*******************************************************************\
+
+Module: Per-Phase Time and Memory Profiling
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <iostream>
+
+#include "i2string.h"
+#include "irep.h"
+#include "json.h"
+#include "memory_info.h"
+#include "string_container.h"
+#include "ui_message.h"
+#include "xml.h"
+
+#include "profiling.h"
+
+profilingt profiling;
+
+/*******************************************************************\
+
+Function: profiling_phaset::profiling_phaset
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+profiling_phaset::profiling_phaset(const std::string &name):
+  index(-1),
+  allocations_at_start(0)
+{
+  if(!profiling.enabled)
+    return;
+
+  index=profiling.phases.size();
+  profiling.phases.push_back(profilingt::phaset());
+
+  profilingt::phaset &phase=profiling.phases.back();
+  phase.name=name;
+  phase.depth=profiling.depth++;
+  phase.peak_memory=0;
+  phase.irep_allocations=0;
+  phase.irep_nodes=0;
+
+  allocations_at_start=irept::number_of_allocations();
+  start=current_time();
+}
+
+/*******************************************************************\
+
+Function: profiling_phaset::~profiling_phaset
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+profiling_phaset::~profiling_phaset()
+{
+  if(index==std::size_t(-1))
+    return;
+
+  profilingt::phaset &phase=profiling.phases[index];
+  phase.time=current_time()-start;
+  phase.peak_memory=peak_memory_usage();
+  phase.irep_allocations=
+    irept::number_of_allocations()-allocations_at_start;
+  phase.irep_nodes=
+    irept::number_of_allocations()-irept::number_of_deallocations();
+
+  profiling.depth--;
+}
+
+/*******************************************************************\
+
+Function: profilingt::output
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void profilingt::output(ui_message_handlert &message_handler) const
+{
+  // the totals
+  counterst totals=counters;
+
+  totals["peakMemory"]=peak_memory_usage();
+  totals["irepAllocations"]=irept::number_of_allocations();
+  totals["irepNodes"]=
+    irept::number_of_allocations()-irept::number_of_deallocations();
+
+  const string_containert::statisticst string_statistics=
+    string_container.get_statistics();
+  totals["stringTableStrings"]=string_statistics.strings;
+  totals["stringTableBytes"]=string_statistics.bytes;
+
+  switch(message_handler.get_ui())
+  {
+  case ui_message_handlert::PLAIN:
+    {
+      messaget message(message_handler);
+
+      message.status() << "Profile:" << messaget::eom;
+
+      for(const auto &phase : phases)
+        message.status() << std::string(2*phase.depth+2, ' ')
+                         << phase.name << ": "
+                         << phase.time << "s, peak memory "
+                         << phase.peak_memory/1000000 << "MB, "
+                         << phase.irep_allocations << " irep allocations, "
+                         << phase.irep_nodes << " irep nodes"
+                         << messaget::eom;
+
+      for(const auto &counter : totals)
+        message.status() << "  " << counter.first << ": "
+                         << counter.second << messaget::eom;
+    }
+    break;
+
+  case ui_message_handlert::XML_UI:
+    {
+      xmlt xml("profile");
+
+      for(const auto &phase : phases)
+      {
+        xmlt &xml_phase=xml.new_element("phase");
+        xml_phase.set_attribute("name", phase.name);
+        xml_phase.set_attribute("depth", phase.depth);
+        xml_phase.set_attribute("time", phase.time.as_string());
+        xml_phase.set_attribute(
+          "peak_memory", (unsigned long long)phase.peak_memory);
+        xml_phase.set_attribute(
+          "irep_allocations", (unsigned long long)phase.irep_allocations);
+        xml_phase.set_attribute(
+          "irep_nodes", (unsigned long long)phase.irep_nodes);
+      }
+
+      for(const auto &counter : totals)
+      {
+        xmlt &xml_counter=xml.new_element("counter");
+        xml_counter.set_attribute("name", counter.first);
+        xml_counter.set_attribute(
+          "value", (unsigned long long)counter.second);
+      }
+
+      std::cout << xml;
+      std::cout << "\n";
+    }
+    break;
+
+  case ui_message_handlert::JSON_UI:
+    {
+      json_objectt json_result;
+      json_objectt &json_profile=json_result["profile"].make_object();
+      json_arrayt &json_phases=json_profile["phases"].make_array();
+
+      for(const auto &phase : phases)
+      {
+        json_objectt &json_phase=json_phases.push_back().make_object();
+        json_phase["name"]=json_stringt(phase.name);
+        json_phase["depth"]=json_numbert(i2string(phase.depth));
+        json_phase["time"]=json_numbert(phase.time.as_string());
+        json_phase["peakMemory"]=
+          json_numbert(i2string(phase.peak_memory));
+        json_phase["irepAllocations"]=
+          json_numbert(i2string(phase.irep_allocations));
+        json_phase["irepNodes"]=
+          json_numbert(i2string(phase.irep_nodes));
+      }
+
+      json_objectt &json_counters=json_profile["counters"].make_object();
+
+      for(const auto &counter : totals)
+        json_counters[counter.first]=
+          json_numbert(i2string(counter.second));
+
+      std::cout << ",\n" << json_result;
+    }
+    break;
+  }
+}
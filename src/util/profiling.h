@@ -0,0 +1,124 @@
+/*******************************************************************\
+
+Module: Per-Phase Time and Memory Profiling
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_PROFILING_H
+#define CPROVER_UTIL_PROFILING_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "time_stopping.h"
+
+class ui_message_handlert;
+
+/*******************************************************************\
+
+   Class: profilingt
+
+ Purpose: Collects the time and memory used by the phases of a
+          tool, and counters such as the size of the SAT instance.
+          Nothing is recorded unless enabled, which the tools do
+          with --profile.
+
+\*******************************************************************/
+
+class profilingt
+{
+public:
+  profilingt():enabled(false), depth(0)
+  {
+  }
+
+  bool enabled;
+
+  struct phaset
+  {
+    std::string name;
+    unsigned depth;
+    time_periodt time;
+    // the peak resident set size at the end of the phase
+    std::size_t peak_memory;
+    // irep nodes allocated during the phase, and alive at its end
+    std::size_t irep_allocations, irep_nodes;
+  };
+
+  // in the order in which the phases begin
+  typedef std::vector<phaset> phasest;
+  phasest phases;
+
+  typedef std::map<std::string, std::size_t> counterst;
+  counterst counters;
+
+  void set_counter(const std::string &name, std::size_t value)
+  {
+    if(enabled)
+      counters[name]=value;
+  }
+
+  // as JSON, XML or text, depending on the user interface
+  void output(ui_message_handlert &) const;
+
+protected:
+  unsigned depth;
+
+  friend class profiling_phaset;
+};
+
+extern profilingt profiling;
+
+/*******************************************************************\
+
+   Class: profiling_phaset
+
+ Purpose: Records a phase from construction to destruction.
+
+\*******************************************************************/
+
+class profiling_phaset
+{
+public:
+  explicit profiling_phaset(const std::string &name);
+  ~profiling_phaset();
+
+protected:
+  // index into profiling.phases, or -1 if not enabled
+  std::size_t index;
+  absolute_timet start;
+  std::size_t allocations_at_start;
+};
+
+/*******************************************************************\
+
+   Class: profiling_reportt
+
+ Purpose: Enables profiling, and outputs the profile when the
+          tool is done, however it finishes.
+
+\*******************************************************************/
+
+class profiling_reportt
+{
+public:
+  profiling_reportt(ui_message_handlert &_message_handler, bool enable):
+    message_handler(_message_handler)
+  {
+    profiling.enabled=enable;
+  }
+
+  ~profiling_reportt()
+  {
+    if(profiling.enabled)
+      profiling.output(message_handler);
+  }
+
+protected:
+  ui_message_handlert &message_handler;
+};
+
+#endif
@@ -11,6 +11,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <cassert>
 
+#ifdef THREAD_SAFE_IREP
+#include <atomic>
+#endif
+
 template<typename T>
 class reference_counting
 {
@@ -76,11 +80,22 @@ protected:
   class dt:public T
   {
   public:
+    #ifdef THREAD_SAFE_IREP
+    std::atomic<unsigned> ref_count;
+    #else
     unsigned ref_count;
+    #endif
 
     dt():ref_count(1)
     {
     }
+
+    #ifdef THREAD_SAFE_IREP
+    // std::atomic cannot be copied; copies start out unshared
+    dt(const dt &other):T(other), ref_count(1)
+    {
+    }
+    #endif
   };
 
   dt *d;
@@ -120,8 +135,7 @@ void reference_counting<T>::remove_ref(dt *old_d)
   std::cout << "R: " << old_d << " " << old_d->ref_count << std::endl;
   #endif
 
-  old_d->ref_count--;
-  if(old_d->ref_count==0)
+  if(--old_d->ref_count==0)
   {
     #ifdef REFERENCE_COUNTING_DEBUG
     std::cout << "DELETING " << old_d << std::endl;
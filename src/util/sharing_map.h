@@ -0,0 +1,492 @@
+/*******************************************************************\
+
+Module: Maps with Structural Sharing
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_SHARING_MAP_H
+#define CPROVER_UTIL_SHARING_MAP_H
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef THREAD_SAFE_IREP
+#include <atomic>
+#endif
+
+/*******************************************************************\
+
+   Class: sharing_mapt
+
+ Purpose: An ordered map that can be copied in constant time. The
+          entries are kept in a treap whose priorities are derived
+          from the hash of the keys, so the shape of the tree only
+          depends on the keys it contains. Copies share all nodes;
+          a write copies the nodes on the path to the entry that is
+          changed, unless they are not shared. As unchanged
+          subtrees remain shared, the entries that differ between
+          two copies can be found by get_delta_view in time
+          proportional to the number of changes.
+
+          Unlike with std::map, there are no mutable iterators:
+          entries are changed through operator[] and insert.
+
+\*******************************************************************/
+
+template<
+  class keyT,
+  class valueT,
+  class hashT=std::hash<keyT>,
+  class compareT=std::less<keyT> >
+class sharing_mapt
+{
+public:
+  typedef keyT key_type;
+  typedef valueT mapped_type;
+  typedef std::pair<const keyT, valueT> value_type;
+  typedef std::size_t size_type;
+
+protected:
+  struct nodet
+  {
+    nodet(const value_type &_data, std::size_t _priority):
+      data(_data),
+      priority(_priority)
+    {
+    }
+
+    value_type data;
+    std::size_t priority;
+    std::shared_ptr<nodet> left, right;
+  };
+
+  typedef std::shared_ptr<nodet> node_ptrt;
+
+public:
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename sharing_mapt::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const value_type *pointer;
+    typedef const value_type &reference;
+
+    const_iterator()
+    {
+    }
+
+    reference operator*() const { return stack.back()->data; }
+    pointer operator->() const { return &stack.back()->data; }
+
+    const_iterator &operator++()
+    {
+      const nodet *n=stack.back();
+      stack.pop_back();
+      push_leftmost(n->right.get());
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const
+    {
+      if(stack.empty() || other.stack.empty())
+        return stack.empty()==other.stack.empty();
+      return stack.back()==other.stack.back();
+    }
+
+    bool operator!=(const const_iterator &other) const
+    {
+      return !(*this==other);
+    }
+
+  protected:
+    // the nodes whose entry and right subtree are yet to be visited,
+    // the next one at the back
+    std::vector<const nodet *> stack;
+
+    void push_leftmost(const nodet *n)
+    {
+      for(; n!=nullptr; n=n->left.get())
+        stack.push_back(n);
+    }
+
+    friend class sharing_mapt;
+  };
+
+  sharing_mapt():number_of_entries(0)
+  {
+  }
+
+  size_type size() const { return number_of_entries; }
+  bool empty() const { return number_of_entries==0; }
+
+  void clear()
+  {
+    root.reset();
+    number_of_entries=0;
+  }
+
+  void swap(sharing_mapt &other)
+  {
+    root.swap(other.root);
+    std::swap(number_of_entries, other.number_of_entries);
+  }
+
+  const_iterator begin() const
+  {
+    const_iterator it;
+    it.push_leftmost(root.get());
+    return it;
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator();
+  }
+
+  const_iterator find(const keyT &key) const
+  {
+    const_iterator it;
+    const compareT compare=compareT();
+
+    // the path is needed for incrementing the iterator
+    for(const nodet *n=root.get(); n!=nullptr; )
+    {
+      if(compare(key, n->data.first))
+      {
+        it.stack.push_back(n);
+        n=n->left.get();
+      }
+      else if(compare(n->data.first, key))
+        n=n->right.get();
+      else
+      {
+        it.stack.push_back(n);
+        return it;
+      }
+    }
+
+    return end();
+  }
+
+  size_type count(const keyT &key) const
+  {
+    return get(key)==nullptr?0:1;
+  }
+
+  // the value for the key, or null if there is none
+  const valueT *get(const keyT &key) const
+  {
+    const compareT compare=compareT();
+
+    for(const nodet *n=root.get(); n!=nullptr; )
+    {
+      if(compare(key, n->data.first))
+        n=n->left.get();
+      else if(compare(n->data.first, key))
+        n=n->right.get();
+      else
+        return &n->data.second;
+    }
+
+    return nullptr;
+  }
+
+  // Returns the value for the given key for writing, and true if it
+  // has been inserted. An existing value is left unchanged.
+  std::pair<valueT &, bool> insert(const value_type &entry)
+  {
+    std::pair<nodet *, bool> result=
+      insert_rec(root, entry, priority(entry.first));
+
+    if(result.second)
+      number_of_entries++;
+
+    return std::pair<valueT &, bool>(result.first->data.second,
+                                     result.second);
+  }
+
+  valueT &operator[](const keyT &key)
+  {
+    return insert(value_type(key, valueT())).first;
+  }
+
+  size_type erase(const keyT &key)
+  {
+    // avoid copying the path if there is nothing to erase
+    if(get(key)==nullptr)
+      return 0;
+
+    erase_rec(root, key);
+    number_of_entries--;
+    return 1;
+  }
+
+  struct delta_itemt
+  {
+    // null if the key is not in the respective map
+    const value_type *entry, *other_entry;
+
+    const keyT &key() const
+    {
+      return entry!=nullptr?entry->first:other_entry->first;
+    }
+  };
+
+  typedef std::vector<delta_itemt> delta_viewt;
+
+  // The entries that may differ between this map and the other one,
+  // in the order of the keys. Shared subtrees are skipped; entries
+  // with the same key in distinct nodes are included even if their
+  // values are equal. The pointers are valid until the maps change.
+  void get_delta_view(
+    const sharing_mapt &other,
+    delta_viewt &dest) const
+  {
+    delta_rec(root.get(), other.root.get(), nullptr, nullptr, dest);
+  }
+
+protected:
+  node_ptrt root;
+  size_type number_of_entries;
+
+  static std::size_t priority(const keyT &key)
+  {
+    // the finaliser of MurmurHash3, as consecutive hash values,
+    // e.g., of numbered strings, would give a degenerate tree
+    unsigned long long h=hashT()(key);
+    h^=h>>33;
+    h*=0xff51afd7ed558ccdULL;
+    h^=h>>33;
+    h*=0xc4ceb9fe1a85ec53ULL;
+    h^=h>>33;
+    return std::size_t(h);
+  }
+
+  // the order of the priorities, with ties broken by the keys
+  static bool above(
+    std::size_t priority,
+    const keyT &key,
+    const nodet &n)
+  {
+    if(priority!=n.priority)
+      return priority>n.priority;
+    return compareT()(key, n.data.first);
+  }
+
+  // copies the node if it is shared with another map
+  static void make_unique(node_ptrt &n)
+  {
+    if(n.use_count()>1)
+      n=std::make_shared<nodet>(*n);
+    #ifdef THREAD_SAFE_IREP
+    else
+    {
+      // use_count() is a relaxed load; the reads of the node by a
+      // thread that has copied it and dropped it must be complete
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    #endif
+  }
+
+  static void split(
+    node_ptrt n,
+    const keyT &key,
+    node_ptrt &left,
+    node_ptrt &right)
+  {
+    if(!n)
+    {
+      left.reset();
+      right.reset();
+    }
+    else
+    {
+      make_unique(n);
+
+      if(compareT()(n->data.first, key))
+      {
+        split(std::move(n->right), key, n->right, right);
+        left=std::move(n);
+      }
+      else
+      {
+        split(std::move(n->left), key, left, n->left);
+        right=std::move(n);
+      }
+    }
+  }
+
+  static node_ptrt merge(node_ptrt left, node_ptrt right)
+  {
+    if(!left)
+      return right;
+    if(!right)
+      return left;
+
+    if(above(left->priority, left->data.first, *right))
+    {
+      make_unique(left);
+      left->right=merge(std::move(left->right), std::move(right));
+      return left;
+    }
+    else
+    {
+      make_unique(right);
+      right->left=merge(std::move(left), std::move(right->left));
+      return right;
+    }
+  }
+
+  static std::pair<nodet *, bool> insert_rec(
+    node_ptrt &n,
+    const value_type &entry,
+    std::size_t entry_priority)
+  {
+    if(!n)
+    {
+      n=std::make_shared<nodet>(entry, entry_priority);
+      return std::pair<nodet *, bool>(n.get(), true);
+    }
+
+    // a node for the key would be above this one, hence the
+    // key is not in this subtree
+    if(above(entry_priority, entry.first, *n))
+    {
+      node_ptrt new_node=std::make_shared<nodet>(entry, entry_priority);
+      split(std::move(n), entry.first, new_node->left, new_node->right);
+      n=std::move(new_node);
+      return std::pair<nodet *, bool>(n.get(), true);
+    }
+
+    make_unique(n);
+
+    const compareT compare=compareT();
+
+    if(compare(entry.first, n->data.first))
+      return insert_rec(n->left, entry, entry_priority);
+    else if(compare(n->data.first, entry.first))
+      return insert_rec(n->right, entry, entry_priority);
+    else
+      return std::pair<nodet *, bool>(n.get(), false);
+  }
+
+  static void erase_rec(node_ptrt &n, const keyT &key)
+  {
+    assert(n);
+    make_unique(n);
+
+    const compareT compare=compareT();
+
+    if(compare(key, n->data.first))
+      erase_rec(n->left, key);
+    else if(compare(n->data.first, key))
+      erase_rec(n->right, key);
+    else
+      n=merge(std::move(n->left), std::move(n->right));
+  }
+
+  // the root of the subtree of the keys strictly between the bounds
+  static const nodet *restrict(
+    const nodet *n,
+    const keyT *lower,
+    const keyT *upper)
+  {
+    const compareT compare=compareT();
+
+    while(n!=nullptr)
+    {
+      if(lower!=nullptr && !compare(*lower, n->data.first))
+        n=n->right.get();
+      else if(upper!=nullptr && !compare(n->data.first, *upper))
+        n=n->left.get();
+      else
+        break;
+    }
+
+    return n;
+  }
+
+  static void add_all(
+    const nodet *n,
+    const keyT *lower,
+    const keyT *upper,
+    bool other,
+    delta_viewt &dest)
+  {
+    n=restrict(n, lower, upper);
+
+    if(n==nullptr)
+      return;
+
+    add_all(n->left.get(), lower, &n->data.first, other, dest);
+
+    delta_itemt item;
+    item.entry=other?nullptr:&n->data;
+    item.other_entry=other?&n->data:nullptr;
+    dest.push_back(item);
+
+    add_all(n->right.get(), &n->data.first, upper, other, dest);
+  }
+
+  // As the trees are canonical, the subtrees for the same range of
+  // keys have the same root if they have the same keys; the root
+  // that is above the other one is missing from the other map.
+  static void delta_rec(
+    const nodet *n,
+    const nodet *other,
+    const keyT *lower,
+    const keyT *upper,
+    delta_viewt &dest)
+  {
+    n=restrict(n, lower, upper);
+    other=restrict(other, lower, upper);
+
+    if(n==other)
+      return; // shared, or both empty
+
+    if(n==nullptr)
+      return add_all(other, lower, upper, true, dest);
+
+    if(other==nullptr)
+      return add_all(n, lower, upper, false, dest);
+
+    delta_itemt item;
+    item.entry=nullptr;
+    item.other_entry=nullptr;
+
+    // the root above the other one, or both if they have the same key
+    if(!above(other->priority, other->data.first, *n))
+      item.entry=&n->data;
+    if(!above(n->priority, n->data.first, *other))
+      item.other_entry=&other->data;
+
+    const keyT &key=item.key();
+
+    delta_rec(
+      item.entry!=nullptr?n->left.get():n,
+      item.other_entry!=nullptr?other->left.get():other,
+      lower, &key, dest);
+
+    dest.push_back(item);
+
+    delta_rec(
+      item.entry!=nullptr?n->right.get():n,
+      item.other_entry!=nullptr?other->right.get():other,
+      &key, upper, dest);
+  }
+};
+
+#endif
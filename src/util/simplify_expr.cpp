@@ -30,6 +30,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "bv_arithmetic.h"
 #include "endianness_map.h"
 #include "simplify_utils.h"
+#include "simplify_expr_cache.h"
 
 //#define DEBUGX
 
@@ -38,32 +39,6 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #endif
 
-//#define USE_CACHE
-
-#ifdef USE_CACHE
-struct simplify_expr_cachet
-{
-public:
-  friend class simplify_exprt;
-
-  #if 1
-  typedef hash_map_cont<
-    exprt, exprt, irep_full_hash, irep_full_eq> containert;
-  #else
-  typedef hash_map_cont<
-    exprt, exprt, irep_hash> containert;
-  #endif
-
-  containert container_normal;
-
-  containert &container()
-  {
-    return container_normal;
-  }
-};
-
-simplify_expr_cachet simplify_expr_cache;
-#endif
 
 /*******************************************************************\
 
@@ -695,7 +670,7 @@ bool simplify_exprt::simplify_typecast(exprt &expr)
          expr_type_id==ID_signedbv ||
          expr_type_id==ID_floatbv)
       {
-        mp_integer int_value=binary2integer(id2string(value), false);
+        mp_integer int_value=binary2integer(value, false);
         expr=from_integer(int_value, expr_type);
         return false;
       }
@@ -858,8 +833,8 @@ bool simplify_exprt::simplify_if_implies(
       else if(type_id==ID_unsignedbv)
       {
         const mp_integer i1, i2;
-        if(binary2integer(cond.op1().get_string(ID_value), false) >=
-           binary2integer(expr.op1().get_string(ID_value), false))
+        if(binary2integer(cond.op1().get(ID_value), false) >=
+           binary2integer(expr.op1().get(ID_value), false))
         {
           new_truth = true;
           return false;
@@ -868,8 +843,8 @@ bool simplify_exprt::simplify_if_implies(
       else if(type_id==ID_signedbv)
       {
         const mp_integer i1, i2;
-        if(binary2integer(cond.op1().get_string(ID_value), true) >=
-           binary2integer(expr.op1().get_string(ID_value), true))
+        if(binary2integer(cond.op1().get(ID_value), true) >=
+           binary2integer(expr.op1().get(ID_value), true))
         {
           new_truth = true;
           return false;
@@ -894,8 +869,8 @@ bool simplify_exprt::simplify_if_implies(
       else if(type_id==ID_unsignedbv)
       {
         const mp_integer i1, i2;
-        if(binary2integer(cond.op1().get_string(ID_value), false) <=
-           binary2integer(expr.op1().get_string(ID_value), false))
+        if(binary2integer(cond.op1().get(ID_value), false) <=
+           binary2integer(expr.op1().get(ID_value), false))
         {
           new_truth = true;
           return false;
@@ -904,8 +879,8 @@ bool simplify_exprt::simplify_if_implies(
       else if(type_id==ID_signedbv)
       {
         const mp_integer i1, i2;
-        if(binary2integer(cond.op1().get_string(ID_value), true) <=
-           binary2integer(expr.op1().get_string(ID_value), true))
+        if(binary2integer(cond.op1().get(ID_value), true) <=
+           binary2integer(expr.op1().get(ID_value), true))
         {
           new_truth = true;
           return false;
@@ -2594,24 +2569,25 @@ Function: simplify_exprt::simplify_rec
 
 bool simplify_exprt::simplify_rec(exprt &expr)
 {
-  // look up in cache
+  // look up in cache; results obtained under local_replace_map
+  // or without simplifying if-expressions are not general
+  simplify_expr_cachet *cache=
+    do_simplify_if && local_replace_map.empty()?
+    ns.get_simplify_cache():NULL;
 
-  #ifdef USE_CACHE
-  std::pair<simplify_expr_cachet::containert::iterator, bool>
-    cache_result=simplify_expr_cache.container().
-      insert(std::pair<exprt, exprt>(expr, exprt()));
-
-  if(!cache_result.second) // found!
+  if(cache!=NULL)
   {
-    const exprt &new_expr=cache_result.first->second;
+    const exprt *cached=cache->find(expr);
 
-    if(new_expr.id()==irep_idt())
-      return true; // no change
+    if(cached!=NULL)
+    {
+      if(cached->id().empty())
+        return true; // no change
 
-    expr=new_expr;
-    return false;
+      expr=*cached;
+      return false;
+    }
   }
-  #endif
 
   // We work on a copy to prevent unnecessary destruction of sharing.
   exprt tmp=expr;
@@ -2637,16 +2613,12 @@ bool simplify_exprt::simplify_rec(exprt &expr)
   }
   #endif
 
+  if(cache!=NULL)
+    cache->insert(expr, result?exprt():tmp);
+
   if(!result)
-  {
     expr.swap(tmp);
 
-    #ifdef USE_CACHE
-    // save in cache
-    cache_result.first->second=expr;
-    #endif
-  }
-
   return result;
 }
 
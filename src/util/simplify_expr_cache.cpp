@@ -0,0 +1,124 @@
+/*******************************************************************\
+
+Module: Simplifier Cache
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <ostream>
+
+#include "simplify_expr_cache.h"
+
+/*******************************************************************\
+
+Function: simplify_expr_cachet::find
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+const exprt *simplify_expr_cachet::find(const exprt &expr)
+{
+  const void *key=&expr.read();
+
+  containert::const_iterator it=current.find(key);
+
+  if(it!=current.end())
+  {
+    hits++;
+    return &it->second.result;
+  }
+
+  it=previous.find(key);
+
+  if(it!=previous.end())
+  {
+    hits++;
+
+    // still in use, keep it in the current generation
+    entryt promoted=it->second;
+    previous.erase(it);
+
+    entryt &entry=new_entry(key);
+    entry=promoted;
+
+    return &entry.result;
+  }
+
+  misses++;
+  return NULL;
+}
+
+/*******************************************************************\
+
+Function: simplify_expr_cachet::insert
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void simplify_expr_cachet::insert(
+  const exprt &expr,
+  const exprt &result)
+{
+  if(max_size==0)
+    return;
+
+  entryt &entry=new_entry(&expr.read());
+  entry.key=expr;
+  entry.result=result;
+}
+
+/*******************************************************************\
+
+Function: simplify_expr_cachet::new_entry
+
+  Inputs:
+
+ Outputs: the entry for the key in the current generation
+
+ Purpose: starts a new generation when the current one is full
+
+\*******************************************************************/
+
+simplify_expr_cachet::entryt &simplify_expr_cachet::new_entry(
+  const void *key)
+{
+  if(current.size()*2>=max_size)
+  {
+    evictions+=previous.size();
+    previous.clear();
+    previous.swap(current);
+  }
+
+  return current[key];
+}
+
+/*******************************************************************\
+
+Function: simplify_expr_cachet::output_statistics
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void simplify_expr_cachet::output_statistics(std::ostream &out) const
+{
+  out << size() << " entries, "
+      << hits << " hits, "
+      << misses << " misses, "
+      << evictions << " evictions";
+}
@@ -0,0 +1,81 @@
+/*******************************************************************\
+
+Module: Simplifier Cache
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_SIMPLIFY_EXPR_CACHE_H
+#define CPROVER_SIMPLIFY_EXPR_CACHE_H
+
+#include <iosfwd>
+
+#include "expr.h"
+#include "hash_cont.h"
+
+// Memoises simplify_exprt::simplify_rec for a namespace; attach it
+// with namespace_baset::set_simplify_cache. Expressions are looked
+// up by the address of their shared representation, which avoids
+// hashing and comparing whole trees. The cache holds a reference to
+// each key, so the address cannot be reused while the entry exists.
+//
+// The cache keeps two generations of at most max_size/2 entries
+// each; once the current one is full, the older one is dropped.
+
+class simplify_expr_cachet
+{
+public:
+  explicit simplify_expr_cachet(std::size_t _max_size):
+    max_size(_max_size),
+    hits(0),
+    misses(0),
+    evictions(0)
+  {
+  }
+
+  // returns NULL if not found; a result with empty id means that
+  // the expression does not simplify
+  const exprt *find(const exprt &expr);
+
+  void insert(const exprt &expr, const exprt &result);
+
+  void clear()
+  {
+    current.clear();
+    previous.clear();
+  }
+
+  std::size_t size() const
+  {
+    return current.size()+previous.size();
+  }
+
+  const std::size_t max_size;
+
+  // statistics
+  unsigned long long hits, misses, evictions;
+
+  void output_statistics(std::ostream &out) const;
+
+protected:
+  struct entryt
+  {
+    exprt key, result;
+  };
+
+  struct pointer_hash
+  {
+    inline std::size_t operator()(const void *p) const
+    {
+      return (std::size_t)p;
+    }
+  };
+
+  typedef hash_map_cont<const void *, entryt, pointer_hash> containert;
+  containert current, previous;
+
+  entryt &new_entry(const void *key);
+};
+
+#endif
@@ -693,8 +693,8 @@ bool simplify_exprt::simplify_bitwise(exprt &expr)
 
   while(expr.operands().size()>=2)
   {
-    const irep_idt &a_str=expr.op0().get(ID_value);
-    const irep_idt &b_str=expr.op1().get(ID_value);
+    const irep_idt &a_val=expr.op0().get(ID_value);
+    const irep_idt &b_val=expr.op1().get(ID_value);
 
     if(!expr.op0().is_constant())
       break;
@@ -708,31 +708,55 @@ bool simplify_exprt::simplify_bitwise(exprt &expr)
     if(expr.op1().type()!=expr.type())
       break;
 
-    assert(a_str.size()==b_str.size());
+    assert(binary_width(a_val)==binary_width(b_val));
 
     constant_exprt new_op(expr.type());
-    std::string new_value;
-    new_value.resize(width);
 
-    if(expr.id()==ID_bitand)
+    if(width<=64)
     {
-      for(std::size_t i=0; i<width; i++)
-        new_value[i]=(a_str[i]=='1' && b_str[i]=='1')?'1':'0';
-    }
-    else if(expr.id()==ID_bitor)
-    {
-      for(std::size_t i=0; i<width; i++)
-        new_value[i]=(a_str[i]=='1' || b_str[i]=='1')?'1':'0';
-    }
-    else if(expr.id()==ID_bitxor)
-    {
-      for(std::size_t i=0; i<width; i++)
-        new_value[i]=((a_str[i]=='1')!=(b_str[i]=='1'))?'1':'0';
+      // in one word, and without strings for most values
+      mp_integer::ullong_t a=integer2ulong(binary2integer(a_val, false));
+      mp_integer::ullong_t b=integer2ulong(binary2integer(b_val, false));
+      mp_integer::ullong_t new_value;
+
+      if(expr.id()==ID_bitand)
+        new_value=a&b;
+      else if(expr.id()==ID_bitor)
+        new_value=a|b;
+      else if(expr.id()==ID_bitxor)
+        new_value=a^b;
+      else
+        break;
+
+      new_op.set_value(integer2binary_id(new_value, width));
     }
     else
-      break;
+    {
+      const std::string &a_str=id2string(a_val);
+      const std::string &b_str=id2string(b_val);
+      std::string new_value;
+      new_value.resize(width);
+
+      if(expr.id()==ID_bitand)
+      {
+        for(std::size_t i=0; i<width; i++)
+          new_value[i]=(a_str[i]=='1' && b_str[i]=='1')?'1':'0';
+      }
+      else if(expr.id()==ID_bitor)
+      {
+        for(std::size_t i=0; i<width; i++)
+          new_value[i]=(a_str[i]=='1' || b_str[i]=='1')?'1':'0';
+      }
+      else if(expr.id()==ID_bitxor)
+      {
+        for(std::size_t i=0; i<width; i++)
+          new_value[i]=((a_str[i]=='1')!=(b_str[i]=='1'))?'1':'0';
+      }
+      else
+        break;
 
-    new_op.set_value(new_value);
+      new_op.set_value(new_value);
+    }
 
     // erase first operand
     expr.operands().erase(expr.operands().begin());
@@ -775,7 +799,7 @@ bool simplify_exprt::simplify_bitwise(exprt &expr)
     else if(expr.id()==ID_bitxor)
     {
       constant_exprt new_op(expr.type());
-      new_op.set_value(integer2binary(0, width));
+      new_op.set_value(integer2binary_id(0, width));
       expr.swap(new_op);
       return false;
     }
@@ -828,10 +852,10 @@ bool simplify_exprt::simplify_extractbit(exprt &expr)
 
   const irep_idt &value=expr.op0().get(ID_value);
 
-  if(value.size()!=width)
+  if(binary_width(value)!=width)
     return true;
 
-  bool bit=(id2string(value)[width-integer2size_t(i)-1]=='1');
+  bool bit=binary_bit(value, integer2size_t(i));
 
   expr.make_bool(bit);
 
@@ -881,10 +905,15 @@ bool simplify_exprt::simplify_concatenation(exprt &expr)
          is_bitvector_type(opn.type()))
       {
         // merge!
-        const std::string new_value=
-          opi.get_string(ID_value)+opn.get_string(ID_value);
-        opi.set(ID_value, new_value);
-        opi.type().set(ID_width, new_value.size());
+        const irep_idt &value_i=opi.get(ID_value);
+        const irep_idt &value_n=opn.get(ID_value);
+        std::size_t width_n=binary_width(value_n);
+        std::size_t new_width=binary_width(value_i)+width_n;
+        mp_integer new_value=
+          binary2integer(value_i, false)*power(2, width_n)+
+          binary2integer(value_n, false);
+        opi.set(ID_value, integer2binary_id(new_value, new_width));
+        opi.type().set(ID_width, new_width);
         // erase opn
         expr.operands().erase(expr.operands().begin()+i+1);
         result=true;
@@ -1133,14 +1162,13 @@ bool simplify_exprt::simplify_extractbits(exprt &expr)
 
     const irep_idt &value=expr.op0().get(ID_value);
 
-    if(value.size()!=width)
+    if(binary_width(value)!=width)
       return true;
 
-    std::string svalue=id2string(value);
-
-    std::string extracted_value=
-      svalue.substr(width-integer2size_t(start)-1,
-                    integer2size_t(start-end+1));
+    // the width cuts off the bits beyond 'start'
+    irep_idt extracted_value=integer2binary_id(
+      binary2integer(value, false)>>end,
+      integer2size_t(start-end+1));
 
     exprt tmp(ID_constant, expr.type());
     tmp.set(ID_value, extracted_value);
@@ -1293,15 +1321,15 @@ bool simplify_exprt::simplify_bitnot(exprt &expr)
     {
       if(op.id()==ID_constant)
       {
-        std::string value=op.get_string(ID_value);
+        const irep_idt &value=op.get(ID_value);
 
-        for(std::string::iterator it=value.begin();
-            it!=value.end();
-            ++it)
-          *it=(*it=='0')?'1':'0';
+        // ~x is -x-1, cut off to the width
+        irep_idt new_value=integer2binary_id(
+          -binary2integer(value, false)-1,
+          binary_width(value));
 
         exprt tmp(ID_constant, op.type());
-        tmp.set(ID_value, value);
+        tmp.set(ID_value, new_value);
         expr.swap(tmp);
         return false;
       }
@@ -0,0 +1,263 @@
+/*******************************************************************\
+
+Module: Sorted Flat Map with Stable References
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_SMALL_FLAT_MAP_H
+#define CPROVER_UTIL_SMALL_FLAT_MAP_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+/*******************************************************************\
+
+   Class: small_flat_mapt
+
+ Purpose: A map for a handful of entries, with the keys in one
+          sorted array, each next to a pointer to its value. The
+          values are allocated one by one and never move, hence,
+          as with std::map, a reference to a value remains valid
+          while entries are added or removed. The map itself is a
+          single pointer, which is null while the map is empty.
+
+          The caller keeps the entries sorted: entries are added
+          at a position found with std::lower_bound, as with a
+          sorted std::list. Neither the key nor the value need to
+          be complete where the map is declared.
+
+\*******************************************************************/
+
+template<
+  typename keyT,
+  typename valueT,
+  typename allocatort=std::allocator<valueT> >
+class small_flat_mapt
+{
+public:
+  struct value_type
+  {
+    keyT first;
+    valueT &second;
+
+    value_type(const keyT &_first, valueT &_second):
+      first(_first), second(_second)
+    {
+    }
+  };
+
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef value_type *iterator;
+  typedef const value_type *const_iterator;
+
+  small_flat_mapt():store(nullptr)
+  {
+  }
+
+  small_flat_mapt(const small_flat_mapt &other):store(nullptr)
+  {
+    if(other.empty())
+      return;
+
+    reserve(other.size());
+
+    for(const_iterator it=other.begin(); it!=other.end(); it++)
+    {
+      valueT *value=new_value(it->second);
+      new (entries()+store->size) value_type(it->first, *value);
+      store->size++;
+    }
+  }
+
+  small_flat_mapt(small_flat_mapt &&other):store(other.store)
+  {
+    other.store=nullptr;
+  }
+
+  ~small_flat_mapt()
+  {
+    clear();
+  }
+
+  small_flat_mapt &operator=(const small_flat_mapt &other)
+  {
+    if(this!=&other)
+    {
+      small_flat_mapt tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  small_flat_mapt &operator=(small_flat_mapt &&other)
+  {
+    swap(other);
+    return *this;
+  }
+
+  void swap(small_flat_mapt &other)
+  {
+    std::swap(store, other.store);
+  }
+
+  // access
+
+  iterator begin() { return store==nullptr?nullptr:entries(); }
+  iterator end() { return store==nullptr?nullptr:entries()+store->size; }
+  const_iterator begin() const
+  { return store==nullptr?nullptr:entries(); }
+  const_iterator end() const
+  { return store==nullptr?nullptr:entries()+store->size; }
+
+  size_type size() const { return store==nullptr?0:store->size; }
+  bool empty() const { return store==nullptr; }
+
+  // modifying
+
+  void clear()
+  {
+    if(store==nullptr)
+      return;
+
+    for(iterator it=begin(); it!=end(); it++)
+    {
+      delete_value(&it->second);
+      it->~value_type();
+    }
+
+    ::operator delete(store);
+    store=nullptr;
+  }
+
+  void reserve(size_type n)
+  {
+    if(n>capacity())
+      reallocate(n);
+  }
+
+  // adds an entry before the given position
+  template<typename... argst>
+  iterator emplace(const_iterator pos, const keyT &key, argst &&... args)
+  {
+    size_type offset=pos-begin();
+    valueT *value=new_value(std::forward<argst>(args)...);
+
+    if(size()==capacity())
+      reallocate(capacity()==0?1:2*capacity());
+
+    value_type *e=entries();
+    // the entries are moved as bytes, which leaves the
+    // values untouched
+    std::memmove(
+      static_cast<void *>(e+offset+1),
+      static_cast<const void *>(e+offset),
+      (store->size-offset)*sizeof(value_type));
+    new (e+offset) value_type(key, *value);
+    store->size++;
+    return e+offset;
+  }
+
+  iterator insert(const_iterator pos, const std::pair<keyT, valueT> &entry)
+  {
+    return emplace(pos, entry.first, entry.second);
+  }
+
+  // appends an entry, which has to come after all others
+  template<typename... argst>
+  void emplace_back(const keyT &key, argst &&... args)
+  {
+    emplace(end(), key, std::forward<argst>(args)...);
+  }
+
+  iterator erase(const_iterator pos)
+  {
+    size_type offset=pos-begin();
+    value_type *e=entries();
+    delete_value(&e[offset].second);
+    e[offset].~value_type();
+    std::memmove(
+      static_cast<void *>(e+offset),
+      static_cast<const void *>(e+offset+1),
+      (store->size-offset-1)*sizeof(value_type));
+    store->size--;
+
+    if(store->size==0)
+    {
+      ::operator delete(store);
+      store=nullptr;
+      return nullptr;
+    }
+
+    return e+offset;
+  }
+
+protected:
+  struct headert
+  {
+    std::uint32_t size, capacity;
+  };
+
+  // followed by the entries
+  headert *store;
+
+  value_type *entries()
+  {
+    return reinterpret_cast<value_type *>(store+1);
+  }
+
+  const value_type *entries() const
+  {
+    return reinterpret_cast<const value_type *>(store+1);
+  }
+
+  size_type capacity() const
+  {
+    return store==nullptr?0:store->capacity;
+  }
+
+  void reallocate(size_type new_capacity)
+  {
+    assert(new_capacity>=size());
+    headert *new_store=static_cast<headert *>(
+      ::operator new(sizeof(headert)+new_capacity*sizeof(value_type)));
+    new_store->size=size();
+    new_store->capacity=new_capacity;
+
+    if(store!=nullptr)
+    {
+      std::memcpy(
+        static_cast<void *>(new_store+1),
+        static_cast<const void *>(store+1),
+        store->size*sizeof(value_type));
+      ::operator delete(store);
+    }
+
+    store=new_store;
+  }
+
+  template<typename... argst>
+  static valueT *new_value(argst &&... args)
+  {
+    allocatort allocator;
+    valueT *value=allocator.allocate(1);
+    new (value) valueT(std::forward<argst>(args)...);
+    return value;
+  }
+
+  static void delete_value(valueT *value)
+  {
+    allocatort allocator;
+    value->~valueT();
+    allocator.deallocate(value, 1);
+  }
+};
+
+#endif
@@ -0,0 +1,469 @@
+/*******************************************************************\
+
+Module: Vector with Inline Storage for a Few Elements
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_SMALL_VECTOR_H
+#define CPROVER_UTIL_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*******************************************************************\
+
+   Class: small_vectort
+
+ Purpose: A vector that keeps up to N elements inside the object
+          itself, and only allocates when it grows beyond that.
+          The elements have to be the size of a pointer, such as
+          irept and the classes derived from it, which allows
+          declaring a small_vectort<irept> inside irept itself.
+          As with std::vector, adding and removing elements moves
+          the others.
+
+\*******************************************************************/
+
+template<typename T, std::size_t N>
+class small_vectort
+{
+public:
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T *iterator;
+  typedef const T *const_iterator;
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  small_vectort():_size(0), _capacity(N)
+  {
+  }
+
+  explicit small_vectort(size_type n):_size(0), _capacity(N)
+  {
+    resize(n);
+  }
+
+  small_vectort(size_type n, const T &value):_size(0), _capacity(N)
+  {
+    resize(n, value);
+  }
+
+  template<
+    typename iteratort,
+    typename=typename std::enable_if<!std::is_integral<iteratort>::value>::type>
+  small_vectort(iteratort first, iteratort last):_size(0), _capacity(N)
+  {
+    assign(first, last);
+  }
+
+  small_vectort(std::initializer_list<T> list):_size(0), _capacity(N)
+  {
+    assign(list.begin(), list.end());
+  }
+
+  small_vectort(const small_vectort &other):_size(0), _capacity(N)
+  {
+    copy_from(other);
+  }
+
+  small_vectort(small_vectort &&other):_size(0), _capacity(N)
+  {
+    take(other);
+  }
+
+  ~small_vectort()
+  {
+    clear();
+    release();
+  }
+
+  small_vectort &operator=(const small_vectort &other)
+  {
+    if(this!=&other)
+    {
+      clear();
+      copy_from(other);
+    }
+    return *this;
+  }
+
+  small_vectort &operator=(small_vectort &&other)
+  {
+    if(this!=&other)
+    {
+      clear();
+      release();
+      take(other);
+    }
+    return *this;
+  }
+
+  small_vectort &operator=(std::initializer_list<T> list)
+  {
+    assign(list.begin(), list.end());
+    return *this;
+  }
+
+  // access
+
+  T *data() { return is_inline()?inline_elements():heap; }
+  const T *data() const { return is_inline()?inline_elements():heap; }
+
+  iterator begin() { return data(); }
+  iterator end() { return data()+_size; }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data()+_size; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rbegin() const
+  { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const
+  { return const_reverse_iterator(begin()); }
+
+  size_type size() const { return _size; }
+  bool empty() const { return _size==0; }
+  size_type capacity() const { return _capacity; }
+  size_type max_size() const { return UINT32_MAX; }
+
+  T &operator[](size_type i) { return data()[i]; }
+  const T &operator[](size_type i) const { return data()[i]; }
+
+  T &at(size_type i) { assert(i<_size); return data()[i]; }
+  const T &at(size_type i) const { assert(i<_size); return data()[i]; }
+
+  T &front() { return data()[0]; }
+  const T &front() const { return data()[0]; }
+  T &back() { return data()[_size-1]; }
+  const T &back() const { return data()[_size-1]; }
+
+  // modifying
+
+  void reserve(size_type n)
+  {
+    if(n>_capacity)
+      reallocate(n);
+  }
+
+  void shrink_to_fit()
+  {
+  }
+
+  void clear()
+  {
+    T *d=data();
+    for(size_type i=0; i<_size; i++)
+      d[i].~T();
+    _size=0;
+  }
+
+  void resize(size_type n)
+  {
+    while(_size>n)
+      pop_back();
+    reserve(n);
+    while(_size<n)
+      emplace_back();
+  }
+
+  void resize(size_type n, const T &value)
+  {
+    while(_size>n)
+      pop_back();
+    if(_size<n)
+      insert(end(), n-_size, value);
+  }
+
+  void push_back(const T &value)
+  {
+    emplace_back(value);
+  }
+
+  void push_back(T &&value)
+  {
+    emplace_back(std::move(value));
+  }
+
+  template<typename... argst>
+  void emplace_back(argst &&... args)
+  {
+    if(_size==_capacity)
+    {
+      // the argument may be one of the elements
+      T tmp(std::forward<argst>(args)...);
+      grow(_size+1);
+      new (data()+_size) T(std::move(tmp));
+    }
+    else
+      new (data()+_size) T(std::forward<argst>(args)...);
+    _size++;
+  }
+
+  void pop_back()
+  {
+    _size--;
+    data()[_size].~T();
+  }
+
+  iterator insert(const_iterator pos, const T &value)
+  {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, T &&value)
+  {
+    return emplace(pos, std::move(value));
+  }
+
+  iterator insert(const_iterator pos, size_type n, const T &value)
+  {
+    size_type offset=pos-begin();
+    // the value may be one of the elements
+    T tmp(value);
+    make_gap(offset, n);
+    T *d=data();
+    for(size_type i=0; i<n; i++)
+      new (d+offset+i) T(tmp);
+    return d+offset;
+  }
+
+  template<
+    typename iteratort,
+    typename=typename std::enable_if<!std::is_integral<iteratort>::value>::type>
+  iterator insert(const_iterator pos, iteratort first, iteratort last)
+  {
+    size_type offset=pos-begin();
+    // the range may be part of this vector
+    small_vectort tmp;
+    for(; first!=last; ++first)
+      tmp.emplace_back(*first);
+    make_gap(offset, tmp.size());
+    T *d=data();
+    for(size_type i=0; i<tmp.size(); i++)
+      new (d+offset+i) T(std::move(tmp[i]));
+    return d+offset;
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<T> list)
+  {
+    return insert(pos, list.begin(), list.end());
+  }
+
+  template<typename... argst>
+  iterator emplace(const_iterator pos, argst &&... args)
+  {
+    size_type offset=pos-begin();
+    T tmp(std::forward<argst>(args)...);
+    make_gap(offset, 1);
+    T *d=data();
+    new (d+offset) T(std::move(tmp));
+    return d+offset;
+  }
+
+  iterator erase(const_iterator pos)
+  {
+    return erase(pos, pos+1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last)
+  {
+    T *d=data();
+    size_type from=first-d, to=last-d;
+    if(from==to)
+      return d+from;
+    std::move(d+to, d+_size, d+from);
+    for(size_type i=_size-(to-from); i<_size; i++)
+      d[i].~T();
+    _size-=to-from;
+    return d+from;
+  }
+
+  template<
+    typename iteratort,
+    typename=typename std::enable_if<!std::is_integral<iteratort>::value>::type>
+  void assign(iteratort first, iteratort last)
+  {
+    small_vectort tmp;
+    for(; first!=last; ++first)
+      tmp.emplace_back(*first);
+    clear();
+    reserve(tmp.size());
+    T *d=data();
+    for(size_type i=0; i<tmp.size(); i++)
+      new (d+i) T(std::move(tmp[i]));
+    _size=tmp.size();
+  }
+
+  void assign(size_type n, const T &value)
+  {
+    T tmp(value);
+    clear();
+    insert(end(), n, tmp);
+  }
+
+  void swap(small_vectort &other)
+  {
+    if(!is_inline() && !other.is_inline())
+    {
+      std::swap(heap, other.heap);
+      std::swap(_size, other._size);
+      std::swap(_capacity, other._capacity);
+      return;
+    }
+
+    small_vectort tmp(std::move(other));
+    other=std::move(*this);
+    *this=std::move(tmp);
+  }
+
+  friend void swap(small_vectort &a, small_vectort &b)
+  {
+    a.swap(b);
+  }
+
+  // comparison
+
+  bool operator==(const small_vectort &other) const
+  {
+    return _size==other._size &&
+           std::equal(begin(), end(), other.begin());
+  }
+
+  bool operator!=(const small_vectort &other) const
+  {
+    return !(*this==other);
+  }
+
+  bool operator<(const small_vectort &other) const
+  {
+    return std::lexicographical_compare(
+      begin(), end(), other.begin(), other.end());
+  }
+
+protected:
+  std::uint32_t _size, _capacity;
+
+  // the elements are inline while the capacity is N
+  union
+  {
+    T *heap;
+    void *storage[N];
+  };
+
+  bool is_inline() const { return _capacity==N; }
+
+  T *inline_elements()
+  {
+    static_assert(
+      sizeof(T)==sizeof(void *) && alignof(T)<=alignof(void *),
+      "small_vectort is for elements the size of a pointer");
+    return reinterpret_cast<T *>(storage);
+  }
+
+  const T *inline_elements() const
+  {
+    return const_cast<small_vectort *>(this)->inline_elements();
+  }
+
+  // moves the elements to a heap block of the given capacity
+  void reallocate(size_type new_capacity)
+  {
+    assert(new_capacity>N && new_capacity>=_size);
+    T *new_elements=
+      static_cast<T *>(::operator new(new_capacity*sizeof(T)));
+    T *d=data();
+    for(size_type i=0; i<_size; i++)
+    {
+      new (new_elements+i) T(std::move(d[i]));
+      d[i].~T();
+    }
+    release();
+    heap=new_elements;
+    _capacity=new_capacity;
+  }
+
+  void grow(size_type min_capacity)
+  {
+    if(min_capacity>_capacity)
+      reallocate(std::max<size_type>(min_capacity, 2*_capacity));
+  }
+
+  // frees the heap block, if any; the elements have to be gone
+  void release()
+  {
+    if(!is_inline())
+    {
+      ::operator delete(heap);
+      _capacity=N;
+    }
+  }
+
+  // takes the elements of a vector, which is left empty
+  void take(small_vectort &other)
+  {
+    if(other.is_inline())
+    {
+      T *d=inline_elements(), *o=other.inline_elements();
+      for(size_type i=0; i<other._size; i++)
+      {
+        new (d+i) T(std::move(o[i]));
+        o[i].~T();
+      }
+      _size=other._size;
+    }
+    else
+    {
+      heap=other.heap;
+      _size=other._size;
+      _capacity=other._capacity;
+      other._capacity=N;
+    }
+    other._size=0;
+  }
+
+  // copies the elements of another vector into this empty one
+  void copy_from(const small_vectort &other)
+  {
+    reserve(other._size);
+    T *d=data();
+    const T *o=other.data();
+    for(size_type i=0; i<other._size; i++)
+      new (d+i) T(o[i]);
+    _size=other._size;
+  }
+
+  // opens a gap of n uninitialised elements at the given offset
+  void make_gap(size_type offset, size_type n)
+  {
+    if(n==0)
+      return;
+    grow(_size+n);
+    T *d=data();
+    // move the tail backwards, starting at the end
+    for(size_type i=_size; i>offset; i--)
+    {
+      new (d+i-1+n) T(std::move(d[i-1]));
+      d[i-1].~T();
+    }
+    _size+=n;
+  }
+};
+
+#endif
@@ -32,7 +32,12 @@ Function: constant_exprt::value_is_zero_string
 
 bool constant_exprt::value_is_zero_string() const
 {
-  const std::string val=id2string(get_value());
+  unsigned no=get_value().get_no();
+
+  if(string_containert::is_binary(no))
+    return string_containert::binary_value(no)==0;
+
+  const std::string &val=id2string(get_value());
   return val.find_first_not_of('0')==std::string::npos;
 }
 
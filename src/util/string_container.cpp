@@ -6,7 +6,9 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <cassert>
 #include <cstring>
+#include <ostream>
 
 #include "string_container.h"
 
@@ -61,13 +63,33 @@ Function: string_containert::string_containert
 
 void initialize_string_container();
 
-string_containert::string_containert()
+string_containert::string_containert():
+  use_binary(false),
+  bytes(0),
+  lookups(0),
+  hits(0)
 {
+  #ifdef THREAD_SAFE_IREP
+  string_chunks.resize(max_chunks, NULL);
+  #endif
+
   // pre-allocate empty string -- this gets index 0
   get("");
 
   // allocate strings
   initialize_string_container();
+
+  // The predefined strings keep their numbers, which means that
+  // the bit-vector values among them, such as "0", are found by
+  // their would-be number.
+  use_binary=true;
+
+  for(const auto &entry : hash_table)
+  {
+    unsigned no;
+    if(encode_binary(entry.first, no))
+      binary_in_table[no]=entry.second;
+  }
 }
 
 /*******************************************************************\
@@ -84,6 +106,43 @@ Function: string_containert::~string_containert
 
 string_containert::~string_containert()
 {
+  #ifdef THREAD_SAFE_IREP
+  for(string_chunkst::iterator
+      it=string_chunks.begin();
+      it!=string_chunks.end();
+      it++)
+    delete[] *it;
+  #endif
+}
+
+/*******************************************************************\
+
+Function: string_containert::add_to_vector
+
+  Inputs: pointer to a stable string, and its number
+
+ Outputs:
+
+ Purpose: make the string retrievable by number
+
+\*******************************************************************/
+
+void string_containert::add_to_vector(std::string *s, size_t no)
+{
+  assert(!is_binary(no));
+
+  #ifdef THREAD_SAFE_IREP
+  size_t chunk=no>>chunk_bits;
+  assert(chunk<max_chunks);
+
+  if(string_chunks[chunk]==NULL)
+    string_chunks[chunk]=new std::string *[chunk_mask+1];
+
+  string_chunks[chunk][no&chunk_mask]=s;
+  #else
+  assert(no==string_vector.size());
+  string_vector.push_back(s);
+  #endif
 }
 
 /*******************************************************************\
@@ -102,21 +161,34 @@ unsigned string_containert::get(const char *s)
 {
   string_ptrt string_ptr(s);
 
+  unsigned binary_no;
+  if(encode_binary(string_ptr, binary_no))
+    return binary_no;
+
+  #ifdef THREAD_SAFE_IREP
+  std::lock_guard<std::mutex> lock(mutex);
+  #endif
+
+  ++lookups;
+
   hash_tablet::iterator it=hash_table.find(string_ptr);
 
   if(it!=hash_table.end())
+  {
+    ++hits;
     return it->second;
+  }
 
   size_t r=hash_table.size();
 
   // these are stable
   string_list.push_back(std::string(s));
   string_ptrt result(string_list.back());
+  bytes+=result.len;
 
   hash_table[result]=r;
 
-  // these are not
-  string_vector.push_back(&string_list.back());
+  add_to_vector(&string_list.back(), r);
 
   return r;
 }
@@ -137,21 +209,257 @@ unsigned string_containert::get(const std::string &s)
 {
   string_ptrt string_ptr(s);
 
+  unsigned binary_no;
+  if(encode_binary(string_ptr, binary_no))
+    return binary_no;
+
+  #ifdef THREAD_SAFE_IREP
+  std::lock_guard<std::mutex> lock(mutex);
+  #endif
+
+  ++lookups;
+
   hash_tablet::iterator it=hash_table.find(string_ptr);
 
   if(it!=hash_table.end())
+  {
+    ++hits;
     return it->second;
+  }
 
   size_t r=hash_table.size();
 
   // these are stable
   string_list.push_back(s);
   string_ptrt result(string_list.back());
+  bytes+=result.len;
 
   hash_table[result]=r;
 
-  // these are not
-  string_vector.push_back(&string_list.back());
+  add_to_vector(&string_list.back(), r);
 
   return r;
 }
+
+/*******************************************************************\
+
+Function: string_containert::encode_binary
+
+  Inputs: a string
+
+ Outputs: true if the string is held in its number, which
+          is then returned in the second argument
+
+ Purpose:
+
+\*******************************************************************/
+
+bool string_containert::encode_binary(
+  const string_ptrt &string_ptr,
+  unsigned &no) const
+{
+  if(string_ptr.len==0 || string_ptr.len>64)
+    return false;
+
+  unsigned long long value=0;
+
+  for(size_t i=0; i<string_ptr.len; i++)
+  {
+    value<<=1;
+
+    if(string_ptr.s[i]=='1')
+      value|=1;
+    else if(string_ptr.s[i]!='0')
+      return false;
+  }
+
+  return encode_binary(value, string_ptr.len, no);
+}
+
+/*******************************************************************\
+
+Function: string_containert::encode_binary
+
+  Inputs: the bits of a value, zero-extended, and its width
+
+ Outputs: true if the string of '0' and '1' with the value is
+          held in its number, which is then returned in the
+          third argument
+
+ Purpose:
+
+\*******************************************************************/
+
+bool string_containert::encode_binary(
+  unsigned long long value,
+  size_t width,
+  unsigned &no) const
+{
+  if(!use_binary)
+    return false;
+
+  // beyond the bits held in the number, the value
+  // has to repeat the last of them
+  if(width>binary_value_bits)
+  {
+    unsigned long long upper=value>>(binary_value_bits-1);
+    unsigned long long ones=
+      (~0ull>>(64-width))>>(binary_value_bits-1);
+
+    if(upper!=0 && upper!=ones)
+      return false;
+  }
+
+  no=binary_flag|
+     unsigned((width-1)<<binary_value_bits)|
+     unsigned(value&((1u<<binary_value_bits)-1));
+
+  binary_in_tablet::const_iterator it=binary_in_table.find(no);
+  if(it!=binary_in_table.end())
+    no=it->second;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: string_containert::get_binary
+
+  Inputs: the bits of a value, and its width, at most 64
+
+ Outputs: the number of the string of '0' and '1' with the value
+
+ Purpose: avoids the string if it is held in its number
+
+\*******************************************************************/
+
+unsigned string_containert::get_binary(
+  unsigned long long value,
+  size_t width)
+{
+  assert(width>=1 && width<=64);
+
+  if(width<64)
+    value&=(1ull<<width)-1;
+
+  unsigned no;
+  if(encode_binary(value, width, no))
+    return no;
+
+  std::string s(width, '0');
+
+  for(size_t i=0; i<width; i++)
+    if((value>>i)&1)
+      s[width-i-1]='1';
+
+  return get(s);
+}
+
+/*******************************************************************\
+
+Function: string_containert::binary_value
+
+  Inputs: the number of a string held in its number
+
+ Outputs: the bits of the value, zero-extended
+
+ Purpose:
+
+\*******************************************************************/
+
+unsigned long long string_containert::binary_value(size_t no)
+{
+  assert(is_binary(no));
+
+  size_t width=binary_width(no);
+  unsigned long long value=no&((1u<<binary_value_bits)-1);
+
+  if(width>binary_value_bits && (value>>(binary_value_bits-1))&1)
+    value|=(~0ull>>(64-width))&(~0ull<<binary_value_bits);
+
+  return value;
+}
+
+/*******************************************************************\
+
+Function: string_containert::get_binary_string
+
+  Inputs: the number of a string held in its number
+
+ Outputs: the string
+
+ Purpose: the string is only stored once it is asked for, which
+          is mainly for output
+
+\*******************************************************************/
+
+const std::string &string_containert::get_binary_string(size_t no) const
+{
+  #ifdef THREAD_SAFE_IREP
+  std::lock_guard<std::mutex> lock(mutex);
+  #endif
+
+  binary_stringst::const_iterator it=binary_strings.find(no);
+
+  if(it!=binary_strings.end())
+    return it->second;
+
+  size_t width=binary_width(no);
+  std::string &result=binary_strings[no];
+  result.resize(width);
+
+  for(size_t i=0; i<width; i++)
+    result[width-i-1]=binary_bit(no, i)?'1':'0';
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: string_containert::get_statistics
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+string_containert::statisticst string_containert::get_statistics()
+{
+  #ifdef THREAD_SAFE_IREP
+  std::lock_guard<std::mutex> lock(mutex);
+  #endif
+
+  statisticst result;
+  result.strings=hash_table.size();
+  result.bytes=bytes;
+  result.lookups=lookups;
+  result.hits=hits;
+  return result;
+}
+
+/*******************************************************************\
+
+Function: operator<<
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::ostream &operator<<(
+  std::ostream &out,
+  const string_containert::statisticst &statistics)
+{
+  out << statistics.strings << " strings, "
+      << statistics.bytes << " bytes, "
+      << statistics.lookups << " lookups, "
+      << statistics.hits << " hits";
+
+  return out;
+}
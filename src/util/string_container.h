@@ -9,9 +9,14 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef STRING_CONTAINER_H
 #define STRING_CONTAINER_H
 
+#include <iosfwd>
 #include <list>
 #include <vector>
 
+#ifdef THREAD_SAFE_IREP
+#include <mutex>
+#endif
+
 #include "hash_cont.h"
 #include "string_hash.h"
 
@@ -62,15 +67,64 @@ public:
   // the pointer is guaranteed to be stable
   inline const char *c_str(size_t no) const
   {
-    return string_vector[no]->c_str();
+    return get_string(no).c_str();
   }
 
   // the reference is guaranteed to be stable
   inline const std::string &get_string(size_t no) const
   {
+    if(is_binary(no))
+      return get_binary_string(no);
+
+    #ifdef THREAD_SAFE_IREP
+    return *string_chunks[no>>chunk_bits][no&chunk_mask];
+    #else
     return *string_vector[no];
+    #endif
+  }
+
+  struct statisticst
+  {
+    size_t strings, bytes;
+    unsigned long long lookups, hits;
+
+    statisticst():strings(0), bytes(0), lookups(0), hits(0)
+    {
+    }
+  };
+
+  statisticst get_statistics();
+
+  // Bit-vector values, i.e., strings of '0' and '1' such as the
+  // values of constants, are not kept in the table when they have
+  // at most 25 characters, or are the sign extension of the last
+  // 25 characters of a string of up to 64. The number then holds
+  // the width and the bits instead.
+  static const unsigned binary_flag=1u<<31;
+  static const unsigned binary_value_bits=25;
+
+  static bool is_binary(size_t no)
+  {
+    return (no&binary_flag)!=0;
+  }
+
+  static size_t binary_width(size_t no)
+  {
+    return ((no>>binary_value_bits)&63)+1;
   }
 
+  // bit i of the value, counting from the least significant one
+  static bool binary_bit(size_t no, size_t i)
+  {
+    return (no>>(i<binary_value_bits?i:binary_value_bits-1))&1;
+  }
+
+  static unsigned long long binary_value(size_t no);
+
+  // the number of the string of the given width with
+  // the given bits, which is only added if it is long
+  unsigned get_binary(unsigned long long value, size_t width);
+
 protected:
   // the 'unsigned' ought to be size_t
   typedef hash_map_cont<string_ptrt, unsigned, string_ptr_hash> hash_tablet;
@@ -79,14 +133,55 @@ protected:
   unsigned get(const char *s);
   unsigned get(const std::string &s);
 
+  void add_to_vector(std::string *s, size_t no);
+
+  // the strings that are held in their number, once asked for
+  typedef hash_map_cont<unsigned, std::string> binary_stringst;
+  mutable binary_stringst binary_strings;
+
+  // the strings in the table that would be held in their number
+  typedef hash_map_cont<unsigned, unsigned> binary_in_tablet;
+  binary_in_tablet binary_in_table;
+  bool use_binary;
+
+  bool encode_binary(const string_ptrt &, unsigned &no) const;
+  bool encode_binary(
+    unsigned long long value,
+    size_t width,
+    unsigned &no) const;
+  const std::string &get_binary_string(size_t no) const;
+
   typedef std::list<std::string> string_listt;
   string_listt string_list;
 
+  size_t bytes;
+  unsigned long long lookups, hits;
+
+  #ifdef THREAD_SAFE_IREP
+  // Lookups by number do not take the lock. The strings are therefore
+  // kept in fixed-size chunks whose addresses never change once
+  // published; the chunk table itself is allocated up-front.
+  static const unsigned chunk_bits=16;
+  static const size_t chunk_mask=(size_t(1)<<chunk_bits)-1;
+  static const size_t max_chunks=size_t(1)<<16;
+
+  typedef std::vector<std::string **> string_chunkst;
+  string_chunkst string_chunks;
+
+  // protects hash_table, string_list, binary_strings
+  // and adding chunks
+  mutable std::mutex mutex;
+  #else
   typedef std::vector<std::string *> string_vectort;
   string_vectort string_vector;
+  #endif
 };
 
 // an ugly global object
 extern string_containert string_container;
 
+std::ostream &operator<<(
+  std::ostream &,
+  const string_containert::statisticst &);
+
 #endif
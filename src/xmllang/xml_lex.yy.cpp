@@ -0,0 +1,358 @@
+/* generated by minflex from scanner.l */
+#define yylex yyxmllex
+#define yytext yyxmltext
+#define yyleng yyxmlleng
+#define yyin yyxmlin
+#define yyout yyxmlout
+#define yywrap yyxmlwrap
+#define yyrestart yyxmlrestart
+#define yylineno yyxmllineno
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#define YY_NULL 0
+#define INITIAL 0
+#define CONTENT 1
+#define PI 2
+#define DTD 3
+extern char *yytext;
+extern int yyleng;
+extern FILE *yyin, *yyout;
+static int yy_start=0;
+#define BEGIN yy_start=
+#define YY_START yy_start
+#define YYSTATE YY_START
+static void yy_flush_buffer_();
+#define YY_FLUSH_BUFFER yy_flush_buffer_()
+static void yy_less_(int n);
+#define yyless(n) yy_less_(n)
+#define ECHO do { if(fwrite(yytext, (size_t)yyleng, 1, yyout)) {} } while(0)
+#define yyterminate() return YY_NULL
+#define YY_BREAK break;
+int yywrap();
+#line 1 "scanner.l"
+#ifdef _WIN32
+#define YY_NO_UNISTD_H
+static int isatty(int) { return 0; }
+#endif
+
+#include <cctype>
+#include <cstring>
+#include <cstdlib>
+
+#include "xml_parser.h"
+#include "xml_y.tab.h"
+
+#define PARSER xml_parser
+
+//static int keep;  /* To store start condition */
+
+static char *word(char *s)
+{
+  char *buf;
+  int i, k;
+  for (k = 0; isspace(s[k]) || s[k] == '<'; k++) ;
+  for (i = k; s[i] && ! isspace(s[i]); i++) ;
+  buf = (char *)malloc((i - k + 1) * sizeof(char));
+  strncpy(buf, &s[k], i - k);
+  buf[i - k] = '\0';
+  return buf;
+}
+
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) \
+  do { result=(int)fread(buf, 1, max_size, yyin); } while(0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+char *yytext;
+int yyleng;
+FILE *yyin, *yyout;
+static const unsigned short yy_ec[256]={0,0,0,0,0,0,0,0,0,1,2,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,5,6,0,0,7,8,0,0,0,0,0,9,10,11,12,12,12,12,12,12,12,12,12,12,10,13,14,15,16,17,0,18,18,19,20,21,18,22,22,22,22,22,22,22,22,23,24,22,22,22,25,22,22,22,22,26,22,0,0,27,0,28,0,18,18,18,18,18,18,22,22,22,22,22,29,30,22,22,22,22,22,22,22,22,22,22,31,22,22,0,0,0,0,0,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28};
+static const int yy_nxt[118][32]={
+{11,5,6,4,11,12,11,11,13,11,11,7,11,11,10,8,9,14,15,15,15,15,15,15,15,15,15,11,15,15,15,15},
+{19,19,17,16,19,19,19,20,19,19,19,19,19,19,18,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+{11,5,22,21,11,12,11,11,13,11,11,11,11,11,18,8,11,14,15,15,15,15,15,15,15,15,15,11,15,15,15,15},
+{24,24,27,23,24,24,24,24,24,24,24,24,24,24,25,24,24,24,24,24,24,24,24,24,24,24,24,26,24,24,24,24},
+{-1,29,28,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,31,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,36,36,36,33,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,34,35,35,35,35,35,35,35,35,35,-1,35,35,35,35},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{40,40,40,40,40,39,40,38,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40},
+{43,43,43,43,43,43,43,41,42,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,44,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,45,45,-1,45,-1,-1,-1,-1,-1,45,45,45,45,45,45,45,45,45,-1,45,45,45,45},
+{49,49,46,49,49,49,49,48,49,49,49,49,49,49,47,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{51,51,51,51,51,51,51,50,51,51,51,51,51,51,47,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51},
+{-1,36,36,36,52,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,34,35,35,35,35,35,35,35,35,35,-1,35,35,35,35},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,-1,-1,-1,-1,55,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,54,54,54,54,54,54,54,54,54,-1,-1,54,54,54},
+{-1,29,56,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,57,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,36,36,36,52,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,34,35,35,35,35,35,35,35,35,35,-1,35,35,35,35},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,58,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,36,36,36,33,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,34,35,35,35,35,35,35,35,35,35,-1,35,35,35,35},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,59,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,61,61,61,-1,-1,-1,-1,-1,60,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,62,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,63},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,64,64,-1,64,-1,-1,-1,-1,-1,64,64,64,64,64,64,64,64,64,-1,64,64,64,64},
+{-1,36,36,36,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,-1,35,35,35,35,35,35,35,35,35,-1,35,35,35,35},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,65,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,66,66,66,66,66,66,66,66,66,-1,-1,66,66,66},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{40,40,40,40,40,39,40,38,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40},
+{-1,-1,-1,-1,-1,-1,67,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,68,68,68,68,68,68,68,68,68,-1,-1,68,68,68},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{43,43,43,43,43,43,43,41,42,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43},
+{-1,-1,70,69,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,45,45,-1,45,-1,-1,-1,-1,-1,45,45,45,45,45,45,45,45,45,-1,45,45,45,45},
+{51,51,51,51,51,51,51,50,51,51,51,51,51,51,47,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51},
+{-1,36,36,36,52,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,34,35,35,35,35,35,35,35,35,35,-1,35,35,35,35},
+{-1,-1,-1,-1,-1,-1,55,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,54,54,54,54,54,54,54,54,54,-1,-1,54,54,54},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,-1,-1,-1,-1,72,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,71,71,71,71,71,71,71,71,71,-1,-1,71,71,71},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,60,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{51,51,51,51,51,51,51,50,51,51,51,51,51,51,-1,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,73,-1,-1,-1,-1,54,54,54,54,54,54,54,54,54,-1,-1,54,54,54},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,75,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,74},
+{-1,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,77,76,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,61,61,61,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,62,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,79,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,80,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,64,64,-1,64,-1,-1,-1,-1,-1,64,64,64,64,64,64,64,64,64,-1,64,64,64,64},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,82,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,81},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,83,-1,-1,-1,-1,66,66,66,66,66,66,66,66,66,-1,-1,66,66,66},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,84},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,86,-1,-1,-1,-1,68,68,68,68,68,68,68,68,68,-1,-1,68,68,68},
+{-1,-1,87,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,88,-1,-1,-1,-1,71,71,71,71,71,71,71,71,71,-1,-1,71,71,71},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,89},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,91,-1,-1,-1,-1,-1,91,91,91,91,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,75,92,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,93,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{94,94,94,94,94,94,94,94,94,95,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,96,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,97,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,98,-1,-1,-1,-1,-1,98,98,98,98,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,82,99,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{40,40,40,40,40,39,40,38,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,100,-1,-1,-1,-1,-1,100,100,100,100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,85,101,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{43,43,43,43,43,43,43,41,42,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,102,-1,-1,-1,-1,-1,102,102,102,102,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,90,103,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,91,104,-1,-1,-1,-1,91,91,91,91,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{94,94,94,94,94,94,94,94,94,95,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94},
+{106,106,106,106,106,106,106,106,106,105,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,107,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,98,108,-1,-1,-1,-1,98,98,98,98,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{40,40,40,40,40,39,40,38,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,100,109,-1,-1,-1,-1,100,100,100,100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{43,43,43,43,43,43,43,41,42,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,102,110,-1,-1,-1,-1,102,102,102,102,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,111,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{94,94,94,94,94,94,94,94,94,95,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,112,-1,-1,-1,-1,-1},
+{40,40,40,40,40,39,40,38,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40},
+{43,43,43,43,43,43,43,41,42,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43},
+{49,49,53,49,49,49,49,48,49,49,49,49,49,49,-1,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+{-1,-1,114,113,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,115,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,117,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+};
+static const int yy_accept[118]={-1,-1,-1,-1,0,0,0,1,2,3,16,16,16,16,16,4,12,17,16,12,16,0,0,14,14,14,14,17,0,0,-1,3,3,-1,10,7,-1,8,-1,5,-1,-1,5,-1,6,4,17,-1,-1,12,-1,12,-1,-1,-1,-1,0,17,15,3,-1,-1,-1,-1,7,-1,-1,-1,-1,6,6,-1,-1,12,-1,-1,15,15,-1,-1,-1,-1,-1,-1,-1,-1,-1,6,12,-1,-1,-1,12,15,-1,-1,-1,9,-1,-1,-1,-1,-1,12,12,-1,-1,-1,-1,-1,12,11,-1,11,11,-1,11,13};
+static const unsigned char yy_live[118]={1,1,1,1,1,1,1,0,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,1,1,1,1,1,0,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,0,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,0};
+static const int yy_sc_start[4]={0,1,2,3};
+
+static std::vector<char> yy_buf(16384);
+static size_t yy_pos=0, yy_end=0; // unconsumed text is [yy_pos, yy_end)
+static char yy_hold=0;
+static bool yy_held=false;
+static std::vector<int> yy_state_stack;
+
+static void yy_unhold()
+{
+  if(yy_held) { yy_buf[yy_pos]=yy_hold; yy_held=false; }
+}
+
+static void yy_flush_buffer_()
+{
+  yy_unhold();
+  yy_pos=yy_end=0;
+}
+
+static void yy_less_(int n)
+{
+  size_t start=yytext-yy_buf.data();
+  yy_unhold();
+  yy_pos=start+n;
+  yy_hold=yy_buf[yy_pos];
+  yy_held=true;
+  yy_buf[yy_pos]=0;
+  yyleng=n;
+}
+
+// read more input; returns false at end of input
+static bool yy_fill()
+{
+  if(yy_pos>0)
+  {
+    std::memmove(yy_buf.data(), yy_buf.data()+yy_pos, yy_end-yy_pos);
+    yy_end-=yy_pos;
+    yy_pos=0;
+  }
+  if(yy_buf.size()-yy_end<8194)
+    yy_buf.resize(yy_buf.size()*2+8194);
+  if(yyin==nullptr) yyin=stdin;
+  int result;
+  char *buf=yy_buf.data()+yy_end;
+  YY_INPUT(buf, result, 8192);
+  if(result<=0)
+    return false;
+  yy_end+=result;
+  return true;
+}
+
+int yylex()
+{
+  if(yyout==nullptr) yyout=stdout;
+  for(;;)
+  {
+    yy_unhold();
+    int state=yy_sc_start[yy_start];
+    size_t cp=yy_pos, last_pos=0;
+    int rule=-1;
+    for(;;)
+    {
+      if(cp==yy_end)
+      {
+        if(!yy_live[state]) break;
+        size_t off=yy_pos;
+        if(!yy_fill()) break;
+        cp-=off; last_pos-=off;
+      }
+      int n=yy_nxt[state][yy_ec[(unsigned char)yy_buf[cp]]];
+      if(n<0) break;
+      state=n; cp++;
+      if(yy_accept[state]>=0) { rule=yy_accept[state]; last_pos=cp; }
+    }
+    if(rule<0)
+    {
+      if(yy_pos==yy_end)
+      {
+        if(yywrap())
+        {
+          yytext=yy_buf.data()+yy_pos; yyleng=0;
+          switch(yy_start)
+          {
+          default:
+            yyterminate();
+          }
+          return YY_NULL;
+        }
+        continue;
+      }
+      // default rule
+      last_pos=yy_pos+1;
+    }
+    yytext=yy_buf.data()+yy_pos;
+    yyleng=(int)(last_pos-yy_pos);
+    yy_pos=last_pos;
+    yy_hold=yy_buf[yy_pos]; yy_held=true; yy_buf[yy_pos]=0;
+    YY_USER_ACTION
+    switch(rule)
+    {
+    case 0:
+{/* skip */}
+    YY_BREAK
+    case 1:
+{return SLASH;}
+    YY_BREAK
+    case 2:
+{return EQ;}
+    YY_BREAK
+    case 3:
+{BEGIN(CONTENT); return CLOSE;}
+    YY_BREAK
+    case 4:
+{yyxmllval.s=strdup(yytext); return NAME;}
+    YY_BREAK
+    case 5:
+{yyxmllval.s=strdup(yytext); return VALUE;}
+    YY_BREAK
+    case 6:
+{BEGIN(INITIAL); return ENDPI;}
+    YY_BREAK
+    case 7:
+{BEGIN(INITIAL); yyxmllval.s=word(yytext); return START;}
+    YY_BREAK
+    case 8:
+{BEGIN(INITIAL); return END;}
+    YY_BREAK
+    case 9:
+{BEGIN(INITIAL); return STARTXMLDECL;}
+    YY_BREAK
+    case 10:
+{BEGIN(PI); yyxmllval.s=word(yytext); return STARTPI;}
+    YY_BREAK
+    case 11:
+{yyxmllval.s=strdup(yytext); return COMMENT;}
+    YY_BREAK
+    case 12:
+{yyxmllval.s=strdup(yytext); return DATA;}
+    YY_BREAK
+    case 13:
+{BEGIN(DTD); /* skip */}
+    YY_BREAK
+    case 14:
+{/* skip */}
+    YY_BREAK
+    case 15:
+{BEGIN(INITIAL); /* skip */}
+    YY_BREAK
+    case 16:
+{ yyxmlerror("unexpected character"); }
+    YY_BREAK
+    case 17:
+{/* skip, must be an extra one at EOF */;}
+    YY_BREAK
+    default:
+      ECHO;
+    }
+  }
+}
+void yyrestart(FILE *f) { yyin=f; yy_flush_buffer_(); }
+
+int yywrap() { return 1; }
+
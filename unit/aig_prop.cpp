@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <util/i2string.h>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/prop/aig_prop.h>
+
+// Checks aig_prop_solvert, which encodes the AIG lazily in the
+// polarities needed, inlines single-use conjunctions, and finds ITE
+// and majority gates, against a reference evaluation of small
+// circuits: XORs, ITEs, carries and a two-bit adder. For each
+// assignment of the inputs, each output has to be satisfiable with
+// its reference value and unsatisfiable with the other one. The
+// circuits are then extended, with a constraint as well, and solved
+// again with the same solver.
+
+unsigned failures=0;
+
+void check(bool condition, const std::string &what)
+{
+  if(!condition)
+  {
+    std::cout << "FAILED: " << what << "\n";
+    failures++;
+  }
+}
+
+// makes the protected parts visible to the test
+class aig_prop_testt:public aig_prop_solvert
+{
+public:
+  explicit aig_prop_testt(propt &_solver):aig_prop_solvert(_solver)
+  {
+  }
+
+  using aig_prop_solvert::ite_gates;
+  using aig_prop_solvert::majority_gates;
+  using aig_prop_solvert::usage_count;
+  using aig_prop_solvert::get_body;
+};
+
+struct outputt
+{
+  std::string name;
+  literalt l;
+  // the value for the inputs given as bits
+  bool (*reference)(unsigned inputs);
+};
+
+typedef std::vector<outputt> outputst;
+
+bool bit(unsigned inputs, unsigned i)
+{
+  return (inputs>>i)&1;
+}
+
+bool ref_xor(unsigned v) { return bit(v, 0)!=bit(v, 1); }
+bool ref_ite(unsigned v) { return bit(v, 2)?bit(v, 0):bit(v, 1); }
+bool ref_carry(unsigned v)
+{
+  return bit(v, 0)+bit(v, 1)+bit(v, 2)>=2;
+}
+bool ref_sum(unsigned v) { return bit(v, 0)^bit(v, 1)^bit(v, 2); }
+
+// a+b with a=inputs 0,1 and b=inputs 2,3
+unsigned adder(unsigned v)
+{
+  return (v&3)+((v>>2)&3);
+}
+
+bool ref_add0(unsigned v) { return bit(adder(v), 0); }
+bool ref_add1(unsigned v) { return bit(adder(v), 1); }
+bool ref_add2(unsigned v) { return bit(adder(v), 2); }
+
+// the outputs added for the second round
+bool ref_xor_carry(unsigned v) { return ref_xor(v)!=ref_carry(v); }
+bool ref_ite_of_outputs(unsigned v)
+{
+  return ref_sum(v)?ref_ite(v):!ref_add1(v);
+}
+bool ref_not_xor(unsigned v) { return !ref_xor(v); }
+// input 4 is constrained to be the XOR of inputs 0 and 1
+bool constraint(unsigned v) { return bit(v, 4)==ref_xor(v); }
+bool ref_input4(unsigned v) { return bit(v, 4); }
+
+// the carry as the disjunction of the three conjunctions
+literalt carry(propt &prop, literalt a, literalt b, literalt c)
+{
+  return prop.lor(
+    prop.lor(prop.land(a, b), prop.land(a, c)),
+    prop.land(b, c));
+}
+
+void check_outputs(
+  aig_prop_testt &prop,
+  const bvt &inputs,
+  const outputst &outputs,
+  bool (*valid)(unsigned inputs),
+  const std::string &round)
+{
+  for(unsigned v=0; v<(1u<<inputs.size()); v++)
+  {
+    bvt assumptions;
+    for(unsigned i=0; i<inputs.size(); i++)
+      assumptions.push_back(inputs[i]^!bit(v, i));
+
+    const std::string where=round+", inputs "+i2string(v);
+
+    for(const auto &output : outputs)
+    {
+      const bool expected=output.reference(v);
+
+      for(unsigned value=0; value<2; value++)
+      {
+        bvt a=assumptions;
+        a.push_back(output.l^(value==0));
+        prop.set_assumptions(a);
+
+        propt::resultt result=prop.prop_solve();
+
+        if(valid!=NULL && !valid(v))
+        {
+          check(result==propt::P_UNSATISFIABLE,
+                output.name+" violates the constraint, "+where);
+          continue;
+        }
+
+        if((value!=0)!=expected)
+        {
+          check(result==propt::P_UNSATISFIABLE,
+                output.name+" has the wrong value, "+where);
+          continue;
+        }
+
+        check(result==propt::P_SATISFIABLE,
+              output.name+" lacks its value, "+where);
+
+        if(result!=propt::P_SATISFIABLE)
+          continue;
+
+        // l_get evaluates all nodes, including those not encoded
+        for(const auto &other : outputs)
+          check(prop.l_get(other.l)==tvt(other.reference(v)),
+                "l_get of "+other.name+", "+where);
+
+        for(unsigned i=0; i<inputs.size(); i++)
+          check(prop.l_get(inputs[i])==tvt(bit(v, i)),
+                "l_get of input "+i2string(i)+", "+where);
+      }
+    }
+  }
+}
+
+void check_bodies()
+{
+  satcheck_no_simplifiert sat;
+  aig_prop_testt prop(sat);
+
+  literalt a=prop.new_variable();
+  literalt b=prop.new_variable();
+  literalt c=prop.new_variable();
+  literalt d=prop.new_variable();
+
+  // the inner conjunction is used once, positively, and is inlined
+  literalt inner=prop.land(a, b);
+  literalt single=prop.land(inner, c);
+
+  // this one is used twice, and is not
+  literalt shared=prop.land(c, d);
+  literalt first=prop.land(shared, a);
+  literalt second=prop.land(shared, b);
+
+  // a negated conjunction is not inlined into a body
+  literalt negated=prop.land(!prop.land(b, d), a);
+
+  prop.l_set_to_true(prop.lor(prop.lor(single, first),
+                              prop.lor(second, negated)));
+  prop.usage_count();
+
+  auto body_of=[&prop](literalt l)
+  {
+    bvt body;
+    prop.get_body(l, body);
+    std::vector<unsigned> result;
+    for(const auto &lit : body)
+      result.push_back(lit.get());
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  auto sorted=[](const bvt &bv)
+  {
+    std::vector<unsigned> result;
+    for(const auto &lit : bv)
+      result.push_back(lit.get());
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  check(body_of(single)==sorted({ a, b, c }),
+        "single-use conjunction inlined");
+  check(body_of(first)==sorted({ shared, a }),
+        "shared conjunction kept");
+  check(body_of(second)==sorted({ shared, b }),
+        "shared conjunction kept in the other use");
+  check(body_of(negated).size()==2,
+        "negated conjunction kept");
+}
+
+int main()
+{
+  check_bodies();
+
+  satcheck_no_simplifiert sat;
+  aig_prop_testt prop(sat);
+
+  bvt inputs;
+  for(unsigned i=0; i<4; i++)
+    inputs.push_back(prop.new_variable());
+
+  const literalt a=inputs[0], b=inputs[1], c=inputs[2], d=inputs[3];
+
+  outputst outputs;
+
+  outputs.push_back({ "xor", prop.lxor(a, b), ref_xor });
+  outputs.push_back({ "ite", prop.lselect(c, a, b), ref_ite });
+  outputs.push_back({ "carry", carry(prop, a, b, c), ref_carry });
+  outputs.push_back({ "sum", prop.lxor(prop.lxor(a, b), c), ref_sum });
+
+  // a two-bit adder, with a half adder and a full adder
+  literalt s0=prop.lxor(a, c);
+  literalt c0=prop.land(a, c);
+  literalt s1=prop.lxor(prop.lxor(b, d), c0);
+  literalt c1=carry(prop, b, d, c0);
+
+  outputs.push_back({ "add0", s0, ref_add0 });
+  outputs.push_back({ "add1", s1, ref_add1 });
+  outputs.push_back({ "add2", c1, ref_add2 });
+
+  check_outputs(prop, inputs, outputs, NULL, "first round");
+
+  check(prop.ite_gates!=0, "ITE gates found");
+  check(prop.majority_gates!=0, "majority gates found");
+
+  // the second round uses the outputs in the polarities not needed
+  // so far, and a new input that is constrained
+  inputs.push_back(prop.new_variable());
+
+  outputs.push_back(
+    { "xor^carry", prop.lxor(outputs[0].l, outputs[2].l), ref_xor_carry });
+  outputs.push_back(
+    { "ite of outputs",
+      prop.lselect(outputs[3].l, outputs[1].l, !outputs[5].l),
+      ref_ite_of_outputs });
+  outputs.push_back({ "!xor", !outputs[0].l, ref_not_xor });
+  outputs.push_back({ "input4", inputs[4], ref_input4 });
+
+  prop.l_set_to_true(prop.lequal(inputs[4], outputs[0].l));
+
+  check_outputs(prop, inputs, outputs, constraint, "second round");
+
+  if(failures!=0)
+  {
+    std::cout << failures << " failures\n";
+    return 1;
+  }
+
+  std::cout << "OK\n";
+  return 0;
+}
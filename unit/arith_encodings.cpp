@@ -0,0 +1,397 @@
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+#include <util/arith_tools.h>
+#include <util/i2string.h>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/sat/dimacs_cnf.h>
+#include <solvers/flattening/bv_utils.h>
+
+// Checks each of the encodings of multiplication and division in
+// bv_utilst against the default one, with miters over all operands
+// of small widths: variable ones, and each constant. Karatsuba is
+// checked with a smaller minimum width, so that it recurses, and the
+// automatic choice with smaller thresholds, so that it takes each of
+// its branches.
+//
+// With --benchmark, builds multiplication- and division-heavy
+// instances with each encoding instead, and reports the size of the
+// CNF and the time the SAT solver takes. With --dimacs as well, the
+// instances are written to files, to be given to other solvers.
+//
+//   arith_encodings [--benchmark [--dimacs] [width...] [instance...]]
+
+typedef std::chrono::steady_clock clockt;
+
+double seconds_since(clockt::time_point start)
+{
+  return std::chrono::duration<double>(clockt::now()-start).count();
+}
+
+struct encodingt
+{
+  const char *name;
+  bv_utilst::multipliert multiplier;
+  bv_utilst::dividert divider;
+};
+
+const encodingt multipliers[]=
+{
+  { "shift-add", bv_utilst::M_SHIFT_ADD, bv_utilst::D_MULTIPLICATION },
+  { "csd", bv_utilst::M_CSD, bv_utilst::D_MULTIPLICATION },
+  { "wallace", bv_utilst::M_WALLACE, bv_utilst::D_MULTIPLICATION },
+  { "dadda", bv_utilst::M_DADDA, bv_utilst::D_MULTIPLICATION },
+  { "karatsuba", bv_utilst::M_KARATSUBA, bv_utilst::D_MULTIPLICATION },
+  { "auto", bv_utilst::M_AUTO, bv_utilst::D_MULTIPLICATION },
+  { NULL, bv_utilst::M_SHIFT_ADD, bv_utilst::D_MULTIPLICATION }
+};
+
+const encodingt dividers[]=
+{
+  { "multiplication", bv_utilst::M_SHIFT_ADD, bv_utilst::D_MULTIPLICATION },
+  { "shift", bv_utilst::M_SHIFT_ADD, bv_utilst::D_SHIFT },
+  { "restoring", bv_utilst::M_SHIFT_ADD, bv_utilst::D_RESTORING },
+  { "auto", bv_utilst::M_SHIFT_ADD, bv_utilst::D_AUTO },
+  { NULL, bv_utilst::M_SHIFT_ADD, bv_utilst::D_MULTIPLICATION }
+};
+
+unsigned failures=0;
+
+void check(bool condition, const std::string &what)
+{
+  if(!condition)
+  {
+    std::cout << "FAILED: " << what << "\n";
+    failures++;
+  }
+}
+
+bvt variable(propt &prop, std::size_t width)
+{
+  bvt result;
+  for(std::size_t i=0; i<width; i++)
+    result.push_back(prop.new_variable());
+  return result;
+}
+
+// x*y with the given encoding differs from shift-and-add,
+// unsatisfiable
+void multiplier_miter(
+  const encodingt &encoding,
+  std::size_t width,
+  bool is_constant,
+  const mp_integer &constant)
+{
+  satcheckt satcheck;
+  bv_utilst bv_utils(satcheck);
+  bv_utils.karatsuba_min_width=4;
+  bv_utils.auto_dadda_min_width=3;
+  bv_utils.auto_karatsuba_min_width=7;
+
+  bvt x=variable(satcheck, width);
+  bvt y=is_constant?bv_utils.build_constant(constant, width):
+                    variable(satcheck, width);
+
+  bv_utils.multiplier_encoding=bv_utilst::M_SHIFT_ADD;
+  bvt expected=bv_utils.unsigned_multiplier(x, y);
+
+  bv_utils.multiplier_encoding=encoding.multiplier;
+  bvt product=bv_utils.unsigned_multiplier(x, y);
+
+  satcheck.l_set_to_false(bv_utils.equal(expected, product));
+
+  check(satcheck.prop_solve()==propt::P_UNSATISFIABLE,
+        std::string(encoding.name)+" multiplier at width "+
+        i2string((unsigned long)width)+
+        (is_constant?" with constant "+integer2string(constant):""));
+}
+
+// x/y and x%y with the given encoding differ from the
+// multiplication constraint for y!=0, unsatisfiable
+void divider_miter(
+  const encodingt &encoding,
+  std::size_t width,
+  bool is_constant,
+  const mp_integer &constant)
+{
+  satcheckt satcheck;
+  bv_utilst bv_utils(satcheck);
+
+  bvt x=variable(satcheck, width);
+  bvt y=is_constant?bv_utils.build_constant(constant, width):
+                    variable(satcheck, width);
+
+  bvt expected_res, expected_rem;
+  bv_utils.divider_encoding=bv_utilst::D_MULTIPLICATION;
+  bv_utils.unsigned_divider(x, y, expected_res, expected_rem);
+
+  bvt res, rem;
+  bv_utils.divider_encoding=encoding.divider;
+  bv_utils.unsigned_divider(x, y, res, rem);
+
+  satcheck.l_set_to_true(bv_utils.is_not_zero(y));
+  satcheck.l_set_to_false(satcheck.land(
+    bv_utils.equal(expected_res, res),
+    bv_utils.equal(expected_rem, rem)));
+
+  check(satcheck.prop_solve()==propt::P_UNSATISFIABLE,
+        std::string(encoding.name)+" divider at width "+
+        i2string((unsigned long)width)+
+        (is_constant?" with constant "+integer2string(constant):""));
+}
+
+void miters()
+{
+  for(const encodingt *e=multipliers+1; e->name!=NULL; e++)
+  {
+    // with the minimum width of 4, Karatsuba splits the operands
+    // from 4 bits on, and splits the halves again from 7 bits on
+    std::size_t max_width=
+      e->multiplier==bv_utilst::M_KARATSUBA ||
+      e->multiplier==bv_utilst::M_AUTO?9:6;
+
+    for(std::size_t width=1; width<=max_width; width++)
+      multiplier_miter(*e, width, false, 0);
+
+    for(std::size_t width=1; width<=5; width++)
+      for(mp_integer c=0; c<power(2, width); ++c)
+        multiplier_miter(*e, width, true, c);
+
+    // from 11 bits on, the middle term of the full product of the
+    // low halves is narrower than the product, and is padded; a
+    // constant keeps these miters small
+    if(e->multiplier==bv_utilst::M_KARATSUBA)
+      for(std::size_t width=10; width<=16; width++)
+        multiplier_miter(*e, width, true, power(2, width)/3);
+  }
+
+  for(const encodingt *e=dividers+1; e->name!=NULL; e++)
+  {
+    for(std::size_t width=1; width<=6; width++)
+      divider_miter(*e, width, false, 0);
+
+    for(std::size_t width=1; width<=5; width++)
+      for(mp_integer c=1; c<power(2, width); ++c)
+        divider_miter(*e, width, true, c);
+  }
+}
+
+// x*y!=y*x, unsatisfiable
+void commutativity(bv_utilst &bv_utils, propt &prop, std::size_t width)
+{
+  bvt x=variable(prop, width), y=variable(prop, width);
+
+  prop.l_set_to_false(bv_utils.equal(
+    bv_utils.unsigned_multiplier(x, y),
+    bv_utils.unsigned_multiplier(y, x)));
+}
+
+// x*y==p for p the product of two primes, on zero-extended halves
+void factoring(bv_utilst &bv_utils, propt &prop, std::size_t width)
+{
+  const unsigned long primes[]=
+    { 2, 3, 7, 13, 31, 61, 127, 251, 509, 1021, 2039, 4093, 8191,
+      16381, 32749, 65521 };
+
+  std::size_t half=std::min(width/2, sizeof(primes)/sizeof(*primes));
+  assert(half>=2);
+
+  mp_integer p=primes[half-1];
+  p*=primes[half-2];
+
+  bvt x=bv_utils.zero_extension(variable(prop, half), width);
+  bvt y=bv_utils.zero_extension(variable(prop, half), width);
+
+  prop.l_set_to_true(bv_utils.equal(
+    bv_utils.unsigned_multiplier(x, y),
+    bv_utils.build_constant(p, width)));
+
+  prop.l_set_to_false(bv_utils.is_one(x));
+  prop.l_set_to_false(bv_utils.is_one(y));
+}
+
+// x*c0*c1!=x*(c0*c1) with constants that have long runs of ones,
+// unsatisfiable
+void constants(bv_utilst &bv_utils, propt &prop, std::size_t width)
+{
+  mp_integer c0=power(2, width-1)-1;
+  mp_integer c1=power(2, width/2)-3;
+  mp_integer c01=(c0*c1)%power(2, width);
+
+  bvt x=variable(prop, width);
+
+  bvt lhs=bv_utils.unsigned_multiplier(
+    bv_utils.unsigned_multiplier(x, bv_utils.build_constant(c0, width)),
+    bv_utils.build_constant(c1, width));
+
+  bvt rhs=bv_utils.unsigned_multiplier(
+    x, bv_utils.build_constant(c01, width));
+
+  prop.l_set_to_false(bv_utils.equal(lhs, rhs));
+}
+
+// a filter, sum c_i*x_i, hitting a given output
+void filter(bv_utilst &bv_utils, propt &prop, std::size_t width)
+{
+  const long taps[]={ -3, 12, -37, 110, 110, -37, 12, -3 };
+
+  bvt sum=bv_utils.zeros(width);
+
+  for(long tap : taps)
+  {
+    bvt x=bv_utils.sign_extension(variable(prop, width/2), width);
+    sum=bv_utils.add(sum, bv_utils.unsigned_multiplier(
+      x, bv_utils.build_constant(tap, width)));
+  }
+
+  prop.l_set_to_true(bv_utils.equal(
+    sum, bv_utils.build_constant(1234, width)));
+}
+
+// (x/y)*y+x%y!=x for y!=0, unsatisfiable
+void division(bv_utilst &bv_utils, propt &prop, std::size_t width)
+{
+  bvt x=variable(prop, width), y=variable(prop, width);
+  bvt res, rem;
+  bv_utils.unsigned_divider(x, y, res, rem);
+
+  bvt sum=bv_utils.add(bv_utils.unsigned_multiplier(res, y), rem);
+
+  prop.l_set_to_true(bv_utils.is_not_zero(y));
+  prop.l_set_to_false(bv_utils.equal(sum, x));
+}
+
+// x/10 and x%10 given, as when printing a number
+void decimal(bv_utilst &bv_utils, propt &prop, std::size_t width)
+{
+  bvt x=variable(prop, width), res, rem;
+  bv_utils.unsigned_divider(
+    x, bv_utils.build_constant(10, width), res, rem);
+
+  prop.l_set_to_true(bv_utils.equal(
+    res, bv_utils.build_constant(power(2, width)/40, width)));
+  prop.l_set_to_true(bv_utils.equal(
+    rem, bv_utils.build_constant(7, width)));
+}
+
+struct instancet
+{
+  const char *name;
+  void (*build)(bv_utilst &, propt &, std::size_t);
+  const encodingt *encodings;
+
+  std::size_t min_width;
+
+  // the instances that get out of reach quickly are only built up
+  // to this width, unless asked for by name
+  std::size_t max_width;
+};
+
+const instancet instances[]=
+{
+  { "commutativity", commutativity, multipliers, 1, 9 },
+  { "factoring", factoring, multipliers, 4, 32 },
+  { "constants", constants, multipliers, 2, 16 },
+  { "filter", filter, multipliers, 2, 0 },
+  { "division", division, dividers, 1, 12 },
+  { "decimal", decimal, dividers, 4, 0 },
+  { NULL, NULL, NULL, 0, 0 }
+};
+
+void benchmark(int argc, const char **argv)
+{
+  bool dimacs=false;
+  std::vector<std::size_t> widths;
+  std::set<std::string> selected;
+
+  for(int i=2; i<argc; i++)
+    if(strcmp(argv[i], "--dimacs")==0)
+      dimacs=true;
+    else if(isdigit(argv[i][0]))
+      widths.push_back(atoi(argv[i]));
+    else
+      selected.insert(argv[i]);
+
+  if(widths.empty())
+  {
+    widths.push_back(8);
+    widths.push_back(16);
+    widths.push_back(32);
+  }
+
+  for(std::size_t width : widths)
+    for(const instancet *i=instances; i->name!=NULL; i++)
+    {
+      if(width<i->min_width)
+        continue;
+
+      if(selected.empty())
+      {
+        if(i->max_width!=0 && width>i->max_width)
+          continue;
+      }
+      else if(selected.count(i->name)==0)
+        continue;
+
+      for(const encodingt *e=i->encodings; e->name!=NULL; e++)
+      {
+        std::string name=std::string(i->name)+"-"+
+                         i2string((unsigned long)width)+"-"+e->name;
+
+        if(dimacs)
+        {
+          dimacs_cnft cnf;
+          bv_utilst bv_utils(cnf);
+          bv_utils.multiplier_encoding=e->multiplier;
+          bv_utils.divider_encoding=e->divider;
+          i->build(bv_utils, cnf, width);
+
+          std::ofstream out((name+".cnf").c_str());
+          cnf.write_dimacs_cnf(out);
+          continue;
+        }
+
+        satcheckt satcheck;
+        bv_utilst bv_utils(satcheck);
+        bv_utils.multiplier_encoding=e->multiplier;
+        bv_utils.divider_encoding=e->divider;
+        i->build(bv_utils, satcheck, width);
+
+        clockt::time_point start=clockt::now();
+        propt::resultt result=satcheck.prop_solve();
+
+        std::cout << name << ": "
+                  << satcheck.no_variables() << " variables, "
+                  << satcheck.no_clauses() << " clauses, "
+                  << (result==propt::P_SATISFIABLE?"SAT":
+                      result==propt::P_UNSATISFIABLE?"UNSAT":"ERROR")
+                  << ", " << seconds_since(start) << "s"
+                  << std::endl;
+      }
+    }
+}
+
+int main(int argc, const char **argv)
+{
+  if(argc>=2 && strcmp(argv[1], "--benchmark")==0)
+  {
+    benchmark(argc, argv);
+    return 0;
+  }
+
+  miters();
+
+  if(failures!=0)
+    return 1;
+
+  std::cout << "OK\n";
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <cassert>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+
+#include <util/chunked_vector.h>
+
+// small chunks, so that the tests cross many chunk boundaries
+typedef chunked_vectort<std::shared_ptr<unsigned>, 4> vectort;
+typedef std::deque<unsigned> reference_vectort;
+
+void check(const vectort &vector, const reference_vectort &reference)
+{
+  assert(vector.size()==reference.size());
+  assert(vector.empty()==reference.empty());
+
+  reference_vectort::const_iterator r_it=reference.begin();
+
+  for(vectort::const_iterator it=vector.begin(); it!=vector.end(); it++, r_it++)
+  {
+    assert(r_it!=reference.end());
+    assert(**it==*r_it);
+  }
+
+  assert(r_it==reference.end());
+
+  reference_vectort::const_reverse_iterator rr_it=reference.rbegin();
+
+  for(vectort::const_reverse_iterator
+      it=vector.rbegin(); it!=vector.rend(); it++, rr_it++)
+    assert(**it==*rr_it);
+
+  for(std::size_t i=0; i<reference.size(); i++)
+  {
+    assert(*vector[i]==reference[i]);
+    assert(*(vector.begin()+i)==vector[i]);
+    assert((vector.begin()+i)-vector.begin()==(std::ptrdiff_t)i);
+  }
+}
+
+int main()
+{
+  vectort vector;
+  reference_vectort reference;
+
+  for(unsigned i=0; i<100; i++)
+  {
+    unsigned value=rand();
+
+    if(rand()%3==0)
+    {
+      vector.push_front(std::make_shared<unsigned>(value));
+      reference.push_front(value);
+    }
+    else
+    {
+      vector.push_back(std::make_shared<unsigned>(value));
+      reference.push_back(value);
+    }
+  }
+
+  check(vector, reference);
+
+  // references and iterators remain valid when elements are added
+  vectort::iterator it=vector.begin()+50;
+  const std::shared_ptr<unsigned> *element=&*it;
+  const unsigned value=**it;
+  const vectort::iterator first=vector.begin();
+
+  for(unsigned i=0; i<100; i++)
+  {
+    vector.push_front(std::make_shared<unsigned>(i));
+    reference.push_front(i);
+    vector.push_back(std::make_shared<unsigned>(i));
+    reference.push_back(i);
+  }
+
+  assert(&*it==element && **it==value);
+  assert(**first==reference[100]);
+  assert(vector.begin()<first && first<it);
+  check(vector, reference);
+
+  // elements can be changed through the iterators
+  for(vectort::iterator e_it=vector.begin(); e_it!=vector.end(); e_it++)
+    **e_it+=1;
+  for(auto &r : reference)
+    r+=1;
+  check(vector, reference);
+
+  // copies are independent, moves leave nothing behind
+  vectort copy=vector;
+  check(copy, reference);
+  copy.push_back(std::make_shared<unsigned>(0));
+  check(vector, reference);
+
+  vectort moved=std::move(vector);
+  check(moved, reference);
+  assert(vector.empty());
+
+  // the elements are destroyed
+  std::weak_ptr<unsigned> weak=moved.front();
+  moved.clear();
+  copy.clear();
+  assert(weak.expired());
+  check(moved, reference_vectort());
+
+  std::cout << "OK\n";
+
+  return 0;
+}
@@ -0,0 +1,354 @@
+#include <iostream>
+#include <sstream>
+
+#include <util/arith_tools.h>
+#include <util/cout_message.h>
+#include <util/i2string.h>
+#include <util/irep_serialization.h>
+#include <util/std_code.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <goto-programs/lazy_goto_binary.h>
+#include <goto-programs/read_bin_goto_object.h>
+#include <goto-programs/write_goto_binary.h>
+
+// Writes a small goto program in versions 3 and 4 of the goto binary
+// format, reads it back, and compares with the original. Version 4 is
+// written once directly and once buffered, as for output that cannot
+// seek, which must give the same bytes. Then loads a single function
+// from the version 4 binary, which must bring in what it calls and the
+// symbols it uses, but nothing else.
+
+unsigned failures=0;
+
+void check(bool condition, const std::string &what)
+{
+  if(!condition)
+  {
+    std::cout << "FAILED: " << what << "\n";
+    failures++;
+  }
+}
+
+signedbv_typet int_type()
+{
+  return signedbv_typet(32);
+}
+
+symbol_exprt add_variable(
+  symbol_tablet &symbol_table,
+  const irep_idt &name,
+  bool is_parameter)
+{
+  symbolt symbol;
+  symbol.name=name;
+  symbol.base_name=name;
+  symbol.type=int_type();
+  symbol.mode=ID_C;
+  symbol.is_lvalue=true;
+  symbol.is_parameter=is_parameter;
+  symbol.is_static_lifetime=!is_parameter;
+  symbol.value=from_integer(0, int_type());
+  symbol_table.add(symbol);
+
+  return symbol.symbol_expr();
+}
+
+goto_programt &add_function(
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  const irep_idt &name,
+  const irep_idt &parameter)
+{
+  code_typet type;
+  type.return_type()=int_type();
+
+  if(parameter!=irep_idt())
+  {
+    code_typet::parametert p(int_type());
+    p.set_identifier(parameter);
+    type.parameters().push_back(p);
+    add_variable(symbol_table, parameter, true);
+  }
+
+  symbolt symbol;
+  symbol.name=name;
+  symbol.base_name=name;
+  symbol.type=type;
+  symbol.mode=ID_C;
+  symbol.value=code_skipt();
+  symbol_table.add(symbol);
+
+  goto_functionst::goto_functiont &function=
+    goto_functions.function_map[name];
+  function.type=type;
+
+  return function.body;
+}
+
+void build(symbol_tablet &symbol_table, goto_functionst &goto_functions)
+{
+  symbol_exprt x=add_variable(symbol_table, "x", false);
+  symbol_exprt t=add_variable(symbol_table, "f::t", false);
+
+  source_locationt location;
+  location.set_file("main.c");
+
+  {
+    // g: x=x+a+0x40000000;
+    // the constant is too large to be held in the number of its value
+    goto_programt &g=
+      add_function(symbol_table, goto_functions, "g", "g::a");
+    symbol_exprt a(symbol_table.lookup("g::a").symbol_expr());
+
+    goto_programt::targett i=g.add_instruction(ASSIGN);
+    i->code=code_assignt(
+      x,
+      plus_exprt(
+        plus_exprt(x, a),
+        from_integer(0x40000000, int_type())));
+    i->function="g";
+    i->source_location=location;
+    i->source_location.set_line(1);
+
+    g.add_instruction(END_FUNCTION)->function="g";
+    g.update();
+  }
+
+  {
+    // f: g(b); if(x==0) goto out; assert(x!=1); out: ;
+    goto_programt &f=
+      add_function(symbol_table, goto_functions, "f", "f::b");
+    symbol_exprt b(symbol_table.lookup("f::b").symbol_expr());
+
+    code_function_callt call;
+    call.lhs()=t;
+    call.function()=symbol_table.lookup("g").symbol_expr();
+    call.arguments().push_back(b);
+
+    goto_programt::targett i=f.add_instruction(FUNCTION_CALL);
+    i->code=call;
+    i->function="f";
+    i->source_location=location;
+    i->source_location.set_line(2);
+
+    goto_programt::targett jump=f.add_instruction(GOTO);
+    jump->guard=equal_exprt(x, from_integer(0, int_type()));
+    jump->function="f";
+
+    i=f.add_instruction(ASSERT);
+    i->guard=notequal_exprt(x, from_integer(1, int_type()));
+    i->function="f";
+    i->source_location=location;
+    i->source_location.set_comment("x!=1");
+
+    goto_programt::targett end=f.add_instruction(END_FUNCTION);
+    end->function="f";
+    end->labels.push_back("out");
+    jump->targets.push_back(end);
+
+    f.update();
+  }
+
+  {
+    // h: assert(0);
+    goto_programt &h=
+      add_function(symbol_table, goto_functions, "h", irep_idt());
+
+    goto_programt::targett i=h.add_instruction(ASSERT);
+    i->guard=false_exprt();
+    i->function="h";
+
+    h.add_instruction(END_FUNCTION)->function="h";
+    h.update();
+  }
+}
+
+// output that cannot seek, like a pipe
+class pipe_buft:public std::streambuf
+{
+public:
+  std::string data;
+
+protected:
+  virtual int overflow(int c)
+  {
+    if(c!=traits_type::eof())
+      data+=char(c);
+    return c;
+  }
+
+  virtual std::streamsize xsputn(const char *s, std::streamsize n)
+  {
+    data.append(s, n);
+    return n;
+  }
+};
+
+bool same_symbol(const symbolt &a, const symbolt &b)
+{
+  return full_eq(a.type, b.type) &&
+         full_eq(a.value, b.value) &&
+         full_eq(a.location, b.location) &&
+         a.name==b.name &&
+         a.base_name==b.base_name &&
+         a.module==b.module &&
+         a.mode==b.mode &&
+         a.is_lvalue==b.is_lvalue &&
+         a.is_parameter==b.is_parameter &&
+         a.is_static_lifetime==b.is_static_lifetime;
+}
+
+bool same_body(const goto_programt &a, const goto_programt &b)
+{
+  if(a.instructions.size()!=b.instructions.size())
+    return false;
+
+  goto_programt::const_targett a_it=a.instructions.begin();
+  goto_programt::const_targett b_it=b.instructions.begin();
+
+  for( ; a_it!=a.instructions.end(); a_it++, b_it++)
+  {
+    if(a_it->type!=b_it->type ||
+       !full_eq(a_it->code, b_it->code) ||
+       !full_eq(a_it->guard, b_it->guard) ||
+       !full_eq(a_it->source_location, b_it->source_location) ||
+       a_it->function!=b_it->function ||
+       a_it->labels!=b_it->labels ||
+       a_it->targets.size()!=b_it->targets.size())
+      return false;
+
+    goto_programt::instructiont::targetst::const_iterator
+      a_t=a_it->targets.begin(), b_t=b_it->targets.begin();
+
+    for( ; a_t!=a_it->targets.end(); a_t++, b_t++)
+      if((*a_t)->target_number!=(*b_t)->target_number)
+        return false;
+  }
+
+  return true;
+}
+
+void check_same(
+  const symbol_tablet &symbol_table,
+  const goto_functionst &goto_functions,
+  const symbol_tablet &read_symbol_table,
+  const goto_functionst &read_goto_functions,
+  const std::string &what)
+{
+  check(symbol_table.symbols.size()==read_symbol_table.symbols.size(),
+        what+": number of symbols");
+
+  forall_symbols(it, symbol_table.symbols)
+  {
+    symbol_tablet::symbolst::const_iterator read_it=
+      read_symbol_table.symbols.find(it->first);
+
+    check(read_it!=read_symbol_table.symbols.end() &&
+          same_symbol(it->second, read_it->second),
+          what+": symbol "+id2string(it->first));
+  }
+
+  forall_goto_functions(it, goto_functions)
+  {
+    goto_functionst::function_mapt::const_iterator read_it=
+      read_goto_functions.function_map.find(it->first);
+
+    check(read_it!=read_goto_functions.function_map.end() &&
+          same_body(it->second.body, read_it->second.body),
+          what+": function "+id2string(it->first));
+  }
+}
+
+int main()
+{
+  symbol_tablet symbol_table;
+  goto_functionst goto_functions;
+  build(symbol_table, goto_functions);
+
+  console_message_handlert message_handler;
+
+  // round trips through both versions
+  for(int version=3; version<=4; version++)
+  {
+    std::stringstream binary;
+    check(!write_goto_binary(
+            binary, symbol_table, goto_functions, version),
+          "write");
+
+    symbol_tablet read_symbol_table;
+    goto_functionst read_goto_functions;
+    check(!read_bin_goto_object(
+            binary, "", read_symbol_table, read_goto_functions,
+            message_handler),
+          "read");
+
+    check_same(
+      symbol_table, goto_functions,
+      read_symbol_table, read_goto_functions,
+      "version "+i2string(version));
+  }
+
+  // the same bytes, whether written directly or buffered
+  std::stringstream binary;
+  write_goto_binary(binary, symbol_table, goto_functions, 4);
+
+  pipe_buft pipe_buf;
+  std::ostream pipe(&pipe_buf);
+  check(pipe.tellp()==std::streampos(-1), "pipe cannot seek");
+  check(!write_goto_binary(pipe, symbol_table, goto_functions, 4),
+        "write buffered");
+  check(pipe_buf.data==binary.str(), "buffered output the same");
+
+  // loading a single function lazily
+
+  char header[4];
+  binary.read(header, 4);
+  check(irep_serializationt::read_gb_word(binary)==4, "version 4");
+
+  lazy_goto_binaryt lazy;
+  check(!lazy.read(binary, "", message_handler), "read index");
+  check(lazy.number_of_symbols()==symbol_table.symbols.size(),
+        "symbols in the index");
+  check(lazy.number_of_functions()==3, "functions in the index");
+  check(lazy.has_function("h") && lazy.symbols_loaded()==0,
+        "nothing loaded yet");
+
+  symbol_tablet lazy_symbol_table;
+  goto_functionst lazy_goto_functions;
+  std::list<irep_idt> roots;
+  roots.push_back("f");
+  lazy.load_reachable(roots, lazy_symbol_table, lazy_goto_functions);
+
+  for(const char *name : { "f", "g", "x", "f::b", "f::t", "g::a" })
+    check(lazy_symbol_table.has_symbol(name),
+          std::string("loaded ")+name);
+
+  check(!lazy_symbol_table.has_symbol("h"), "h not loaded");
+  check(lazy_goto_functions.function_map.count("h")==0,
+        "body of h not loaded");
+  check(lazy.functions_loaded()==2, "two functions loaded");
+  check(lazy.symbols_loaded()==lazy_symbol_table.symbols.size(),
+        "symbols loaded");
+
+  for(const char *name : { "f", "g" })
+    check(same_body(
+            goto_functions.function_map[name].body,
+            lazy_goto_functions.function_map[name].body),
+          std::string("lazily loaded ")+name);
+
+  // loading the rest later
+  check(!lazy.load_function("h", lazy_goto_functions), "load h");
+  check(lazy.load_function("h", lazy_goto_functions), "h loaded once");
+  check(same_body(
+          goto_functions.function_map["h"].body,
+          lazy_goto_functions.function_map["h"].body),
+        "lazily loaded h");
+
+  if(failures!=0)
+    return 1;
+
+  std::cout << "OK\n";
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <iostream>
+
+#include <util/merge_irep.h>
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+// Structurally equal ireps share storage with HASH_CONSING. Needs util
+// built with the flag, which the rule in the Makefile does.
+
+#ifndef HASH_CONSING
+#error "build with HASH_CONSING"
+#endif
+
+unsigned failures=0;
+
+void check(bool condition, const char *what)
+{
+  if(!condition)
+  {
+    std::cout << "FAILED: " << what << "\n";
+    failures++;
+  }
+}
+
+int main()
+{
+  // types are shared as expressions are constructed
+  symbol_exprt a("a", signedbv_typet(32));
+  symbol_exprt b("b", signedbv_typet(32));
+  symbol_exprt c("c", unsignedbv_typet(32));
+
+  check(&a.type().read()==&b.type().read(), "equal types shared");
+  check(&a.type().read()!=&c.type().read(), "different types");
+  check(a.type()==b.type(), "equal types compare equal");
+  check(a.type()!=c.type(), "different types compare unequal");
+
+  // the table disregards comments, so these are kept apart
+  signedbv_typet const_int(32);
+  const_int.set(ID_C_constant, true);
+  symbol_exprt d("d", const_int);
+  check(&d.type().read()!=&a.type().read(), "type with comments kept");
+  check(d.type().get_bool(ID_C_constant), "comment preserved");
+  check(!a.type().get_bool(ID_C_constant), "comment not shared");
+
+  // copy-on-write leaves the shared node alone
+  b.type().set(ID_width, 16);
+  check(a.type().get(ID_width)=="32", "writes detach");
+  check(&a.type().read()!=&b.type().read(), "written type not shared");
+
+  // merging makes whole expressions shared
+  plus_exprt sum1(a, symbol_exprt("x", signedbv_typet(32)));
+  plus_exprt sum2(a, symbol_exprt("x", signedbv_typet(32)));
+  plus_exprt sum3(a, symbol_exprt("y", signedbv_typet(32)));
+  check(&sum1.read()!=&sum2.read(), "not yet merged");
+
+  merge_irept merge;
+  merge(sum1);
+  merge(sum2);
+  merge(sum3);
+
+  check(&sum1.read()==&sum2.read(), "merged expressions shared");
+  check(sum1.is_merged() && sum2.is_merged(), "merged flag");
+  check(sum1==sum2, "merged expressions compare equal");
+  check(sum1!=sum3, "different merged expressions compare unequal");
+
+  // non-const access would detach
+  const exprt &merged1=sum1, &merged3=sum3;
+  check(&merged1.op0().read()==&merged3.op0().read(),
+        "common operand shared");
+
+  // a second table instance sees the same entries
+  plus_exprt sum4(a, symbol_exprt("x", signedbv_typet(32)));
+  merge_irept()(sum4);
+  check(&sum4.read()==&sum1.read(), "one global table");
+
+  if(failures!=0)
+    return 1;
+
+  std::cout << "OK\n";
+  return 0;
+}
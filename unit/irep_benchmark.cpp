@@ -0,0 +1,146 @@
+#include <chrono>
+#include <iostream>
+
+#ifdef __linux__
+#include <malloc.h>
+#endif
+
+#include <util/i2string.h>
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+// Builds expressions that look like those in SSA equations, and
+// reports memory and time for construction, traversal and
+// copy-on-write updates, the throughput of allocating and freeing
+// irep nodes, and the heap fragmentation left behind. Compare
+// builds with the alternative representations and the IREP_POOL
+// allocator selected in util/irep.h.
+
+typedef std::chrono::steady_clock clockt;
+
+double seconds_since(clockt::time_point start)
+{
+  return std::chrono::duration<double>(clockt::now()-start).count();
+}
+
+std::size_t allocated_bytes()
+{
+  #ifdef __linux__
+  struct mallinfo m=mallinfo();
+  return m.uordblks+m.hblkhd;
+  #else
+  return 0;
+  #endif
+}
+
+// free, but not returned to the system
+std::size_t free_heap_bytes()
+{
+  #ifdef __linux__
+  struct mallinfo m=mallinfo();
+  return m.fordblks;
+  #else
+  return 0;
+  #endif
+}
+
+exprt make_expr(unsigned i)
+{
+  // fresh types, as produced by the front-end for each declaration
+  signedbv_typet type(32);
+  type.set(ID_C_c_type, ID_signed_int);
+
+  symbol_exprt a("a!0@1#"+i2string(i), type);
+  symbol_exprt b("b!0@1#"+i2string(i/2), type);
+  a.add_source_location().set_line(i);
+  b.add_source_location().set_line(i);
+
+  plus_exprt sum(a, b);
+  sum.add_source_location().set_line(i);
+
+  return equal_exprt(symbol_exprt("c!0@1#"+i2string(i), type), sum);
+}
+
+int main()
+{
+  const unsigned count=200000;
+
+  std::cout << "sizeof(irept::dt): " << sizeof(irept::dt) << "\n";
+
+  std::size_t before=allocated_bytes();
+  clockt::time_point start=clockt::now();
+
+  std::vector<exprt> exprs;
+  exprs.reserve(count);
+
+  for(unsigned i=0; i<count; i++)
+    exprs.push_back(make_expr(i));
+
+  std::cout << "construction: " << seconds_since(start) << "s, "
+            << (allocated_bytes()-before)/count << " bytes/expression\n";
+
+  start=clockt::now();
+
+  std::size_t hash=0;
+  for(const auto &expr : exprs)
+    hash+=expr.hash();
+
+  std::cout << "traversal: " << seconds_since(start) << "s\n";
+
+  start=clockt::now();
+
+  std::size_t found=0;
+  for(const auto &expr : exprs)
+    found+=expr.op1().op0().type().get(ID_C_c_type)==ID_signed_int;
+
+  std::cout << "lookup: " << seconds_since(start) << "s\n";
+
+  start=clockt::now();
+
+  for(auto &expr : exprs)
+  {
+    exprt copy=expr;
+    copy.op1().op0().add_source_location().set_line(0);
+    copy.set(ID_C_lvalue, ID_1);
+  }
+
+  std::cout << "copy-on-write: " << seconds_since(start) << "s\n";
+
+  // build and drop expressions, as symex does for temporaries
+  start=clockt::now();
+  std::size_t allocations=irept::number_of_allocations();
+
+  for(unsigned round=0; round<20; round++)
+  {
+    std::vector<exprt> temporaries;
+    temporaries.reserve(count/10);
+
+    for(unsigned i=0; i<count/10; i++)
+      temporaries.push_back(make_expr(i));
+  }
+
+  double allocation_time=seconds_since(start);
+  allocations=irept::number_of_allocations()-allocations;
+
+  std::cout << "allocation: " << allocation_time << "s, "
+            << allocations/allocation_time/1e6
+            << "M nodes/s\n";
+
+  // free every other expression while strings are allocated in
+  // between, and see how much of the heap is left unusable
+  std::vector<std::string> strings;
+  strings.reserve(count);
+
+  for(unsigned i=0; i<count; i++)
+  {
+    if(i%2==0)
+      exprs[i]=exprt();
+    strings.push_back(std::string(24+i%40, 'x'));
+  }
+
+  std::cout << "fragmentation: " << free_heap_bytes()/1024
+            << "KB free in the heap after releasing half\n";
+
+  // keep the results alive
+  return (hash==0 && found==0 && strings.empty())?1:0;
+}
@@ -0,0 +1,121 @@
+#include <iostream>
+#include <vector>
+
+#ifdef THREAD_SAFE_IREP
+#include <thread>
+#endif
+
+#include <util/i2string.h>
+#include <util/irep.h>
+
+// Builds, copies, modifies and frees trees of ireps whose nodes come
+// from the pool, and checks that no node is handed out twice. With
+// THREAD_SAFE_IREP, threads that end leave their nodes to others.
+// The ireps with static storage duration are destroyed at exit, after
+// the thread-local destructors. Needs util built with IREP_POOL, which
+// the rule in the Makefile does.
+
+#ifndef IREP_POOL
+#error "build with IREP_POOL"
+#endif
+
+unsigned failures=0;
+
+irept tree(unsigned depth, unsigned n)
+{
+  irept result("n"+i2string(n));
+  result.set(ID_value, depth);
+
+  if(depth!=0)
+  {
+    result.get_sub().push_back(tree(depth-1, 2*n));
+    result.get_sub().push_back(tree(depth-1, 2*n+1));
+  }
+
+  return result;
+}
+
+bool check_tree(const irept &irep, unsigned depth, unsigned n)
+{
+  if(irep.id()!="n"+i2string(n) ||
+     irep.get_int(ID_value)!=int(depth))
+    return false;
+
+  if(depth==0)
+    return irep.get_sub().empty();
+
+  return irep.get_sub().size()==2 &&
+         check_tree(irep.get_sub()[0], depth-1, 2*n) &&
+         check_tree(irep.get_sub()[1], depth-1, 2*n+1);
+}
+
+unsigned work(unsigned rounds)
+{
+  unsigned errors=0;
+  std::vector<irept> kept;
+
+  for(unsigned r=0; r<rounds; r++)
+  {
+    irept t=tree(10, 1);
+    irept copy=t;
+
+    // detaches the path to the node
+    copy.get_sub()[1].get_sub()[0].id("changed");
+
+    if(!check_tree(t, 10, 1) ||
+       copy.get_sub()[1].get_sub()[0].id()!="changed")
+      errors++;
+
+    // some survive the round, while the others are freed
+    if(r%4==0)
+      kept.push_back(copy);
+  }
+
+  for(const auto &k : kept)
+    if(!check_tree(k.get_sub()[0], 9, 2))
+      errors++;
+
+  return errors;
+}
+
+int main()
+{
+  // freed at exit
+  static irept static_irep("static");
+  static_irep.get_sub().push_back(tree(4, 1));
+
+  failures+=work(50);
+
+  #ifdef THREAD_SAFE_IREP
+  for(unsigned generation=0; generation<3; generation++)
+  {
+    std::vector<unsigned> errors(4, 0);
+    std::vector<std::thread> threads;
+
+    for(unsigned t=0; t<4; t++)
+      threads.push_back(std::thread(
+        [&errors, t]() { errors[t]=work(50); }));
+
+    for(auto &thread : threads)
+      thread.join();
+
+    for(unsigned e : errors)
+      failures+=e;
+
+    // takes nodes that the threads have left
+    failures+=work(10);
+  }
+  #endif
+
+  if(!check_tree(static_irep.get_sub()[0], 4, 1))
+    failures++;
+
+  if(failures!=0)
+  {
+    std::cout << "FAILED: " << failures << " failures\n";
+    return 1;
+  }
+
+  std::cout << "OK\n";
+  return 0;
+}
@@ -0,0 +1,191 @@
+#include <iostream>
+#include <vector>
+
+#include <util/arith_tools.h>
+#include <util/mp_arith.h>
+#include <util/string_container.h>
+
+// Compares integer2binary and binary2integer, which have fast paths
+// for values that fit into a machine word, with conversions done
+// bit by bit on mp_integers, for negative values, zero and values
+// around and beyond the word size. The same for the conversions of
+// the values of constants, which are mostly held in the number of
+// the irep_idt rather than in the string table.
+
+unsigned failures=0;
+
+// bit i of the two's complement representation is floor(n/2^i) mod 2
+std::string reference_binary(const mp_integer &n, std::size_t width)
+{
+  std::string result(width, '0');
+
+  for(std::size_t i=0; i<width; i++)
+    if((n>>i)%2!=0)
+      result[width-i-1]='1';
+
+  return result;
+}
+
+mp_integer reference_integer(const std::string &s, bool is_signed)
+{
+  mp_integer result=0;
+
+  for(std::size_t i=0; i<s.size(); i++)
+  {
+    result*=2;
+    if(s[i]=='1')
+      result+=1;
+  }
+
+  if(is_signed && !s.empty() && s[0]=='1')
+    result-=power(2, s.size());
+
+  return result;
+}
+
+void check_id(const mp_integer &n, std::size_t width)
+{
+  std::string expected=reference_binary(n, width);
+  irep_idt id=integer2binary_id(n, width);
+
+  if(id2string(id)!=expected || id!=irep_idt(expected))
+  {
+    std::cout << "integer2binary_id(" << n << ", " << width << ")="
+              << id << ", expected " << expected << "\n";
+    failures++;
+  }
+
+  if(binary_width(id)!=width)
+  {
+    std::cout << "binary_width(" << expected << ")="
+              << binary_width(id) << "\n";
+    failures++;
+  }
+
+  for(std::size_t i=0; i<width; i++)
+    if(binary_bit(id, i)!=(expected[width-i-1]=='1'))
+    {
+      std::cout << "binary_bit(" << expected << ", " << i << ")\n";
+      failures++;
+    }
+
+  for(int is_signed=0; is_signed<2; is_signed++)
+  {
+    mp_integer value=binary2integer(id, is_signed);
+    mp_integer expected_value=reference_integer(expected, is_signed);
+
+    if(value!=expected_value)
+    {
+      std::cout << "binary2integer(irep_idt(" << expected << "), "
+                << is_signed << ")=" << value << ", expected "
+                << expected_value << "\n";
+      failures++;
+    }
+  }
+}
+
+void check(const mp_integer &n, std::size_t width)
+{
+  std::string binary=integer2binary(n, width);
+  std::string expected=reference_binary(n, width);
+
+  if(binary!=expected)
+  {
+    std::cout << "integer2binary(" << n << ", " << width << ")="
+              << binary << ", expected " << expected << "\n";
+    failures++;
+  }
+
+  for(int is_signed=0; is_signed<2; is_signed++)
+  {
+    mp_integer value=binary2integer(expected, is_signed);
+    mp_integer expected_value=reference_integer(expected, is_signed);
+
+    if(value!=expected_value)
+    {
+      std::cout << "binary2integer(" << expected << ", " << is_signed
+                << ")=" << value << ", expected " << expected_value
+                << "\n";
+      failures++;
+    }
+  }
+}
+
+int main()
+{
+  const std::size_t widths[]=
+    { 0, 1, 2, 7, 8, 31, 32, 33, 63, 64, 65, 100, 128, 200 };
+
+  std::vector<mp_integer> values;
+
+  for(long i=-4; i<=4; i++)
+    values.push_back(i);
+
+  // around the word boundaries, and beyond them
+  for(unsigned e : { 7, 8, 31, 32, 63, 64, 65, 127, 128, 150 })
+  {
+    mp_integer p=power(2, e);
+    for(const mp_integer &v : { p-1, p, p+1 })
+    {
+      values.push_back(v);
+      values.push_back(-v);
+    }
+  }
+
+  values.push_back(string2integer("123456789012345678901234567890"));
+  values.push_back(string2integer("-123456789012345678901234567890"));
+
+  for(const mp_integer &value : values)
+    for(std::size_t width : widths)
+    {
+      check(value, width);
+      check_id(value, width);
+    }
+
+  // the values of constants of up to 64 bits between -2^24 and 2^24
+  // do not add to the string table, including when converted from
+  // a string, unless they are output
+  std::size_t strings=string_container.get_statistics().strings;
+
+  for(long i=-100000; i<100000; i+=7)
+  {
+    mp_integer value=i*167;
+    for(std::size_t width : { 32, 64 })
+    {
+      irep_idt id=integer2binary_id(value, width);
+
+      if(irep_idt(integer2binary(value, width))!=id ||
+         binary2integer(id, true)!=value)
+      {
+        std::cout << "integer2binary_id(" << value << ", " << width
+                  << ")\n";
+        failures++;
+      }
+    }
+  }
+
+  std::size_t added=string_container.get_statistics().strings-strings;
+
+  if(added!=0)
+  {
+    std::cout << added << " constants added to the string table\n";
+    failures++;
+  }
+
+  // the predefined "0" and "1" keep their numbers
+  if(integer2binary_id(0, 1)!=ID_0 || integer2binary_id(1, 1)!=ID_1 ||
+     irep_idt("1")!=ID_1)
+  {
+    std::cout << "\"0\" and \"1\" are not ID_0 and ID_1\n";
+    failures++;
+  }
+
+  if(failures!=0)
+  {
+    std::cout << "FAILED: " << failures << " failures\n";
+    return 1;
+  }
+
+  std::cout << "OK\n";
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <iostream>
+
+#include <util/irep.h>
+
+// Adds, finds and removes named subs and comments, and checks that
+// they are kept in order, that references to them stay valid, and
+// that comparison and hashing do not depend on the order in which
+// they were added. The Makefile builds it once with std::map and
+// once with NAMED_SUB_IS_FORWARD_LIST.
+
+unsigned failures=0;
+
+void check(bool condition, const char *what)
+{
+  if(!condition)
+  {
+    std::cout << "FAILED: " << what << "\n";
+    failures++;
+  }
+}
+
+bool is_sorted(const irept::named_subt &s)
+{
+  irept::named_subt::const_iterator it=s.begin();
+  if(it==s.end())
+    return true;
+
+  for(irept::named_subt::const_iterator next=it; ++next!=s.end(); it=next)
+    if(!(it->first<next->first))
+      return false;
+
+  return true;
+}
+
+int main()
+{
+  const char *names[]=
+    { "value", "type", "width", "identifier", "base_name",
+      "mode", "size", "components", "op", "statement" };
+  const std::size_t no_names=sizeof(names)/sizeof(*names);
+
+  irept forward("e"), backward("e");
+
+  for(std::size_t i=0; i<no_names; i++)
+  {
+    forward.set(names[i], i);
+    backward.set(names[no_names-i-1], no_names-i-1);
+  }
+
+  const irept &f=forward, &b=backward;
+
+  check(f.get_named_sub().size()==no_names, "size");
+  check(is_sorted(f.get_named_sub()), "named subs sorted");
+  check(is_sorted(b.get_named_sub()), "named subs sorted, reversed");
+  check(f.get_int("width")==2, "get");
+  check(f.find("missing").is_nil(), "find missing");
+  check(f.get("missing").empty(), "get missing");
+
+  check(forward==backward, "equal regardless of order");
+  check(f.hash()==b.hash(), "hash regardless of order");
+  check(!(forward<backward) && !(backward<forward), "ordering");
+
+  // replacing a value does not add an entry
+  forward.set("width", 32);
+  check(f.get_named_sub().size()==no_names, "size after replacing");
+  check(f.get_int("width")==32, "replaced");
+  check(forward!=backward, "unequal after replacing");
+
+  // comments are kept apart, and ignored by ==
+  forward.set("width", 2);
+  forward.set(ID_C_constant, true);
+  forward.add(ID_C_source_location).set(ID_line, 1);
+  check(f.get_named_sub().size()==no_names, "comments not named subs");
+  check(f.get_comments().size()==2, "comments");
+  check(is_sorted(f.get_comments()), "comments sorted");
+  check(f.get_bool(ID_C_constant), "get comment");
+  check(forward==backward, "comments ignored by ==");
+  check(!full_eq(forward, backward), "comments compared by full_eq");
+
+  // references from add() stay valid when more are added
+  irept r("r");
+  irept &first=r.add("m");
+  for(std::size_t i=0; i<no_names; i++)
+    r.add(names[i]).id(names[i]);
+  first.id("still here");
+  check(r.find("m").id()=="still here", "stable references");
+
+  // removing
+  forward.remove("value");
+  forward.remove("missing");
+  forward.remove(ID_C_constant);
+  check(f.get_named_sub().size()==no_names-1, "size after remove");
+  check(f.find("value").is_nil(), "removed");
+  check(f.get_comments().size()==1, "comment removed");
+  check(is_sorted(f.get_named_sub()), "sorted after remove");
+
+  for(std::size_t i=0; i<no_names; i++)
+    forward.remove(names[i]);
+  check(f.get_named_sub().empty(), "all removed");
+
+  // copy-on-write
+  irept copy=backward;
+  copy.set("type", "changed");
+  check(b.get("type")=="1", "copy-on-write");
+
+  if(failures!=0)
+    return 1;
+
+  std::cout << "OK\n";
+  return 0;
+}
@@ -0,0 +1,127 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+
+#include <util/sharing_map.h>
+
+typedef sharing_mapt<unsigned, unsigned> mapt;
+typedef std::map<unsigned, unsigned> reference_mapt;
+
+void check(const mapt &map, const reference_mapt &reference)
+{
+  assert(map.size()==reference.size());
+
+  reference_mapt::const_iterator r_it=reference.begin();
+
+  for(mapt::const_iterator it=map.begin(); it!=map.end(); it++, r_it++)
+  {
+    assert(r_it!=reference.end());
+    assert(it->first==r_it->first);
+    assert(it->second==r_it->second);
+  }
+
+  assert(r_it==reference.end());
+}
+
+void change(mapt &map, reference_mapt &reference, unsigned steps)
+{
+  for(unsigned i=0; i<steps; i++)
+  {
+    unsigned key=rand()%1000;
+
+    if(rand()%3==0)
+    {
+      assert(map.erase(key)==reference.erase(key));
+    }
+    else
+    {
+      unsigned value=rand();
+      map[key]=value;
+      reference[key]=value;
+    }
+  }
+}
+
+void check_delta(
+  const mapt &map1, const reference_mapt &reference1,
+  const mapt &map2, const reference_mapt &reference2)
+{
+  mapt::delta_viewt delta;
+  map1.get_delta_view(map2, delta);
+
+  // everything that differs must be in the delta
+  reference_mapt expected;
+
+  for(const auto &entry : reference1)
+  {
+    reference_mapt::const_iterator it=reference2.find(entry.first);
+    if(it==reference2.end() || it->second!=entry.second)
+      expected.insert(entry);
+  }
+
+  for(const auto &entry : reference2)
+    if(reference1.find(entry.first)==reference1.end())
+      expected.insert(entry);
+
+  for(const auto &item : delta)
+  {
+    const unsigned *value1=map1.get(item.key());
+    const unsigned *value2=map2.get(item.key());
+    assert((item.entry==nullptr)==(value1==nullptr));
+    assert((item.other_entry==nullptr)==(value2==nullptr));
+    expected.erase(item.key());
+  }
+
+  assert(expected.empty());
+
+  std::cout << "delta: " << delta.size() << " of "
+            << map1.size() << " entries\n";
+}
+
+int main()
+{
+  mapt map;
+  reference_mapt reference;
+
+  change(map, reference, 5000);
+  check(map, reference);
+
+  // copies are independent
+  mapt copy=map;
+  reference_mapt reference_copy=reference;
+
+  change(copy, reference_copy, 20);
+  check(map, reference);
+  check(copy, reference_copy);
+  check_delta(map, reference, copy, reference_copy);
+
+  change(map, reference, 20);
+  check(map, reference);
+  check(copy, reference_copy);
+  check_delta(map, reference, copy, reference_copy);
+
+  // the same keys in any order give the same maps
+  mapt other;
+  for(reference_mapt::const_reverse_iterator
+      it=reference.rbegin(); it!=reference.rend(); it++)
+    other.insert(*it);
+
+  check_delta(map, reference, other, reference);
+
+  // find yields iterators that can be incremented
+  for(const auto &entry : reference)
+  {
+    mapt::const_iterator it=map.find(entry.first);
+    assert(it!=map.end() && it->second==entry.second);
+    it++;
+    reference_mapt::const_iterator r_it=reference.find(entry.first);
+    r_it++;
+    assert((it==map.end())==(r_it==reference.end()));
+    assert(it==map.end() || it->first==r_it->first);
+  }
+
+  std::cout << "OK\n";
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include <iostream>
+#include <vector>
+
+#include <util/i2string.h>
+#include <util/irep.h>
+#include <util/string_container.h>
+
+// Interns strings that only temporary dstrings and ireps refer to,
+// as the SSA names of a round of symex would be, and checks that
+// string_containert::collect() takes them out of the table again,
+// while the strings that are still referred to stay. Needs util
+// built with REFERENCE_COUNTED_DSTRING, which the rule in the
+// Makefile does.
+
+#ifndef REFERENCE_COUNTED_DSTRING
+#error "build with REFERENCE_COUNTED_DSTRING"
+#endif
+
+unsigned failures=0;
+
+void check(bool condition, const std::string &what)
+{
+  if(!condition)
+  {
+    std::cout << "FAILED: " << what << "\n";
+    failures++;
+  }
+}
+
+const unsigned no_strings=10000;
+
+// the names of one round, most of which are dropped at its end
+irept round(unsigned r)
+{
+  std::vector<irep_idt> names;
+
+  for(unsigned i=0; i<no_strings; i++)
+    names.push_back("main::1::x!0@"+i2string(r)+"#"+i2string(i));
+
+  irept kept("kept");
+
+  for(unsigned i=0; i<no_strings; i+=1000)
+  {
+    irept symbol(ID_symbol);
+    symbol.set(ID_identifier, names[i]);
+    kept.get_sub().push_back(symbol);
+  }
+
+  return kept;
+}
+
+int main()
+{
+  string_containert::statisticst before=string_container.get_statistics();
+
+  std::vector<irept> kept;
+
+  for(unsigned r=0; r<5; r++)
+  {
+    kept.push_back(round(r));
+
+    string_containert::statisticst grown=
+      string_container.get_statistics();
+
+    check(grown.strings>=before.strings+no_strings,
+          "round "+i2string(r)+" adds its strings");
+
+    string_container.collect();
+
+    string_containert::statisticst collected=
+      string_container.get_statistics();
+
+    // only the names that kept refers to remain
+    check(collected.strings==before.strings+(r+1)*no_strings/1000,
+          "round "+i2string(r)+" shrinks the table to "+
+          i2string(collected.strings));
+    check(collected.bytes<grown.bytes,
+          "round "+i2string(r)+" frees the bytes");
+  }
+
+  for(unsigned r=0; r<kept.size(); r++)
+    for(unsigned i=0; i<kept[r].get_sub().size(); i++)
+      check(kept[r].get_sub()[i].get(ID_identifier)==
+              "main::1::x!0@"+i2string(r)+"#"+i2string(i*1000),
+            "kept name "+i2string(i)+" of round "+i2string(r));
+
+  // the numbers of collected strings are taken again, and
+  // their strings have to be found by the new contents
+  irep_idt reused="reused";
+  check(reused.get_no()<before.strings+no_strings,
+        "numbers are reused");
+  check(irep_idt("reused")==reused, "reused string found again");
+
+  // the predefined strings are never collected
+  check(ID_symbol=="symbol" && irep_idt("symbol")==ID_symbol,
+        "predefined strings stay");
+
+  kept.clear();
+  reused.clear();
+  string_container.collect();
+
+  check(string_container.get_statistics().strings==before.strings,
+        "everything is collected in the end");
+
+  if(failures!=0)
+    return 1;
+
+  std::cout << "OK\n";
+  return 0;
+}
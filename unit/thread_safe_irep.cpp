@@ -0,0 +1,118 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <util/i2string.h>
+#include <util/irep.h>
+
+// Copies and modifies ireps shared between threads, and interns the
+// same strings from all of them, and checks that the nodes counted
+// by the threads add up once they are done. Needs util built with
+// THREAD_SAFE_IREP, which the rule in the Makefile does.
+
+#ifndef THREAD_SAFE_IREP
+#error "build with THREAD_SAFE_IREP"
+#endif
+
+const unsigned no_threads=8;
+const unsigned rounds=20000;
+const unsigned no_strings=1000;
+
+void worker(
+  const irept &shared,
+  unsigned t,
+  std::vector<unsigned> &numbers,
+  unsigned &failures)
+{
+  numbers.resize(no_strings);
+
+  for(unsigned r=0; r<rounds; r++)
+  {
+    irept copy=shared;
+
+    // copy-on-write must leave the shared one alone
+    std::string value="t"+i2string(t)+"r"+i2string(r%100);
+    copy.set(ID_value, value);
+    copy.get_sub()[r%4].id("modified");
+
+    if(copy.get(ID_value)!=value ||
+       copy.get_sub()[r%4].id()!="modified")
+      failures++;
+
+    if(shared.get(ID_value)!="x" ||
+       shared.get_sub()[r%4].id()!="op"+i2string(r%4))
+      failures++;
+
+    // the same string has the same number in all threads
+    irep_idt id="s"+i2string(r%no_strings);
+    if(id2string(id)!="s"+i2string(r%no_strings))
+      failures++;
+    numbers[r%no_strings]=id.get_no();
+  }
+}
+
+int main()
+{
+  irept shared("shared");
+  for(unsigned i=0; i<4; i++)
+    shared.get_sub().push_back(irept("op"+i2string(i)));
+  shared.set(ID_value, "x");
+
+  std::vector<std::vector<unsigned> > numbers(no_threads);
+  std::vector<unsigned> failures(no_threads, 0);
+  std::vector<std::thread> threads;
+
+  std::size_t allocations=irept::number_of_allocations();
+  std::size_t nodes=allocations-irept::number_of_deallocations();
+
+  for(unsigned t=0; t<no_threads; t++)
+    threads.push_back(std::thread(
+      worker,
+      std::cref(shared),
+      t,
+      std::ref(numbers[t]),
+      std::ref(failures[t])));
+
+  for(auto &thread : threads)
+    thread.join();
+
+  unsigned total=0;
+
+  for(unsigned t=0; t<no_threads; t++)
+  {
+    total+=failures[t];
+    if(numbers[t]!=numbers[0])
+    {
+      std::cout << "thread " << t << " got different string numbers\n";
+      total++;
+    }
+  }
+
+  // each round detaches the copy and one of its operands
+  allocations=irept::number_of_allocations()-allocations;
+  if(allocations<2*no_threads*rounds)
+  {
+    std::cout << "only " << allocations << " allocations counted\n";
+    total++;
+  }
+
+  if(irept::number_of_allocations()-irept::number_of_deallocations()!=
+     nodes)
+  {
+    std::cout << "the threads left nodes behind\n";
+    total++;
+  }
+
+  const irept &s=shared;
+  if(s.get(ID_value)!="x" || s.get_sub().size()!=4)
+    total++;
+
+  if(total!=0)
+  {
+    std::cout << "FAILED: " << total << " failures\n";
+    return 1;
+  }
+
+  std::cout << "OK\n";
+  return 0;
+}